@@ -711,48 +711,22 @@ namespace sdv
             {
                 try
                 {
-                    // Parse the config TOML.
-                    toml::CTOMLParser parser(ssObjectConfig);
+                    // Parse the config TOML. Comments and whitespace are not needed for reading the parameters.
+                    toml::CTOMLParser parser(ssObjectConfig, true);
                     if (!parser.IsValid())
                     {
                         m_eObjectState = EObjectState::config_error;
                         return;
                     }
 
-                    // Read group function (iterative)
-                    u8string ssGroup;
-                    std::function<void(const toml::CNodeCollection&)> fnReadGroup;
-                    fnReadGroup = [&](const toml::CNodeCollection& rTable)
+                    // Get all values of the configuration with one call; parsers without INodeCollectionFlatten are walked
+                    // through node by node. Tables are represented by a group prefix, separated by a dot. Arrays cannot be
+                    // processed.
+                    for (const toml::SKeyValue& rsKeyValue : parser.GetFlattened())
                     {
-                        // Iterate through the config.
-                        for (size_t n = 0; n < rTable.GetCount(); n++)
-                        {
-                            const toml::CNode node = rTable.Get(n);
-                            switch (node.GetType())
-                            {
-                            case toml::ENodeType::node_integer:
-                            case toml::ENodeType::node_floating_point:
-                            case toml::ENodeType::node_boolean:
-                            case toml::ENodeType::node_string:
-                                // Ignore the result. If it is not possible to set the parameter, this is not a failure.
-                                SetParam(ssGroup + node.GetName(), node.GetValue());
-                                break;
-                            case toml::ENodeType::node_table:
-                                {
-                                    const toml::CNodeCollection sub_table= node;
-                                    if (!sub_table.IsValid()) break;
-                                    ssGroup += sub_table.GetName() + ".";
-                                    fnReadGroup(sub_table);
-                                }
-                            default:
-                                // Other node types cannot be processed.
-                                break;
-                            }
-                        }
-                    };
-
-                    // Parse the root node
-                    fnReadGroup(parser);
+                        // Ignore the result. If it is not possible to set the parameter, this is not a failure.
+                        SetParam(rsKeyValue.ssKey, rsKeyValue.anyValue);
+                    }
                 } catch (const toml::XTOMLParseException& rexcept)
                 {
                     SDV_LOG(core::ELogSeverity::error, "Cannot process object configuration TOML: ", rexcept.what());
@@ -1142,6 +1116,8 @@ namespace sdv
 
 [Interface]
 Version = )toml" << SDVFrameworkInterfaceVersion
+                << std::endl
+                << "Layout = " << SDVFrameworkLayoutVersion
                 << std::endl
                 << std::endl;
 
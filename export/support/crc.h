@@ -16,8 +16,19 @@
 
 #include <array>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 #include <stddef.h>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <nmmintrin.h>
+#endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
 namespace sdv
 {
     /**
@@ -43,6 +54,81 @@ namespace sdv
         return tReflection;
     }
 
+    namespace internal
+    {
+        /**
+         * @brief Check whether the processor provides the CRC32-C instructions.
+         * @return Returns 'true' when the instructions are available; 'false' when not.
+         */
+        inline bool crc32c_hw_available() noexcept
+        {
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(_MSC_VER)
+            static const bool bAvailable = []
+            {
+                int rgiRegs[4] = {};
+                __cpuid(rgiRegs, 1);
+                return (rgiRegs[2] & (1 << 20)) != 0;   // SSE4.2
+            }();
+            return bAvailable;
+#elif defined(__x86_64__)
+            static const bool bAvailable = __builtin_cpu_supports("sse4.2");
+            return bAvailable;
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Continue a CRC32-C calculation using the processor instructions.
+         * @pre crc32c_hw_available returned 'true'.
+         * @param[in] uiReg The reflected CRC register value to continue with.
+         * @param[in] pData Pointer to the data.
+         * @param[in] nSize Size of the data in bytes.
+         * @return The updated reflected CRC register value.
+         */
+#if defined(__x86_64__) && !defined(_MSC_VER)
+        __attribute__((target("sse4.2")))
+#endif
+        inline uint32_t crc32c_hw(uint32_t uiReg, const uint8_t* pData, size_t nSize) noexcept
+        {
+#if defined(__x86_64__) || defined(_M_X64)
+            uint64_t uiReg64 = uiReg;
+            for (; nSize >= 8; nSize -= 8, pData += 8)
+            {
+                uint64_t uiValue = 0;
+                std::memcpy(&uiValue, pData, 8);
+#ifdef _MSC_VER
+                uiReg64 = _mm_crc32_u64(uiReg64, uiValue);
+#else
+                uiReg64 = __builtin_ia32_crc32di(uiReg64, uiValue);
+#endif
+            }
+            uiReg = static_cast<uint32_t>(uiReg64);
+            for (; nSize; nSize--, pData++)
+#ifdef _MSC_VER
+                uiReg = _mm_crc32_u8(uiReg, *pData);
+#else
+                uiReg = __builtin_ia32_crc32qi(uiReg, *pData);
+#endif
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+            for (; nSize >= 8; nSize -= 8, pData += 8)
+            {
+                uint64_t uiValue = 0;
+                std::memcpy(&uiValue, pData, 8);
+                uiReg = __crc32cd(uiReg, uiValue);
+            }
+            for (; nSize; nSize--, pData++)
+                uiReg = __crc32cb(uiReg, *pData);
+#else
+            (void)pData;
+            (void)nSize;
+#endif
+            return uiReg;
+        }
+    } // namespace internal
+
     /**
      * @brief Templated CRC calculation class
      * @tparam TCRC The CRC type to use for the calculation.
@@ -85,6 +171,16 @@ namespace sdv
          */
         TCRCType get_checksum() const noexcept;
 
+        /**
+         * @brief Continue the calculation with a data block of which the checksum was calculated separately.
+         * @details This allows calculating the checksums of consecutive data blocks independently (e.g. in parallel) and combining
+         * them afterwards. The result is identical to calculating the checksum over the data blocks consecutively.
+         * @remarks Only available for CRC functions reflecting the input and the output.
+         * @param[in] tBlockChecksum The checksum calculated over the data block (starting with a reset calculation).
+         * @param[in] nBlockSize The size of the data block in bytes.
+         */
+        void combine(TCRCType tBlockChecksum, uint64_t nBlockSize) noexcept;
+
         /**
          * @brief Set a CRC checksum to continue the calculation with additional data.
          * @param[in] tCrcValue The previously calculated CRC value.
@@ -107,6 +203,75 @@ namespace sdv
          */
         static constexpr uint64_t m_nMsb = 1ull << (m_nWidth - 1);
 
+        /**
+         * @brief When set, the input and the output is reflected. The calculation uses a reflected register and lookup table,
+         * which prevents reflecting every byte.
+         */
+        static constexpr bool m_bReflected = bReflectIn && bReflectOut;
+
+        /**
+         * @brief Initial register value.
+         */
+        static constexpr TCRCType m_tInitReg = m_bReflected ? reflect(tInitVal) : tInitVal;
+
+        /**
+         * @brief Reflected polynomial.
+         */
+        static constexpr TCRCType m_tPolynomialReflected = reflect(tPolynomial);
+
+        /**
+         * @brief Multiply two polynomials modulo the reflected CRC polynomial.
+         * @param[in] tA First polynomial (reflected).
+         * @param[in] tB Second polynomial (reflected).
+         * @return The product modulo the polynomial (reflected).
+         */
+        static constexpr TCRCType multiply_mod(TCRCType tA, TCRCType tB) noexcept
+        {
+            TCRCType tProduct = 0;
+            for (TCRCType tMask = static_cast<TCRCType>(m_nMsb); tMask; tMask = static_cast<TCRCType>(tMask >> 1))
+            {
+                if (tA & tMask) tProduct ^= tB;
+                tB = (tB & 1) ? static_cast<TCRCType>((tB >> 1) ^ m_tPolynomialReflected) : static_cast<TCRCType>(tB >> 1);
+            }
+            return tProduct;
+        }
+
+        /**
+         * @brief Table with the polynomials x^(2^n) modulo the reflected CRC polynomial, used to combine checksums.
+         */
+        static constexpr auto m_arrPowerTable = []
+        {
+            std::array<TCRCType, 64> arrTemp{};
+            TCRCType tPower = static_cast<TCRCType>(m_nMsb >> 1);     // x^1
+            for (size_t n = 0; n < 64; n++)
+            {
+                arrTemp[n] = tPower;
+                tPower = multiply_mod(tPower, tPower);
+            }
+            return arrTemp;
+        }();
+
+        /**
+         * @brief Reflected CRC lookup table.
+         */
+        static constexpr auto m_arrTableReflected = []
+        {
+            std::array<TCRCType, 256> arrTemp{};
+            for (size_t tDividend = 0; tDividend < 256; ++tDividend)
+            {
+                TCRCType tRemainder = static_cast<TCRCType>(tDividend);
+                for (uint8_t bit = 8; bit > 0; --bit)
+                {
+                    if (tRemainder & 1)
+                        tRemainder = static_cast<TCRCType>((tRemainder >> 1) ^ m_tPolynomialReflected);
+                    else
+                        tRemainder = static_cast<TCRCType>(tRemainder >> 1);
+                }
+                arrTemp[tDividend] = tRemainder;
+            }
+            return arrTemp;
+        }();
+
         /**
          * @brief CRC lookup table.
          */
@@ -128,7 +293,7 @@ namespace sdv
             return arrTemp;
         }();
 
-        TCRCType m_tCrcValue = tInitVal;  ///< Calculated CRC value.
+        TCRCType m_tCrcValue = m_tInitReg;  ///< Calculated CRC value (reflected register for reflected CRC functions).
     };
 
     /// SAE-J1850: polynomial 0x1D, initial = 0xFF, final_xor = 0xFF, reflect_input = false, reflect_output = false
@@ -163,8 +328,28 @@ namespace sdv
         crc<TCRC, tPolynomial, tInitVal, tXorOut, bReflectIn, bReflectOut>::calc_checksum(const T* pData, size_t nCount) noexcept
     {
         if (!pData || !nCount) return get_checksum();
-        for (size_t nIndex = 0; nIndex < nCount; nIndex++)
-            add(pData[nIndex]);
+        if constexpr (m_bReflected)
+        {
+            const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(pData);
+            size_t nSize = nCount * sizeof(T);
+            if constexpr (std::is_same_v<TCRCType, uint32_t> && tPolynomial == 0x1EDC6F41u)
+            {
+                // CRC32-C is supported by the processor on most platforms
+                if (internal::crc32c_hw_available())
+                {
+                    m_tCrcValue = internal::crc32c_hw(m_tCrcValue, pBytes, nSize);
+                    return get_checksum();
+                }
+            }
+            for (size_t nIndex = 0; nIndex < nSize; nIndex++)
+                m_tCrcValue = static_cast<TCRCType>(m_arrTableReflected[(m_tCrcValue ^ pBytes[nIndex]) & 0xff] ^
+                    (static_cast<uint64_t>(m_tCrcValue) >> 8));
+        }
+        else
+        {
+            for (size_t nIndex = 0; nIndex < nCount; nIndex++)
+                add(pData[nIndex]);
+        }
         return get_checksum();
     }
 
@@ -172,7 +357,13 @@ namespace sdv
     template <typename T>
     inline void crc<TCRC, tPolynomial, tInitVal, tXorOut, bReflectIn, bReflectOut>::add(T tValue) noexcept
     {
-        if constexpr (bReflectIn)
+        if constexpr (m_bReflected)
+        {
+            for (size_t nIndex = 0; nIndex < sizeof(T); ++nIndex)
+                m_tCrcValue = static_cast<TCRCType>(m_arrTableReflected[(m_tCrcValue ^
+                    reinterpret_cast<uint8_t*>(&tValue)[nIndex]) & 0xff] ^ (static_cast<uint64_t>(m_tCrcValue) >> 8));
+        }
+        else if constexpr (bReflectIn)
         {
             for (size_t nIndex = 0; nIndex < sizeof(T); ++nIndex)
             {
@@ -194,7 +385,9 @@ namespace sdv
     inline typename crc<TCRC, tPolynomial, tInitVal, tXorOut, bReflectIn, bReflectOut>::TCRCType
         crc<TCRC, tPolynomial, tInitVal, tXorOut, bReflectIn, bReflectOut>::get_checksum() const noexcept
     {
-        if constexpr (bReflectOut)
+        if constexpr (m_bReflected)
+            return static_cast<TCRCType>(m_tCrcValue ^ tXorOut);
+        else if constexpr (bReflectOut)
             return static_cast<TCRCType>(reflect(m_tCrcValue) ^ tXorOut);
         else
             return static_cast<TCRCType>(m_tCrcValue ^ tXorOut);
@@ -203,16 +396,36 @@ namespace sdv
     template <typename TCRC, TCRC tPolynomial, TCRC tInitVal, TCRC tXorOut, bool bReflectIn, bool bReflectOut>
     inline void crc<TCRC, tPolynomial, tInitVal, tXorOut, bReflectIn, bReflectOut>::set_checksum(TCRCType tCrcValue) noexcept
     {
-        if constexpr (bReflectOut)
+        if constexpr (m_bReflected)
+            m_tCrcValue = static_cast<TCRCType>(tCrcValue ^ tXorOut);
+        else if constexpr (bReflectOut)
             m_tCrcValue = static_cast<TCRCType>(reflect(static_cast<TCRCType>(tCrcValue ^ tXorOut)));
         else
             m_tCrcValue = static_cast<TCRCType>(tCrcValue ^ tXorOut);
     }
 
+    template <typename TCRC, TCRC tPolynomial, TCRC tInitVal, TCRC tXorOut, bool bReflectIn, bool bReflectOut>
+    inline void crc<TCRC, tPolynomial, tInitVal, tXorOut, bReflectIn, bReflectOut>::combine(TCRCType tBlockChecksum,
+        uint64_t nBlockSize) noexcept
+    {
+        static_assert(m_bReflected, "Combining checksums is only supported for reflected CRC functions.");
+
+        // The register after the block equals the register before the block shifted by the block size (multiplied by
+        // x^(8*size)), combined with the register of the block calculated from a zero register. The block checksum was
+        // calculated from the initial register, which is removed by shifting the initial register along.
+        TCRCType tShifted = static_cast<TCRCType>(m_tCrcValue ^ m_tInitReg);
+        for (size_t nPower = 3; nBlockSize; nBlockSize >>= 1, nPower++)
+        {
+            if (nBlockSize & 1)
+                tShifted = multiply_mod(m_arrPowerTable[nPower & 63], tShifted);
+        }
+        m_tCrcValue = static_cast<TCRCType>(tShifted ^ tBlockChecksum ^ tXorOut);
+    }
+
     template <typename TCRC, TCRC tPolynomial, TCRC tInitVal, TCRC tXorOut, bool bReflectIn, bool bReflectOut>
     inline void crc<TCRC, tPolynomial, tInitVal, tXorOut, bReflectIn, bReflectOut>::reset() noexcept
     {
-        m_tCrcValue = tInitVal;
+        m_tCrcValue = m_tInitReg;
     }
 
 } // namespace sdv
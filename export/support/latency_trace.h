@@ -0,0 +1,187 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef SDV_LATENCY_TRACE_H
+#define SDV_LATENCY_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "../interfaces/log.h"
+#include "local_service_access.h"
+
+#ifndef ENABLE_LATENCY_TRACE
+/**
+ * @brief Enable the latency trace points by setting to a non-zero value. When disabled, the trace macros don't generate any
+ * code. The CMake option SDV_ENABLE_LATENCY_TRACE enables the trace points for the framework.
+ */
+#define ENABLE_LATENCY_TRACE 0
+#endif
+
+/**
+ * @brief Software Defined Vehicle framework.
+ */
+namespace sdv
+{
+    /**
+     * @brief Core features.
+     */
+    namespace core
+    {
+        /**
+         * @brief Get the latency trace key of a name. The key is a FNV-1a hash of the name and therefore the same in all
+         * processes.
+         * @param[in] rssName Reference to the name.
+         * @return The key; never 0.
+         */
+        inline uint32_t GetLatencyTraceKey(const std::string& rssName)
+        {
+            uint32_t uiHash = 2166136261u;
+            for (char c : rssName)
+            {
+                uiHash ^= static_cast<uint8_t>(c);
+                uiHash *= 16777619u;
+            }
+            return uiHash ? uiHash : 1u;
+        }
+
+        /**
+         * @brief Get access to the latency trace service of the core.
+         * @return Pointer to the latency trace interface or NULL when the core isn't available.
+         */
+        inline ILatencyTrace* GetLatencyTrace()
+        {
+            // Same mechanism as GetMemMgr: the interface is requested again when the core changes or is not available any more
+            // (the core library could have been unloaded).
+            static std::atomic<ILatencyTrace*> pTrace{nullptr};
+            static std::atomic<const IInterfaceAccess*> pLocalServices{nullptr};
+
+            // cppcheck-suppress knownConditionTrueFalse
+            const IInterfaceAccess* pCore = GetCore();
+            ILatencyTrace* pCurrent = nullptr;
+            if (pCore)
+            {
+                pCurrent = pTrace.load(std::memory_order_acquire);
+                if (pCore != pLocalServices.load(std::memory_order_acquire) || !pCurrent)
+                    pCurrent = GetCore<ILatencyTrace>();
+            }
+            pTrace.store(pCurrent, std::memory_order_release);
+            pLocalServices.store(pCore, std::memory_order_release);
+            return pCurrent;
+        }
+
+        /**
+         * @brief Register the name belonging to a trace key, allowing the monitor to show the name.
+         * @param[in] rssName Reference to the name of the signal.
+         * @return The key to use for the trace points.
+         */
+        inline uint32_t RegisterLatencyTraceName(const std::string& rssName)
+        {
+            ILatencyTrace* pTrace = GetLatencyTrace();
+            return pTrace ? pTrace->RegisterTraceName(rssName) : GetLatencyTraceKey(rssName);
+        }
+
+        /**
+         * @brief Start a new trace at the first stage of the signal path. The trace ID is assigned to the calling thread.
+         * @param[in] eStage The stage.
+         * @param[in] uiKey The key (e.g. CAN message ID).
+         */
+        inline void StartLatencyTrace(ETraceStage eStage, uint32_t uiKey)
+        {
+            ILatencyTrace* pTrace = GetLatencyTrace();
+            if (pTrace) pTrace->StartTrace(eStage, uiKey);
+        }
+
+        /**
+         * @brief Record a trace point for the trace ID assigned to the calling thread.
+         * @param[in] eStage The stage.
+         * @param[in] uiKey The key (e.g. CAN message ID or signal key).
+         */
+        inline void LatencyTracePoint(ETraceStage eStage, uint32_t uiKey)
+        {
+            ILatencyTrace* pTrace = GetLatencyTrace();
+            if (pTrace) pTrace->TracePoint(eStage, uiKey);
+        }
+
+        /**
+         * @brief Get the trace ID assigned to the calling thread; used to hand the trace over to another thread.
+         * @return The trace ID or 0 when no trace is active.
+         */
+        inline uint64_t GetLatencyTraceID()
+        {
+            ILatencyTrace* pTrace = GetLatencyTrace();
+            return pTrace ? pTrace->GetTraceID() : 0;
+        }
+
+        /**
+         * @brief Assign a trace ID to the calling thread; used to continue a trace handed over by another thread.
+         * @param[in] uiTraceID The trace ID or 0 to end the trace.
+         */
+        inline void SetLatencyTraceID(uint64_t uiTraceID)
+        {
+            ILatencyTrace* pTrace = GetLatencyTrace();
+            if (pTrace) pTrace->SetTraceID(uiTraceID);
+        }
+    } // namespace core
+} // namespace sdv
+
+#if ENABLE_LATENCY_TRACE != 0
+
+/**
+ * @brief Start a new latency trace (e.g. at the reception of a CAN frame).
+ * @param stage The stage (sdv::core::ETraceStage).
+ * @param key The key of the trace point (e.g. CAN message ID).
+ */
+#define SDV_LATENCY_TRACE_START(stage, key) sdv::core::StartLatencyTrace(stage, key)
+
+/**
+ * @brief Record a trace point of the current latency trace.
+ * @param stage The stage (sdv::core::ETraceStage).
+ * @param key The key of the trace point (e.g. CAN message ID or a key returned by sdv::core::RegisterLatencyTraceName).
+ */
+#define SDV_LATENCY_TRACE(stage, key) sdv::core::LatencyTracePoint(stage, key)
+
+/**
+ * @brief Record a trace point of the current latency trace using a signal name. The name is registered at the first call.
+ * @param stage The stage (sdv::core::ETraceStage).
+ * @param name The name of the signal.
+ */
+#define SDV_LATENCY_TRACE_NAME(stage, name) \
+    do { \
+        static const uint32_t uiLatencyTraceKey = sdv::core::RegisterLatencyTraceName(name); \
+        sdv::core::LatencyTracePoint(stage, uiLatencyTraceKey); \
+    } while (false)
+
+/**
+ * @brief Get the trace ID of the current latency trace to hand it over to another thread.
+ */
+#define SDV_LATENCY_TRACE_GET_ID() sdv::core::GetLatencyTraceID()
+
+/**
+ * @brief Continue a latency trace handed over by another thread.
+ * @param id The trace ID or 0 to end the trace.
+ */
+#define SDV_LATENCY_TRACE_SET_ID(id) sdv::core::SetLatencyTraceID(id)
+
+#else // ENABLE_LATENCY_TRACE == 0
+
+#define SDV_LATENCY_TRACE_START(stage, key) ((void)0)
+#define SDV_LATENCY_TRACE(stage, key) ((void)0)
+#define SDV_LATENCY_TRACE_NAME(stage, name) ((void)0)
+#define SDV_LATENCY_TRACE_GET_ID() (static_cast<uint64_t>(0))
+#define SDV_LATENCY_TRACE_SET_ID(id) ((void)0)
+
+#endif
+
+#endif // !defined SDV_LATENCY_TRACE_H
@@ -0,0 +1,215 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef SDV_METRICS_H
+#define SDV_METRICS_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../interfaces/metrics.h"
+#include "local_service_access.h"
+
+/**
+ * @brief Software Defined Vehicle framework.
+ */
+namespace sdv
+{
+    /**
+     * @brief Core features.
+     */
+    namespace core
+    {
+        /**
+         * @brief Get access to the metrics registry of the core.
+         * @return Pointer to the metrics interface or NULL when the core isn't available.
+         */
+        inline IMetrics* GetMetrics()
+        {
+            // Same mechanism as GetMemMgr: the interface is requested again when the core changes or is not available any more
+            // (the core library could have been unloaded).
+            static std::atomic<IMetrics*> pMetrics{nullptr};
+            static std::atomic<const IInterfaceAccess*> pLocalServices{nullptr};
+
+            // cppcheck-suppress knownConditionTrueFalse
+            const IInterfaceAccess* pCore = GetCore();
+            IMetrics* pCurrent = nullptr;
+            if (pCore)
+            {
+                pCurrent = pMetrics.load(std::memory_order_acquire);
+                if (pCore != pLocalServices.load(std::memory_order_acquire) || !pCurrent)
+                    pCurrent = GetCore<IMetrics>();
+            }
+            pMetrics.store(pCurrent, std::memory_order_release);
+            pLocalServices.store(pCore, std::memory_order_release);
+            return pCurrent;
+        }
+
+        /**
+         * @brief Metric helper base class. The metric is registered at the first update; updates are ignored when the core
+         * isn't available.
+         */
+        class CMetric
+        {
+        public:
+            /**
+             * @brief Constructor
+             * @param[in] rssName Reference to the name of the metric, optionally followed by labels.
+             * @param[in] rssHelp Reference to the description of the metric.
+             * @param[in] eType The type of the metric.
+             * @param[in] rvecBounds Reference to the bucket bounds of a histogram.
+             */
+            CMetric(const std::string& rssName, const std::string& rssHelp, EMetricType eType,
+                const std::vector<uint64_t>& rvecBounds = {}) :
+                m_ssName(rssName), m_ssHelp(rssHelp), m_eType(eType), m_vecBounds(rvecBounds)
+            {}
+
+        protected:
+            /**
+             * @brief Get the metrics interface and the ID of the metric; registers the metric when needed.
+             * @return The metrics interface or NULL when the metric is not available.
+             */
+            IMetrics* Get()
+            {
+                IMetrics* pMetrics = GetMetrics();
+                if (!pMetrics) return nullptr;
+
+                // Register again when the registry changed; the ID is only valid in the registry it was assigned by.
+                if (m_pRegistry.load(std::memory_order_acquire) != pMetrics)
+                {
+                    m_uiID.store(0, std::memory_order_relaxed);
+                    m_pRegistry.store(pMetrics, std::memory_order_release);
+                }
+                if (!m_uiID.load(std::memory_order_relaxed))
+                {
+                    sequence<uint64_t> seqBounds;
+                    for (uint64_t uiBound : m_vecBounds) seqBounds.push_back(uiBound);
+                    m_uiID.store(pMetrics->RegisterMetric(m_ssName, m_ssHelp, m_eType, seqBounds), std::memory_order_relaxed);
+                }
+                return m_uiID.load(std::memory_order_relaxed) ? pMetrics : nullptr;
+            }
+
+            std::atomic_uint32_t    m_uiID{0};      ///< The ID of the metric; 0 when not registered.
+
+        private:
+            std::atomic<IMetrics*>  m_pRegistry{nullptr};   ///< The registry the metric was registered with.
+            std::string             m_ssName;       ///< Name of the metric.
+            std::string             m_ssHelp;       ///< Description of the metric.
+            EMetricType             m_eType;        ///< Type of the metric.
+            std::vector<uint64_t>   m_vecBounds;    ///< Bucket bounds of a histogram.
+        };
+
+        /**
+         * @brief Counter metric.
+         */
+        class CMetricCounter : public CMetric
+        {
+        public:
+            /**
+             * @brief Constructor
+             * @param[in] rssName Reference to the name of the counter, optionally followed by labels.
+             * @param[in] rssHelp Reference to the description of the counter.
+             */
+            CMetricCounter(const std::string& rssName, const std::string& rssHelp) :
+                CMetric(rssName, rssHelp, EMetricType::counter)
+            {}
+
+            /**
+             * @brief Increase the counter.
+             * @param[in] uiValue The value to add.
+             */
+            void Increment(uint64_t uiValue = 1)
+            {
+                IMetrics* pMetrics = Get();
+                if (pMetrics) pMetrics->AddCounter(m_uiID.load(std::memory_order_relaxed), uiValue);
+            }
+        };
+
+        /**
+         * @brief Gauge metric.
+         */
+        class CMetricGauge : public CMetric
+        {
+        public:
+            /**
+             * @brief Constructor
+             * @param[in] rssName Reference to the name of the gauge, optionally followed by labels.
+             * @param[in] rssHelp Reference to the description of the gauge.
+             */
+            CMetricGauge(const std::string& rssName, const std::string& rssHelp) :
+                CMetric(rssName, rssHelp, EMetricType::gauge)
+            {}
+
+            /**
+             * @brief Set the gauge.
+             * @param[in] iValue The new value.
+             */
+            void Set(int64_t iValue)
+            {
+                IMetrics* pMetrics = Get();
+                if (pMetrics) pMetrics->SetGauge(m_uiID.load(std::memory_order_relaxed), iValue);
+            }
+
+            /**
+             * @brief Increase or decrease the gauge.
+             * @param[in] iValue The value to add; negative to decrease.
+             */
+            void Add(int64_t iValue)
+            {
+                IMetrics* pMetrics = Get();
+                if (pMetrics) pMetrics->AddGauge(m_uiID.load(std::memory_order_relaxed), iValue);
+            }
+        };
+
+        /**
+         * @brief Histogram metric.
+         */
+        class CMetricHistogram : public CMetric
+        {
+        public:
+            /**
+             * @brief Constructor
+             * @param[in] rssName Reference to the name of the histogram, optionally followed by labels.
+             * @param[in] rssHelp Reference to the description of the histogram.
+             * @param[in] rvecBounds Reference to the inclusive upper bounds of the buckets in ascending order.
+             */
+            CMetricHistogram(const std::string& rssName, const std::string& rssHelp, const std::vector<uint64_t>& rvecBounds) :
+                CMetric(rssName, rssHelp, EMetricType::histogram, rvecBounds)
+            {}
+
+            /**
+             * @brief Add an observation.
+             * @param[in] uiValue The observed value.
+             */
+            void Observe(uint64_t uiValue)
+            {
+                IMetrics* pMetrics = Get();
+                if (pMetrics) pMetrics->Observe(m_uiID.load(std::memory_order_relaxed), uiValue);
+            }
+        };
+
+        /**
+         * @brief Default bucket bounds for durations and latencies in us (10us ... 1s).
+         */
+        inline const std::vector<uint64_t>& GetMetricDurationBounds()
+        {
+            static const std::vector<uint64_t> vecBounds = {10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000,
+                100000, 250000, 500000, 1000000};
+            return vecBounds;
+        }
+    } // namespace core
+} // namespace sdv
+
+#endif // !defined SDV_METRICS_H
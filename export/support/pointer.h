@@ -17,6 +17,7 @@
 #include <ostream>
 #include <atomic>
 #include <algorithm>
+#include <new>
 #include "iterator.h"
 #ifndef DONT_LOAD_CORE_TYPES
 #include "../interfaces/core_types.h"
@@ -671,6 +672,173 @@ namespace sdv
     template <typename T>
     const T* cast(const pointer<uint8_t>& rptr, size_t nOffset = 0);
 
+    namespace internal
+    {
+        /**
+         * @brief Storage of a dynamic sized buffer with a small inline buffer. A small amount of elements is stored inside the
+         * object without any allocation; when exceeding the inline capacity, the elements are moved to a pointer allocation that
+         * is stored in the same memory. The storage provides the pointer functions used by the string and sequence classes.
+         * @remarks The size of the storage is part of the memory layout of the framework (see SDVFrameworkLayoutVersion).
+         * @tparam T Type of the elements; must be a complete type.
+         * @tparam nStorageSize Size of the storage object (in bytes).
+         */
+        template <typename T, size_t nStorageSize>
+        class inline_storage
+        {
+        public:
+            /**
+             * @brief Amount of elements that can be stored inline.
+             */
+            static const size_t inline_capacity = (nStorageSize - 1) / sizeof(T);
+
+            /**
+             * @brief Default constructor.
+             */
+            inline_storage() noexcept;
+
+            /**
+             * @brief Copying is not supported; the owning class copies the content.
+             */
+            inline_storage(const inline_storage&) = delete;
+
+            /**
+             * @brief Move constructor.
+             * @param[in] rstorage Reference to the storage to move.
+             */
+            inline_storage(inline_storage&& rstorage) noexcept;
+
+            /**
+             * @brief Destructor
+             */
+            ~inline_storage();
+
+            /**
+             * @brief Copying is not supported; the owning class copies the content.
+             * @return Reference to this storage.
+             */
+            inline_storage& operator=(const inline_storage&) = delete;
+
+            /**
+             * @brief Move operator.
+             * @param[in] rstorage Reference to the storage to move.
+             * @return Reference to this storage.
+             */
+            inline_storage& operator=(inline_storage&& rstorage) noexcept;
+
+            /**
+             * @brief Assign the content of a pointer. A dynamic sized pointer is taken over, the content of a fixed sized pointer is
+             * moved.
+             * @tparam nFixedSize The fixed size of the pointer.
+             * @param[in] rptr Reference to the pointer to assign.
+             * @return Reference to this storage.
+             */
+            template <size_t nFixedSize>
+            inline_storage& operator=(pointer<T, nFixedSize>&& rptr);
+
+            /**
+             * @brief Get access to the underlying buffer.
+             * @return Pointer to the buffer or NULL when nothing is stored.
+             */
+            T* get() const noexcept;
+
+            /**
+             * @brief Get the indexed value.
+             * @param[in] nIndex Index to request the value of.
+             * @return Reference to the indexed value.
+             */
+            T& operator[](size_t nIndex) const;
+
+            /**
+             * @brief Return whether elements are stored.
+             */
+            operator bool() const noexcept;
+
+            /**
+             * @brief Return the amount of elements stored.
+             * @return The size of the storage.
+             */
+            size_t size() const noexcept;
+
+            /**
+             * @brief Return the amount of elements allocated; equal to the size (like the dynamic pointer).
+             * @return The capacity of the storage.
+             */
+            size_t capacity() const noexcept;
+
+            /**
+             * @brief Resize the storage. New scalar elements are set to zero, other elements are default constructed. Exceeding the
+             * inline capacity moves the content to a pointer allocation.
+             * @param[in] nSize The new amount of elements.
+             */
+            void resize(size_t nSize);
+
+            /**
+             * @brief Destroy the elements and release any allocation.
+             */
+            void reset();
+
+            /**
+             * @brief Return whether the content is stored inline.
+             * @return Returns 'true' when the content is stored inline; 'false' when stored in a pointer allocation.
+             */
+            bool is_inline() const noexcept;
+
+            /**
+             * @brief Get access to the content as pointer. Inline content is moved to a pointer allocation first.
+             * @return Reference to the pointer.
+             */
+            pointer<T>& buffer();
+
+        private:
+            /**
+             * @brief Get the pointer stored in the storage. Only valid when not inline.
+             * @return Reference to the pointer.
+             */
+            pointer<T>& heap() const noexcept;
+
+            /**
+             * @brief Get the inline stored elements.
+             * @return Pointer to the inline elements.
+             */
+            T* inline_data() const noexcept;
+
+            /**
+             * @brief Move the inline elements to a pointer allocation of the provided size.
+             * @param[in] nSize The size of the allocation; must not be smaller than the amount of inline elements.
+             */
+            void move_to_heap(size_t nSize);
+
+            /// Inline size marking the storage of the content in a pointer allocation.
+            static const uint8_t heap_marker = 0xff;
+
+            static_assert(sizeof(pointer<T>) <= nStorageSize - 1);
+            static_assert(inline_capacity < heap_marker);
+
+            /// Alignment of the storage suitable for the elements as well as for the pointer.
+            static const size_t storage_alignment = std::max(alignof(T), alignof(pointer<T>));
+
+            alignas(storage_alignment) uint8_t m_rguiStorage[nStorageSize - 1]; ///< Inline elements or the pointer.
+            uint8_t     m_uiInlineSize = 0;                                     ///< Amount of inline elements or heap_marker.
+        };
+
+        /**
+         * @brief Types that are stored inline by small dynamic sized sequences: scalars and dynamic pointers.
+         * @remarks The trait does not require a complete type; sequences of other types (e.g. recursive structures) are stored
+         * in a pointer allocation only.
+         * @tparam T The type to check.
+         */
+        template <typename T>
+        struct is_inline_storable : std::is_scalar<T>
+        {};
+
+        /**
+         * @brief Dynamic pointers are stored inline by small dynamic sized sequences.
+         * @tparam T The type the pointer holds.
+         */
+        template <typename T>
+        struct is_inline_storable<pointer<T, 0>> : std::true_type
+        {};
+    } // namespace internal
 } // namespace sdv
 
 #include "pointer.inl"
@@ -876,6 +876,193 @@ namespace sdv
         return reinterpret_cast<const T*>(rptr.get() + nOffset);
     }
 
+    namespace internal
+    {
+        template <typename T, size_t nStorageSize>
+        inline inline_storage<T, nStorageSize>::inline_storage() noexcept
+        {}
+
+        template <typename T, size_t nStorageSize>
+        inline inline_storage<T, nStorageSize>::inline_storage(inline_storage&& rstorage) noexcept
+        {
+            operator=(std::move(rstorage));
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline inline_storage<T, nStorageSize>::~inline_storage()
+        {
+            reset();
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline inline_storage<T, nStorageSize>& inline_storage<T, nStorageSize>::operator=(inline_storage&& rstorage) noexcept
+        {
+            if (&rstorage == this) return *this;
+            reset();
+            if (rstorage.is_inline())
+            {
+                T* ptSource = rstorage.inline_data();
+                for (size_t nIndex = 0; nIndex < rstorage.m_uiInlineSize; nIndex++)
+                    new (m_rguiStorage + nIndex * sizeof(T)) T(std::move(ptSource[nIndex]));
+                m_uiInlineSize = rstorage.m_uiInlineSize;
+            }
+            else
+            {
+                new (m_rguiStorage) pointer<T>(std::move(rstorage.heap()));
+                m_uiInlineSize = heap_marker;
+            }
+            rstorage.reset();
+            return *this;
+        }
+
+        /// @cond DOXYGEN_IGNORE
+        template <typename T, size_t nStorageSize>
+        template <size_t nFixedSize>
+        inline inline_storage<T, nStorageSize>& inline_storage<T, nStorageSize>::operator=(pointer<T, nFixedSize>&& rptr)
+        {
+            reset();
+            if constexpr (nFixedSize == 0)
+            {
+                // Take over the allocation
+                if (!rptr) return *this;
+                new (m_rguiStorage) pointer<T>(std::move(rptr));
+                m_uiInlineSize = heap_marker;
+            }
+            else
+            {
+                // Move the content
+                size_t nSize = rptr.size();
+                resize(nSize);
+                std::move(rptr.get(), rptr.get() + nSize, get());
+                rptr.reset();
+            }
+            return *this;
+        }
+        /// @endcond
+
+        template <typename T, size_t nStorageSize>
+        inline T* inline_storage<T, nStorageSize>::get() const noexcept
+        {
+            if (!is_inline()) return heap().get();
+            return m_uiInlineSize ? inline_data() : nullptr;
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline T& inline_storage<T, nStorageSize>::operator[](size_t nIndex) const
+        {
+            if (!is_inline()) return heap()[nIndex];
+            if (!m_uiInlineSize) throw XNullPointer();
+            if (nIndex >= m_uiInlineSize)
+            {
+                XIndexOutOfRange exception;
+                exception.uiIndex = static_cast<uint32_t>(nIndex);
+                exception.uiSize = static_cast<uint32_t>(m_uiInlineSize);
+                throw exception;
+            }
+            return inline_data()[nIndex];
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline inline_storage<T, nStorageSize>::operator bool() const noexcept
+        {
+            return is_inline() ? m_uiInlineSize != 0 : static_cast<bool>(heap());
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline size_t inline_storage<T, nStorageSize>::size() const noexcept
+        {
+            return is_inline() ? m_uiInlineSize : heap().size();
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline size_t inline_storage<T, nStorageSize>::capacity() const noexcept
+        {
+            return is_inline() ? m_uiInlineSize : heap().capacity();
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline void inline_storage<T, nStorageSize>::resize(size_t nSize)
+        {
+            if (!is_inline())
+            {
+                heap().resize(nSize);
+                return;
+            }
+            if (nSize > inline_capacity)
+            {
+                move_to_heap(nSize);
+                return;
+            }
+
+            // Destroy the removed elements or create the new elements (scalars are set to zero like the pointer does).
+            T* ptData = inline_data();
+            if constexpr (!std::is_scalar_v<T>)
+            {
+                for (size_t nIndex = nSize; nIndex < m_uiInlineSize; nIndex++)
+                    ptData[nIndex].~T();
+            }
+            for (size_t nIndex = m_uiInlineSize; nIndex < nSize; nIndex++)
+                new (m_rguiStorage + nIndex * sizeof(T)) T();
+            m_uiInlineSize = static_cast<uint8_t>(nSize);
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline void inline_storage<T, nStorageSize>::reset()
+        {
+            if (is_inline())
+            {
+                if constexpr (!std::is_scalar_v<T>)
+                {
+                    T* ptData = inline_data();
+                    for (size_t nIndex = 0; nIndex < m_uiInlineSize; nIndex++)
+                        ptData[nIndex].~T();
+                }
+            }
+            else
+            {
+                heap().reset();
+                heap().~pointer<T>();
+            }
+            m_uiInlineSize = 0;
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline bool inline_storage<T, nStorageSize>::is_inline() const noexcept
+        {
+            return m_uiInlineSize != heap_marker;
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline pointer<T>& inline_storage<T, nStorageSize>::buffer()
+        {
+            if (is_inline()) move_to_heap(m_uiInlineSize);
+            return heap();
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline pointer<T>& inline_storage<T, nStorageSize>::heap() const noexcept
+        {
+            return *std::launder(reinterpret_cast<pointer<T>*>(const_cast<uint8_t*>(m_rguiStorage)));
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline T* inline_storage<T, nStorageSize>::inline_data() const noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(const_cast<uint8_t*>(m_rguiStorage)));
+        }
+
+        template <typename T, size_t nStorageSize>
+        inline void inline_storage<T, nStorageSize>::move_to_heap(size_t nSize)
+        {
+            pointer<T> ptrHeap;
+            if (nSize) ptrHeap.resize(nSize);
+            std::move(inline_data(), inline_data() + m_uiInlineSize, ptrHeap.get());
+            reset();
+            new (m_rguiStorage) pointer<T>(std::move(ptrHeap));
+            m_uiInlineSize = heap_marker;
+        }
+    } // namespace internal
+
 } // namespace sdv
 /// @endcond
 
@@ -22,12 +22,23 @@
 
 namespace sdv
 {
+    namespace internal
+    {
+        /**
+         * @brief Storage of small dynamic sized sequences; e.g. up to 31 bytes or 3 pointers are stored without allocation.
+         * @tparam T The type of the elements.
+         */
+        template <typename T>
+        using sequence_storage = inline_storage<T, 32>;
+    } // namespace internal
+
     /**
      * @brief Managed sequence class.
      * @details Sequence management class. A sequence provides a dynamic vector based on a buffer implementation of the ptr-class.
      * There are two versions of buffer management, fixed buffer management (nFixedSize template parameter larger than 0) and
-     * dynamic buffer management (nFixedSize template parameter is 0). The functions of this class are similar to the functions of
-     * the std::vector class.
+     * dynamic buffer management (nFixedSize template parameter is 0). Dynamic sequences of scalars and pointers store a small
+     * amount of elements inline and only allocate when exceeding the inline capacity. The functions of this class are similar to
+     * the functions of the std::vector class.
      * @tparam T Type to use for the buffer allocation.
      * @tparam nFixedSize Size of the fixed size buffer or 0 for a dynamic sized buffer.
      */
@@ -125,11 +136,12 @@ namespace sdv
 
         /**
          * @brief Move constructor of other sequence types.
+         * @remarks Can throw when the elements do not fit into a fixed sequence or when the elements need an allocation.
          * @tparam nFixedSize2 The fixed size of the provided sequence.
          * @param[in] rseq Reference to the sequence to move the values from.
          */
         template <size_t nFixedSize2>
-        sequence(sequence<T, nFixedSize2>&& rseq) noexcept;
+        sequence(sequence<T, nFixedSize2>&& rseq);
 
         /**
          * @brief Construct a sequence from a vector.
@@ -168,12 +180,13 @@ namespace sdv
 
         /**
          * @brief Move operator of other sequence types.
+         * @remarks Can throw when the elements do not fit into a fixed sequence or when the elements need an allocation.
          * @tparam nFixedSize2 The fixed size of the provided sequence.
          * @param[in] rseq Reference to the sequence.
          * @return Reference to this sequence.
          */
         template <size_t nFixedSize2>
-        sequence& operator=(sequence<T, nFixedSize2>&& rseq) noexcept;
+        sequence& operator=(sequence<T, nFixedSize2>&& rseq);
 
         /**
          * @brief Assignment operator for vector.
@@ -276,10 +289,10 @@ namespace sdv
         const T* data() const noexcept;
 
         /**
-         * @brief Access to the buffer.
+         * @brief Access to the buffer. A dynamic sequence stored inline is moved into an allocation first.
          * @return Return a reference to the internal buffer.
          */
-        pointer<T, nFixedSize>& buffer() noexcept;
+        pointer<T, nFixedSize>& buffer();
 
         /**
          * @brief Return an iterator to the itFirst value of the sequence.
@@ -508,14 +521,30 @@ namespace sdv
 
         /**
          * @brief Exchange the content of provided sequence with this sequence.
+         * @remarks Exchanging with other sequence types moves the elements and can throw (see the move operator).
          * @tparam nFixedSize2 The fixed size of the provided sequence.
          * @param[in] rseq Reference to the sequence to swap with.
          */
         template <size_t nFixedSize2>
-        void swap(sequence<T, nFixedSize2>& rseq) noexcept;
+        void swap(sequence<T, nFixedSize2>& rseq) noexcept(nFixedSize == nFixedSize2);
 
     private:
-        pointer<T, nFixedSize>      m_ptrData;        ///< Smart pointer to the data.
+        /// Sequences of other types access the storage when moving.
+        template <class T2, size_t nFixedSize2>
+        friend class sequence;
+
+        /**
+         * @brief Move the content of a sequence of another type into this (empty) sequence. Inline stored elements are moved
+         * element-wise; an allocation is taken over.
+         * @tparam nFixedSize2 The fixed size of the provided sequence.
+         * @param[in] rseq Reference to the sequence to move the values from.
+         */
+        template <size_t nFixedSize2>
+        void move_from(sequence<T, nFixedSize2>& rseq);
+
+        /// Storage of the data; inline storage for small dynamic sized sequences of scalars and pointers.
+        std::conditional_t<nFixedSize == 0 && internal::is_inline_storable<T>::value, internal::sequence_storage<T>,
+            pointer<T, nFixedSize>> m_ptrData;
     };
 
     /**
@@ -527,7 +556,8 @@ namespace sdv
      * @param[in] rseqRight Reference to the second sequence.
      */
     template <class T, size_t nFixedSizeLeft, size_t nFixedSizeRight>
-    void swap(sequence<T, nFixedSizeLeft>& rseqLeft, sequence<T, nFixedSizeRight>& rseqRight) noexcept;
+    void swap(sequence<T, nFixedSizeLeft>& rseqLeft, sequence<T, nFixedSizeRight>& rseqRight)
+        noexcept(nFixedSizeLeft == nFixedSizeRight);
 
     /**
      * @brief Compare whether the content of both sequences is identical.
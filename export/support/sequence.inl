@@ -84,9 +84,9 @@ namespace sdv
     /// @cond DOXYGEN_IGNORE
     template <class T, size_t nFixedSize>
     template <size_t nFixedSize2>
-    inline sequence<T, nFixedSize>::sequence(sequence<T, nFixedSize2>&& rseq) noexcept : sequence()
+    inline sequence<T, nFixedSize>::sequence(sequence<T, nFixedSize2>&& rseq) : sequence()
     {
-        m_ptrData = std::move(rseq.buffer());
+        move_from(rseq);
     }
 	/// @endcond
 
@@ -139,10 +139,10 @@ namespace sdv
     /// @cond DOXYGEN_IGNORE
     template <class T, size_t nFixedSize>
     template <size_t nFixedSize2>
-    inline sequence<T, nFixedSize>& sequence<T, nFixedSize>::operator=(sequence<T, nFixedSize2>&& rseq) noexcept
+    inline sequence<T, nFixedSize>& sequence<T, nFixedSize>::operator=(sequence<T, nFixedSize2>&& rseq)
     {
         clear();
-        m_ptrData = std::move(rseq.buffer());
+        move_from(rseq);
         return *this;
     }
 	/// @endcond
@@ -330,9 +330,12 @@ namespace sdv
     }
 
     template <class T, size_t nFixedSize>
-    inline pointer<T, nFixedSize>& sequence<T, nFixedSize>::buffer() noexcept
+    inline pointer<T, nFixedSize>& sequence<T, nFixedSize>::buffer()
     {
-        return m_ptrData;
+        if constexpr (std::is_same_v<decltype(m_ptrData), pointer<T, nFixedSize>>)
+            return m_ptrData;
+        else
+            return m_ptrData.buffer();
     }
 
     template <class T, size_t nFixedSize>
@@ -647,7 +650,7 @@ namespace sdv
     /// @cond DOXYGEN_IGNORE
     template <class T, size_t nFixedSize>
     template <size_t nFixedSize2>
-    inline void sequence<T, nFixedSize>::swap(sequence<T, nFixedSize2>& rseq) noexcept
+    inline void sequence<T, nFixedSize>::swap(sequence<T, nFixedSize2>& rseq) noexcept(nFixedSize == nFixedSize2)
     {
         sequence seqTemp = std::move(rseq);
         rseq = std::move(*this);
@@ -656,11 +659,33 @@ namespace sdv
 	/// @endcond
 
     template <class T, size_t nFixedSizeLeft, size_t nFixedSizeRight>
-    inline void swap(sequence<T, nFixedSizeLeft>& rseqLeft, sequence<T, nFixedSizeRight>& rseqRight) noexcept
+    inline void swap(sequence<T, nFixedSizeLeft>& rseqLeft, sequence<T, nFixedSizeRight>& rseqRight)
+        noexcept(nFixedSizeLeft == nFixedSizeRight)
     {
         rseqLeft.swap(rseqRight);
     }
 
+    /// @cond DOXYGEN_IGNORE
+    template <class T, size_t nFixedSize>
+    template <size_t nFixedSize2>
+    inline void sequence<T, nFixedSize>::move_from(sequence<T, nFixedSize2>& rseq)
+    {
+        // Inline stored elements are moved into the own storage; requesting the buffer would move them into an allocation first.
+        if constexpr (!std::is_same_v<decltype(rseq.m_ptrData), pointer<T, nFixedSize2>>)
+        {
+            if (rseq.m_ptrData.is_inline())
+            {
+                size_t nSize = rseq.size();
+                m_ptrData.resize(nSize);
+                std::move(rseq.m_ptrData.get(), rseq.m_ptrData.get() + nSize, m_ptrData.get());
+                rseq.m_ptrData.reset();
+                return;
+            }
+        }
+        m_ptrData = std::move(rseq.buffer());
+    }
+	/// @endcond
+
     template <class T, size_t nFixedSizeLeft, size_t nFixedSizeRight>
     inline bool operator==(const sequence<T, nFixedSizeLeft>& rseqLeft, const sequence<T, nFixedSizeRight>& rseqRight)
     {
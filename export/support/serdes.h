@@ -15,6 +15,7 @@
 #define SDV_SERDES_H
 
 #include <cstdint>
+#include <type_traits>
 #include "pointer.h"
 #include "sequence.h"
 #include "string.h"
@@ -279,6 +280,54 @@ namespace serdes
         template <sdv::EEndian eSourceEndianess, typename TCRC>
         static sdv::deserializer<eSourceEndianess, TCRC>& Deserialize(sdv::deserializer<eSourceEndianess, TCRC>& rDeserializer, T& rtValue);
     };
+
+    /**
+     * @brief Minimum size of a variable in serialized form; used to validate the element count of pointers and sequences before
+     * the elements are allocated.
+     * @remarks The serialized size of other compound types depends on their content (e.g. the active member of a union); these
+     * count as one byte.
+     * @tparam T Type of the variable.
+     */
+    template <typename T>
+    struct min_ser_size : std::integral_constant<size_t, std::is_fundamental_v<T> || std::is_enum_v<T> ? sizeof(T) : 1>
+    {};
+
+    /**
+     * @brief Minimum serialized size of an array: the minimum size of all elements.
+     * @tparam T Type of the elements.
+     * @tparam nSize The size of the array.
+     */
+    template <typename T, size_t nSize>
+    struct min_ser_size<T[nSize]> : std::integral_constant<size_t, nSize * min_ser_size<T>::value>
+    {};
+
+    /**
+     * @brief Minimum serialized size of a pointer: the element count.
+     * @tparam T Type of the elements.
+     * @tparam nFixedSize The fixed size of the pointer or 0 when the pointer is dynamic.
+     */
+    template <typename T, size_t nFixedSize>
+    struct min_ser_size<sdv::pointer<T, nFixedSize>> : std::integral_constant<size_t, sizeof(uint64_t)>
+    {};
+
+    /**
+     * @brief Minimum serialized size of a sequence: the element count.
+     * @tparam T Type of the elements.
+     * @tparam nFixedSize The fixed size of the sequence or 0 when the sequence is dynamic.
+     */
+    template <typename T, size_t nFixedSize>
+    struct min_ser_size<sdv::sequence<T, nFixedSize>> : std::integral_constant<size_t, sizeof(uint64_t)>
+    {};
+
+    /**
+     * @brief Minimum serialized size of a string: the character count.
+     * @tparam TCharType The character type.
+     * @tparam bUnicode When set, the string is a unicode string.
+     * @tparam nFixedSize The fixed size of the string or 0 when the string is dynamic.
+     */
+    template <typename TCharType, bool bUnicode, size_t nFixedSize>
+    struct min_ser_size<sdv::string_base<TCharType, bUnicode, nFixedSize>> : std::integral_constant<size_t, sizeof(uint64_t)>
+    {};
 } // namespace serdes
 
 /**
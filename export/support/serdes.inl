@@ -154,30 +154,30 @@ namespace sdv
         static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, bool> || std::is_enum_v<T>);
 
         // Without buffer there is no deserialization.
-        if (!m_ptrBuffer) return;
+        if (!m_pData) return;
 
         // Align to the proper address.
         align<T>();
 
         // Check whether the buffer contains the data requested
-        if (m_ptrBuffer.size() < m_nOffset + sizeof(T))
+        if (m_nSize < m_nOffset + sizeof(T))
         {
             sdv::XBufferTooSmall exception;
             exception.uiSize = m_nOffset + sizeof(T);
-            exception.uiCapacity = m_ptrBuffer.size();
+            exception.uiCapacity = m_nSize;
             throw exception;
         }
 
         // Calculate CRC
         for (size_t nIndex = m_nOffset; nIndex < m_nOffset + sizeof(T); nIndex++)
-            m_crcChecksum.add(m_ptrBuffer[nIndex]);
+            m_crcChecksum.add(m_pData[nIndex]);
 
         // Copy data
         if constexpr (eSourceEndianess == GetPlatformEndianess()) // No swapping
-            rtValue = *reinterpret_cast<T*>(m_ptrBuffer.get() + m_nOffset);
+            rtValue = *reinterpret_cast<const T*>(m_pData + m_nOffset);
         else // Swap bytes
         {
-            const uint8_t* pData = m_ptrBuffer.get() + m_nOffset;
+            const uint8_t* pData = m_pData + m_nOffset;
             for (size_t nIndex = 0; nIndex < sizeof(T); nIndex++)
                 reinterpret_cast<uint8_t*>(&rtValue)[nIndex] = pData[sizeof(T) - nIndex - 1];
         }
@@ -193,7 +193,7 @@ namespace sdv
         static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, bool> || std::is_enum_v<T>);
 
         // Without buffer there is no deserialization.
-        if (!m_ptrBuffer) return;
+        if (!m_pData) return;
 
         // Store the offset and checksum
         size_t nOffsetTemp = m_nOffset;
@@ -203,20 +203,20 @@ namespace sdv
         align<T>();
 
         // Check whether the buffer contains the data requested
-        if (m_ptrBuffer.size() < m_nOffset + sizeof(T))
+        if (m_nSize < m_nOffset + sizeof(T))
         {
             sdv::XBufferTooSmall exception;
             exception.uiSize = m_nOffset + sizeof(T);
-            exception.uiCapacity = m_ptrBuffer.size();
+            exception.uiCapacity = m_nSize;
             throw exception;
         }
 
         // Copy data
         if constexpr (eSourceEndianess == GetPlatformEndianess()) // No swapping
-            rtValue = *reinterpret_cast<T*>(m_ptrBuffer.get() + m_nOffset);
+            rtValue = *reinterpret_cast<const T*>(m_pData + m_nOffset);
         else // Swap bytes
         {
-            const uint8_t* pData = m_ptrBuffer.get() + m_nOffset;
+            const uint8_t* pData = m_pData + m_nOffset;
             for (size_t nIndex = 0; nIndex < sizeof(T); nIndex++)
                 reinterpret_cast<uint8_t*>(&rtValue)[nIndex] = pData[sizeof(T) - nIndex - 1];
         }
@@ -234,7 +234,7 @@ namespace sdv
         // Check the checksum value
         if (uiChecksum)
         {
-            crcCCITT_FALSE crcChecksum;
+            TCRC crcChecksum;
             for (size_t nIndex = 0; nIndex < nSize; nIndex++)
                 crcChecksum.add(pData[nIndex]);
             if (crcChecksum.get_checksum() != uiChecksum)
@@ -274,7 +274,7 @@ namespace sdv
 
             // Add the padding to the checksum value calculation.
             for (size_t nIndex = m_nOffset; nIndex != nOffsetNew; nIndex++)
-                m_crcChecksum.add(m_ptrBuffer[nIndex]);
+                m_crcChecksum.add(m_pData[nIndex]);
 
             m_nOffset = nOffsetNew;
         }
@@ -301,11 +301,11 @@ namespace sdv
     template <EEndian eSourceEndianess, typename TCRC>
     void deserializer<eSourceEndianess, TCRC>::jump(size_t nOffset, typename TCRC::TCRCType uiChecksum /*= 0*/)
     {
-        if (nOffset > m_ptrBuffer.size())
+        if (nOffset > m_nSize)
         {
             XOffsetPastBufferSize exception;
             exception.uiOffset = static_cast<uint32_t>(nOffset);
-            exception.uiSize = static_cast<uint32_t>(m_ptrBuffer.size());
+            exception.uiSize = static_cast<uint32_t>(m_nSize);
             throw exception;
         }
 
@@ -474,11 +474,14 @@ namespace serdes
         {
             uint64_t nSize = 0;
             rDeserializer >> nSize;
-            if (nSize * sizeof(T) > rDeserializer.remaining())
+
+            // Every element occupies at least its minimum serialized size; the memory size of compound types is no measure for it.
+            const size_t nMinElementSize = min_ser_size<T>::value;
+            if (nSize > rDeserializer.remaining() / nMinElementSize)
             {
                 sdv::XOffsetPastBufferSize exception;
                 exception.uiSize = rDeserializer.size();
-                exception.uiOffset = rDeserializer.offset() + nSize * sizeof(T);
+                exception.uiOffset = rDeserializer.offset() + nSize * nMinElementSize;
                 throw exception;
             }
             rptrValue.resize(nSize);
@@ -553,11 +556,14 @@ namespace serdes
         {
             uint64_t nSize = 0;
             rDeserializer >> nSize;
-            if (nSize * sizeof(T) > rDeserializer.remaining())
+
+            // Every element occupies at least its minimum serialized size; the memory size of compound types is no measure for it.
+            const size_t nMinElementSize = min_ser_size<T>::value;
+            if (nSize > rDeserializer.remaining() / nMinElementSize)
             {
                 sdv::XOffsetPastBufferSize exception;
                 exception.uiSize = rDeserializer.size();
-                exception.uiOffset = rDeserializer.offset() + nSize * sizeof(T);
+                exception.uiOffset = rDeserializer.offset() + nSize * nMinElementSize;
                 throw exception;
             }
             rseqValue.resize(nSize);
@@ -629,7 +635,7 @@ namespace serdes
         {
             uint64_t nSize = 0;
             rDeserializer >> nSize;
-            if (nSize * sizeof(TCharType) > rDeserializer.remaining())
+            if (nSize > rDeserializer.remaining() / sizeof(TCharType))
             {
                 sdv::XOffsetPastBufferSize exception;
                 exception.uiSize = rDeserializer.size();
@@ -14,8 +14,13 @@
 #ifndef SIGNAL_SUPPORT_H
 #define SIGNAL_SUPPORT_H
 
+#include <algorithm>
+#include <atomic>
+#include <cassert>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 #include "../interfaces/dispatch.h"
@@ -101,6 +106,28 @@ namespace sdv
             template <typename TType>
             CSignal Subscribe(const u8string& rssSignalName, std::atomic<TType>& rtVal);
 
+            /**
+             * @brief Subscribe to a signal event using a subscription policy.
+             * @param[in] rssSignalName Reference to the name of the signal to publish data for.
+             * @param[in] func Function to call when data is received and passed the policy.
+             * @param[in] rsPolicy Reference to the subscription policy (change-only, deadband and rate limit).
+             * @return Returns the initialized signal class or an empty signal when the signal was nor registered before or the
+             * dispatch service could not be reached.
+             */
+            CSignal Subscribe(const u8string& rssSignalName, std::function<void(any_t)> func, const SSubscriptionPolicy& rsPolicy);
+
+            /**
+             * @brief Subscribe to a signal event using a subscription policy and allow updating the signal value automatically.
+             * @tparam TType Type of the signal data.
+             * @param[in] rssSignalName Reference to the name of the signal to publish data for.
+             * @param[in] rtVal Reference to the value to be filled automatically.
+             * @param[in] rsPolicy Reference to the subscription policy (change-only, deadband and rate limit).
+             * @return Returns the initialized signal class or an empty signal when the signal was nor registered before or the
+             * dispatch service could not be reached.
+             */
+            template <typename TType>
+            CSignal Subscribe(const u8string& rssSignalName, std::atomic<TType>& rtVal, const SSubscriptionPolicy& rsPolicy);
+
             /**
              * @brief Get a list of registered signals.
              * @return List of registration functions.
@@ -236,6 +263,18 @@ namespace sdv
                 return m_pTransaction;
             }
 
+            /**
+             * @brief Returns whether a signal was read with this transaction after the signal history didn't contain the
+             * transaction any more. The oldest available value was read instead.
+             * @return Returns 'true' when the snapshot was too old for at least one signal; 'false' otherwise.
+             */
+            bool IsSnapshotTooOld() const
+            {
+                if (!m_pTransaction) return false;
+                const ITransactionSnapshot* pSnapshot = m_pTransaction->GetInterface<ITransactionSnapshot>();
+                return pSnapshot ? pSnapshot->IsSnapshotTooOld() : false;
+            }
+
         private:
             CDispatchService*       m_pDispatch = nullptr;          ///< Pointer to the dispatch class.
             IInterfaceAccess*       m_pTransaction = nullptr;       ///< Transaction object
@@ -427,6 +466,18 @@ namespace sdv
                 return anyVal;
             }
 
+            /**
+             * @brief Get the statistics of the subscription. This function is available for subscriptions.
+             * @return The amount of delivered and suppressed values.
+             */
+            SSubscriptionStatistics GetSubscriptionStatistics() const
+            {
+                SSubscriptionStatistics sStatistics{};
+                const ISubscriptionStatistics* pStatistics = m_pSignal ? m_pSignal->GetInterface<ISubscriptionStatistics>() : nullptr;
+                if (pStatistics) sStatistics = pStatistics->GetSubscriptionStatistics();
+                return sStatistics;
+            }
+
             /**
              * @brief Was this signal class used for registration of the signal.
              * @return Set when this signal is used for registration.
@@ -686,6 +737,20 @@ namespace sdv
                 pTrigger->RemoveSignal(rSignal.GetName());
             }
 
+            /**
+             * @brief Set the amount of periodic triggers that still occur after all signals have returned to their default value.
+             * Only used for triggers being created with the bOnlyWhenActive flag.
+             * @param[in] uiRepetitions The amount of inactive repetitions (default 1).
+             */
+            void SetInactiveRepetitions(uint32_t uiRepetitions)
+            {
+                if (!m_pTrigger) return;
+                ITxTriggerConfig* pTriggerConfig = m_pTrigger->GetInterface<ITxTriggerConfig>();
+                if (!pTriggerConfig) return;
+
+                pTriggerConfig->SetInactiveRepetitions(uiRepetitions);
+            }
+
         protected:
             /**
              * @brief Get the pointer of the callback object.
@@ -737,6 +802,161 @@ namespace sdv
             std::unique_ptr<STriggerCallback>   m_ptrCallback;                  ///< Callback object
         };
 
+        /**
+         * @brief Copy-on-write array of callback interfaces used to distribute signal changes.
+         * @details Calling the callbacks doesn't lock; the caller takes a snapshot of the array. Adding and removing a callback
+         * creates a new array. The calls are counted per epoch; removing a callback starts a new epoch and waits until all calls
+         * of the previous epoch have finished. This covers every snapshot that could still contain the callback, so the callback
+         * object can be destroyed directly after the removal.
+         * @remarks Removing a callback from within a callback of the same array is not supported; the calling thread would
+         * still use a snapshot containing the removed callback. This is asserted in debug builds. In release builds the removal
+         * doesn't wait for the calls of the calling thread itself.
+         * @tparam TCallback Type of the callback interface.
+         */
+        template <typename TCallback>
+        class CCallbackArray
+        {
+        public:
+            /**
+             * @brief Default constructor.
+             */
+            CCallbackArray() : m_ptrCallbacks(std::make_shared<const std::vector<TCallback*>>())
+            {}
+
+            /**
+             * @brief Add a callback. Adding a callback twice is ignored.
+             * @param[in] pCallback Pointer to the callback interface.
+             */
+            void Add(TCallback* pCallback)
+            {
+                if (!pCallback) return;
+                std::unique_lock<std::mutex> lock(m_mtxModify);
+                std::vector<TCallback*> vecCallbacks = *std::atomic_load(&m_ptrCallbacks);
+                if (std::find(vecCallbacks.begin(), vecCallbacks.end(), pCallback) != vecCallbacks.end()) return;
+                vecCallbacks.push_back(pCallback);
+                std::atomic_store(&m_ptrCallbacks, std::make_shared<const std::vector<TCallback*>>(std::move(vecCallbacks)));
+            }
+
+            /**
+             * @brief Remove a callback. Returns when the callback is not called any more.
+             * @param[in] pCallback Pointer to the callback interface.
+             */
+            void Remove(TCallback* pCallback)
+            {
+                if (!pCallback) return;
+                assert(!CallingThreadCount(0) && !CallingThreadCount(1) &&
+                    "A callback cannot be removed from within a callback of the same array.");
+                std::unique_lock<std::mutex> lock(m_mtxModify);
+                std::vector<TCallback*> vecCallbacks = *std::atomic_load(&m_ptrCallbacks);
+                auto itCallback = std::find(vecCallbacks.begin(), vecCallbacks.end(), pCallback);
+                if (itCallback == vecCallbacks.end()) return;
+                vecCallbacks.erase(itCallback);
+                std::atomic_store(&m_ptrCallbacks, std::make_shared<const std::vector<TCallback*>>(std::move(vecCallbacks)));
+
+                // Start a new epoch; calls starting from now use the new snapshot. Wait for the calls of the previous epoch, which
+                // might use any earlier snapshot.
+                size_t nIndex = static_cast<size_t>(m_uiEpoch.fetch_add(1) & 1);
+                size_t nOwnCalls = CallingThreadCount(nIndex);
+                while (m_rgnCalls[nIndex].load() > nOwnCalls)
+                    std::this_thread::yield();
+            }
+
+            /**
+             * @brief Call a function for each callback.
+             * @tparam TFunction Type of the function; called with the callback pointer as argument.
+             * @param[in] rfnCall Reference to the function to call.
+             */
+            template <typename TFunction>
+            void ForEach(const TFunction& rfnCall) const
+            {
+                // The snapshot is taken after registering the call; a removal waits for the call when using an old snapshot.
+                SCall sCall(*this);
+                std::shared_ptr<const std::vector<TCallback*>> ptrCallbacks = std::atomic_load(&m_ptrCallbacks);
+                for (TCallback* pCallback : *ptrCallbacks)
+                    rfnCall(pCallback);
+            }
+
+            /**
+             * @brief Is the array empty?
+             * @return Returns whether no callback was added.
+             */
+            bool Empty() const
+            {
+                return std::atomic_load(&m_ptrCallbacks)->empty();
+            }
+
+        private:
+            /**
+             * @brief Registration of a running call in the epoch. The registrations of a thread are chained to detect calls from
+             * within a callback.
+             */
+            struct SCall
+            {
+                /**
+                 * @brief Register the call in the current epoch.
+                 * @param[in] rArray Reference to the callback array.
+                 */
+                SCall(const CCallbackArray& rArray) : pArray(&rArray), pPrevious(Top())
+                {
+                    // When the epoch changes in between, the removal could have missed the registration; try again in the new
+                    // epoch.
+                    while (true)
+                    {
+                        uint64_t uiEpoch = rArray.m_uiEpoch.load();
+                        nIndex = static_cast<size_t>(uiEpoch & 1);
+                        rArray.m_rgnCalls[nIndex]++;
+                        if (rArray.m_uiEpoch.load() == uiEpoch) break;
+                        rArray.m_rgnCalls[nIndex]--;
+                    }
+                    Top() = this;
+                }
+
+                /**
+                 * @brief Unregister the call.
+                 */
+                ~SCall()
+                {
+                    Top() = pPrevious;
+                    pArray->m_rgnCalls[nIndex]--;
+                }
+
+                SCall(const SCall&) = delete;
+                SCall& operator=(const SCall&) = delete;
+
+                /**
+                 * @brief Last registered call of the calling thread.
+                 * @return Reference to the pointer to the last call.
+                 */
+                static SCall*& Top()
+                {
+                    static thread_local SCall* pTop = nullptr;
+                    return pTop;
+                }
+
+                const CCallbackArray*   pArray = nullptr;       ///< The array being called.
+                SCall*                  pPrevious = nullptr;    ///< Previous call of the thread.
+                size_t                  nIndex = 0;             ///< Index of the counter of the epoch.
+            };
+
+            /**
+             * @brief Count the calls of the calling thread to this array registered with the counter.
+             * @param[in] nIndex Index of the epoch counter.
+             * @return The amount of calls.
+             */
+            size_t CallingThreadCount(size_t nIndex) const
+            {
+                size_t nCount = 0;
+                for (const SCall* pCall = SCall::Top(); pCall; pCall = pCall->pPrevious)
+                    if (pCall->pArray == this && pCall->nIndex == nIndex) nCount++;
+                return nCount;
+            }
+
+            std::mutex                                      m_mtxModify;        ///< Serializes adding and removing callbacks.
+            std::shared_ptr<const std::vector<TCallback*>>  m_ptrCallbacks;     ///< Current snapshot of the callbacks.
+            std::atomic_uint64_t                            m_uiEpoch{0};       ///< Removal epoch; the lowest bit selects the counter.
+            mutable std::atomic_size_t                      m_rgnCalls[2]{};    ///< Running calls of the current and previous epoch.
+        };
+
         inline CDispatchService::CDispatchService()
         {}
 
@@ -792,6 +1012,27 @@ namespace sdv
             return signal;
         }
 
+        inline CSignal CDispatchService::Subscribe(const u8string& rssSignalName, std::function<void(any_t)> func,
+            const SSubscriptionPolicy& rsPolicy)
+        {
+            ISignalAccessEx* pAccess = GetObject<ISignalAccessEx>("DataDispatchService");
+            CSignal signal(*this, rssSignalName, func);
+            if (pAccess)
+                signal.Assign(pAccess->AddSignalSubscriptionEx(rssSignalName, signal.GetSubscriptionEventHandler(), rsPolicy));
+            return signal;
+        }
+
+        template <typename TType>
+        inline CSignal CDispatchService::Subscribe(const u8string& rssSignalName, std::atomic<TType>& rtVal,
+            const SSubscriptionPolicy& rsPolicy)
+        {
+            ISignalAccessEx* pAccess = GetObject<ISignalAccessEx>("DataDispatchService");
+            CSignal signal(*this, rssSignalName, rtVal);
+            if (pAccess)
+                signal.Assign(pAccess->AddSignalSubscriptionEx(rssSignalName, signal.GetSubscriptionEventHandler(), rsPolicy));
+            return signal;
+        }
+
         inline sequence<SSignalRegistration> CDispatchService::GetRegisteredSignals() const
         {
             ISignalAccess* pAccess = GetObject<ISignalAccess>("DataDispatchService");
@@ -24,6 +24,16 @@
 
 namespace sdv
 {
+    namespace internal
+    {
+        /**
+         * @brief Storage of the dynamic sized string; strings up to 22 bytes are stored without allocation.
+         * @tparam TCharType The character type that the storage holds.
+         */
+        template <typename TCharType>
+        using string_storage = inline_storage<TCharType, 24>;
+    } // namespace internal
+
     /**
      * @brief Templated string class.
      * @tparam TCharType The character type that the class uses.
@@ -412,10 +422,10 @@ namespace sdv
         const TCharType* data() const noexcept;
 
         /**
-         * @brief Access to the buffer.
+         * @brief Access to the buffer. A dynamic sized string stored inline is moved into an allocation first.
          * @return Returns reference to the internal buffer.
          */
-        pointer<TCharType, nFixedSize ? nFixedSize + 1 : 0>& buffer() noexcept;
+        pointer<TCharType, nFixedSize ? nFixedSize + 1 : 0>& buffer();
 
         /**
          * @brief Return a pointer to a zero terminate string.
@@ -1338,7 +1348,8 @@ namespace sdv
         size_t find_last_not_of(TCharType c, size_t nPos = npos) const noexcept;
 
     private:
-        pointer<TCharType, nFixedSize ? nFixedSize + 1 : 0> m_ptrData; ///< Smart pointer to the data.
+        /// Storage of the data; inline storage for short dynamic sized strings.
+        std::conditional_t<nFixedSize == 0, internal::string_storage<TCharType>, pointer<TCharType, nFixedSize + 1>> m_ptrData;
     };
 
     /**
@@ -444,9 +444,12 @@ namespace sdv
     }
 
     template <typename TCharType, bool bUnicode, size_t nFixedSize>
-    inline pointer<TCharType, nFixedSize ? nFixedSize + 1 : 0>& string_base<TCharType, bUnicode, nFixedSize>::buffer() noexcept
+    inline pointer<TCharType, nFixedSize ? nFixedSize + 1 : 0>& string_base<TCharType, bUnicode, nFixedSize>::buffer()
     {
-        return m_ptrData;
+        if constexpr (nFixedSize == 0)
+            return m_ptrData.buffer();
+        else
+            return m_ptrData;
     }
 
     template <typename TCharType, bool bUnicode, size_t nFixedSize>
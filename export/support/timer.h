@@ -58,6 +58,33 @@ namespace sdv
                 m_pTimer = pTaskTimer->CreateTimer(uiPeriod, m_ptrCallback.get());
             }
 
+            /**
+             * @brief Constructor
+             * @param[in] rsConfig Reference to the timer configuration containing the period in us and the overrun policy.
+             * @param[in] fnCallback Callback function to be called on task execution.
+             * @param[in] fnDeadlineMiss Callback function to be called when the execution did not finish before the next tick;
+             * receives the lateness in us. Could be empty.
+             * @param[in] bUseSimTimer Use the simulated task timer instead of the actual task timer.
+             */
+            CTaskTimer(const STimerConfig& rsConfig, std::function<void()> fnCallback,
+                std::function<void(uint64_t)> fnDeadlineMiss = {}, bool bUseSimTimer = false) :
+                m_ptrCallback(std::make_unique<STimerCallback>(fnCallback, fnDeadlineMiss))
+            {
+                if (!m_ptrCallback) return;
+                if (!rsConfig.uiPeriodUs) return;
+
+                // Get the extended task timer service.
+                sdv::core::ITaskTimerEx* pTaskTimer = nullptr;
+                if (bUseSimTimer)
+                    pTaskTimer = sdv::core::GetObject<sdv::core::ITaskTimerEx>("SimulationTaskTimerService");
+                else
+                    pTaskTimer = sdv::core::GetObject<sdv::core::ITaskTimerEx>("TaskTimerService");
+                if (!pTaskTimer) return;
+
+                // Create the timer
+                m_pTimer = pTaskTimer->CreateTimerEx(rsConfig, m_ptrCallback.get());
+            }
+
             /**
             * @brief Constructor
             * @param[in] uiPeriod The period to create a timer for.
@@ -151,6 +178,16 @@ namespace sdv
                 m_uiPeriod = 0ul;
             }
 
+            /**
+             * @brief Get the statistics of the timer.
+             * @return The timer statistics. Empty when the timer is not valid or doesn't provide statistics.
+             */
+            STimerStatistics GetStatistics() const
+            {
+                ITimerStatistics* pStatistics = m_pTimer ? m_pTimer->GetInterface<ITimerStatistics>() : nullptr;
+                return pStatistics ? pStatistics->GetStatistics() : STimerStatistics{};
+            }
+
             /**
              * @brief Get the task timer period.
              * @return The period of the timer in ms.
@@ -164,15 +201,17 @@ namespace sdv
             /**
             * @brief Timer callback wrapper object.
             */
-            struct STimerCallback : public IInterfaceAccess, public core::ITaskExecute
+            struct STimerCallback : public IInterfaceAccess, public core::ITaskExecute, public core::ITaskDeadlineMiss
             {
-                STimerCallback(std::function<void()> fnCallback) : m_fnCallback(fnCallback)
+                STimerCallback(std::function<void()> fnCallback, std::function<void(uint64_t)> fnDeadlineMiss = {}) :
+                    m_fnCallback(fnCallback), m_fnDeadlineMiss(fnDeadlineMiss)
                 {}
 
             protected:
                 // Interface map
                 BEGIN_SDV_INTERFACE_MAP()
                     SDV_INTERFACE_ENTRY(core::ITaskExecute)
+                    SDV_INTERFACE_ENTRY(core::ITaskDeadlineMiss)
                 END_SDV_INTERFACE_MAP()
 
                 /**
@@ -183,8 +222,18 @@ namespace sdv
                     if (m_fnCallback) m_fnCallback();
                 }
 
+                /**
+                * @brief The execution missed the deadline. Overload of ITaskDeadlineMiss::DeadlineMissed.
+                * @param[in] uiLatenessUs The time in us the execution finished after the deadline.
+                */
+                virtual void DeadlineMissed(uint64_t uiLatenessUs) override
+                {
+                    if (m_fnDeadlineMiss) m_fnDeadlineMiss(uiLatenessUs);
+                }
+
             private:
                 std::function<void()>       m_fnCallback;           ///< Callback function
+                std::function<void(uint64_t)> m_fnDeadlineMiss;     ///< Deadline miss callback function
             };
 
             sdv::IInterfaceAccess*          m_pTimer = nullptr;     ///< Timer object
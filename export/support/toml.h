@@ -17,6 +17,8 @@
 #include "../interfaces/toml.h"
 #include "interface_ptr.h"
 #include "local_service_access.h"
+#include <set>
+#include <vector>
 
 namespace sdv::toml
 {
@@ -228,6 +230,18 @@ namespace sdv::toml
          */
         CNode GetDirect(const sdv::u8string& rssNode) const;
 
+        /**
+         * @brief Get all values of this collection and of its child collections with one call.
+         * @details The keys are composed of the node names separated by a dot; array elements are addressed by their index in
+         * brackets (e.g. 'table.array[1]'). The keys are not quoted. The values are returned in the order they are defined.
+         * @param[in] bIncludeArrays When set, the elements of arrays and table arrays are included as well. Otherwise arrays and
+         * their content are skipped.
+         * @remarks When the parser does not provide the INodeCollectionFlatten interface, the values are collected by walking
+         * through the nodes.
+         * @return Sequence with the key/value pairs. The sequence is empty when the collection is not valid.
+         */
+        sdv::sequence<SKeyValue> GetFlattened(bool bIncludeArrays = false) const;
+
         /**
          * @brief Insert a value node before the provided position.
          * @remarks The actual position depends on the type of node and the order the nodes are stored. Inline nodes come before
@@ -363,6 +377,15 @@ namespace sdv::toml
         int AddTOML(const std::string& rssTOML, bool bAllowPartial = false);
 
     private:
+        /**
+         * @brief Add the values of this collection and of its child collections by walking through the nodes. Used when the
+         * INodeCollectionFlatten interface is not available.
+         * @param[in] rssPrefix Reference to the key of this collection; empty for the root collection.
+         * @param[in] bIncludeArrays When set, the elements of arrays and table arrays are included as well.
+         * @param[in, out] rvecKeyValues Reference to the vector receiving the key/value pairs.
+         */
+        void Flatten(const std::string& rssPrefix, bool bIncludeArrays, std::vector<SKeyValue>& rvecKeyValues) const;
+
         INodeCollection*    m_pCollection = nullptr;        ///< Pointer to the node collection interface.
     };
 
@@ -380,15 +403,19 @@ namespace sdv::toml
         /**
          * @brief Constructor providing automatic processing.
          * @param[in] rssConfig Reference to the configuration.
+         * @param[in] bReadOnly When set, the configuration is processed without preserving comments and whitespace. This is
+         * faster, but TOML generated from the configuration will not contain the original formatting.
          */
-        CTOMLParser(const std::string& rssConfig);
+        CTOMLParser(const std::string& rssConfig, bool bReadOnly = false);
 
         /**
          * @brief Process a configuration. This will clear any previous configuration.
          * @param[in] rssConfig Reference to the configuration.
+         * @param[in] bReadOnly When set, the configuration is processed without preserving comments and whitespace. This is
+         * faster, but TOML generated from the configuration will not contain the original formatting.
          * @return Returns 'true' when the processing was successful; 'false# when not.
          */
-        bool Process(const std::string& rssConfig);
+        bool Process(const std::string& rssConfig, bool bReadOnly = false);
 
         /**
          * @brief Returns whether a valid processed configuration is available.
@@ -605,6 +632,65 @@ namespace sdv::toml
         return m_pCollection ? CNode(m_pCollection->GetNodeDirect(rssNode)) : CNode();
     }
 
+    inline sdv::sequence<SKeyValue> CNodeCollection::GetFlattened(bool bIncludeArrays /*= false*/) const
+    {
+        INodeCollectionFlatten* pFlatten = m_ptrNode.GetInterface<INodeCollectionFlatten>();
+        if (pFlatten) return pFlatten->GetFlattened(bIncludeArrays);
+
+        std::vector<SKeyValue> vecKeyValues;
+        Flatten(std::string(), bIncludeArrays, vecKeyValues);
+        sdv::sequence<SKeyValue> seqKeyValues(vecKeyValues.size());
+        std::move(vecKeyValues.begin(), vecKeyValues.end(), seqKeyValues.begin());
+        return seqKeyValues;
+    }
+
+    inline void CNodeCollection::Flatten(const std::string& rssPrefix, bool bIncludeArrays,
+        std::vector<SKeyValue>& rvecKeyValues) const
+    {
+        // The node order of a table can also contain the nodes of its sub-tables. These are represented by their ancestor
+        // being a direct child of this collection; every direct child is processed once.
+        if (!m_pCollection) return;
+        auto fnGetChild = [this](TInterfaceAccessPtr ptrNode) -> TInterfaceAccessPtr
+        {
+            while (ptrNode)
+            {
+                INodeInfo* pNodeInfo = ptrNode.GetInterface<INodeInfo>();
+                TInterfaceAccessPtr ptrParent = pNodeInfo ? pNodeInfo->GetParent() : nullptr;
+                if (ptrParent.GetInterface<INodeCollection>() == m_pCollection) return ptrNode;
+                ptrNode = ptrParent;
+            }
+            return nullptr;
+        };
+
+        bool bArray = GetType() == ENodeType::node_array;
+        std::set<INodeInfo*> setChildren;
+        for (size_t n = 0; n < GetCount(); n++)
+        {
+            TInterfaceAccessPtr ptrChild = fnGetChild(Get(n).GetInterface());
+            if (!ptrChild || !setChildren.insert(ptrChild.GetInterface<INodeInfo>()).second) continue;
+            const CNode node(ptrChild);
+            std::string ssKey;
+            if (bArray)
+                ssKey = rssPrefix + "[" + std::to_string(setChildren.size() - 1) + "]";
+            else
+                ssKey = rssPrefix.empty() ? node.GetName() : rssPrefix + "." + node.GetName();
+            switch (node.GetType())
+            {
+            case ENodeType::node_array:
+                if (!bIncludeArrays) break;
+                [[fallthrough]];
+            case ENodeType::node_table:
+                CNodeCollection(node).Flatten(ssKey, bIncludeArrays, rvecKeyValues);
+                break;
+            case ENodeType::node_invalid:
+                break;
+            default:
+                rvecKeyValues.push_back(SKeyValue{ssKey, node.GetValue()});
+                break;
+            }
+        }
+    }
+
     inline CNode CNodeCollection::InsertValue(size_t nIndex, const std::string& rssName, const sdv::any_t& ranyValue)
     {
         INodeCollectionInsert* pInsert = m_ptrNode.GetInterface<INodeCollectionInsert>();
@@ -704,12 +790,12 @@ namespace sdv::toml
         }
     }
 
-    inline CTOMLParser::CTOMLParser(const std::string& rssConfig)
+    inline CTOMLParser::CTOMLParser(const std::string& rssConfig, bool bReadOnly /*= false*/)
     {
-        Process(rssConfig);
+        Process(rssConfig, bReadOnly);
     }
 
-    inline bool CTOMLParser::Process(const std::string& rssConfig)
+    inline bool CTOMLParser::Process(const std::string& rssConfig, bool bReadOnly /*= false*/)
     {
         Clear();
         m_ptrParserUtil = sdv::core::CreateUtility("TOMLParserUtility");
@@ -718,7 +804,11 @@ namespace sdv::toml
         {
             try
             {
-                m_pParser->Process(rssConfig);
+                ITOMLParserReadOnly* pParserReadOnly = bReadOnly ? m_ptrParserUtil.GetInterface<ITOMLParserReadOnly>() : nullptr;
+                if (pParserReadOnly)
+                    pParserReadOnly->ProcessReadOnly(rssConfig);
+                else
+                    m_pParser->Process(rssConfig);
                 CNodeCollection::operator=(m_ptrParserUtil);
             }
             catch (const sdv::toml::XTOMLParseException&)
@@ -0,0 +1,185 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+#include <support/signal_support.h>
+#include <interfaces/dispatch.h>
+#include <support/app_control.h>
+#include <signal_identifier.h>
+#include <vss_vehiclechassisbodyint32_vd_rx.h>
+#include <vss_vehiclechassisbodystring_vd_rx.h>
+#include <vss_vehiclechassisbodyint32_bs_rx.h>
+#include <vss_vehiclechassisbodystring_bs_rx.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+bool InitializeAppControl(sdv::app::CAppControl* appControl, const std::string& configFileName)
+{
+    auto bResult = appControl->AddModuleSearchDir("../../bin");
+    bResult &= appControl->Startup("");
+    appControl->SetConfigMode();
+    bResult &= appControl->AddConfigSearchDir("../../tests/bin/config");
+
+    if (!configFileName.empty())
+    {
+        bResult &= appControl->LoadConfig(configFileName.c_str()) == sdv::core::EConfigProcessResult::successful;
+    }
+
+    return bResult;
+}
+
+/**
+ * @brief Callback of the basic service detecting calls after it was unregistered.
+ */
+class CInt32Callback : public vss::Vehicle::Chassis::Body::Int32Service::IVSS_SetSignalTypeInt32_Event
+{
+public:
+    /**
+     * @brief Set signal value. Overload of IVSS_SetSignalTypeInt32_Event::SetSignalTypeInt32.
+     * @param[in] value The value.
+     */
+    virtual void SetSignalTypeInt32(int32_t value) override
+    {
+        if (m_bUnregistered) m_bCalledAfterUnregister = true;
+        m_iValue = value;
+    }
+
+    std::atomic_bool    m_bUnregistered = false;            ///< Set after unregistering the callback.
+    std::atomic_bool    m_bCalledAfterUnregister = false;   ///< Set when called after unregistering.
+    std::atomic_int32_t m_iValue = 0;                       ///< Last value.
+};
+
+TEST(VSSComponentTest, RXInt32)
+{
+    sdv::app::CAppControl appControl;
+
+    auto bResult = InitializeAppControl(&appControl, "data_dispatch_service.toml");
+    ASSERT_EQ(bResult, true);
+
+    sdv::core::CDispatchService dispatch;
+    sdv::core::CSignal signalRx;
+    signalRx = dispatch.RegisterRxSignal(testcase6::dsSignalInt32);
+    ASSERT_TRUE(signalRx);
+
+    bResult &= appControl.LoadConfig("rxfusedtypeint32.toml") == sdv::core::EConfigProcessResult::successful;
+    ASSERT_EQ(bResult, true);
+
+    auto basicService = sdv::core::GetObject("Vehicle.Chassis.Body.Int32_Service").GetInterface<vss::Vehicle::Chassis::Body::Int32Service::IVSS_GetSignalTypeInt32>();
+    ASSERT_TRUE(basicService);
+
+    CInt32Callback callback;
+    basicService->RegisterOnSignalChangeOfSignalInt32(&callback);
+
+    appControl.SetRunningMode();
+    const int32_t expected = 123;
+    signalRx.Write(expected);
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    ASSERT_EQ(expected * 2, basicService->GetSignalTypeInt32());
+    EXPECT_EQ(expected * 2, callback.m_iValue);
+
+    basicService->UnregisterOnSignalChangeOfSignalInt32(&callback);
+    signalRx.Reset();
+    appControl.Shutdown();
+}
+
+TEST(VSSComponentTest, RXString)
+{
+    sdv::app::CAppControl appControl;
+
+    auto bResult = InitializeAppControl(&appControl, "data_dispatch_service.toml");
+    ASSERT_EQ(bResult, true);
+
+    sdv::core::CDispatchService dispatch;
+    sdv::core::CSignal signalRx;
+    signalRx = dispatch.RegisterRxSignal(testcase6::dsSignalString);
+    ASSERT_TRUE(signalRx);
+
+    bResult &= appControl.LoadConfig("rxfusedtypestring.toml") == sdv::core::EConfigProcessResult::successful;
+    ASSERT_EQ(bResult, true);
+
+    auto basicService = sdv::core::GetObject("Vehicle.Chassis.Body.String_Service").GetInterface<vss::Vehicle::Chassis::Body::StringService::IVSS_GetSignalTypeString>();
+    ASSERT_TRUE(basicService);
+
+    appControl.SetRunningMode();
+    std::string expected = "some text written";
+    signalRx.Write(expected);
+    expected.append("_string_added");
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    ASSERT_EQ(expected, basicService->GetSignalTypeString());
+
+    signalRx.Reset();
+    appControl.Shutdown();
+}
+
+TEST(VSSComponentTest, RXInt32RegisterWhileWriting)
+{
+    sdv::app::CAppControl appControl;
+
+    auto bResult = InitializeAppControl(&appControl, "data_dispatch_service.toml");
+    ASSERT_EQ(bResult, true);
+
+    sdv::core::CDispatchService dispatch;
+    sdv::core::CSignal signalRx;
+    signalRx = dispatch.RegisterRxSignal(testcase6::dsSignalInt32);
+    ASSERT_TRUE(signalRx);
+
+    bResult &= appControl.LoadConfig("rxfusedtypeint32.toml") == sdv::core::EConfigProcessResult::successful;
+    ASSERT_EQ(bResult, true);
+
+    auto basicService = sdv::core::GetObject("Vehicle.Chassis.Body.Int32_Service").GetInterface<vss::Vehicle::Chassis::Body::Int32Service::IVSS_GetSignalTypeInt32>();
+    ASSERT_TRUE(basicService);
+
+    appControl.SetRunningMode();
+
+    // Write the signal and read the basic service value continuously while registering and unregistering callbacks.
+    std::atomic_bool bStop = false;
+    std::thread threadWrite([&]()
+        {
+            int32_t iValue = 0;
+            while (!bStop)
+            {
+                signalRx.Write(iValue++);
+                basicService->GetSignalTypeInt32();
+                std::this_thread::yield();
+            }
+        });
+
+    bool bCalledAfterUnregister = false;
+    for (size_t n = 0; n < 1000; n++)
+    {
+        auto ptrCallback = std::make_unique<CInt32Callback>();
+        basicService->RegisterOnSignalChangeOfSignalInt32(ptrCallback.get());
+        std::this_thread::yield();
+        basicService->UnregisterOnSignalChangeOfSignalInt32(ptrCallback.get());
+        ptrCallback->m_bUnregistered = true;
+        std::this_thread::yield();
+        bCalledAfterUnregister |= ptrCallback->m_bCalledAfterUnregister;
+    }
+
+    bStop = true;
+    threadWrite.join();
+    EXPECT_FALSE(bCalledAfterUnregister);
+
+    signalRx.Reset();
+    appControl.Shutdown();
+}
+
+extern "C" int main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+
+    return result;
+}
@@ -12,10 +12,15 @@
  ********************************************************************************/
 
 #include "ascreader.h"
+#include "cancapture.h"
+#include "../mapped_file.h"
 #include <iostream>
-#include <fstream>
 #include <string>
 #include <thread>
+#include <charconv>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
 
 #ifdef _WIN32
 #ifndef NOMINMAX
@@ -30,7 +35,104 @@
 
 namespace asc
 {
-    CAscReader::CAscReader() : m_itCurrent(m_lstMessages.begin())
+    namespace
+    {
+        /**
+         * @brief Simple tokenizer splitting a sample line into whitespace separated tokens without copying.
+         */
+        class CTokenizer
+        {
+        public:
+            /**
+             * @brief Constructor
+             * @param[in] ssLine The line to tokenize.
+             */
+            CTokenizer(std::string_view ssLine) : m_ssLine(ssLine)
+            {}
+
+            /**
+             * @brief Get the next token.
+             * @return The next token or an empty string when no more tokens are available.
+             */
+            std::string_view Next()
+            {
+                SkipSpace();
+                size_t nPos = m_nPos;
+                while (m_nPos < m_ssLine.size() && !IsSpace(m_ssLine[m_nPos])) m_nPos++;
+                return m_ssLine.substr(nPos, m_nPos - nPos);
+            }
+
+            /**
+             * @brief Peek at the next character following whitespace.
+             * @return The next non-whitespace character or '\0' when the end of the line has been reached.
+             */
+            char Peek()
+            {
+                SkipSpace();
+                return m_nPos < m_ssLine.size() ? m_ssLine[m_nPos] : '\0';
+            }
+
+        private:
+            /**
+             * @brief Is the character a whitespace character?
+             * @param[in] c The character to check.
+             * @return Returns whether the character is whitespace.
+             */
+            static bool IsSpace(char c)
+            {
+                return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+            }
+
+            /**
+             * @brief Skip whitespace.
+             */
+            void SkipSpace()
+            {
+                while (m_nPos < m_ssLine.size() && IsSpace(m_ssLine[m_nPos])) m_nPos++;
+            }
+
+            std::string_view    m_ssLine;       ///< The line to tokenize.
+            size_t              m_nPos = 0;     ///< The current position within the line.
+        };
+
+        /**
+         * @brief Convert a token to an unsigned number. The complete token must be consumed.
+         * @param[in] ssToken The token.
+         * @param[in] iBase The number base (10 or 16).
+         * @param[out] ruiValue Reference to the value.
+         * @return Returns 'true' on success; 'false' otherwise.
+         */
+        bool ToUInt(std::string_view ssToken, int iBase, uint32_t& ruiValue)
+        {
+            if (ssToken.empty()) return false;
+            auto sResult = std::from_chars(ssToken.data(), ssToken.data() + ssToken.size(), ruiValue, iBase);
+            return sResult.ec == std::errc() && sResult.ptr == ssToken.data() + ssToken.size();
+        }
+
+        /**
+         * @brief Case insensitive comparison of the start of the line.
+         * @param[in] ssLine The line.
+         * @param[in] ssPrefix The prefix to compare with.
+         * @return Returns whether the line starts with the prefix.
+         */
+        bool StartsWithNoCase(std::string_view ssLine, std::string_view ssPrefix)
+        {
+            if (ssLine.size() < ssPrefix.size()) return false;
+            return std::equal(ssPrefix.begin(), ssPrefix.end(), ssLine.begin(), [](char a, char b)
+                { return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b)); });
+        }
+
+        /// Frame flag: extended CAN ID
+        constexpr uint8_t uiFlagExtended = 1;
+
+        /// Frame flag: CAN-FD frame
+        constexpr uint8_t uiFlagCanFd = 2;
+
+        /// Frame flag: TX direction
+        constexpr uint8_t uiFlagTx = 4;
+    }
+
+    CAscReader::CAscReader()
     {}
 
     CAscReader::~CAscReader()
@@ -41,36 +143,46 @@ namespace asc
     bool CAscReader::Read(const std::filesystem::path& rpathFile)
     {
         // Clear current messages
-        m_lstMessages.clear();
+        m_vecFrames.clear();
+        m_vecData.clear();
+        m_ptrCapture.reset();
+        m_vecBlockStart.clear();
+        m_vecBlockFrames.clear();
+        m_nBlock = SIZE_MAX;
         JumpBegin();
 
-        // Open and read the file
-        std::ifstream fstream(rpathFile);
-        if (!fstream.is_open()) return false;
+        // Binary capture file?
+        if (CCaptureReader::IsCaptureFile(rpathFile))
+            return ReadCapture(rpathFile);
+
+        // Map the file into memory; the file content is paged in while parsing and doesn't need to be copied.
+        CMappedFile file;
+        if (!file.Open(rpathFile)) return false;
+        std::string_view ssContent(file.Data() ? file.Data() : "", file.Size());
+
+        // Reserve the frame store based on a typical line length to prevent repeated reallocation for large files.
+        m_vecFrames.reserve(ssContent.size() / 64);
+        m_vecData.reserve(ssContent.size() / 8);
 
-        // Read the file line by line
-        std::string ssLine;
+        // Process the file line by line
         enum class EState {header, body, footer} eState = EState::header;
-        while (std::getline(fstream, ssLine))
+        size_t nPos = 0;
+        while (nPos < ssContent.size() && eState != EState::footer)
         {
-            // Compare two characters and two strings case insensitive
-            auto ichar_equals = [](char a, char b)
-            {
-                return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
-            };
-            auto iequals = [&](const std::string& a, const std::string& b)
-            {
-                return std::equal(a.begin(), a.end(), b.begin(), b.end(), ichar_equals);
-            };
+            const char* szEnd = static_cast<const char*>(std::memchr(ssContent.data() + nPos, '\n', ssContent.size() - nPos));
+            size_t nEnd = szEnd ? static_cast<size_t>(szEnd - ssContent.data()) : ssContent.size();
+            std::string_view ssLine = ssContent.substr(nPos, nEnd - nPos);
+            if (!ssLine.empty() && ssLine.back() == '\r') ssLine.remove_suffix(1);
+            nPos = nEnd + 1;
 
             switch (eState)
             {
             case EState::header:
-                if (iequals(ssLine.substr(0, 18), "Begin TriggerBlock"))
+                if (StartsWithNoCase(ssLine, "Begin TriggerBlock"))
                     eState = EState::body;
                 break;
             case EState::body:
-                if (iequals(ssLine.substr(0, 16), "End TriggerBlock"))
+                if (StartsWithNoCase(ssLine, "End TriggerBlock"))
                     eState = EState::footer;
                 else
                     ProcessSample(ssLine);
@@ -79,9 +191,8 @@ namespace asc
                 break;
             }
         }
-        fstream.close();
 
-        // Set the current iterator
+        // Set the current position
         JumpBegin();
 
         return true;
@@ -89,68 +200,91 @@ namespace asc
 
     std::pair<SCanMessage, bool> CAscReader::Get() const
     {
-        if (m_itCurrent == m_lstMessages.end())
+        SCanMessage sMsg{};
+        if (!GetFrame(m_nCurrent, sMsg))
             return std::make_pair(SCanMessage(), false);
-        else
-            return std::make_pair(*m_itCurrent, true);
+        return std::make_pair(sMsg, true);
     }
 
     uint32_t CAscReader::GetMessageCount() const
     {
-        return static_cast<uint32_t>(m_lstMessages.size());
+        return static_cast<uint32_t>(FrameCount());
     }
 
     uint32_t CAscReader::GetLoopCount() const
     {
         return m_uiLoopCount;
     }
-    
+
     void CAscReader::JumpBegin()
     {
-        m_itCurrent = m_lstMessages.begin();
+        m_nCurrent = 0;
     }
 
     void CAscReader::JumpEnd()
     {
-        m_itCurrent = m_lstMessages.end();
+        m_nCurrent = FrameCount();
+    }
+
+    bool CAscReader::JumpTimestamp(double dTimestamp)
+    {
+        // Capture file: search the block through the index and only decode that block.
+        if (m_ptrCapture)
+        {
+            size_t nBlock = m_ptrCapture->FindBlock(dTimestamp);
+            if (!LoadBlock(nBlock))
+            {
+                JumpEnd();
+                return false;
+            }
+            auto itFrame = std::lower_bound(m_vecBlockFrames.begin(), m_vecBlockFrames.end(), dTimestamp,
+                [](const SCanMessage& rsMsg, double dTime) { return rsMsg.dTimestamp < dTime; });
+            m_nCurrent = m_vecBlockStart[nBlock] + static_cast<size_t>(itFrame - m_vecBlockFrames.begin());
+            return !IsEOF();
+        }
+
+        auto itFrame = std::lower_bound(m_vecFrames.begin(), m_vecFrames.end(), dTimestamp,
+            [](const SFrame& rsFrame, double dTime) { return rsFrame.dTimestamp < dTime; });
+        m_nCurrent = static_cast<size_t>(itFrame - m_vecFrames.begin());
+        return !IsEOF();
     }
 
     CAscReader& CAscReader::operator++()
     {
-        if (m_itCurrent != m_lstMessages.end())
-            ++m_itCurrent;
+        if (m_nCurrent < FrameCount())
+            ++m_nCurrent;
         return *this;
     }
 
     CAscReader& CAscReader::operator++(int)
     {
-        if (m_itCurrent != m_lstMessages.end())
-            ++m_itCurrent;
+        if (m_nCurrent < FrameCount())
+            ++m_nCurrent;
         return *this;
     }
 
     CAscReader& CAscReader::operator--()
     {
-        if (m_itCurrent != m_lstMessages.begin())
-            --m_itCurrent;
+        if (m_nCurrent)
+            --m_nCurrent;
         return *this;
     }
 
     CAscReader& CAscReader::operator--(int)
     {
-        if (m_itCurrent != m_lstMessages.begin())
-            --m_itCurrent;
+        if (m_nCurrent)
+            --m_nCurrent;
         return *this;
     }
 
     bool CAscReader::IsBOF() const
     {
-        return m_itCurrent == m_lstMessages.begin();
+        return m_nCurrent == 0;
     }
 
     bool CAscReader::IsEOF() const
     {
-        return m_itCurrent == m_lstMessages.end();
+        return m_nCurrent >= FrameCount();
     }
 
     void CAscReader::StartPlayback(std::function<void(const SCanMessage&)> fnCallback, bool bRepeat /*= true*/)
@@ -158,7 +292,7 @@ namespace asc
         StopPlayback();
 
         if (!fnCallback) return;
-        if (m_lstMessages.empty()) return;
+        if (!FrameCount()) return;
 
         m_bPlaybackThread = false;
         m_bPlayback = true;
@@ -183,133 +317,196 @@ namespace asc
         return m_bPlayback;
     }
 
-    void CAscReader::ProcessSample(const std::string& rssSample)
+    void CAscReader::SetPlaybackSpeed(double dFactor)
     {
-        std::istringstream sstream(rssSample);
+        m_dSpeed = dFactor > 0.0 ? dFactor : 0.0;
+    }
 
-        SCanMessage sMsg{};
+    double CAscReader::GetPlaybackSpeed() const
+    {
+        return m_dSpeed;
+    }
+
+    bool CAscReader::ReadCapture(const std::filesystem::path& rpathFile)
+    {
+        // Only the index is read; the blocks are decoded on demand.
+        auto ptrCapture = std::make_unique<CCaptureReader>();
+        if (!ptrCapture->Open(rpathFile)) return false;
+        size_t nFrames = 0;
+        for (const SCaptureBlockInfo& rsBlock : ptrCapture->GetBlocks())
+        {
+            m_vecBlockStart.push_back(nFrames);
+            nFrames += rsBlock.uiFrames;
+        }
+        m_ptrCapture = std::move(ptrCapture);
+        JumpBegin();
+        return true;
+    }
+
+    size_t CAscReader::FrameCount() const
+    {
+        return m_ptrCapture ? static_cast<size_t>(m_ptrCapture->GetFrameCount()) : m_vecFrames.size();
+    }
+
+    bool CAscReader::GetFrame(size_t nIndex, SCanMessage& rsMsg) const
+    {
+        if (nIndex >= FrameCount()) return false;
+
+        // Capture file: find the block containing the frame
+        if (m_ptrCapture)
+        {
+            size_t nBlock = static_cast<size_t>(std::upper_bound(m_vecBlockStart.begin(), m_vecBlockStart.end(), nIndex) -
+                m_vecBlockStart.begin()) - 1;
+            if (!LoadBlock(nBlock) || nIndex - m_vecBlockStart[nBlock] >= m_vecBlockFrames.size()) return false;
+            rsMsg = m_vecBlockFrames[nIndex - m_vecBlockStart[nBlock]];
+            return true;
+        }
+
+        const SFrame& rsFrame = m_vecFrames[nIndex];
+        rsMsg.dTimestamp = rsFrame.dTimestamp;
+        rsMsg.uiChannel = rsFrame.uiChannel;
+        rsMsg.uiId = rsFrame.uiId;
+        rsMsg.bExtended = (rsFrame.uiFlags & uiFlagExtended) != 0;
+        rsMsg.bCanFd = (rsFrame.uiFlags & uiFlagCanFd) != 0;
+        rsMsg.eDirection = (rsFrame.uiFlags & uiFlagTx) ? SCanMessage::EDirection::tx : SCanMessage::EDirection::rx;
+        rsMsg.uiLength = rsFrame.uiLength;
+        std::copy_n(m_vecData.begin() + static_cast<ptrdiff_t>(rsFrame.uiDataOffset), rsFrame.uiLength, rsMsg.rguiData);
+        return true;
+    }
+
+    bool CAscReader::LoadBlock(size_t nBlock) const
+    {
+        if (!m_ptrCapture || nBlock >= m_vecBlockStart.size()) return false;
+        if (nBlock == m_nBlock) return true;
+        m_vecBlockFrames.clear();
+        m_nBlock = SIZE_MAX;
+        if (!m_ptrCapture->ReadBlock(nBlock, m_vecBlockFrames))
+        {
+            m_vecBlockFrames.clear();
+            return false;
+        }
+        m_nBlock = nBlock;
+        return true;
+    }
+
+    void CAscReader::ProcessSample(std::string_view ssSample)
+    {
+        CTokenizer tokenizer(ssSample);
+
+        SFrame sFrame{};
 
         // Expecting a time
-        if (!(sstream >> sMsg.dTimestamp))
+        std::string_view ssTimestamp = tokenizer.Next();
+        auto sTimeResult = std::from_chars(ssTimestamp.data(), ssTimestamp.data() + ssTimestamp.size(), sFrame.dTimestamp);
+        if (ssTimestamp.empty() || sTimeResult.ec != std::errc() || sTimeResult.ptr != ssTimestamp.data() + ssTimestamp.size())
             return;  // All usable mesaurements must start with a timestamp
 
-        // Skip whitespace
-        while (std::isspace(sstream.peek())) sstream.get();
+        // Get the message ID in hex format, followed by an optional 'x' for an extended ID.
+        auto fnProcessID = [&]() -> bool
+        {
+            std::string_view ssID = tokenizer.Next();
+            if (!ssID.empty() && std::tolower(static_cast<unsigned char>(ssID.back())) == 'x')
+            {
+                sFrame.uiFlags |= uiFlagExtended;
+                ssID.remove_suffix(1);
+            }
+            if (!ToUInt(ssID, 16, sFrame.uiId))
+                return false; // Expected an ID (otherwise the measurement might contain meta data)
+            if (!(sFrame.uiFlags & uiFlagExtended) && std::tolower(static_cast<unsigned char>(tokenizer.Peek())) == 'x' &&
+                tokenizer.Next().size() == 1)
+                sFrame.uiFlags |= uiFlagExtended;
+            return true;
+        };
+
+        // Determine the direction
+        auto fnProcessDirection = [&]() -> bool
+        {
+            std::string_view ssDirection = tokenizer.Next();
+            if (ssDirection == "Tx")
+                sFrame.uiFlags |= uiFlagTx;
+            else if (ssDirection != "Rx")
+                return false; // Invalid direction
+            return true;
+        };
+
+        // Get the channel
+        auto fnProcessChannel = [&]() -> bool
+        {
+            uint32_t uiChannel = 0;
+            if (!ToUInt(tokenizer.Next(), 10, uiChannel) || uiChannel > 0xffff)
+                return false;  // Expected a channel (otherwise the measurement might contain meta data)
+            sFrame.uiChannel = static_cast<uint16_t>(uiChannel);
+            return true;
+        };
+
+        uint32_t uiLength = 0;
 
         // If the next timestamp is followed by the "CANFD" keyword, the sample is a CAN-FD sample
-        if (std::isalpha(sstream.peek()))
+        if (std::isalpha(static_cast<unsigned char>(tokenizer.Peek())))
         {
-            std::string ssKeyword;
-            if (!(sstream >> ssKeyword))
-                return; // Unexpected
-            if (ssKeyword != "CANFD")
+            if (tokenizer.Next() != "CANFD")
                 return; // Not a CAN-FD sample
-            sMsg.bCanFd = true;
-
-            // Expecting a channel
-            if (!(sstream >> sMsg.uiChannel))
-                return; // Expected a channel (otherwise the measurement might contain meta data)
-
-            // Determine the direction
-            std::string ssDirection;
-            if (!(sstream >> ssDirection))
-                return; // Expected a direction
-            if (ssDirection == "Rx")
-                sMsg.eDirection = SCanMessage::EDirection::rx;
-            else if (ssDirection == "Tx")
-                sMsg.eDirection = SCanMessage::EDirection::tx;
-            else
-                return; // Invalid direction
-
-            // Expecting a message ID in hex format
-            if (!(sstream >> std::hex >> sMsg.uiId))
-                return; // Expected an ID (otherwise the measurement might contain meta data)
-
-            // Skip whitespace
-            while (std::isspace(sstream.peek())) sstream.get();
-
-            // Optional 'x' for an extended ID
-            if (std::tolower(sstream.peek()) == 'x')
-            {
-                sMsg.bExtended = true;
-                sstream.get();  // Skip the character, since already processed
-            }
+            sFrame.uiFlags |= uiFlagCanFd;
+
+            if (!fnProcessChannel() || !fnProcessDirection() || !fnProcessID())
+                return;
 
             // Get bit rate switch (BRS)
-            size_t nBRS = 0;
-            if (!(sstream >> nBRS) || nBRS > 1)
+            uint32_t uiBRS = 0;
+            if (!ToUInt(tokenizer.Next(), 16, uiBRS) || uiBRS > 1)
                 return; // Unexpected or invalid BRS
 
             // Get error state indicator (ESI)
-            size_t nESI = 0;
-            if (!(sstream >> nESI) || nESI > 1)
+            uint32_t uiESI = 0;
+            if (!ToUInt(tokenizer.Next(), 16, uiESI) || uiESI > 1)
                 return; // Unexpected or invalid ESI
 
-            // Get data length code (DLC)
-            size_t nDLC;
-            if (!(sstream >> nDLC) || nDLC > 15)
-                return; // Unexpected or invalid DLC
+            // Get data length code (DLC); decimal, or a single hexadecimal digit as written by some tools.
+            uint32_t uiDLC = 0;
+            std::string_view ssDLC = tokenizer.Next();
+            if (!ToUInt(ssDLC, 10, uiDLC) && (ssDLC.size() != 1 || !ToUInt(ssDLC, 16, uiDLC)))
+                return; // Unexpected DLC
+            if (uiDLC > 15)
+                return; // Invalid DLC
 
             // Get the data length
-            if (!(sstream >> std::dec >> sMsg.uiLength) || sMsg.uiLength > 64)
+            if (!ToUInt(tokenizer.Next(), 10, uiLength) || uiLength > 64)
                 return; // Length expected or invalid length
 
             // Check for proper DLC vs. length
-            const size_t rgnDLCLength[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
-            if (rgnDLCLength[nDLC] != sMsg.uiLength) return; // Invalid length
+            const uint32_t rguiDLCLength[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+            if (rguiDLCLength[uiDLC] != uiLength) return; // Invalid length
         }
         else // standard CAN
         {
-            // Expecting a channel
-            if (!(sstream >> sMsg.uiChannel))
-                return; // Expected a channel (otherwise the measurement might contain meta data)
-
-            // Expecting a message ID in hex format
-            if (!(sstream >> std::hex >> sMsg.uiId))
-                return; // Expected an ID (otherwise the measurement might contain meta data)
-
-            // Skip whitespace
-            while (std::isspace(sstream.peek())) sstream.get();
-
-            // Optional 'x' for an extended ID
-            if (std::tolower(sstream.peek()) == 'x')
-            {
-                sMsg.bExtended = true;
-                sstream.get();  // Skip the character, since already processed
-            }
-
-            // Determine the direction
-            std::string ssDirection;
-            if (!(sstream >> ssDirection))
-                return; // Expected a direction
-            if (ssDirection == "Rx")
-                sMsg.eDirection = SCanMessage::EDirection::rx;
-            else if (ssDirection == "Tx")
-                sMsg.eDirection = SCanMessage::EDirection::tx;
-            else
-                return; // Invalid direction
+            if (!fnProcessChannel() || !fnProcessID() || !fnProcessDirection())
+                return;
 
             // Determine whether the measurement contains data from a data frame (remote frames are not processed).
-            char cLocation = '\0';
-            if (!(sstream >> cLocation) || std::tolower(cLocation) != 'd')
+            std::string_view ssLocation = tokenizer.Next();
+            if (ssLocation.size() != 1 || std::tolower(static_cast<unsigned char>(ssLocation[0])) != 'd')
                 return; // Not supported location
 
             // Get the data length
-            if (!(sstream >> std::dec >> sMsg.uiLength) || sMsg.uiLength > 8)
+            if (!ToUInt(tokenizer.Next(), 10, uiLength) || uiLength > 8)
                 return; // Length expected or invalid length
         }
 
         // Read the data
-        for (uint32_t uiIndex = 0; uiIndex < sMsg.uiLength; uiIndex++)
+        uint8_t rguiData[64] = {};
+        for (uint32_t uiIndex = 0; uiIndex < uiLength; uiIndex++)
         {
             uint32_t uiVal = 0;
-            if (!(sstream >> std::hex >> uiVal))
+            if (!ToUInt(tokenizer.Next(), 16, uiVal))
                 return; // Expected data byte
-            sMsg.rguiData[uiIndex] = static_cast<uint8_t>(uiVal);
+            rguiData[uiIndex] = static_cast<uint8_t>(uiVal);
         }
 
-        // Add the message to the vector
-        m_lstMessages.push_back(std::move(sMsg));
+        // Add the frame to the frame store
+        sFrame.uiLength = static_cast<uint8_t>(uiLength);
+        sFrame.uiDataOffset = m_vecData.size();
+        m_vecData.insert(m_vecData.end(), rguiData, rguiData + uiLength);
+        m_vecFrames.push_back(sFrame);
 
         // Ignore the rest of the line (additional information could have been logged).
     }
@@ -330,65 +527,61 @@ namespace asc
 
         // Indicate that playback thread has started.
         m_bPlaybackThread = true;
-        // when data set is repeated, we need the offset compared to the first run
-        double dLoopOffset = 0.00000;
 
         // Define the offset
         double dOffset = 0.00000;
         if (!IsBOF())
         {
-            operator--();
-            auto prSample = Get();
-            if (!prSample.second)
+            if (IsEOF() && !bRepeat)
             {
                 m_bPlayback = false;
-                std::cout << "ASC PLAYBACK: Unexpected situation. Not BOF, but also no previous sample." << std::endl;
-                return;    // Should not occur
+                return;     // Nothing to do
             }
-            dOffset = prSample.first.dTimestamp;
-            operator++();
+            SCanMessage sPrevious{};
+            if (!IsEOF() && GetFrame(m_nCurrent - 1, sPrevious))
+                dOffset = sPrevious.dTimestamp;
         }
 
+        // The playback is scheduled against the start of the current loop. Sleeping is done up to shortly before the sample is
+        // due; the remaining time is spent yielding to achieve an accurate send time without occupying the processor.
+        const double dSpeed = m_dSpeed;
+        const auto durationSpin = std::chrono::microseconds(500);
+        const auto durationMaxSleep = std::chrono::milliseconds(10);    // Allows stopping the playback in time
         loopCount++;
-        auto timepointStartOfFirstLoop = std::chrono::high_resolution_clock::now();
-        auto timepointStart = std::chrono::high_resolution_clock::now();
+        auto timepointStart = std::chrono::steady_clock::now();
         while (m_bPlayback)
         {
             if (IsEOF())
             {
                 if (!bRepeat) break;    // Done
 
-                // Data set will be repeated, callculate offset compared to the first run
-                auto timepointStartOfNextLoop = std::chrono::high_resolution_clock::now();
-                dLoopOffset = std::chrono::duration<double>(timepointStartOfNextLoop - timepointStartOfFirstLoop).count();
-
-                // Restart
-                loopCount++;                
+                // Restart; the data set will be repeated relative to the current time.
+                loopCount++;
                 dOffset = 0.00000;
+                timepointStart = std::chrono::steady_clock::now();
                 JumpBegin();
             }
 
             // Get a sample
             auto prSample = Get();
-            if (!prSample.second) 
+            if (!prSample.second)
                 break;    // Should not occur
 
-            // Need to sleep?
-            while (m_bPlayback)
+            // Need to wait?
+            if (dSpeed > 0.0)
             {
-                // Determine the current time relative to start time.
-                auto timepoint = std::chrono::high_resolution_clock::now();
-                double dTime = std::chrono::duration<double>(timepoint - timepointStart).count() + dOffset;
-
-                // If the sample is overdue... do not sleep
-                if ((prSample.first.dTimestamp + dLoopOffset) < dTime) 
-                    break;
-
-                // If the sample will be overdue in 10 ms, yield the current thread only (this will not put the thread in idle mode).
-                //if (prSample.first.dTimestamp < dTime + 0.010)
-                //    std::this_thread::yield();
-                //else // Sleep shortly... this might cause a sleep of more than 1ms dependable on the load of the system
-                std::this_thread::sleep_for(std::chrono::milliseconds(0));
+                auto timepointDue = timepointStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>((prSample.first.dTimestamp - dOffset) / dSpeed));
+                while (m_bPlayback)
+                {
+                    auto timepoint = std::chrono::steady_clock::now();
+                    if (timepoint >= timepointDue) break;   // Sample is due
+                    if (timepointDue - timepoint > durationSpin)
+                        std::this_thread::sleep_until(std::min(timepointDue - durationSpin, timepoint + durationMaxSleep));
+                    else
+                        std::this_thread::yield();
+                }
+                if (!m_bPlayback) break;
             }
 
             // Send the sample
@@ -14,11 +14,14 @@
 #ifndef ASC_FILE_READER_H
 #define ASC_FILE_READER_H
 
-#include <list>
+#include <cstdint>
+#include <vector>
+#include <string_view>
 #include <functional>
 #include <filesystem>
 #include <thread>
 #include <atomic>
+#include <memory>
 
 namespace asc
 {
@@ -39,6 +42,8 @@ namespace asc
         uint8_t     rguiData[64];                       ///< Array with the CAN data.
     };
 
+    class CCaptureReader;
+
     /**
      * @brief This class allows reading the Vector ASC file format.
      * @attention This class assumes no concurrency between reading a file, navigation and playback. No thread synchronization is
@@ -59,6 +64,9 @@ namespace asc
 
         /**
          * @brief Read a file (this will replace the current samples with the samples of the file).
+         * @remarks Besides the ASC format, the binary capture format (see cancapture.h) is supported as well. The format is
+         * detected by the file header. Of a capture file only the index is read; the blocks are decoded when accessed, so corrupt
+         * blocks cause Get to return an invalid sample.
          * @param[in] rpathFile Reference to the file path.
          * @return Returns 'true' on success or 'false' when not.
         */
@@ -92,6 +100,13 @@ namespace asc
          */
         void JumpEnd();
 
+        /**
+         * @brief Jump to the first sample with a timestamp equal or larger than the provided timestamp.
+         * @param[in] dTimestamp The timestamp in seconds.
+         * @return Returns 'true' when a sample was found; 'false' when the position was set beyond the last sample.
+         */
+        bool JumpTimestamp(double dTimestamp);
+
         /**
          * @{
          * @brief Increase the current position to the next sample.
@@ -150,7 +165,60 @@ namespace asc
          */
         bool PlaybackRunning() const;
 
+        /**
+         * @brief Set the playback speed. The speed is applied when the playback is started.
+         * @param[in] dFactor The speed factor relative to the original recording time (e.g. 2.0 plays back twice as fast, 0.5
+         * with half the speed). A factor of 0.0 (or less) plays back the samples as fast as possible without any waiting.
+         */
+        void SetPlaybackSpeed(double dFactor);
+
+        /**
+         * @brief Get the playback speed.
+         * @return The speed factor relative to the original recording time; 0.0 when playing back as fast as possible.
+         */
+        double GetPlaybackSpeed() const;
+
     private:
+        /**
+         * @brief Read a binary capture file.
+         * @param[in] rpathFile Reference to the file path.
+         * @return Returns 'true' on success or 'false' when not.
+         */
+        bool ReadCapture(const std::filesystem::path& rpathFile);
+
+        /**
+         * @brief Get the amount of frames of the data set.
+         * @return The amount of frames.
+         */
+        size_t FrameCount() const;
+
+        /**
+         * @brief Get a frame.
+         * @param[in] nIndex The index of the frame.
+         * @param[out] rsMsg Reference to the message receiving the frame.
+         * @return Returns 'true' on success; 'false' when the index is invalid or the frame could not be decoded.
+         */
+        bool GetFrame(size_t nIndex, SCanMessage& rsMsg) const;
+
+        /**
+         * @brief Decode a block of the capture file unless it is the currently decoded block.
+         * @param[in] nBlock The index of the block.
+         * @return Returns 'true' when the block is available in the block cache; 'false' when not.
+         */
+        bool LoadBlock(size_t nBlock) const;
+
+        /**
+         * @brief Compact frame information stored for each sample. The data bytes are stored in a separate contiguous buffer.
+         */
+        struct SFrame
+        {
+            double      dTimestamp;                     ///< Timestamp in seconds
+            uint64_t    uiDataOffset;                   ///< Offset of the data within the data buffer.
+            uint32_t    uiId;                           ///< CAN ID
+            uint16_t    uiChannel;                      ///< CAN channel
+            uint8_t     uiLength;                       ///< Length of the CAN data.
+            uint8_t     uiFlags;                        ///< Combination of the flags: 1 = extended, 2 = CAN-FD, 4 = TX
+        };
         /**
          * @brief Process a measurement value sample (one line within the ASC trigger block section).
          * @details The ASC measurement uses the following format for one CAN measurement value:
@@ -160,9 +228,9 @@ namespace asc
          * For CAN-FD: Timestamp CANFD <channel> <dir> <id> <brs> <esi> <dlc> <data_len> <data> [ ... ] 
          * \endverbatim
          * 
-         * @param[in] rssSample Reference to the measurement value sample.
+         * @param[in] ssSample The measurement value sample (without line ending).
          */
-        void ProcessSample(const std::string& rssSample);
+        void ProcessSample(std::string_view ssSample);
 
         /**
          * @brief Playback thread function. If the current position is BOF, the playback starts from time = 0.0000, otherwise the
@@ -170,8 +238,14 @@ namespace asc
          */
         void PlaybackThreadFunc(std::function<void(const SCanMessage&)> fnCallback, std::atomic<uint32_t>& loopCount, bool bRepeat);
 
-        std::list<SCanMessage>              m_lstMessages;                  ///< Vector with messages
-        std::list<SCanMessage>::iterator    m_itCurrent;                    ///< Current iterator position
+        std::vector<SFrame>                 m_vecFrames;                    ///< Vector with the frames
+        std::vector<uint8_t>                m_vecData;                      ///< Data bytes of all frames
+        std::unique_ptr<CCaptureReader>     m_ptrCapture;                   ///< Capture file reader (when reading a capture file)
+        std::vector<size_t>                 m_vecBlockStart;                ///< Index of the first frame of each capture block
+        mutable size_t                      m_nBlock = SIZE_MAX;            ///< Index of the decoded capture block
+        mutable std::vector<SCanMessage>    m_vecBlockFrames;               ///< Frames of the decoded capture block
+        size_t                              m_nCurrent = 0;                 ///< Current position
+        double                              m_dSpeed = 1.0;                 ///< Playback speed factor (0.0 = fast as possible)
         std::thread                         m_threadPlayback;               ///< Playback thread.
         std::atomic_bool                    m_bPlaybackThread = false;      ///< Set when running playback thread
         std::atomic_bool                    m_bPlayback = false;            ///< Set when running playback
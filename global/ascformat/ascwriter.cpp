@@ -12,6 +12,7 @@
  ********************************************************************************/
 
 #include "ascwriter.h"
+#include "cancapture.h"
 #include <fstream>
 
 namespace asc
@@ -56,6 +57,16 @@ namespace asc
 
     bool CAscWriter::Write(const std::filesystem::path& rpathFile)
     {
+        // Binary capture format
+        if (rpathFile.extension() == szCaptureExtension)
+        {
+            CCaptureWriter writer;
+            if (!writer.Open(rpathFile)) return false;
+            for (const SCanMessage& rsSample : m_lstMessages)
+                writer.Add(rsSample);
+            return writer.Close();
+        }
+
         // Open and write the file
         std::ofstream fstream(rpathFile, std::ios::out | std::ios::trunc);
         if (!fstream.is_open()) return false;
@@ -75,18 +86,18 @@ namespace asc
             fstream << std::string(11ull - sstreamTimestamp.str().length(), ' ') << sstreamTimestamp.str();
             if (rsSample.bCanFd)
             {
-                fstream << " " << "CANFD" << " " << rsSample.uiChannel << " " <<
-                    (rsSample.eDirection == SCanMessage::EDirection::rx ? "Rx" : "Tx") <<
+                fstream << " " << "CANFD" << " " << std::dec << rsSample.uiChannel << " " <<
+                    (rsSample.eDirection == SCanMessage::EDirection::rx ? "Rx" : "Tx") << " " <<
                     std::hex << std::uppercase << rsSample.uiId << (rsSample.bExtended ? "x" : "") << " 1 0 ";
                 const size_t rgnDLCLength[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
                 size_t nDLC = 0;
                 for (size_t n = 0; n < 16; n++)
                     if (rgnDLCLength[n] == rsSample.uiLength) nDLC = n;
-                fstream << nDLC << " " << rsSample.uiLength;
+                fstream << std::dec << nDLC << " " << rsSample.uiLength;
             }
             else // Normal CAN
             {
-                fstream << " " << rsSample.uiChannel;
+                fstream << " " << std::dec << rsSample.uiChannel;
                 std::stringstream sstreamID;
                 sstreamID << std::hex << std::uppercase << rsSample.uiId;
                 fstream << "  " << sstreamID.str() << (rsSample.bExtended ? "x" : "");
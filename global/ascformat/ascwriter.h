@@ -60,6 +60,8 @@ namespace asc
 
         /**
          * @brief Write to a file (the file gets overwritten if existing).
+         * @remarks Files with the extension of the binary capture format (".cancap") are written in the binary capture format;
+         * all other files are written in the ASC format.
          * @param[in] rpathFile Reference to the file path.
          * @return Returns 'true' on success or 'false' when not.
          */
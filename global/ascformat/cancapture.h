@@ -0,0 +1,722 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef CAN_CAPTURE_H
+#define CAN_CAPTURE_H
+
+#include "ascreader.h"
+#include "../mapped_file.h"
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @brief Binary CAN capture format.
+ * @details The capture file is a compact alternative to the ASC format, which can be written at full bus load and which allows
+ * jumping to a timestamp without scanning the complete file. All values are stored in little endian byte order.
+ *
+ * \verbatim
+ * File header      "SDVCAN01", uint32 version, uint32 reserved
+ * Block 0..n       SBlockHeader followed by the (compressed) frame data
+ * Index            uint32 magic "CIDX", uint32 block count, block index entries (offset, first/last timestamp, frame count),
+ *                  uint32 ID count, ID index entries (channel, ID, frame count, block count, block indices)
+ * Trailer          uint64 index offset, "SDVCANIX"
+ * \endverbatim
+ *
+ * The frames within a block are stored with the timestamp relative to the previous frame (in nanoseconds), the channel and the
+ * ID as variable length integers followed by the flags, the length and the data. The block data is compressed using a simple LZ77
+ * compression, which takes advantage of the highly repetitive nature of CAN traffic.
+ */
+namespace asc
+{
+    /// File extension used for the binary capture format.
+    inline constexpr const char szCaptureExtension[] = ".cancap";
+
+    namespace capture
+    {
+        /// File header magic.
+        inline constexpr const char szFileMagic[8] = { 'S', 'D', 'V', 'C', 'A', 'N', '0', '1' };
+
+        /// File trailer magic.
+        inline constexpr const char szTrailerMagic[8] = { 'S', 'D', 'V', 'C', 'A', 'N', 'I', 'X' };
+
+        /// Block header magic ("CBLK").
+        inline constexpr uint32_t uiBlockMagic = 0x4b4c4243;
+
+        /// Index magic ("CIDX").
+        inline constexpr uint32_t uiIndexMagic = 0x58444943;
+
+        /// Format version.
+        inline constexpr uint32_t uiVersion = 1;
+
+        /// Block flag: the block data is compressed.
+        inline constexpr uint32_t uiBlockCompressed = 1;
+
+        /// Extended ID flag within the ID index.
+        inline constexpr uint32_t uiIdExtended = 0x80000000;
+
+        /**
+         * @brief Block header preceding the block data.
+         */
+        struct SBlockHeader
+        {
+            uint32_t    uiMagic;                ///< Block magic
+            uint32_t    uiFlags;                ///< Block flags
+            uint32_t    uiFrames;               ///< Amount of frames within the block.
+            uint32_t    uiRawSize;              ///< Size of the uncompressed block data.
+            uint32_t    uiStoredSize;           ///< Size of the stored block data.
+            uint32_t    uiReserved;             ///< Reserved; set to 0.
+            int64_t     iFirstTime;             ///< Timestamp of the first frame in nanoseconds.
+            int64_t     iLastTime;              ///< Timestamp of the last frame in nanoseconds.
+        };
+
+        /**
+         * @brief Append a POD value to a buffer.
+         * @tparam TValue Type of the value.
+         * @param[in, out] rssBuffer Reference to the buffer.
+         * @param[in] tValue The value to append.
+         */
+        template <typename TValue>
+        inline void Append(std::string& rssBuffer, const TValue& tValue)
+        {
+            rssBuffer.append(reinterpret_cast<const char*>(&tValue), sizeof(TValue));
+        }
+
+        /**
+         * @brief Extract a POD value from a buffer.
+         * @tparam TValue Type of the value.
+         * @param[in, out] rpData Reference to the current read position; will be incremented.
+         * @param[in] pEnd The end of the buffer.
+         * @param[out] rtValue Reference to the value.
+         * @return Returns 'true' when the value could be read; 'false' when the buffer is too small.
+         */
+        template <typename TValue>
+        inline bool Extract(const char*& rpData, const char* pEnd, TValue& rtValue)
+        {
+            if (static_cast<size_t>(pEnd - rpData) < sizeof(TValue)) return false;
+            std::memcpy(&rtValue, rpData, sizeof(TValue));
+            rpData += sizeof(TValue);
+            return true;
+        }
+
+        /**
+         * @brief Append a variable length integer (7 bits per byte).
+         * @param[in, out] rssBuffer Reference to the buffer.
+         * @param[in] uiValue The value to append.
+         */
+        inline void AppendVarInt(std::string& rssBuffer, uint64_t uiValue)
+        {
+            while (uiValue >= 0x80)
+            {
+                rssBuffer.push_back(static_cast<char>((uiValue & 0x7f) | 0x80));
+                uiValue >>= 7;
+            }
+            rssBuffer.push_back(static_cast<char>(uiValue));
+        }
+
+        /**
+         * @brief Extract a variable length integer.
+         * @param[in, out] rpData Reference to the current read position; will be incremented.
+         * @param[in] pEnd The end of the buffer.
+         * @param[out] ruiValue Reference to the value.
+         * @return Returns 'true' when the value could be read; 'false' when the buffer is too small or the value invalid.
+         */
+        inline bool ExtractVarInt(const char*& rpData, const char* pEnd, uint64_t& ruiValue)
+        {
+            ruiValue = 0;
+            for (uint32_t uiShift = 0; uiShift < 64; uiShift += 7)
+            {
+                if (rpData == pEnd) return false;
+                uint8_t uiByte = static_cast<uint8_t>(*rpData++);
+                ruiValue |= static_cast<uint64_t>(uiByte & 0x7f) << uiShift;
+                if (!(uiByte & 0x80)) return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Convert a timestamp in seconds to nanoseconds.
+         * @param[in] dTimestamp The timestamp in seconds.
+         * @return The timestamp in nanoseconds.
+         */
+        inline int64_t ToNanoseconds(double dTimestamp)
+        {
+            return static_cast<int64_t>(std::llround(dTimestamp * 1e9));
+        }
+
+        /**
+         * @brief Convert a timestamp in nanoseconds to seconds.
+         * @param[in] iTimestamp The timestamp in nanoseconds.
+         * @return The timestamp in seconds.
+         */
+        inline double ToSeconds(int64_t iTimestamp)
+        {
+            return static_cast<double>(iTimestamp) / 1e9;
+        }
+
+        /**
+         * @brief Append a length using the LZ length extension (additional bytes of 255 followed by the remainder).
+         * @param[in, out] rssBuffer Reference to the buffer.
+         * @param[in] nLength The length minus the part stored in the token.
+         */
+        inline void AppendLZLength(std::string& rssBuffer, size_t nLength)
+        {
+            while (nLength >= 255)
+            {
+                rssBuffer.push_back(static_cast<char>(255));
+                nLength -= 255;
+            }
+            rssBuffer.push_back(static_cast<char>(nLength));
+        }
+
+        /**
+         * @brief Compress data using a simple LZ77 scheme. Each sequence consists of a token (high nibble literal length, low
+         * nibble match length - 4), the literals, a 16-bit match offset and optional length extensions. The last sequence only
+         * contains literals.
+         * @param[in] pData Pointer to the data.
+         * @param[in] nSize Size of the data.
+         * @param[out] rssCompressed Reference to the buffer receiving the compressed data.
+         */
+        inline void CompressLZ(const char* pData, size_t nSize, std::string& rssCompressed)
+        {
+            rssCompressed.clear();
+            rssCompressed.reserve(nSize / 2);
+            const size_t nMinMatch = 4;
+            std::vector<uint32_t> vecHashTable(4096, 0);   // Position + 1; 0 = empty
+            auto fnRead32 = [&](size_t nPos) { uint32_t uiValue = 0; std::memcpy(&uiValue, pData + nPos, 4); return uiValue; };
+            auto fnEmit = [&](size_t nLiteralPos, size_t nLiteralLen, size_t nOffset, size_t nMatchLen)
+            {
+                size_t nMatchCode = nMatchLen ? nMatchLen - nMinMatch : 0;
+                rssCompressed.push_back(static_cast<char>((std::min<size_t>(nLiteralLen, 15) << 4) | std::min<size_t>(nMatchCode, 15)));
+                if (nLiteralLen >= 15) AppendLZLength(rssCompressed, nLiteralLen - 15);
+                rssCompressed.append(pData + nLiteralPos, nLiteralLen);
+                if (!nMatchLen) return;
+                rssCompressed.push_back(static_cast<char>(nOffset & 0xff));
+                rssCompressed.push_back(static_cast<char>(nOffset >> 8));
+                if (nMatchCode >= 15) AppendLZLength(rssCompressed, nMatchCode - 15);
+            };
+
+            size_t nAnchor = 0, nPos = 0;
+            while (nPos + nMinMatch <= nSize)
+            {
+                uint32_t uiSequence = fnRead32(nPos);
+                uint32_t& ruiEntry = vecHashTable[(uiSequence * 2654435761u) >> 20];
+                size_t nCandidate = ruiEntry;
+                ruiEntry = static_cast<uint32_t>(nPos + 1);
+                if (nCandidate && nPos - (nCandidate - 1) <= 0xffff && fnRead32(nCandidate - 1) == uiSequence)
+                {
+                    size_t nMatchPos = nCandidate - 1;
+                    size_t nMatchLen = nMinMatch;
+                    while (nPos + nMatchLen < nSize && pData[nMatchPos + nMatchLen] == pData[nPos + nMatchLen]) nMatchLen++;
+                    fnEmit(nAnchor, nPos - nAnchor, nPos - nMatchPos, nMatchLen);
+                    nPos += nMatchLen;
+                    nAnchor = nPos;
+                    continue;
+                }
+                nPos++;
+            }
+            fnEmit(nAnchor, nSize - nAnchor, 0, 0);
+        }
+
+        /**
+         * @brief Decompress data compressed with CompressLZ.
+         * @param[in] pData Pointer to the compressed data.
+         * @param[in] nSize Size of the compressed data.
+         * @param[in] nRawSize Size of the uncompressed data.
+         * @param[out] rssRaw Reference to the buffer receiving the uncompressed data.
+         * @return Returns 'true' on success; 'false' when the compressed data is invalid.
+         */
+        inline bool DecompressLZ(const char* pData, size_t nSize, size_t nRawSize, std::string& rssRaw)
+        {
+            rssRaw.clear();
+            rssRaw.reserve(nRawSize);
+            const char* pEnd = pData + nSize;
+            auto fnReadLength = [&](size_t& rnLength) -> bool
+            {
+                uint8_t uiByte = 255;
+                while (uiByte == 255)
+                {
+                    if (pData == pEnd) return false;
+                    uiByte = static_cast<uint8_t>(*pData++);
+                    rnLength += uiByte;
+                }
+                return true;
+            };
+            while (pData < pEnd)
+            {
+                uint8_t uiToken = static_cast<uint8_t>(*pData++);
+                size_t nLiteralLen = uiToken >> 4;
+                if (nLiteralLen == 15 && !fnReadLength(nLiteralLen)) return false;
+                if (static_cast<size_t>(pEnd - pData) < nLiteralLen || rssRaw.size() + nLiteralLen > nRawSize) return false;
+                rssRaw.append(pData, nLiteralLen);
+                pData += nLiteralLen;
+                if (pData == pEnd) break;   // Last sequence
+
+                if (pEnd - pData < 2) return false;
+                size_t nOffset = static_cast<uint8_t>(pData[0]) | (static_cast<size_t>(static_cast<uint8_t>(pData[1])) << 8);
+                pData += 2;
+                size_t nMatchLen = uiToken & 0x0f;
+                if (nMatchLen == 15 && !fnReadLength(nMatchLen)) return false;
+                nMatchLen += 4;
+                if (!nOffset || nOffset > rssRaw.size() || rssRaw.size() + nMatchLen > nRawSize) return false;
+                size_t nMatchPos = rssRaw.size() - nOffset;
+                for (size_t n = 0; n < nMatchLen; n++)   // Byte by byte; the match might overlap
+                    rssRaw.push_back(rssRaw[nMatchPos + n]);
+            }
+            return rssRaw.size() == nRawSize;
+        }
+    } // namespace capture
+
+    /**
+     * @brief Block information of the capture file index.
+     */
+    struct SCaptureBlockInfo
+    {
+        uint64_t    uiOffset;                   ///< File offset of the block header.
+        double      dFirstTimestamp;            ///< Timestamp of the first frame in the block.
+        double      dLastTimestamp;             ///< Timestamp of the last frame in the block.
+        uint32_t    uiFrames;                   ///< Amount of frames within the block.
+    };
+
+    /**
+     * @brief Channel/ID information of the capture file index.
+     */
+    struct SCaptureIdInfo
+    {
+        uint32_t                uiChannel;      ///< CAN channel
+        uint32_t                uiId;           ///< CAN ID
+        bool                    bExtended;      ///< Set when the CAN ID is extended.
+        uint32_t                uiFrames;       ///< Amount of frames with this channel and ID.
+        std::vector<uint32_t>   vecBlocks;      ///< Indices of the blocks containing frames with this channel and ID.
+    };
+
+    /**
+     * @brief Writer of the binary capture format. The frames are written block by block while recording; only the frames of the
+     * current block are kept in memory.
+     * @attention This class assumes no concurrency between adding frames and closing the file. No thread synchronization is
+     * implemented.
+     */
+    class CCaptureWriter
+    {
+    public:
+        /**
+         * @brief Default constructor.
+         */
+        CCaptureWriter() = default;
+
+        /**
+         * @brief Destructor; finalizes the file.
+         */
+        ~CCaptureWriter()
+        {
+            Close();
+        }
+
+        /**
+         * @brief Create the capture file (the file gets overwritten if existing).
+         * @param[in] rpathFile Reference to the file path.
+         * @param[in] uiBlockFrames The maximum amount of frames per block. Smaller blocks allow more precise seeking; larger blocks
+         * compress better.
+         * @return Returns 'true' on success or 'false' when not.
+         */
+        bool Open(const std::filesystem::path& rpathFile, uint32_t uiBlockFrames = 4096)
+        {
+            Close();
+            m_fstream.open(rpathFile, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!m_fstream.is_open()) return false;
+            m_uiBlockFrames = uiBlockFrames ? uiBlockFrames : 4096;
+            m_timepointStart = std::chrono::high_resolution_clock::now();
+
+            std::string ssHeader(capture::szFileMagic, sizeof(capture::szFileMagic));
+            capture::Append(ssHeader, capture::uiVersion);
+            capture::Append(ssHeader, uint32_t(0));
+            m_fstream.write(ssHeader.data(), static_cast<std::streamsize>(ssHeader.size()));
+            m_uiOffset = ssHeader.size();
+            return m_fstream.good();
+        }
+
+        /**
+         * @brief Is the file opened?
+         * @return Returns whether the file is opened.
+         */
+        bool IsOpen() const
+        {
+            return m_fstream.is_open();
+        }
+
+        /**
+         * @brief Add a frame.
+         * @attention The frame will not be added if the timestamp is smaller than the timestamp of the last frame.
+         * @param[in] rsSample Reference to the CAN sample structure.
+         * @param[in] bTimestampNow When set, the timestamp of the sample is ignored and the time elapsed since opening the file is
+         * used instead.
+         */
+        void Add(const SCanMessage& rsSample, bool bTimestampNow = false)
+        {
+            if (!IsOpen()) return;
+            int64_t iTimestamp = bTimestampNow ?
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() -
+                    m_timepointStart).count() :
+                capture::ToNanoseconds(rsSample.dTimestamp);
+            if (m_uiFrames && iTimestamp < m_iLastTime) return;
+            uint32_t uiLength = std::min<uint32_t>(rsSample.uiLength, 64);
+
+            // Encode the frame
+            if (!m_uiBlockFramesCurrent) m_iBlockFirstTime = iTimestamp;
+            capture::AppendVarInt(m_ssBlock, static_cast<uint64_t>(iTimestamp - (m_uiBlockFramesCurrent ? m_iLastTime :
+                m_iBlockFirstTime)));
+            capture::AppendVarInt(m_ssBlock, rsSample.uiChannel);
+            capture::AppendVarInt(m_ssBlock, (static_cast<uint64_t>(rsSample.uiId) << 1) | (rsSample.bExtended ? 1 : 0));
+            m_ssBlock.push_back(static_cast<char>((rsSample.bCanFd ? 1 : 0) |
+                (rsSample.eDirection == SCanMessage::EDirection::tx ? 2 : 0)));
+            m_ssBlock.push_back(static_cast<char>(uiLength));
+            m_ssBlock.append(reinterpret_cast<const char*>(rsSample.rguiData), uiLength);
+            m_iLastTime = iTimestamp;
+            m_uiFrames++;
+            m_uiBlockFramesCurrent++;
+
+            // Update the ID index
+            SCaptureIdInfo& rsIdInfo = m_mapIds[std::make_pair(rsSample.uiChannel, rsSample.uiId |
+                (rsSample.bExtended ? capture::uiIdExtended : 0))];
+            rsIdInfo.uiChannel = rsSample.uiChannel;
+            rsIdInfo.uiId = rsSample.uiId;
+            rsIdInfo.bExtended = rsSample.bExtended;
+            rsIdInfo.uiFrames++;
+            uint32_t uiBlock = static_cast<uint32_t>(m_vecBlocks.size());
+            if (rsIdInfo.vecBlocks.empty() || rsIdInfo.vecBlocks.back() != uiBlock)
+                rsIdInfo.vecBlocks.push_back(uiBlock);
+
+            if (m_uiBlockFramesCurrent >= m_uiBlockFrames) FlushBlock();
+        }
+
+        /**
+         * @brief Get the amount of frames written.
+         * @return The amount of frames.
+         */
+        uint64_t GetFrameCount() const
+        {
+            return m_uiFrames;
+        }
+
+        /**
+         * @brief Write the last block and the index and close the file.
+         * @return Returns 'true' when the file was written successfully; 'false' when not or when the file was not opened.
+         */
+        bool Close()
+        {
+            if (!IsOpen()) return false;
+            FlushBlock();
+
+            // Block index
+            std::string ssIndex;
+            capture::Append(ssIndex, capture::uiIndexMagic);
+            capture::Append(ssIndex, static_cast<uint32_t>(m_vecBlocks.size()));
+            for (const SCaptureBlockInfo& rsBlock : m_vecBlocks)
+            {
+                capture::Append(ssIndex, rsBlock.uiOffset);
+                capture::Append(ssIndex, capture::ToNanoseconds(rsBlock.dFirstTimestamp));
+                capture::Append(ssIndex, capture::ToNanoseconds(rsBlock.dLastTimestamp));
+                capture::Append(ssIndex, rsBlock.uiFrames);
+                capture::Append(ssIndex, uint32_t(0));
+            }
+
+            // ID index
+            capture::Append(ssIndex, static_cast<uint32_t>(m_mapIds.size()));
+            for (const auto& rvtId : m_mapIds)
+            {
+                capture::Append(ssIndex, rvtId.first.first);
+                capture::Append(ssIndex, rvtId.first.second);
+                capture::Append(ssIndex, rvtId.second.uiFrames);
+                capture::Append(ssIndex, static_cast<uint32_t>(rvtId.second.vecBlocks.size()));
+                for (uint32_t uiBlock : rvtId.second.vecBlocks)
+                    capture::Append(ssIndex, uiBlock);
+            }
+
+            // Trailer
+            capture::Append(ssIndex, m_uiOffset);
+            ssIndex.append(capture::szTrailerMagic, sizeof(capture::szTrailerMagic));
+            m_fstream.write(ssIndex.data(), static_cast<std::streamsize>(ssIndex.size()));
+            bool bResult = m_fstream.good();
+            m_fstream.close();
+
+            m_vecBlocks.clear();
+            m_mapIds.clear();
+            m_uiFrames = 0;
+            m_uiOffset = 0;
+            return bResult;
+        }
+
+    private:
+        /**
+         * @brief Compress and write the current block.
+         */
+        void FlushBlock()
+        {
+            if (!m_uiBlockFramesCurrent) return;
+
+            capture::SBlockHeader sHeader{};
+            sHeader.uiMagic = capture::uiBlockMagic;
+            sHeader.uiFrames = m_uiBlockFramesCurrent;
+            sHeader.uiRawSize = static_cast<uint32_t>(m_ssBlock.size());
+            sHeader.iFirstTime = m_iBlockFirstTime;
+            sHeader.iLastTime = m_iLastTime;
+
+            // Store the data uncompressed if compression doesn't reduce the size.
+            capture::CompressLZ(m_ssBlock.data(), m_ssBlock.size(), m_ssCompressed);
+            const std::string& rssStored = m_ssCompressed.size() < m_ssBlock.size() ? m_ssCompressed : m_ssBlock;
+            if (&rssStored == &m_ssCompressed) sHeader.uiFlags |= capture::uiBlockCompressed;
+            sHeader.uiStoredSize = static_cast<uint32_t>(rssStored.size());
+            m_fstream.write(reinterpret_cast<const char*>(&sHeader), sizeof(sHeader));
+            m_fstream.write(rssStored.data(), static_cast<std::streamsize>(rssStored.size()));
+
+            m_vecBlocks.push_back(SCaptureBlockInfo{ m_uiOffset, capture::ToSeconds(m_iBlockFirstTime),
+                capture::ToSeconds(m_iLastTime), m_uiBlockFramesCurrent });
+            m_uiOffset += sizeof(sHeader) + rssStored.size();
+            m_ssBlock.clear();
+            m_uiBlockFramesCurrent = 0;
+        }
+
+        std::ofstream                               m_fstream;                  ///< Output file
+        uint32_t                                    m_uiBlockFrames = 4096;     ///< Maximum amount of frames per block.
+        uint32_t                                    m_uiBlockFramesCurrent = 0; ///< Amount of frames in the current block.
+        uint64_t                                    m_uiFrames = 0;             ///< Total amount of frames.
+        uint64_t                                    m_uiOffset = 0;             ///< Current file offset.
+        int64_t                                     m_iBlockFirstTime = 0;      ///< Timestamp of the first frame of the block.
+        int64_t                                     m_iLastTime = 0;            ///< Timestamp of the last frame.
+        std::string                                 m_ssBlock;                  ///< Encoded frames of the current block.
+        std::string                                 m_ssCompressed;             ///< Compression buffer.
+        std::vector<SCaptureBlockInfo>              m_vecBlocks;                ///< Block index.
+        std::map<std::pair<uint32_t, uint32_t>, SCaptureIdInfo> m_mapIds;       ///< ID index (channel, ID | extended flag).
+        std::chrono::high_resolution_clock::time_point m_timepointStart;        ///< Starting timepoint for automatic timestamps.
+    };
+
+    /**
+     * @brief Reader of the binary capture format. The file is memory mapped; blocks are decoded on request.
+     */
+    class CCaptureReader
+    {
+    public:
+        /**
+         * @brief Check whether the file is a capture file (by checking the file header).
+         * @param[in] rpathFile Reference to the file path.
+         * @return Returns 'true' when the file starts with the capture file header.
+         */
+        static bool IsCaptureFile(const std::filesystem::path& rpathFile)
+        {
+            std::ifstream fstream(rpathFile, std::ios::binary);
+            char szMagic[sizeof(capture::szFileMagic)] = {};
+            if (!fstream.read(szMagic, sizeof(szMagic))) return false;
+            return std::memcmp(szMagic, capture::szFileMagic, sizeof(szMagic)) == 0;
+        }
+
+        /**
+         * @brief Open a capture file and read the index.
+         * @param[in] rpathFile Reference to the file path.
+         * @return Returns 'true' on success or 'false' when the file could not be opened or is not a valid capture file.
+         */
+        bool Open(const std::filesystem::path& rpathFile)
+        {
+            Close();
+            if (!m_file.Open(rpathFile)) return false;
+            if (!ReadIndex())
+            {
+                Close();
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Close the file.
+         */
+        void Close()
+        {
+            m_file.Close();
+            m_vecBlocks.clear();
+            m_vecIds.clear();
+            m_uiFrames = 0;
+        }
+
+        /**
+         * @brief Get the total amount of frames.
+         * @return The amount of frames.
+         */
+        uint64_t GetFrameCount() const
+        {
+            return m_uiFrames;
+        }
+
+        /**
+         * @brief Get the block index.
+         * @return Reference to the vector with block information.
+         */
+        const std::vector<SCaptureBlockInfo>& GetBlocks() const
+        {
+            return m_vecBlocks;
+        }
+
+        /**
+         * @brief Get the channel/ID index.
+         * @return Reference to the vector with the channel/ID information.
+         */
+        const std::vector<SCaptureIdInfo>& GetIds() const
+        {
+            return m_vecIds;
+        }
+
+        /**
+         * @brief Find the block containing the first frame with a timestamp equal or larger than the provided timestamp.
+         * @param[in] dTimestamp The timestamp in seconds.
+         * @return The index of the block or the amount of blocks when all frames are before the timestamp.
+         */
+        size_t FindBlock(double dTimestamp) const
+        {
+            auto itBlock = std::lower_bound(m_vecBlocks.begin(), m_vecBlocks.end(), dTimestamp,
+                [](const SCaptureBlockInfo& rsBlock, double dTime) { return rsBlock.dLastTimestamp < dTime; });
+            return static_cast<size_t>(itBlock - m_vecBlocks.begin());
+        }
+
+        /**
+         * @brief Decode a block.
+         * @param[in] nBlock The index of the block.
+         * @param[out] rvecFrames Reference to the vector receiving the frames (frames are appended).
+         * @return Returns 'true' on success; 'false' when the block index is invalid or the block data is corrupt.
+         */
+        bool ReadBlock(size_t nBlock, std::vector<SCanMessage>& rvecFrames) const
+        {
+            if (nBlock >= m_vecBlocks.size()) return false;
+            const char* pData = m_file.Data() + m_vecBlocks[nBlock].uiOffset;
+            const char* pEnd = m_file.Data() + m_file.Size();
+            capture::SBlockHeader sHeader{};
+            if (!capture::Extract(pData, pEnd, sHeader) || sHeader.uiMagic != capture::uiBlockMagic ||
+                static_cast<size_t>(pEnd - pData) < sHeader.uiStoredSize)
+                return false;
+
+            // Decompress
+            std::string ssRaw;
+            const char* pRaw = pData;
+            const char* pRawEnd = pData + sHeader.uiStoredSize;
+            if (sHeader.uiFlags & capture::uiBlockCompressed)
+            {
+                if (!capture::DecompressLZ(pData, sHeader.uiStoredSize, sHeader.uiRawSize, ssRaw)) return false;
+                pRaw = ssRaw.data();
+                pRawEnd = ssRaw.data() + ssRaw.size();
+            }
+
+            // Decode the frames
+            rvecFrames.reserve(rvecFrames.size() + sHeader.uiFrames);
+            int64_t iTimestamp = sHeader.iFirstTime;
+            for (uint32_t uiFrame = 0; uiFrame < sHeader.uiFrames; uiFrame++)
+            {
+                uint64_t uiDelta = 0, uiChannel = 0, uiId = 0;
+                uint8_t uiFlags = 0, uiLength = 0;
+                if (!capture::ExtractVarInt(pRaw, pRawEnd, uiDelta) || !capture::ExtractVarInt(pRaw, pRawEnd, uiChannel) ||
+                    !capture::ExtractVarInt(pRaw, pRawEnd, uiId) || !capture::Extract(pRaw, pRawEnd, uiFlags) ||
+                    !capture::Extract(pRaw, pRawEnd, uiLength) || uiLength > 64 || pRawEnd - pRaw < uiLength)
+                    return false;
+                iTimestamp += static_cast<int64_t>(uiDelta);
+                SCanMessage sMsg{};
+                sMsg.dTimestamp = capture::ToSeconds(iTimestamp);
+                sMsg.uiChannel = static_cast<uint32_t>(uiChannel);
+                sMsg.uiId = static_cast<uint32_t>(uiId >> 1);
+                sMsg.bExtended = (uiId & 1) != 0;
+                sMsg.bCanFd = (uiFlags & 1) != 0;
+                sMsg.eDirection = (uiFlags & 2) ? SCanMessage::EDirection::tx : SCanMessage::EDirection::rx;
+                sMsg.uiLength = uiLength;
+                std::memcpy(sMsg.rguiData, pRaw, uiLength);
+                pRaw += uiLength;
+                rvecFrames.push_back(sMsg);
+            }
+            return true;
+        }
+
+    private:
+        /**
+         * @brief Read and validate the file header, trailer and index.
+         * @return Returns 'true' when the index could be read; 'false' otherwise.
+         */
+        bool ReadIndex()
+        {
+            const char* pBegin = m_file.Data();
+            size_t nSize = m_file.Size();
+            const size_t nHeaderSize = sizeof(capture::szFileMagic) + 2 * sizeof(uint32_t);
+            const size_t nTrailerSize = sizeof(uint64_t) + sizeof(capture::szTrailerMagic);
+            if (!pBegin || nSize < nHeaderSize + nTrailerSize) return false;
+            if (std::memcmp(pBegin, capture::szFileMagic, sizeof(capture::szFileMagic)) != 0) return false;
+            uint32_t uiVersion = 0;
+            std::memcpy(&uiVersion, pBegin + sizeof(capture::szFileMagic), sizeof(uiVersion));
+            if (uiVersion != capture::uiVersion) return false;
+
+            // Trailer
+            const char* pEnd = pBegin + nSize;
+            if (std::memcmp(pEnd - sizeof(capture::szTrailerMagic), capture::szTrailerMagic, sizeof(capture::szTrailerMagic)) != 0)
+                return false;
+            uint64_t uiIndexOffset = 0;
+            std::memcpy(&uiIndexOffset, pEnd - nTrailerSize, sizeof(uiIndexOffset));
+            if (uiIndexOffset < nHeaderSize || uiIndexOffset > nSize - nTrailerSize) return false;
+
+            // Block index
+            const char* pData = pBegin + uiIndexOffset;
+            const char* pIndexEnd = pEnd - nTrailerSize;
+            uint32_t uiMagic = 0, uiBlockCount = 0;
+            if (!capture::Extract(pData, pIndexEnd, uiMagic) || uiMagic != capture::uiIndexMagic ||
+                !capture::Extract(pData, pIndexEnd, uiBlockCount))
+                return false;
+            for (uint32_t uiBlock = 0; uiBlock < uiBlockCount; uiBlock++)
+            {
+                uint64_t uiOffset = 0;
+                int64_t iFirstTime = 0, iLastTime = 0;
+                uint32_t uiFrames = 0, uiReserved = 0;
+                if (!capture::Extract(pData, pIndexEnd, uiOffset) || !capture::Extract(pData, pIndexEnd, iFirstTime) ||
+                    !capture::Extract(pData, pIndexEnd, iLastTime) || !capture::Extract(pData, pIndexEnd, uiFrames) ||
+                    !capture::Extract(pData, pIndexEnd, uiReserved) || uiOffset >= uiIndexOffset)
+                    return false;
+                m_vecBlocks.push_back(SCaptureBlockInfo{ uiOffset, capture::ToSeconds(iFirstTime), capture::ToSeconds(iLastTime),
+                    uiFrames });
+                m_uiFrames += uiFrames;
+            }
+
+            // ID index
+            uint32_t uiIdCount = 0;
+            if (!capture::Extract(pData, pIndexEnd, uiIdCount)) return false;
+            for (uint32_t uiIdIndex = 0; uiIdIndex < uiIdCount; uiIdIndex++)
+            {
+                SCaptureIdInfo sIdInfo{};
+                uint32_t uiId = 0, uiBlocks = 0;
+                if (!capture::Extract(pData, pIndexEnd, sIdInfo.uiChannel) || !capture::Extract(pData, pIndexEnd, uiId) ||
+                    !capture::Extract(pData, pIndexEnd, sIdInfo.uiFrames) || !capture::Extract(pData, pIndexEnd, uiBlocks) ||
+                    static_cast<size_t>(pIndexEnd - pData) / sizeof(uint32_t) < uiBlocks)
+                    return false;
+                sIdInfo.uiId = uiId & ~capture::uiIdExtended;
+                sIdInfo.bExtended = (uiId & capture::uiIdExtended) != 0;
+                sIdInfo.vecBlocks.resize(uiBlocks);
+                std::memcpy(sIdInfo.vecBlocks.data(), pData, uiBlocks * sizeof(uint32_t));
+                pData += uiBlocks * sizeof(uint32_t);
+                m_vecIds.push_back(std::move(sIdInfo));
+            }
+            return true;
+        }
+
+        CMappedFile                     m_file;             ///< Memory mapped capture file.
+        std::vector<SCaptureBlockInfo>  m_vecBlocks;        ///< Block index.
+        std::vector<SCaptureIdInfo>     m_vecIds;           ///< Channel/ID index.
+        uint64_t                        m_uiFrames = 0;     ///< Total amount of frames.
+    };
+} // namespace asc
+
+#endif // !defined CAN_CAPTURE_H
@@ -0,0 +1,534 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef CAN_RECEIVER_LIST_H
+#define CAN_RECEIVER_LIST_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <interfaces/can.h>
+#include <support/metrics.h>
+
+/**
+ * @brief Runtime metrics of the CAN communication; shared by the CAN services of the process. The frame rate is derived from
+ * the counters by the scraper.
+ */
+struct SCanMetrics
+{
+    /// Amount of received frames.
+    sdv::core::CMetricCounter   counterReceived{"sdv_can_frames_received_total", "Amount of CAN frames received from the bus."};
+
+    /// Amount of sent frames.
+    sdv::core::CMetricCounter   counterSent{"sdv_can_frames_sent_total", "Amount of CAN frames sent to the bus."};
+
+    /// Amount of received error frames.
+    sdv::core::CMetricCounter   counterErrors{"sdv_can_error_frames_total", "Amount of CAN error frames received from the bus."};
+
+    /// Amount of frames dropped because the delivery queue of a receiver was full.
+    sdv::core::CMetricCounter   counterDropped{"sdv_can_frames_dropped_total",
+        "Amount of CAN frames dropped because the delivery queue of a receiver was full."};
+};
+
+/**
+ * @brief Get the runtime metrics of the CAN communication.
+ * @return Reference to the metrics.
+ */
+inline SCanMetrics& GetCanMetrics()
+{
+    static SCanMetrics sMetrics;
+    return sMetrics;
+}
+
+/**
+ * @brief Single consumer delivery queue of a CAN receiver. The bus reader (producer) stores the messages in a fixed size ring
+ * buffer, which is emptied by a dedicated thread calling the receiver. This prevents a slow receiver from delaying the bus reader
+ * and the other receivers. When the ring buffer is full, the message is dropped.
+ * @remarks Multiple producing threads are serialized by a lightweight spin flag; in the common case only one thread reads the
+ * bus and the flag is never contended.
+ */
+class CCanReceiverQueue : public std::enable_shared_from_this<CCanReceiverQueue>
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] pReceiver Pointer to the receiver interface to deliver the messages to.
+     * @param[in] nSize The minimum amount of entries the queue can hold; rounded up to the next power of two.
+     */
+    CCanReceiverQueue(sdv::can::IReceive* pReceiver, size_t nSize) : m_pReceiver(pReceiver)
+    {
+        size_t nCapacity = 2;
+        while (nCapacity < nSize) nCapacity <<= 1;
+        m_vecRing.resize(nCapacity);
+    }
+
+    /**
+     * @brief Start the delivery thread. The thread holds a reference to the queue, keeping it alive until the thread ends.
+     */
+    void Start()
+    {
+        std::shared_ptr<CCanReceiverQueue> ptrThis = shared_from_this();
+        m_thread = std::thread([ptrThis]() { ptrThis->DeliveryFunc(); });
+    }
+
+    /**
+     * @brief Stop the delivery thread. Messages still in the queue are discarded. After the function returns, the receiver is
+     * not called any more. If called from within the delivery thread, the thread ends after returning from the receiver.
+     */
+    void Stop()
+    {
+        m_bStop = true;
+        {
+            std::unique_lock<std::mutex> lock(m_mtxWait);
+            m_cvWait.notify_all();
+        }
+        if (!m_thread.joinable()) return;
+        if (m_thread.get_id() == std::this_thread::get_id())
+            m_thread.detach();
+        else
+            m_thread.join();
+    }
+
+    /**
+     * @brief Add a message to the queue.
+     * @param[in] rsMsg Reference to the message.
+     * @param[in] uiIfcIndex Interface index of the received message.
+     */
+    void PushMessage(const sdv::can::SMessage& rsMsg, uint32_t uiIfcIndex)
+    {
+        Push([&](SEntry& rsEntry)
+            {
+                rsEntry.bError = false;
+                rsEntry.sMsg = rsMsg;
+                rsEntry.uiIfcIndex = uiIfcIndex;
+            });
+    }
+
+    /**
+     * @brief Add an error frame to the queue.
+     * @param[in] rsError Reference to the error frame.
+     * @param[in] uiIfcIndex Interface index of the received error frame.
+     */
+    void PushError(const sdv::can::SErrorFrame& rsError, uint32_t uiIfcIndex)
+    {
+        Push([&](SEntry& rsEntry)
+            {
+                rsEntry.bError = true;
+                rsEntry.sError = rsError;
+                rsEntry.uiIfcIndex = uiIfcIndex;
+            });
+    }
+
+    /**
+     * @brief Get the amount of messages that were dropped because the queue was full.
+     * @return The amount of dropped messages.
+     */
+    uint64_t GetDroppedCount() const
+    {
+        return m_uiDropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @brief Queue entry.
+     */
+    struct SEntry
+    {
+        bool                    bError = false;     ///< When set, the entry contains an error frame; otherwise a message.
+        sdv::can::SMessage      sMsg{};             ///< The message.
+        sdv::can::SErrorFrame   sError{};           ///< The error frame.
+        uint32_t                uiIfcIndex = 0;     ///< The interface index.
+    };
+
+    /**
+     * @brief Store an entry in the ring buffer and wake up the delivery thread if needed.
+     * @tparam TFill Type of the function filling the entry.
+     * @param[in] fnFill Function filling the entry.
+     */
+    template <typename TFill>
+    void Push(TFill fnFill)
+    {
+        while (m_flagProducer.test_and_set(std::memory_order_acquire))
+            std::this_thread::yield();
+        size_t nHead = m_nHead.load(std::memory_order_relaxed);
+        if (nHead - m_nTail.load(std::memory_order_acquire) >= m_vecRing.size())
+        {
+            m_flagProducer.clear(std::memory_order_release);
+            m_uiDropped.fetch_add(1, std::memory_order_relaxed);
+            GetCanMetrics().counterDropped.Increment();
+            return;
+        }
+        fnFill(m_vecRing[nHead & (m_vecRing.size() - 1)]);
+        m_nHead.store(nHead + 1, std::memory_order_seq_cst);
+        m_flagProducer.clear(std::memory_order_release);
+
+        // Only take the mutex when the delivery thread is (about to be) waiting.
+        if (m_bWaiting.load(std::memory_order_seq_cst))
+        {
+            std::unique_lock<std::mutex> lock(m_mtxWait);
+            m_cvWait.notify_one();
+        }
+    }
+
+    /**
+     * @brief Delivery thread function.
+     */
+    void DeliveryFunc()
+    {
+        while (!m_bStop)
+        {
+            size_t nTail = m_nTail.load(std::memory_order_relaxed);
+            if (nTail == m_nHead.load(std::memory_order_acquire))
+            {
+                // Announce the wait before checking the write position once more; a producer storing the write position
+                // afterwards sees the flag and notifies under the mutex. Stop notifies as well, so no timeout is needed.
+                std::unique_lock<std::mutex> lock(m_mtxWait);
+                m_bWaiting.store(true, std::memory_order_seq_cst);
+                m_cvWait.wait(lock, [&]() { return m_bStop || nTail != m_nHead.load(std::memory_order_seq_cst); });
+                m_bWaiting.store(false, std::memory_order_relaxed);
+                continue;
+            }
+
+            SEntry& rsEntry = m_vecRing[nTail & (m_vecRing.size() - 1)];
+            if (rsEntry.bError)
+                m_pReceiver->Error(rsEntry.sError, rsEntry.uiIfcIndex);
+            else
+                m_pReceiver->Receive(rsEntry.sMsg, rsEntry.uiIfcIndex);
+            m_nTail.store(nTail + 1, std::memory_order_release);
+        }
+    }
+
+    sdv::can::IReceive*     m_pReceiver = nullptr;      ///< The receiver to deliver the messages to.
+    std::vector<SEntry>     m_vecRing;                  ///< Ring buffer; the size is a power of two.
+    alignas(64) std::atomic<size_t> m_nHead{0};         ///< Write position (only incremented).
+    alignas(64) std::atomic<size_t> m_nTail{0};         ///< Read position (only incremented).
+    std::atomic_flag        m_flagProducer = ATOMIC_FLAG_INIT;  ///< Serializes multiple producers.
+    std::atomic<uint64_t>   m_uiDropped{0};             ///< Amount of dropped messages.
+    std::atomic_bool        m_bWaiting{false};          ///< Set when the delivery thread is waiting for messages.
+    std::atomic_bool        m_bStop{false};             ///< Set when the delivery thread should end.
+    std::mutex              m_mtxWait;                  ///< Mutex for the wait condition.
+    std::condition_variable m_cvWait;                   ///< Wait condition of the delivery thread.
+    std::thread             m_thread;                   ///< Delivery thread.
+};
+
+/**
+ * @brief List of CAN receivers that is read without locking by the thread(s) reading the bus.
+ * @details The receivers are published as an immutable snapshot (copy on write). Registration and unregistration create a new
+ * snapshot and replace the published one; dispatching only loads the current snapshot and iterates it. The previous snapshot is
+ * released after a grace period, which ends when all dispatches that could have loaded it have finished. Consequently, when
+ * Unregister returns, the receiver will not be called any more and can be destroyed. When Unregister is called from within a
+ * receiver callback, the grace period cannot be awaited; the receiver is deactivated instead and the snapshot is released later.
+ * Each receiver can have a set of ID filters, which are evaluated before dispatching, and an optional delivery queue with its
+ * own thread (see CCanReceiverQueue).
+ */
+class CCanReceiverList
+{
+public:
+    /**
+     * @brief Default constructor.
+     */
+    CCanReceiverList() = default;
+
+    /** No copy constructor */
+    CCanReceiverList(const CCanReceiverList&) = delete;
+
+    /**
+     * @brief Destructor; unregisters all receivers.
+     */
+    ~CCanReceiverList()
+    {
+        Clear();
+    }
+
+    /** No assignment operator */
+    CCanReceiverList& operator=(const CCanReceiverList&) = delete;
+
+    /**
+     * @brief Register a receiver.
+     * @param[in] pReceiver Pointer to the receiver interface.
+     * @param[in] rsConfig Reference to the receiver configuration.
+     * @return Returns 'true' when the receiver was registered; 'false' when the receiver is invalid or was registered already.
+     */
+    bool Register(sdv::can::IReceive* pReceiver, const sdv::can::SReceiverConfig& rsConfig = {})
+    {
+        if (!pReceiver) return false;
+
+        std::unique_lock<std::mutex> lock(m_mtxWriters);
+        const SSnapshot* pCurrent = m_pSnapshot.load();
+        if (pCurrent)
+        {
+            for (const auto& rptrEntry : pCurrent->vecEntries)
+                if (rptrEntry->pReceiver == pReceiver) return false;
+        }
+
+        auto ptrEntry = std::make_shared<SEntry>();
+        ptrEntry->pReceiver = pReceiver;
+        ptrEntry->vecFilters.assign(rsConfig.seqFilters.begin(), rsConfig.seqFilters.end());
+        if (rsConfig.uiQueueSize)
+        {
+            ptrEntry->ptrQueue = std::make_shared<CCanReceiverQueue>(pReceiver, rsConfig.uiQueueSize);
+            ptrEntry->ptrQueue->Start();
+        }
+
+        auto ptrNew = std::make_unique<SSnapshot>();
+        if (pCurrent) ptrNew->vecEntries = pCurrent->vecEntries;
+        ptrNew->vecEntries.push_back(std::move(ptrEntry));
+        Publish(std::move(ptrNew));
+        return true;
+    }
+
+    /**
+     * @brief Unregister a receiver. When the function returns, the receiver is not called any more.
+     * @param[in] pReceiver Pointer to the receiver interface.
+     * @return Returns 'true' when the receiver was unregistered; 'false' when the receiver wasn't registered.
+     */
+    bool Unregister(sdv::can::IReceive* pReceiver)
+    {
+        std::unique_lock<std::mutex> lock(m_mtxWriters);
+        const SSnapshot* pCurrent = m_pSnapshot.load();
+        if (!pCurrent) return false;
+
+        auto ptrNew = std::make_unique<SSnapshot>();
+        std::shared_ptr<SEntry> ptrRemoved;
+        for (const auto& rptrEntry : pCurrent->vecEntries)
+        {
+            if (rptrEntry->pReceiver == pReceiver)
+                ptrRemoved = rptrEntry;
+            else
+                ptrNew->vecEntries.push_back(rptrEntry);
+        }
+        if (!ptrRemoved) return false;
+
+        // Deactivate first; this covers dispatches still iterating the old snapshot when the grace period cannot be awaited.
+        ptrRemoved->bActive = false;
+        Publish(std::move(ptrNew));
+        if (ptrRemoved->ptrQueue) ptrRemoved->ptrQueue->Stop();
+        return true;
+    }
+
+    /**
+     * @brief Unregister all receivers.
+     */
+    void Clear()
+    {
+        std::unique_lock<std::mutex> lock(m_mtxWriters);
+        const SSnapshot* pCurrent = m_pSnapshot.load();
+        if (!pCurrent) return;
+        std::vector<std::shared_ptr<SEntry>> vecRemoved = pCurrent->vecEntries;
+        for (const auto& rptrEntry : vecRemoved)
+            rptrEntry->bActive = false;
+        Publish(nullptr);
+        for (const auto& rptrEntry : vecRemoved)
+            if (rptrEntry->ptrQueue) rptrEntry->ptrQueue->Stop();
+    }
+
+    /**
+     * @brief Get the amount of registered receivers.
+     * @return The amount of receivers.
+     */
+    size_t GetCount() const
+    {
+        std::unique_lock<std::mutex> lock(m_mtxWriters);
+        const SSnapshot* pCurrent = m_pSnapshot.load();
+        return pCurrent ? pCurrent->vecEntries.size() : 0;
+    }
+
+    /**
+     * @brief Get the amount of messages that were dropped for a receiver because its delivery queue was full.
+     * @param[in] pReceiver Pointer to the receiver interface.
+     * @return The amount of dropped messages; 0 when the receiver is not registered or doesn't use a queue.
+     */
+    uint64_t GetDroppedCount(sdv::can::IReceive* pReceiver) const
+    {
+        std::unique_lock<std::mutex> lock(m_mtxWriters);
+        const SSnapshot* pCurrent = m_pSnapshot.load();
+        if (!pCurrent) return 0;
+        for (const auto& rptrEntry : pCurrent->vecEntries)
+        {
+            if (rptrEntry->pReceiver == pReceiver)
+                return rptrEntry->ptrQueue ? rptrEntry->ptrQueue->GetDroppedCount() : 0;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Dispatch a received message to the receivers with a matching filter.
+     * @param[in] rsMsg Reference to the message.
+     * @param[in] uiIfcIndex Interface index of the received message.
+     */
+    void Dispatch(const sdv::can::SMessage& rsMsg, uint32_t uiIfcIndex) const
+    {
+        GetCanMetrics().counterReceived.Increment();
+        SReadGuard guard(*this);
+        if (!guard.pSnapshot) return;
+        for (const auto& rptrEntry : guard.pSnapshot->vecEntries)
+        {
+            if (!rptrEntry->Match(rsMsg.uiID)) continue;
+            if (rptrEntry->ptrQueue)
+                rptrEntry->ptrQueue->PushMessage(rsMsg, uiIfcIndex);
+            else if (rptrEntry->bActive.load(std::memory_order_relaxed))
+                rptrEntry->pReceiver->Receive(rsMsg, uiIfcIndex);
+        }
+    }
+
+    /**
+     * @brief Dispatch an error frame to the receivers. The filters are applied when the error frame refers to a specific ID.
+     * @param[in] rsError Reference to the error frame.
+     * @param[in] uiIfcIndex Interface index of the received error frame.
+     */
+    void DispatchError(const sdv::can::SErrorFrame& rsError, uint32_t uiIfcIndex) const
+    {
+        GetCanMetrics().counterErrors.Increment();
+        SReadGuard guard(*this);
+        if (!guard.pSnapshot) return;
+        for (const auto& rptrEntry : guard.pSnapshot->vecEntries)
+        {
+            if (rsError.uiID && !rptrEntry->Match(rsError.uiID)) continue;
+            if (rptrEntry->ptrQueue)
+                rptrEntry->ptrQueue->PushError(rsError, uiIfcIndex);
+            else if (rptrEntry->bActive.load(std::memory_order_relaxed))
+                rptrEntry->pReceiver->Error(rsError, uiIfcIndex);
+        }
+    }
+
+private:
+    /**
+     * @brief Registered receiver.
+     */
+    struct SEntry
+    {
+        /**
+         * @brief Does the ID pass the filters?
+         * @param[in] uiID The CAN ID to check.
+         * @return Returns 'true' when no filters are defined or when at least one filter matches; 'false' otherwise.
+         */
+        bool Match(uint32_t uiID) const
+        {
+            if (vecFilters.empty()) return true;
+            for (const sdv::can::SReceiveFilter& rsFilter : vecFilters)
+                if ((uiID & rsFilter.uiMask) == (rsFilter.uiID & rsFilter.uiMask)) return true;
+            return false;
+        }
+
+        sdv::can::IReceive*                     pReceiver = nullptr;    ///< The receiver interface.
+        std::vector<sdv::can::SReceiveFilter>   vecFilters;             ///< The receive filters.
+        std::shared_ptr<CCanReceiverQueue>      ptrQueue;               ///< Optional delivery queue.
+        std::atomic_bool                        bActive{true};          ///< Cleared when the receiver is unregistered.
+    };
+
+    /**
+     * @brief Immutable snapshot of the receivers.
+     */
+    struct SSnapshot
+    {
+        std::vector<std::shared_ptr<SEntry>>    vecEntries;             ///< The registered receivers.
+    };
+
+    /**
+     * @brief Read guard announcing a dispatch in progress for the duration of its lifetime.
+     * @details The reader registers itself at the counter of the current epoch and confirms the epoch didn't change in the
+     * meantime. This guarantees that a writer replacing the snapshot and switching the epoch afterwards will wait for this
+     * reader if it could have loaded the previous snapshot.
+     */
+    struct SReadGuard
+    {
+        /**
+         * @brief Constructor; enters the read section and loads the current snapshot.
+         * @param[in] rList Reference to the receiver list.
+         */
+        SReadGuard(const CCanReceiverList& rList) : rCounter(rList.Enter())
+        {
+            pSnapshot = rList.m_pSnapshot.load();
+            pPrevList = m_pDispatchingList;
+            m_pDispatchingList = &rList;
+        }
+
+        /**
+         * @brief Destructor; leaves the read section.
+         */
+        ~SReadGuard()
+        {
+            m_pDispatchingList = pPrevList;
+            rCounter.fetch_sub(1, std::memory_order_release);
+        }
+
+        SReadGuard(const SReadGuard&) = delete;                 ///< No copy constructor.
+        SReadGuard& operator=(const SReadGuard&) = delete;      ///< No assignment operator.
+
+        std::atomic<uint32_t>&      rCounter;               ///< The reader counter of the epoch.
+        const SSnapshot*            pSnapshot = nullptr;    ///< The snapshot valid during the read section.
+        const CCanReceiverList*     pPrevList = nullptr;    ///< List being dispatched before entering (nested dispatches).
+    };
+
+    /**
+     * @brief Register a reader at the current epoch.
+     * @return Reference to the reader counter of the epoch.
+     */
+    std::atomic<uint32_t>& Enter() const
+    {
+        while (true)
+        {
+            uint32_t uiEpoch = m_uiEpoch.load();
+            std::atomic<uint32_t>& rCounter = m_rguiReaders[uiEpoch & 1];
+            rCounter.fetch_add(1);
+            if (m_uiEpoch.load() == uiEpoch) return rCounter;
+            rCounter.fetch_sub(1);
+        }
+    }
+
+    /**
+     * @brief Publish a new snapshot and release the previous one after the grace period. Must be called with the writer mutex
+     * locked.
+     * @param[in] ptrNew The new snapshot; could be nullptr.
+     */
+    void Publish(std::unique_ptr<SSnapshot>&& ptrNew)
+    {
+        std::unique_ptr<const SSnapshot> ptrOld(m_pSnapshot.exchange(ptrNew.release()));
+        uint32_t uiEpoch = m_uiEpoch.fetch_add(1);
+
+        // Called from within a dispatch of this list? Waiting would deadlock; keep the snapshot until the next publication.
+        if (m_pDispatchingList == this)
+        {
+            if (ptrOld) m_vecRetired.push_back(std::move(ptrOld));
+            return;
+        }
+
+        // Wait until the readers that could have loaded the previous snapshot are finished.
+        while (m_rguiReaders[uiEpoch & 1].load(std::memory_order_acquire))
+            std::this_thread::yield();
+        ptrOld.reset();
+
+        // Snapshots retired during a dispatch could still be in use by readers of older epochs of both parities. Switch the epoch
+        // once more and wait for the other parity as well before releasing them.
+        if (!m_vecRetired.empty())
+        {
+            uiEpoch = m_uiEpoch.fetch_add(1);
+            while (m_rguiReaders[uiEpoch & 1].load(std::memory_order_acquire))
+                std::this_thread::yield();
+            m_vecRetired.clear();
+        }
+    }
+
+    mutable std::mutex                  m_mtxWriters;               ///< Serializes registration and unregistration.
+    std::atomic<const SSnapshot*>       m_pSnapshot{nullptr};       ///< The published snapshot.
+    std::atomic<uint32_t>               m_uiEpoch{0};               ///< Epoch; incremented with every publication.
+    mutable std::atomic<uint32_t>       m_rguiReaders[2] = {};      ///< Reader counters of even and odd epochs.
+    std::vector<std::unique_ptr<const SSnapshot>> m_vecRetired;     ///< Snapshots retired from within a dispatch.
+    static inline thread_local const CCanReceiverList* m_pDispatchingList = nullptr; ///< List dispatched by the current thread.
+};
+
+#endif // !defined CAN_RECEIVER_LIST_H
@@ -0,0 +1,339 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "latency_trace_buffer.h"
+
+#ifdef _WIN32
+// Resolve conflict
+#pragma push_macro("interface")
+#undef interface
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <WinSock2.h>
+#include <Windows.h>
+
+// Resolve conflict
+#pragma pop_macro("interface")
+#ifdef GetClassInfo
+#undef GetClassInfo
+#endif
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+CLatencyTraceBuffer::CLatencyTraceBuffer(uint32_t uiInstanceID /*= 1000u*/) : m_uiInstanceID(uiInstanceID)
+{}
+
+CLatencyTraceBuffer::~CLatencyTraceBuffer()
+{
+    Close();
+}
+
+bool CLatencyTraceBuffer::Create()
+{
+    Close();
+    if (!Map(true)) return false;
+    m_bCreated = true;
+
+    // Initialize the header. The rings and names of a still existing buffer are kept; reading starts at the current position.
+    std::strncpy(m_psBuffer->rgszSignature, "SDV_LAT", sizeof(m_psBuffer->rgszSignature));
+    m_psBuffer->uiInstanceID = m_uiInstanceID;
+    m_psBuffer->uiBufferSize = static_cast<uint32_t>(sizeof(SSharedMemBuffer));
+    m_vecReadPos.resize(nRingCount);
+    for (uint32_t uiRing = 0; uiRing < nRingCount; uiRing++)
+        m_vecReadPos[uiRing] = m_psBuffer->rgsRings[uiRing].uiWritePos.load(std::memory_order_acquire);
+    if (!m_psBuffer->uiNextTraceID.load()) m_psBuffer->uiNextTraceID = 1;
+    m_psBuffer->uiHeartbeat.store(GetTimestamp(), std::memory_order_relaxed);
+    m_psBuffer->uiActive.store(1, std::memory_order_release);
+    return true;
+}
+
+bool CLatencyTraceBuffer::Open()
+{
+    Close();
+    if (!Map(false)) return false;
+
+    // Check the header
+    if (std::strncmp(m_psBuffer->rgszSignature, "SDV_LAT", sizeof(m_psBuffer->rgszSignature)) != 0 ||
+        m_psBuffer->uiInstanceID != m_uiInstanceID || m_psBuffer->uiBufferSize != sizeof(SSharedMemBuffer) ||
+        !IsActive(GetTimestamp()))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void CLatencyTraceBuffer::Close()
+{
+    if (m_psBuffer && m_bCreated)
+        m_psBuffer->uiActive.store(0, std::memory_order_release);
+    Unmap();
+    m_bCreated = false;
+    m_vecReadPos.clear();
+}
+
+bool CLatencyTraceBuffer::IsOpened() const
+{
+    return m_psBuffer != nullptr;
+}
+
+bool CLatencyTraceBuffer::IsActive(uint64_t uiTimestamp) const
+{
+    if (!m_psBuffer || !m_psBuffer->uiActive.load(std::memory_order_acquire)) return false;
+
+    // A monitor that stopped without deactivating the buffer doesn't update the heartbeat any more.
+    uint64_t uiHeartbeat = m_psBuffer->uiHeartbeat.load(std::memory_order_relaxed);
+    return uiTimestamp < uiHeartbeat || uiTimestamp - uiHeartbeat < uiHeartbeatTimeout;
+}
+
+uint32_t CLatencyTraceBuffer::GetInstanceID() const
+{
+    return m_uiInstanceID;
+}
+
+uint64_t CLatencyTraceBuffer::NewTraceID()
+{
+    if (!m_psBuffer) return 0;
+    uint64_t uiTraceID = m_psBuffer->uiNextTraceID.fetch_add(1, std::memory_order_relaxed);
+    return uiTraceID ? uiTraceID : m_psBuffer->uiNextTraceID.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t CLatencyTraceBuffer::ClaimRing()
+{
+    if (!m_psBuffer) return nRingCount;
+    uint64_t uiOwner = GetOwnerID();
+    uint32_t uiFirst = m_psBuffer->uiNextRing.fetch_add(1, std::memory_order_relaxed);
+    for (uint32_t n = 0; n < nRingCount; n++)
+    {
+        uint32_t uiRing = (uiFirst + n) % nRingCount;
+        uint64_t uiFree = 0;
+        if (m_psBuffer->rgsRings[uiRing].uiOwner.compare_exchange_strong(uiFree, uiOwner, std::memory_order_acq_rel))
+            return uiRing;
+    }
+    return nRingCount;
+}
+
+void CLatencyTraceBuffer::ReleaseRing(uint32_t uiRing)
+{
+    if (!m_psBuffer || uiRing >= nRingCount) return;
+    uint64_t uiOwner = GetOwnerID();
+    m_psBuffer->rgsRings[uiRing].uiOwner.compare_exchange_strong(uiOwner, 0, std::memory_order_acq_rel);
+}
+
+void CLatencyTraceBuffer::Record(uint32_t uiRing, const SLatencyTraceEvent& rsEvent)
+{
+    if (!m_psBuffer || uiRing >= nRingCount) return;
+    SRing& rsRing = m_psBuffer->rgsRings[uiRing];
+
+    // Only the owning thread writes; the position is published after the event has been written.
+    uint64_t uiPos = rsRing.uiWritePos.load(std::memory_order_relaxed);
+    rsRing.rgsEvents[uiPos & (nRingSize - 1)] = rsEvent;
+    rsRing.uiWritePos.store(uiPos + 1, std::memory_order_release);
+}
+
+void CLatencyTraceBuffer::AddName(uint32_t uiKey, const std::string& rssName)
+{
+    if (!m_psBuffer || rssName.empty()) return;
+
+    // The names are added rarely; a spin lock shared between the processes is sufficient.
+    uint32_t uiUnlocked = 0;
+    while (!m_psBuffer->uiNameLock.compare_exchange_weak(uiUnlocked, 1, std::memory_order_acquire))
+    {
+        uiUnlocked = 0;
+        std::this_thread::yield();
+    }
+    uint32_t uiCount = m_psBuffer->uiNameCount.load(std::memory_order_relaxed);
+    bool bFound = false;
+    for (uint32_t uiIndex = 0; !bFound && uiIndex < uiCount; uiIndex++)
+        bFound = m_psBuffer->rgsNames[uiIndex].uiKey == uiKey;
+    if (!bFound && uiCount < nNameCount)
+    {
+        SName& rsName = m_psBuffer->rgsNames[uiCount];
+        rsName.uiKey = uiKey;
+        std::strncpy(rsName.szName, rssName.c_str(), nNameLength - 1);
+        rsName.szName[nNameLength - 1] = '\0';
+        m_psBuffer->uiNameCount.store(uiCount + 1, std::memory_order_release);
+    }
+    m_psBuffer->uiNameLock.store(0, std::memory_order_release);
+}
+
+size_t CLatencyTraceBuffer::Read(std::vector<SLatencyTraceRecord>& rvecRecords)
+{
+    if (!m_psBuffer) return 0;
+    m_psBuffer->uiHeartbeat.store(GetTimestamp(), std::memory_order_relaxed);
+    m_vecReadPos.resize(nRingCount);
+
+    size_t nLost = 0;
+    for (uint32_t uiRing = 0; uiRing < nRingCount; uiRing++)
+    {
+        SRing& rsRing = m_psBuffer->rgsRings[uiRing];
+        uint64_t& ruiReadPos = m_vecReadPos[uiRing];
+        uint64_t uiWritePos = rsRing.uiWritePos.load(std::memory_order_acquire);
+        if (uiWritePos == ruiReadPos) continue;
+        if (uiWritePos - ruiReadPos > nRingSize)
+        {
+            nLost += static_cast<size_t>(uiWritePos - ruiReadPos - nRingSize);
+            ruiReadPos = uiWritePos - nRingSize;
+        }
+
+        // Copy the events and the owner.
+        uint64_t uiOwner = rsRing.uiOwner.load(std::memory_order_relaxed);
+        size_t nFirst = rvecRecords.size();
+        for (uint64_t uiPos = ruiReadPos; uiPos < uiWritePos; uiPos++)
+        {
+            SLatencyTraceRecord sRecord;
+            static_cast<SLatencyTraceEvent&>(sRecord) = rsRing.rgsEvents[uiPos & (nRingSize - 1)];
+            sRecord.uiProcessID = static_cast<uint32_t>(uiOwner >> 32);
+            sRecord.uiThreadID = static_cast<uint32_t>(uiOwner);
+            rvecRecords.push_back(sRecord);
+        }
+
+        // Events that were overwritten by the writer while copying are discarded.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t uiWritePosAfter = rsRing.uiWritePos.load(std::memory_order_relaxed);
+        if (uiWritePosAfter - ruiReadPos > nRingSize)
+        {
+            size_t nOverwritten = static_cast<size_t>(std::min<uint64_t>(uiWritePosAfter - ruiReadPos - nRingSize,
+                uiWritePos - ruiReadPos));
+            rvecRecords.erase(rvecRecords.begin() + static_cast<std::ptrdiff_t>(nFirst),
+                rvecRecords.begin() + static_cast<std::ptrdiff_t>(nFirst + nOverwritten));
+            nLost += nOverwritten;
+        }
+        ruiReadPos = uiWritePos;
+    }
+    return nLost;
+}
+
+std::string CLatencyTraceBuffer::FindName(uint32_t uiKey) const
+{
+    if (!m_psBuffer) return {};
+    uint32_t uiCount = m_psBuffer->uiNameCount.load(std::memory_order_acquire);
+    for (uint32_t uiIndex = 0; uiIndex < uiCount && uiIndex < nNameCount; uiIndex++)
+    {
+        if (m_psBuffer->rgsNames[uiIndex].uiKey == uiKey)
+            return std::string(m_psBuffer->rgsNames[uiIndex].szName,
+                strnlen(m_psBuffer->rgsNames[uiIndex].szName, nNameLength));
+    }
+    return {};
+}
+
+uint64_t CLatencyTraceBuffer::GetTimestamp()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t CLatencyTraceBuffer::GetOwnerID()
+{
+#ifdef _WIN32
+    return static_cast<uint64_t>(GetCurrentProcessId()) << 32 | GetCurrentThreadId();
+#else
+    return static_cast<uint64_t>(static_cast<uint32_t>(getpid())) << 32 | static_cast<uint32_t>(syscall(SYS_gettid));
+#endif
+}
+
+#ifdef _WIN32
+bool CLatencyTraceBuffer::Map(bool bCreate)
+{
+    std::string ssSharedMemName = "SDV_LATENCY_TRACE_" + std::to_string(m_uiInstanceID);
+    HANDLE hMapFile = bCreate ?
+        CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, static_cast<DWORD>(sizeof(SSharedMemBuffer)),
+            ssSharedMemName.c_str()) :
+        OpenFileMappingA(FILE_MAP_ALL_ACCESS, false, ssSharedMemName.c_str());
+    if (!hMapFile || hMapFile == INVALID_HANDLE_VALUE) return false;
+    void* pView = MapViewOfFile(hMapFile, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+    if (!pView)
+    {
+        CloseHandle(hMapFile);
+        return false;
+    }
+
+    // The view might be smaller when created by another version.
+    MEMORY_BASIC_INFORMATION sInfo{};
+    if (VirtualQuery(pView, &sInfo, sizeof(sInfo)) < sizeof(sInfo) || sInfo.RegionSize < sizeof(SSharedMemBuffer))
+    {
+        UnmapViewOfFile(pView);
+        CloseHandle(hMapFile);
+        return false;
+    }
+    m_hMapFile = hMapFile;
+    m_psBuffer = static_cast<SSharedMemBuffer*>(pView);
+    return true;
+}
+
+void CLatencyTraceBuffer::Unmap()
+{
+    if (m_psBuffer) UnmapViewOfFile(m_psBuffer);
+    if (m_hMapFile) CloseHandle(m_hMapFile);
+    m_psBuffer = nullptr;
+    m_hMapFile = nullptr;
+}
+#else
+bool CLatencyTraceBuffer::Map(bool bCreate)
+{
+    std::string ssSharedMemName = "/SDV_LATENCY_TRACE_" + std::to_string(m_uiInstanceID);
+
+    // Creating replaces a previous buffer; processes still writing to the previous buffer reconnect when it becomes inactive.
+    if (bCreate) shm_unlink(ssSharedMemName.c_str());
+    int iFileDescr = shm_open(ssSharedMemName.c_str(), bCreate ? O_CREAT | O_EXCL | O_RDWR : O_RDWR, 0666);
+    if (iFileDescr < 0) return false;
+    if (bCreate)
+    {
+        // Allow all users to record (the mode is reduced by the umask during creation).
+        fchmod(iFileDescr, 0666);
+        if (ftruncate(iFileDescr, static_cast<off_t>(sizeof(SSharedMemBuffer))) != 0)
+        {
+            close(iFileDescr);
+            shm_unlink(ssSharedMemName.c_str());
+            return false;
+        }
+    }
+    struct stat sStat{};
+    if (fstat(iFileDescr, &sStat) != 0 || static_cast<size_t>(sStat.st_size) < sizeof(SSharedMemBuffer))
+    {
+        close(iFileDescr);
+        return false;
+    }
+    void* pView = mmap(nullptr, sizeof(SSharedMemBuffer), PROT_READ | PROT_WRITE, MAP_SHARED, iFileDescr, 0);
+    if (pView == MAP_FAILED)
+    {
+        close(iFileDescr);
+        if (bCreate) shm_unlink(ssSharedMemName.c_str());
+        return false;
+    }
+    m_iFileDescr = iFileDescr;
+    m_psBuffer = static_cast<SSharedMemBuffer*>(pView);
+    return true;
+}
+
+void CLatencyTraceBuffer::Unmap()
+{
+    if (m_psBuffer) munmap(m_psBuffer, sizeof(SSharedMemBuffer));
+    if (m_iFileDescr >= 0) close(m_iFileDescr);
+    if (m_psBuffer && m_bCreated)
+        shm_unlink(("/SDV_LATENCY_TRACE_" + std::to_string(m_uiInstanceID)).c_str());
+    m_psBuffer = nullptr;
+    m_iFileDescr = -1;
+}
+#endif
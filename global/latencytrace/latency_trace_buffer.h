@@ -0,0 +1,250 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef LATENCY_TRACE_BUFFER_H
+#define LATENCY_TRACE_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Latency trace event as stored in the ring buffer of a thread.
+ */
+struct SLatencyTraceEvent
+{
+    uint64_t    uiTraceID = 0;      ///< Trace ID correlating the events of one frame or transaction.
+    uint64_t    uiTimestamp = 0;    ///< Timestamp of the steady clock in ns; the same clock in all processes.
+    uint32_t    uiStage = 0;        ///< The stage (sdv::core::ETraceStage).
+    uint32_t    uiKey = 0;          ///< Key of the CAN message or signal.
+};
+
+/**
+ * @brief Latency trace event including the thread that recorded the event.
+ */
+struct SLatencyTraceRecord : SLatencyTraceEvent
+{
+    uint32_t    uiProcessID = 0;    ///< Process ID of the recording thread.
+    uint32_t    uiThreadID = 0;     ///< Thread ID of the recording thread.
+};
+
+/**
+ * @brief Shared memory buffer containing the latency trace events of all processes of an instance.
+ * @details The monitor creates the buffer and keeps it alive with a heartbeat. The processes of the instance open the buffer
+ * and each recording thread claims a ring of its own. Writing an event therefore doesn't need any synchronization: the
+ * thread writes the event and then publishes it by incrementing the write position of the ring. When the monitor doesn't
+ * read fast enough, the oldest events are overwritten; the reader detects and counts them as lost events.
+ * Next to the rings the buffer contains a table with the names belonging to the signal keys.
+ */
+class CLatencyTraceBuffer
+{
+public:
+    /// Amount of rings; limits the amount of threads recording at the same time.
+    static constexpr uint32_t nRingCount = 64;
+
+    /// Amount of events per ring; must be a power of two.
+    static constexpr uint32_t nRingSize = 2048;
+
+    /// Amount of names in the name table.
+    static constexpr uint32_t nNameCount = 1024;
+
+    /// Maximum length of a name including the terminating zero.
+    static constexpr uint32_t nNameLength = 60;
+
+    /// Time in ns after which the buffer is considered inactive when the monitor stopped updating the heartbeat.
+    static constexpr uint64_t uiHeartbeatTimeout = 2000000000ull;
+
+    /**
+     * @brief Constructor
+     * @param[in] uiInstanceID The instance ID of the processes being traced.
+     */
+    CLatencyTraceBuffer(uint32_t uiInstanceID = 1000u);
+
+    /**
+     * @brief Destructor
+     * @remarks Automatically closes the buffer if opened before.
+     */
+    ~CLatencyTraceBuffer();
+
+    /**
+     * @brief Copy constructor is not available.
+     * @param[in] rbuffer Reference to the buffer to copy.
+     */
+    CLatencyTraceBuffer(const CLatencyTraceBuffer& rbuffer) = delete;
+
+    /**
+     * @brief Copy assignment is not available.
+     * @param[in] rbuffer Reference to the buffer.
+     * @return Returns a reference to this buffer.
+     */
+    CLatencyTraceBuffer& operator=(const CLatencyTraceBuffer& rbuffer) = delete;
+
+    /**
+     * @brief Create the buffer and activate the recording. Used by the monitor. A previous buffer of the instance is
+     * replaced.
+     * @return Returns true when the buffer could be created; false otherwise.
+     */
+    bool Create();
+
+    /**
+     * @brief Open the buffer created by the monitor. Used by the recording processes.
+     * @return Returns true when the buffer exists and is active; false otherwise.
+     */
+    bool Open();
+
+    /**
+     * @brief Close the buffer. When created by this object, the recording is deactivated and the buffer is removed.
+     */
+    void Close();
+
+    /**
+     * @brief Is the buffer opened?
+     * @return Returns true when opened; false otherwise.
+     */
+    bool IsOpened() const;
+
+    /**
+     * @brief Is the buffer opened and is the monitor still reading?
+     * @param[in] uiTimestamp The current timestamp (see GetTimestamp).
+     * @return Returns true when events should be recorded; false otherwise.
+     */
+    bool IsActive(uint64_t uiTimestamp) const;
+
+    /**
+     * @brief Get the instance ID of the buffer.
+     * @return The instance ID.
+     */
+    uint32_t GetInstanceID() const;
+
+    /**
+     * @brief Create a new trace ID; unique for all processes using the buffer.
+     * @return The trace ID or 0 when the buffer isn't opened.
+     */
+    uint64_t NewTraceID();
+
+    /**
+     * @brief Claim a ring for the calling thread. The rings are claimed in turn, so the events of a released ring are
+     * overwritten as late as possible.
+     * @return The index of the ring or nRingCount when all rings are in use.
+     */
+    uint32_t ClaimRing();
+
+    /**
+     * @brief Release the ring claimed by the calling thread. The events in the ring stay available for the reader.
+     * @param[in] uiRing The index of the ring.
+     */
+    void ReleaseRing(uint32_t uiRing);
+
+    /**
+     * @brief Record an event. Only allowed for the thread that claimed the ring.
+     * @param[in] uiRing The index of the ring.
+     * @param[in] rsEvent Reference to the event.
+     */
+    void Record(uint32_t uiRing, const SLatencyTraceEvent& rsEvent);
+
+    /**
+     * @brief Add a name to the name table. Names that are already in the table are not added again.
+     * @param[in] uiKey The key the name belongs to.
+     * @param[in] rssName Reference to the name. Longer names are truncated.
+     */
+    void AddName(uint32_t uiKey, const std::string& rssName);
+
+    /**
+     * @brief Read the events recorded since the last call and update the heartbeat. Used by the monitor.
+     * @param[out] rvecRecords Reference to the vector the events are appended to.
+     * @return The amount of events that were overwritten before they could be read.
+     */
+    size_t Read(std::vector<SLatencyTraceRecord>& rvecRecords);
+
+    /**
+     * @brief Find the name belonging to a key.
+     * @param[in] uiKey The key.
+     * @return The name or an empty string when no name was added for the key.
+     */
+    std::string FindName(uint32_t uiKey) const;
+
+    /**
+     * @brief Get the timestamp of the steady clock used for the events.
+     * @return The timestamp in ns.
+     */
+    static uint64_t GetTimestamp();
+
+private:
+    /**
+     * @brief Ring containing the events of one thread.
+     */
+    struct SRing
+    {
+        std::atomic_uint64_t    uiOwner;                ///< Process ID (upper 32 bits) and thread ID of the owner; 0 when free.
+        std::atomic_uint64_t    uiWritePos;             ///< Amount of events written to the ring.
+        SLatencyTraceEvent      rgsEvents[nRingSize];   ///< The events.
+    };
+
+    /**
+     * @brief Entry of the name table.
+     */
+    struct SName
+    {
+        uint32_t                uiKey;                  ///< Key of the name.
+        char                    szName[nNameLength];    ///< The zero terminated name.
+    };
+
+    /**
+     * @brief Shared memory layout.
+     */
+    struct SSharedMemBuffer
+    {
+        char                    rgszSignature[8];       ///< Signature "SDV_LAT\0"
+        uint32_t                uiInstanceID;           ///< Instance ID of the server instance.
+        uint32_t                uiBufferSize;           ///< Size of the buffer; protects against different layouts.
+        std::atomic_uint32_t    uiActive;               ///< Set while the monitor is reading.
+        std::atomic_uint32_t    uiNameLock;             ///< Spin lock protecting the addition of names.
+        std::atomic_uint64_t    uiHeartbeat;            ///< Timestamp of the last read by the monitor.
+        std::atomic_uint64_t    uiNextTraceID;          ///< Next trace ID to assign.
+        std::atomic_uint32_t    uiNameCount;            ///< Amount of names in the name table.
+        std::atomic_uint32_t    uiNextRing;             ///< Ring to try first; spreads the use of the rings.
+        SName                   rgsNames[nNameCount];   ///< Name table.
+        SRing                   rgsRings[nRingCount];   ///< Rings with the events.
+    };
+
+    /**
+     * @brief Get the owner ID of the calling thread.
+     * @return The owner ID combining the process and thread ID.
+     */
+    static uint64_t GetOwnerID();
+
+    /**
+     * @brief Map the shared memory.
+     * @param[in] bCreate When set, create the shared memory; otherwise open an existing shared memory.
+     * @return Returns true when mapped; false otherwise.
+     */
+    bool Map(bool bCreate);
+
+    /**
+     * @brief Unmap the shared memory and remove it when created by this object.
+     */
+    void Unmap();
+
+    uint32_t                m_uiInstanceID = 1000;      ///< Instance ID.
+    bool                    m_bCreated = false;         ///< Set when the buffer was created by this object.
+    SSharedMemBuffer*       m_psBuffer = nullptr;       ///< The mapped buffer.
+    std::vector<uint64_t>   m_vecReadPos;               ///< Read position per ring (monitor only).
+#ifdef _WIN32
+    void*                   m_hMapFile = nullptr;       ///< File mapping handle.
+#else
+    int                     m_iFileDescr = -1;          ///< Shared memory file descriptor.
+#endif
+};
+
+#endif // !defined LATENCY_TRACE_BUFFER_H
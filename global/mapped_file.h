@@ -0,0 +1,205 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <filesystem>
+#include <cstdint>
+#include <cstddef>
+
+#ifdef _WIN32
+#pragma push_macro("interface")
+#undef interface
+#pragma push_macro("GetObject")
+#undef GetObject
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+
+#include <WinSock2.h>
+#include <Windows.h>
+
+// Resolve conflict
+#pragma pop_macro("GetObject")
+#pragma pop_macro("interface")
+#ifdef GetClassInfo
+#undef GetClassInfo
+#endif
+#elif defined __unix__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#error OS is not supported!
+#endif
+
+/**
+ * @brief Read-only memory mapped file. The file content is accessible as one contiguous block of memory, which is paged in by the
+ * operating system when accessed. This allows processing of files that are much larger than the available memory without
+ * copying the content.
+ */
+class CMappedFile
+{
+public:
+    /**
+     * @brief Default constructor.
+     */
+    CMappedFile() = default;
+
+    /**
+     * @brief Constructor opening the file.
+     * @param[in] rpathFile Reference to the path of the file to map.
+     */
+    CMappedFile(const std::filesystem::path& rpathFile)
+    {
+        Open(rpathFile);
+    }
+
+    /** No copy constructor */
+    CMappedFile(const CMappedFile&) = delete;
+
+    /**
+     * @brief Destructor; unmaps the file.
+     */
+    ~CMappedFile()
+    {
+        Close();
+    }
+
+    /** No assignment operator */
+    CMappedFile& operator=(const CMappedFile&) = delete;
+
+    /**
+     * @brief Map the file into memory (replaces a previously mapped file).
+     * @param[in] rpathFile Reference to the path of the file to map.
+     * @return Returns 'true' when the file could be opened; 'false' otherwise. An empty file is opened successfully, but doesn't
+     * provide any data.
+     */
+    bool Open(const std::filesystem::path& rpathFile)
+    {
+        Close();
+#ifdef _WIN32
+        m_hFile = CreateFileW(rpathFile.native().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_hFile == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER sSize{};
+        if (!GetFileSizeEx(m_hFile, &sSize))
+        {
+            Close();
+            return false;
+        }
+        m_nSize = static_cast<size_t>(sSize.QuadPart);
+        if (!m_nSize) return true;
+        m_hMapping = CreateFileMappingW(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_hMapping)
+        {
+            Close();
+            return false;
+        }
+        m_pData = static_cast<const char*>(MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0));
+        if (!m_pData)
+        {
+            Close();
+            return false;
+        }
+#elif defined __unix__
+        m_iFD = open(rpathFile.native().c_str(), O_RDONLY | O_CLOEXEC);
+        if (m_iFD < 0) return false;
+        struct stat sStat {};
+        if (fstat(m_iFD, &sStat) != 0 || !S_ISREG(sStat.st_mode))
+        {
+            Close();
+            return false;
+        }
+        m_nSize = static_cast<size_t>(sStat.st_size);
+        if (!m_nSize) return true;
+        void* pData = mmap(nullptr, m_nSize, PROT_READ, MAP_PRIVATE, m_iFD, 0);
+        if (pData == MAP_FAILED)
+        {
+            Close();
+            return false;
+        }
+        m_pData = static_cast<const char*>(pData);
+
+        // The file is usually processed from the beginning to the end; allow the kernel to read ahead aggressively.
+        madvise(pData, m_nSize, MADV_SEQUENTIAL);
+#endif
+        return true;
+    }
+
+    /**
+     * @brief Unmap and close the file.
+     */
+    void Close()
+    {
+#ifdef _WIN32
+        if (m_pData) UnmapViewOfFile(m_pData);
+        if (m_hMapping) CloseHandle(m_hMapping);
+        if (m_hFile != INVALID_HANDLE_VALUE) CloseHandle(m_hFile);
+        m_hMapping = nullptr;
+        m_hFile = INVALID_HANDLE_VALUE;
+#elif defined __unix__
+        if (m_pData) munmap(const_cast<char*>(m_pData), m_nSize);
+        if (m_iFD >= 0) close(m_iFD);
+        m_iFD = -1;
+#endif
+        m_pData = nullptr;
+        m_nSize = 0;
+    }
+
+    /**
+     * @brief Is the file opened?
+     * @return Returns whether the file is opened.
+     */
+    bool IsOpen() const
+    {
+#ifdef _WIN32
+        return m_hFile != INVALID_HANDLE_VALUE;
+#elif defined __unix__
+        return m_iFD >= 0;
+#endif
+    }
+
+    /**
+     * @brief Get the pointer to the file content.
+     * @return Pointer to the first byte of the file or nullptr when the file is not opened or empty.
+     */
+    const char* Data() const
+    {
+        return m_pData;
+    }
+
+    /**
+     * @brief Get the size of the file.
+     * @return The size of the file in bytes.
+     */
+    size_t Size() const
+    {
+        return m_nSize;
+    }
+
+private:
+#ifdef _WIN32
+    HANDLE          m_hFile = INVALID_HANDLE_VALUE;     ///< File handle.
+    HANDLE          m_hMapping = nullptr;               ///< File mapping handle.
+#elif defined __unix__
+    int             m_iFD = -1;                         ///< File descriptor.
+#endif
+    const char*     m_pData = nullptr;                  ///< Pointer to the mapped file content.
+    size_t          m_nSize = 0;                        ///< Size of the file.
+};
+
+#endif // !defined MAPPED_FILE_H
@@ -0,0 +1,109 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef METRICS_EXPOSITION_H
+#define METRICS_EXPOSITION_H
+
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <interfaces/metrics.h>
+
+/**
+ * @brief Split the name of a metric into the base name and the labels.
+ * @param[in] rssName Reference to the name, optionally followed by labels, e.g. sdv_can_frames_total{interface="can0"}.
+ * @param[out] rssBase Reference to the string receiving the base name.
+ * @param[out] rssLabels Reference to the string receiving the labels without the braces; empty when there are no labels.
+ */
+inline void SplitMetricName(const std::string& rssName, std::string& rssBase, std::string& rssLabels)
+{
+    size_t nPos = rssName.find('{');
+    rssBase = rssName.substr(0, nPos);
+    rssLabels.clear();
+    if (nPos == std::string::npos) return;
+    size_t nEnd = rssName.rfind('}');
+    if (nEnd != std::string::npos && nEnd > nPos) rssLabels = rssName.substr(nPos + 1, nEnd - nPos - 1);
+}
+
+/**
+ * @brief Write a metrics snapshot in the text exposition format used by Prometheus and compatible scrapers.
+ * @remarks The metrics are grouped by base name (the name without labels); the HELP and TYPE lines are written once per group.
+ * @param[in] rstream Reference to the stream to write to.
+ * @param[in] rsSnapshot Reference to the snapshot.
+ */
+inline void WriteMetricsExposition(std::ostream& rstream, const sdv::core::SMetricsSnapshot& rsSnapshot)
+{
+    // Group the metrics by base name. The snapshot is ordered by the full name, which could place another metric between the
+    // labelled variants of a metric (e.g. "sdv_x_y" sorts before "sdv_x{...}").
+    std::vector<std::pair<std::string, const sdv::core::SMetric*>> vecMetrics;
+    for (const sdv::core::SMetric& rsMetric : rsSnapshot.seqMetrics)
+        vecMetrics.emplace_back(static_cast<std::string>(rsMetric.ssName).substr(0, rsMetric.ssName.find('{')), &rsMetric);
+    std::stable_sort(vecMetrics.begin(), vecMetrics.end(),
+        [](const auto& rprLeft, const auto& rprRight) { return rprLeft.first < rprRight.first; });
+
+    std::string ssLastBase;
+    for (const auto& rprMetric : vecMetrics)
+    {
+        const sdv::core::SMetric& rsMetric = *rprMetric.second;
+        std::string ssBase, ssLabels;
+        SplitMetricName(rsMetric.ssName, ssBase, ssLabels);
+        if (ssBase.empty()) continue;
+
+        if (ssBase != ssLastBase)
+        {
+            ssLastBase = ssBase;
+            std::string ssHelp;
+            for (char c : static_cast<std::string>(rsMetric.ssHelp))
+            {
+                switch (c)
+                {
+                case '\\':  ssHelp += "\\\\";   break;
+                case '\n':  ssHelp += "\\n";    break;
+                default:    ssHelp += c;        break;
+                }
+            }
+            rstream << "# HELP " << ssBase << " " << ssHelp << "\n";
+            rstream << "# TYPE " << ssBase << " ";
+            switch (rsMetric.eType)
+            {
+            case sdv::core::EMetricType::counter:   rstream << "counter\n";     break;
+            case sdv::core::EMetricType::gauge:     rstream << "gauge\n";       break;
+            case sdv::core::EMetricType::histogram: rstream << "histogram\n";   break;
+            default:                                rstream << "untyped\n";     break;
+            }
+        }
+
+        std::string ssLabelsBraced = ssLabels.empty() ? std::string() : "{" + ssLabels + "}";
+        if (rsMetric.eType != sdv::core::EMetricType::histogram)
+        {
+            rstream << ssBase << ssLabelsBraced << " " << rsMetric.iValue << "\n";
+            continue;
+        }
+        for (const sdv::core::SMetricBucket& rsBucket : rsMetric.seqBuckets)
+        {
+            rstream << ssBase << "_bucket{" << ssLabels << (ssLabels.empty() ? "" : ",") << "le=\"";
+            if (rsBucket.uiUpperBound == UINT64_MAX)
+                rstream << "+Inf";
+            else
+                rstream << rsBucket.uiUpperBound;
+            rstream << "\"} " << rsBucket.uiCount << "\n";
+        }
+        rstream << ssBase << "_sum" << ssLabelsBraced << " " << rsMetric.uiSum << "\n";
+        rstream << ssBase << "_count" << ssLabelsBraced << " " << rsMetric.uiCount << "\n";
+    }
+}
+
+#endif // !defined METRICS_EXPOSITION_H
@@ -15,12 +15,15 @@
 #define PROCESS_WATCHDOG_H
 
 #include <thread>
+#include <chrono>
 #include <cstdint>
 #include <string>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <atomic>
+#include <mutex>
+#include <condition_variable>
 #ifdef _WIN32
 // Prevent reassignment of "interface"
 #pragma push_macro("interface")
@@ -77,7 +80,10 @@ public:
      */
     ~CProcessWatchdog()
     {
+        std::unique_lock<std::mutex> lock(m_mtxWatchdog);
         m_bTerminateWatchdog = true;
+        lock.unlock();
+        m_cvWatchdog.notify_all();
         if (m_threadWatchdog.joinable())
             m_threadWatchdog.join();
     }
@@ -128,13 +134,20 @@ private:
     void WatchdogThreadFunc(int64_t iWatchdogTimeS)
     {
         // Run for the most the set time; then terminate...
+        // The thread sleeps until the deadline is reached or the watchdog is cancelled; there is no periodic wakeup.
         auto tpStart = std::chrono::steady_clock::now();
+        auto tpDeadline = tpStart + std::chrono::seconds(iWatchdogTimeS);
+        std::unique_lock<std::mutex> lock(m_mtxWatchdog);
         while (!m_bTerminateWatchdog)
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+            if (m_cvWatchdog.wait_until(lock, tpDeadline, [this]() { return m_bTerminateWatchdog.load(); }))
+                break;
             auto tpNow = std::chrono::steady_clock::now();
-            if (std::chrono::duration_cast<std::chrono::seconds>(tpNow - tpStart).count() > iWatchdogTimeS)
+            if (tpNow >= tpDeadline)
             {
+                // Check again after one second.
+                tpDeadline = tpNow + std::chrono::seconds(1);
+
                 // Do not end the process when a debugger is present.
                 if (IsDebuggerPresent()) continue;
 
@@ -158,8 +171,10 @@ private:
         }
     }
 
-    std::atomic_bool    m_bTerminateWatchdog = false;       ///< When set, allows the thread to terminate.
-    std::thread         m_threadWatchdog;                   ///< The watchdog thread.
+    std::atomic_bool        m_bTerminateWatchdog = false;   ///< When set, allows the thread to terminate.
+    std::mutex              m_mtxWatchdog;                  ///< Protects the termination flag for the condition variable.
+    std::condition_variable m_cvWatchdog;                   ///< Wakes the watchdog thread on cancellation.
+    std::thread             m_threadWatchdog;               ///< The watchdog thread.
 };
 
 #endif // !defined PROCESS_WATCHDOG_H
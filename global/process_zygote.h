@@ -0,0 +1,400 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef PROCESS_ZYGOTE_H
+#define PROCESS_ZYGOTE_H
+
+#ifdef __unix__
+
+#include <sys/socket.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <filesystem>
+
+/**
+ * @brief Zygote process support.
+ * @details A zygote is a pre-initialized instance of an executable (e.g. sdv_iso), which has already loaded the framework
+ * libraries. Instead of starting the executable from scratch, the zygote creates a copy of itself for each process request.
+ * The copy continues with the provided command line arguments as if it was started normally. The copy is created with fork()
+ * by an intermediate process, which ends directly afterwards. While a request is being processed, the requesting process is
+ * registered as child subreaper (PR_SET_CHILD_SUBREAPER), which re-parents the orphaned copy to the requesting process instead
+ * of to the init process. This allows the requesting process to monitor the process and to retrieve its exit code as if it
+ * was started directly.
+ *
+ * The zygote is started with the single command line argument "--zygote_fd<fd>", where fd is the file descriptor of the
+ * connection to the requesting process. The zygote ends when the connection is closed.
+ *
+ * Request: uint32 flags, uint32 argument count, followed by the arguments (uint32 length followed by the characters).
+ * Response: int32 process ID of the new process or 0 when the process could not be created.
+ */
+namespace zygote
+{
+    /// Command line argument prefix used to start an executable in zygote mode; the file descriptor follows directly.
+    inline constexpr const char szZygoteArg[] = "--zygote_fd";
+
+    /// File descriptor number the connection is assigned to in the zygote process.
+    inline constexpr int iZygoteFD = 3;
+
+    /// Request flag: reduce the rights of the new process to the rights of the real user and group.
+    inline constexpr uint32_t uiFlagReduceRights = 1;
+
+    /**
+     * @brief Write the complete buffer to the socket.
+     * @remarks The data is sent with MSG_NOSIGNAL. When the other side of the connection has ended, the function fails with
+     * EPIPE instead of raising SIGPIPE, which would terminate the writing process.
+     * @param[in] iFD The file descriptor of the socket to write to.
+     * @param[in] pData Pointer to the data.
+     * @param[in] nSize Size of the data.
+     * @return Returns 'true' when all data was written; 'false' otherwise.
+     */
+    inline bool WriteAll(int iFD, const void* pData, size_t nSize)
+    {
+        const char* pBuffer = static_cast<const char*>(pData);
+        while (nSize)
+        {
+            ssize_t nWritten = send(iFD, pBuffer, nSize, MSG_NOSIGNAL);
+            if (nWritten < 0 && errno == EINTR) continue;
+            if (nWritten <= 0) return false;
+            pBuffer += nWritten;
+            nSize -= static_cast<size_t>(nWritten);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Read the complete buffer from the file descriptor.
+     * @param[in] iFD The file descriptor to read from.
+     * @param[out] pData Pointer to the buffer receiving the data.
+     * @param[in] nSize Size of the data to read.
+     * @return Returns 'true' when all data was read; 'false' when the connection was closed or an error occurred.
+     */
+    inline bool ReadAll(int iFD, void* pData, size_t nSize)
+    {
+        char* pBuffer = static_cast<char*>(pData);
+        while (nSize)
+        {
+            ssize_t nRead = read(iFD, pBuffer, nSize);
+            if (nRead < 0 && errno == EINTR) continue;
+            if (nRead <= 0) return false;
+            pBuffer += nRead;
+            nSize -= static_cast<size_t>(nRead);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Check whether the command line argument starts the zygote mode.
+     * @param[in] szArg The command line argument.
+     * @return Returns the file descriptor of the connection or -1 when the argument doesn't start the zygote mode.
+     */
+    inline int GetZygoteFD(const char* szArg)
+    {
+        if (!szArg || std::strncmp(szArg, szZygoteArg, sizeof(szZygoteArg) - 1) != 0) return -1;
+        const char* szFD = szArg + sizeof(szZygoteArg) - 1;
+        if (!*szFD) return -1;
+        char* szEnd = nullptr;
+        long lFD = std::strtol(szFD, &szEnd, 10);
+        if (*szEnd || lFD < 0) return -1;
+        return static_cast<int>(lFD);
+    }
+
+    /**
+     * @brief Zygote client; used by the requesting process to start the zygote and to request new processes.
+     */
+    class CZygoteClient
+    {
+    public:
+        /**
+         * @brief Default constructor.
+         */
+        CZygoteClient() = default;
+
+        /**
+         * @brief Destructor; closes the connection and ends the zygote.
+         */
+        ~CZygoteClient()
+        {
+            Close();
+        }
+
+        /**
+         * @brief Start the zygote process (if not started already).
+         * @param[in] rpathModule Path to the executable supporting the zygote mode.
+         * @return Returns 'true' when the zygote is running; 'false' otherwise.
+         */
+        bool Start(const std::filesystem::path& rpathModule)
+        {
+            std::unique_lock<std::mutex> lock(m_mtxZygote);
+            if (m_iFD >= 0) return true;
+
+            int rgiFD[2] = { -1, -1 };
+            if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, rgiFD) != 0) return false;
+
+            // Assign the zygote end of the connection to the predefined file descriptor (dup2 removes the close-on-exec flag).
+            posix_spawn_file_actions_t sActions;
+            posix_spawn_file_actions_init(&sActions);
+            posix_spawn_file_actions_adddup2(&sActions, rgiFD[1], iZygoteFD);
+
+            std::string ssModule = rpathModule.native();
+            std::string ssArg = std::string(szZygoteArg) + std::to_string(iZygoteFD);
+            std::vector<char*> vecArgs = { &ssModule.front(), &ssArg.front(), nullptr };
+            std::vector<char*> vecEnv = { nullptr };
+            pid_t pid = 0;
+            bool bSubreaper = EnableSubreaper();
+            int iResult = posix_spawn(&pid, ssModule.c_str(), &sActions, nullptr, vecArgs.data(), vecEnv.data());
+            if (bSubreaper) prctl(PR_SET_CHILD_SUBREAPER, 0, 0, 0, 0);
+            posix_spawn_file_actions_destroy(&sActions);
+            close(rgiFD[1]);
+            if (iResult != 0)
+            {
+                close(rgiFD[0]);
+                return false;
+            }
+            m_iFD = rgiFD[0];
+            m_pidZygote = pid;
+            return true;
+        }
+
+        /**
+         * @brief Is the zygote running?
+         * @return Returns 'true' when the zygote was started and the connection is available.
+         */
+        bool IsRunning() const
+        {
+            std::unique_lock<std::mutex> lock(m_mtxZygote);
+            return m_iFD >= 0;
+        }
+
+        /**
+         * @brief Get the process ID of the zygote.
+         * @return The process ID or 0 when the zygote is not running.
+         */
+        pid_t GetZygoteProcessID() const
+        {
+            std::unique_lock<std::mutex> lock(m_mtxZygote);
+            return m_pidZygote;
+        }
+
+        /**
+         * @brief Request a new process from the zygote.
+         * @param[in] rvecArgs Reference to the command line arguments (excluding the module name).
+         * @param[in] bReduceRights When set, the process is started with the rights of the real user and group.
+         * @return The process ID of the new process (a child of the calling process) or 0 when the request failed. The zygote
+         * connection is closed on a communication error (e.g. EPIPE when the zygote has ended); the caller should start the
+         * process directly. A succeeding call to Start restarts the zygote.
+         */
+        pid_t Spawn(const std::vector<std::string>& rvecArgs, bool bReduceRights)
+        {
+            std::unique_lock<std::mutex> lock(m_mtxZygote);
+            if (m_iFD < 0) return 0;
+
+            // Compose the request
+            std::string ssRequest;
+            auto fnAppend = [&](uint32_t uiValue) { ssRequest.append(reinterpret_cast<const char*>(&uiValue), sizeof(uiValue)); };
+            fnAppend(bReduceRights ? uiFlagReduceRights : 0u);
+            fnAppend(static_cast<uint32_t>(rvecArgs.size()));
+            for (const std::string& rssArg : rvecArgs)
+            {
+                fnAppend(static_cast<uint32_t>(rssArg.size()));
+                ssRequest.append(rssArg);
+            }
+
+            // Send the request and wait for the reply. The created process is re-parented to this process while being a
+            // child subreaper.
+            int32_t iPid = 0;
+            bool bSubreaper = EnableSubreaper();
+            bool bResult = WriteAll(m_iFD, ssRequest.data(), ssRequest.size()) && ReadAll(m_iFD, &iPid, sizeof(iPid));
+            if (bSubreaper) prctl(PR_SET_CHILD_SUBREAPER, 0, 0, 0, 0);
+            if (!bResult)
+            {
+                lock.unlock();
+                Close();
+                return 0;
+            }
+            return static_cast<pid_t>(iPid);
+        }
+
+        /**
+         * @brief Close the connection; the zygote ends.
+         */
+        void Close()
+        {
+            std::unique_lock<std::mutex> lock(m_mtxZygote);
+            if (m_iFD < 0) return;
+            close(m_iFD);
+            m_iFD = -1;
+
+            // The zygote is a child process; collect the exit status to prevent a zombie.
+            if (m_pidZygote) waitpid(m_pidZygote, nullptr, 0);
+            m_pidZygote = 0;
+        }
+
+    private:
+        /**
+         * @brief Register this process as child subreaper, causing orphaned descendants to be re-parented to this process.
+         * @remarks The setting applies to the complete process; it is only enabled while starting the zygote and while
+         * processing a request, limiting the re-parenting of unrelated orphaned descendants to that period.
+         * @return Returns 'true' when the setting was enabled by this function and should be disabled afterwards; 'false' when
+         * the process was already registered as child subreaper or the registration failed.
+         */
+        static bool EnableSubreaper()
+        {
+            int iSubreaper = 0;
+            if (prctl(PR_GET_CHILD_SUBREAPER, &iSubreaper, 0, 0, 0) != 0 || iSubreaper) return false;
+            return prctl(PR_SET_CHILD_SUBREAPER, 1, 0, 0, 0) == 0;
+        }
+
+        mutable std::mutex  m_mtxZygote;            ///< Protect the connection (one request at the time).
+        int                 m_iFD = -1;             ///< Connection to the zygote.
+        pid_t               m_pidZygote = 0;        ///< Process ID of the zygote.
+    };
+
+    /**
+     * @brief Zygote server; runs within the zygote process.
+     */
+    class CZygoteServer
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param[in] iFD The file descriptor of the connection to the requesting process.
+         */
+        CZygoteServer(int iFD) : m_iFD(iFD)
+        {}
+
+        /**
+         * @brief Destructor. Libraries loaded by the zygote stay loaded.
+         */
+        ~CZygoteServer()
+        {
+            if (m_iFD >= 0) close(m_iFD);
+        }
+
+        /**
+         * @brief Preload a library, allowing the processes created by the zygote to share the already loaded and relocated
+         * library.
+         * @attention Loading the library runs its static constructors within the zygote process. Preloaded libraries must not
+         * start threads or open resources (files, sockets, shared memory) at load time; threads are not copied to the created
+         * processes and the zygote must stay single threaded, and open resources would be shared by all created processes.
+         * @param[in] rpathLibrary Path to the library.
+         * @return Returns 'true' when the library could be loaded; 'false' otherwise.
+         */
+        bool Preload(const std::filesystem::path& rpathLibrary)
+        {
+            void* pModule = dlopen(rpathLibrary.native().c_str(), RTLD_NOW);
+            if (!pModule) return false;
+            m_vecModules.push_back(pModule);
+            return true;
+        }
+
+        /**
+         * @brief Process requests.
+         * @attention The zygote process must be single threaded when calling this function.
+         * @param[out] rvecArgs Reference to the vector receiving the command line arguments of the new process.
+         * @return Returns 'false' in the zygote process when the connection was closed. Returns 'true' in a newly created process;
+         * the process should continue with the command line arguments provided in rvecArgs.
+         */
+        bool Run(std::vector<std::string>& rvecArgs)
+        {
+            if (m_iFD < 0) return false;
+            while (true)
+            {
+                // Receive the request
+                uint32_t uiFlags = 0, uiCount = 0;
+                if (!ReadAll(m_iFD, &uiFlags, sizeof(uiFlags)) || !ReadAll(m_iFD, &uiCount, sizeof(uiCount)))
+                    return false;
+                rvecArgs.clear();
+                for (uint32_t uiIndex = 0; uiIndex < uiCount; uiIndex++)
+                {
+                    uint32_t uiLength = 0;
+                    if (!ReadAll(m_iFD, &uiLength, sizeof(uiLength))) return false;
+                    std::string ssArg(uiLength, '\0');
+                    if (uiLength && !ReadAll(m_iFD, &ssArg.front(), uiLength)) return false;
+                    rvecArgs.push_back(std::move(ssArg));
+                }
+
+                // Create a copy of this process through an intermediate process. The intermediate process ends directly after
+                // the copy was created, which re-parents the copy to the requesting process (being child subreaper during the
+                // request). Both processes are created with fork(), keeping the state of the C library consistent in the copy.
+                int32_t iPid = 0;
+                int rgiPipe[2] = { -1, -1 };
+                if (pipe2(rgiPipe, O_CLOEXEC) == 0)
+                {
+                    pid_t pidIntermediate = fork();
+                    if (pidIntermediate == 0)
+                    {
+                        close(rgiPipe[0]);
+                        pid_t pid = fork();
+                        if (pid == 0)
+                        {
+                            // New process; detach from the zygote.
+                            close(rgiPipe[1]);
+                            close(m_iFD);
+                            m_iFD = -1;
+
+                            // Reduce rights
+                            if (uiFlags & uiFlagReduceRights)
+                            {
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-result"
+#endif
+                                setgid(getgid());
+                                setuid(getuid());
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+                            }
+                            return true;
+                        }
+
+                        // Intermediate process; provide the process ID to the zygote and end without any cleanup.
+                        iPid = pid > 0 ? static_cast<int32_t>(pid) : 0;
+                        _exit(write(rgiPipe[1], &iPid, sizeof(iPid)) == static_cast<ssize_t>(sizeof(iPid)) ? 0 : 1);
+                    }
+                    close(rgiPipe[1]);
+
+                    // The new process is re-parented when the intermediate process has ended.
+                    if (pidIntermediate > 0)
+                    {
+                        if (!ReadAll(rgiPipe[0], &iPid, sizeof(iPid))) iPid = 0;
+                        while (waitpid(pidIntermediate, nullptr, 0) < 0 && errno == EINTR);
+                    }
+                    close(rgiPipe[0]);
+                }
+
+                // Reply with the process ID.
+                if (!WriteAll(m_iFD, &iPid, sizeof(iPid))) return false;
+            }
+        }
+
+    private:
+        int                 m_iFD = -1;             ///< Connection to the requesting process.
+        std::vector<void*>  m_vecModules;           ///< Preloaded libraries.
+    };
+} // namespace zygote
+
+#endif // defined __unix__
+
+#endif // !defined PROCESS_ZYGOTE_H
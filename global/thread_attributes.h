@@ -0,0 +1,217 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef THREAD_ATTRIBUTES_H
+#define THREAD_ATTRIBUTES_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <support/component_impl.h>
+#include <support/local_service_access.h>
+
+#ifdef _WIN32
+// Resolve conflict
+#pragma push_macro("interface")
+#undef interface
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+
+#include <WinSock2.h>
+#include <Windows.h>
+
+// Resolve conflict
+#pragma pop_macro("interface")
+#ifdef GetClassInfo
+#undef GetClassInfo
+#endif
+#elif defined __unix__
+#include <cerrno>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#else
+#error OS is not supported!
+#endif
+
+/**
+ * @brief Parse a list of CPU numbers and ranges, e.g. "2,3" or "0-3,6".
+ * @param[in] rssList Reference to the string containing the list.
+ * @param[out] rvecCpus Reference to the vector receiving the CPU numbers.
+ * @return Returns whether the list could be parsed. An empty list is valid and results in an empty vector.
+ */
+inline bool ParseCpuList(const std::string& rssList, std::vector<uint32_t>& rvecCpus)
+{
+    rvecCpus.clear();
+    size_t nPos = 0;
+    while (nPos < rssList.size())
+    {
+        size_t nEnd = rssList.find(',', nPos);
+        if (nEnd == std::string::npos) nEnd = rssList.size();
+        std::string ssItem = rssList.substr(nPos, nEnd - nPos);
+        nPos = nEnd + 1;
+
+        // Remove whitespace
+        ssItem.erase(0, ssItem.find_first_not_of(" \t"));
+        ssItem.erase(ssItem.find_last_not_of(" \t") + 1);
+        if (ssItem.empty() || ssItem.find_first_not_of("0123456789-") != std::string::npos) return false;
+
+        // Single CPU or range
+        size_t nDash = ssItem.find('-');
+        if (nDash == 0 || nDash == ssItem.size() - 1 || ssItem.find('-', nDash + 1) != std::string::npos) return false;
+        uint32_t uiFirst = static_cast<uint32_t>(std::strtoul(ssItem.substr(0, nDash).c_str(), nullptr, 10));
+        uint32_t uiLast = nDash == std::string::npos ? uiFirst :
+            static_cast<uint32_t>(std::strtoul(ssItem.substr(nDash + 1).c_str(), nullptr, 10));
+        if (uiLast < uiFirst || uiLast >= 1024) return false;
+        for (uint32_t uiCpu = uiFirst; uiCpu <= uiLast; uiCpu++)
+            rvecCpus.push_back(uiCpu);
+    }
+    return true;
+}
+
+/**
+ * @brief Real-time attributes of the latency critical threads of a service. The attributes are configured in the RealTime table
+ * of the object configuration by chaining the parameter map into the parameter map of the service:
+ * @code
+ * [RealTime]
+ * Priority = 80
+ * CpuAffinity = "2,3"
+ * LockMemory = true
+ * @endcode
+ * The thread applies the attributes to itself when started. Without configuration, the thread keeps the default attributes.
+ */
+class CThreadAttributes : public sdv::CSdvParamMap
+{
+public:
+    // Parameter map
+    BEGIN_SDV_PARAM_MAP()
+        SDV_PARAM_GROUP("RealTime")
+        SDV_PARAM_NUMBER_ENTRY(m_uiPriority, "Priority", 0u, >= 0u, <= 99u, "",
+            "Real-time priority (SCHED_FIFO) of the threads. Use 0 to keep the default scheduling policy. On Windows, a priority "
+            "of 50 and higher maps to time critical and a lower priority to highest.")
+        SDV_PARAM_STRING_ENTRY(m_ssCpuAffinity, "CpuAffinity", "", "", "",
+            "CPUs the threads are restricted to, e.g. \"2,3\" or \"0-3\". Leave empty to run on any CPU.")
+        SDV_PARAM_ENTRY(m_bLockMemory, "LockMemory", false, "",
+            "Lock the current and future memory of the process in RAM (mlockall) to prevent page faults. Not available on "
+            "Windows.")
+    END_SDV_PARAM_MAP()
+
+    /**
+     * @brief Are any attributes configured?
+     * @return Returns 'true' when at least one attribute differs from the default.
+     */
+    bool IsConfigured() const
+    {
+        return m_uiPriority || !m_ssCpuAffinity.empty() || m_bLockMemory;
+    }
+
+    /**
+     * @brief Apply the attributes to the calling thread. Attributes that cannot be applied (e.g. due to missing privileges) are
+     * reported in the log; the thread continues with its current attributes.
+     * @param[in] rssThreadName Reference to the name of the thread used for reporting.
+     * @return Returns whether all configured attributes could be applied.
+     */
+    bool Apply(const std::string& rssThreadName) const
+    {
+        if (!IsConfigured()) return true;
+        bool bResult = true;
+
+        // The memory lock is process wide; lock once.
+        static std::atomic_bool bMemoryLocked = false;
+        if (m_bLockMemory && !bMemoryLocked.exchange(true))
+        {
+#ifdef _WIN32
+            SDV_LOG_WARNING("Memory locking is not supported; requested for thread ", rssThreadName);
+            bResult = false;
+#elif defined __unix__
+            if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+            {
+                SDV_LOG_WARNING("Cannot lock the process memory for thread ", rssThreadName, ": ", std::strerror(errno));
+                bResult = false;
+            }
+#endif
+        }
+
+        if (!m_ssCpuAffinity.empty())
+        {
+            std::vector<uint32_t> vecCpus;
+            if (!ParseCpuList(m_ssCpuAffinity, vecCpus))
+            {
+                SDV_LOG_WARNING("Invalid CPU affinity \"", m_ssCpuAffinity, "\" for thread ", rssThreadName);
+                bResult = false;
+            }
+            else
+            {
+#ifdef _WIN32
+                DWORD_PTR dwMask = 0;
+                for (uint32_t uiCpu : vecCpus)
+                    if (uiCpu < sizeof(DWORD_PTR) * 8) dwMask |= static_cast<DWORD_PTR>(1) << uiCpu;
+                if (!dwMask || !SetThreadAffinityMask(GetCurrentThread(), dwMask))
+                {
+                    SDV_LOG_WARNING("Cannot set the CPU affinity \"", m_ssCpuAffinity, "\" for thread ", rssThreadName);
+                    bResult = false;
+                }
+#elif defined __unix__
+                cpu_set_t sCpuSet;
+                CPU_ZERO(&sCpuSet);
+                for (uint32_t uiCpu : vecCpus)
+                    if (uiCpu < CPU_SETSIZE) CPU_SET(uiCpu, &sCpuSet);
+                int iError = pthread_setaffinity_np(pthread_self(), sizeof(sCpuSet), &sCpuSet);
+                if (iError)
+                {
+                    SDV_LOG_WARNING("Cannot set the CPU affinity \"", m_ssCpuAffinity, "\" for thread ", rssThreadName, ": ",
+                        std::strerror(iError));
+                    bResult = false;
+                }
+#endif
+            }
+        }
+
+        if (m_uiPriority)
+        {
+#ifdef _WIN32
+            if (!SetThreadPriority(GetCurrentThread(),
+                m_uiPriority >= 50 ? THREAD_PRIORITY_TIME_CRITICAL : THREAD_PRIORITY_HIGHEST))
+            {
+                SDV_LOG_WARNING("Cannot set the priority ", m_uiPriority, " for thread ", rssThreadName);
+                bResult = false;
+            }
+#elif defined __unix__
+            // Requires CAP_SYS_NICE or a sufficient RLIMIT_RTPRIO.
+            sched_param sParam{};
+            sParam.sched_priority = static_cast<int>(m_uiPriority);
+            int iError = pthread_setschedparam(pthread_self(), SCHED_FIFO, &sParam);
+            if (iError)
+            {
+                SDV_LOG_WARNING("Cannot set the real-time priority ", m_uiPriority, " for thread ", rssThreadName, ": ",
+                    std::strerror(iError));
+                bResult = false;
+            }
+#endif
+        }
+
+        return bResult;
+    }
+
+private:
+    uint32_t        m_uiPriority = 0;       ///< Real-time priority; 0 for the default scheduling policy.
+    std::string     m_ssCpuAffinity;        ///< CPU list the threads are restricted to; empty for any CPU.
+    bool            m_bLockMemory = false;  ///< When set, lock the process memory.
+};
+
+#endif // !defined THREAD_ATTRIBUTES_H
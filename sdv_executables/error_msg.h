@@ -59,6 +59,7 @@ MAKE_ERROR_MSG(-133, REPOSITORY_SERVICE_ACCESS_ERROR, "Repository service is not
 MAKE_ERROR_MSG(-134, CONFIG_SERVICE_ACCESS_ERROR, "Configuration service is not accessible.", "The configuration service could not be accessed.")
 MAKE_ERROR_MSG(-135, COMMUNICATION_CONTROL_SERVICE_ACCESS_ERROR, "Communication control service is not accessible.", "The communication control service service could not be accessed.")
 MAKE_ERROR_MSG(-136, APP_CONTROL_SERVICE_ACCESS_ERROR, "Application control service is not accessible.", "The application control service could not be accessed.")
+MAKE_ERROR_MSG(-137, METRICS_SERVICE_ACCESS_ERROR, "Metrics service is not accessible.", "The metrics service could not be accessed.")
 MAKE_ERROR_MSG(-170, CANNOT_FIND_OBJECT, "The object cannot be found.", "A search for an object with supplied name was not successful.")
 
 
@@ -83,6 +84,7 @@ MAKE_ERROR_MSG(-822, CORE_NOT_STARTED, "The SDV core process was not running.",
 MAKE_ERROR_MSG(-823, SHUTDOWN_CORE_ERROR, "Could not start the SDV core process.", "Failed to start the SDV core process.")
 MAKE_ERROR_MSG(-840, START_OBJECT_ERROR, "Could not start the object.", "Failed to start an object.")
 MAKE_ERROR_MSG(-841, STOP_OBJECT_ERROR, "Could not stop the object.", "Failed to stop/destroy an object.")
+MAKE_ERROR_MSG(-845, METRICS_EXPORT_ERROR, "Could not export the metrics.", "Failed to write the metrics exposition file.")
 
 
 ////////// SDV PACKAGER ERROR CODES ////////////
@@ -105,6 +107,7 @@ MAKE_ERROR_MSG(-1018, CMDLN_INVALID_PARAM_STRING, "The configuration parameter s
 MAKE_ERROR_MSG(-1019, CMDLN_INVALID_PARAM_FILE, "The configuration parameter TOML file could not be read.", "The configuration parameter TOML file contains errors or cannot be read.")
 MAKE_ERROR_MSG(-1020, CMDLN_TOO_MANY_CONFIG_TARGETS, "Too many configuration targets were selected.", "Only one configuration target can be selected for configuration merging.")
 MAKE_ERROR_MSG(-1021, CMDLN_MISSING_TARGET, "No target was provided.", "Cannot continue without target.")
+MAKE_ERROR_MSG(-1022, CMDLN_DELTA_BASE_ERROR, "Installation manifest of the delta base cannot be found.", "The supplied installation manifest or installation directory to create the delta package for doesn't exist.")
 MAKE_ERROR_MSG(-1030, SAVE_INSTALL_MANIFEST_ERROR, "Failed to save the installation manifest.", "Saving the installation manifest returned with an error.")
 MAKE_ERROR_MSG(-1031, SAVE_SETTINGS_FILE_ERROR, "Failed to save application settings file.", "Saving the application settings file returned with an error.")
 MAKE_ERROR_MSG(-1035, SAVE_CONFIG_FILE_ERROR, "Failed to save the config file.", "Saving the configuration file returned with an error.")
@@ -123,6 +126,14 @@ MAKE_ERROR_MSG(-1062, PARTLY_FAILED_UPDATING_CONFIG, "The configuration could on
 ////////// SDV TRACE MONITOR ERROR CODES ////////////
 MAKE_ERROR_MSG(-5500, TRACE_MON_REG_HNDLR_ERROR, "Failed to register application control handler.", "The OS returned an error during the registration of the application control handler.")
 MAKE_ERROR_MSG(-5501, TRACE_MON_FIFO_OPEN_ERROR, "Failed to open the trace fifo.", "Failure trying to open a connection to the trace fifo.")
+MAKE_ERROR_MSG(-5502, TRACE_MON_LATENCY_CREATE_ERROR, "Failed to create the latency trace buffer.", "Failure trying to create the shared memory receiving the latency trace points.")
+MAKE_ERROR_MSG(-5503, TRACE_MON_LATENCY_EXPORT_ERROR, "Failed to export the latency trace.", "Failure trying to write the latency trace file.")
+
+
+
+////////// SDV CAN CONVERT ERROR CODES ////////////
+MAKE_ERROR_MSG(-5600, CAN_TRACE_READ_ERROR, "Failed to read the CAN trace file.", "The source file could not be read or is not a valid ASC or binary capture file.")
+MAKE_ERROR_MSG(-5601, CAN_TRACE_WRITE_ERROR, "Failed to write the CAN trace file.", "The target file could not be written.")
 
 
 
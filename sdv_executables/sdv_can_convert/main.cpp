@@ -0,0 +1,164 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "../../global/process_watchdog.h"
+#include <interfaces/core.h>
+#include <interfaces/mem.h>
+#include "../../global/cmdlnparser/cmdlnparser.cpp"
+#include "../../global/ascformat/ascreader.cpp"
+#include "../../global/ascformat/ascwriter.cpp"
+#include "../../global/localmemmgr.h"
+#include <iostream>
+#include "../error_msg.h"
+
+#if defined(_WIN32) && defined(_UNICODE)
+extern "C" int wmain(int iArgc, const wchar_t* rgszArgv[])
+#else
+extern "C" int main(int iArgc, const char* rgszArgv[])
+#endif
+{
+    // Workaround for GCC to make certain that POSIX thread library is loaded before the components are loaded.
+    CProcessWatchdog watchdog;
+
+    // Suppress the warning supplied by ccpcheck about an unsused variable. The memory manager registers itself into the system and
+    // needs to stay in scope.
+    // cppcheck-suppress unusedVariable
+    CLocalMemMgr memmgr;
+
+    CCommandLine cmdln(static_cast<uint32_t>(CCommandLine::EParseFlags::no_assignment_character));
+    bool bHelp = false;
+    bool bError = false;
+    bool bSilent = false;
+    bool bVerbose = false;
+    bool bInfo = false;
+    size_t nBlockFrames = 4096;
+    std::vector<std::filesystem::path> vecFileNames;
+    try
+    {
+        auto& rArgHelpDef = cmdln.DefineOption("?", bHelp, "Show help");
+        rArgHelpDef.AddSubOptionName("help");
+        auto& rArgSilentDef = cmdln.DefineOption("s", bSilent, "Do not show any information on STDOUT. Not compatible with 'verbose'.");
+        rArgSilentDef.AddSubOptionName("silent");
+        auto& rArgVerboseDef = cmdln.DefineOption("v", bVerbose, "Provide verbose information. Not compatible with 'silent'.");
+        rArgVerboseDef.AddSubOptionName("verbose");
+        cmdln.DefineSubOption("info", bInfo, "Show the index information of a binary capture file (no conversion).");
+        cmdln.DefineSubOption("block_frames", nBlockFrames, "Amount of frames per block of the binary capture file (default=4096).");
+        cmdln.DefineDefaultArgument(vecFileNames, "Source file followed by the target file. A target file with the extension "
+            "'.cancap' is written in the binary capture format; otherwise the ASC format is written.");
+        cmdln.Parse(static_cast<size_t>(iArgc), rgszArgv);
+    } catch (const SArgumentParseException& rsExcept)
+    {
+        std::cout << "ERROR: " << rsExcept.what() << std::endl;
+        bHelp = true;
+        bError = true;
+    }
+
+    if (!bSilent)
+    {
+        std::cout << "CAN trace conversion utility" << std::endl;
+        std::cout << "Copyright (C): 2022-2026 ZF Friedrichshafen AG" << std::endl;
+        std::cout << "Author: Erik Verhoeven" << std::endl;
+    }
+    if (!bHelp && bSilent && bVerbose)
+    {
+        std::cout << "ERROR: " << CMDLN_SILENT_VERBOSE_MSG << std::endl;
+        return CMDLN_SILENT_VERBOSE;
+    }
+    if (!bHelp && vecFileNames.empty())
+    {
+        std::cout << "ERROR: " << CMDLN_SOURCE_FILE_MISSING_MSG << std::endl;
+        bHelp = true;
+        bError = true;
+    }
+    if (!bHelp && vecFileNames.size() != (bInfo ? 1u : 2u))
+    {
+        std::cout << "ERROR: " << CMDLN_ARG_ERR_MSG << std::endl;
+        bHelp = true;
+        bError = true;
+    }
+    if (bHelp)
+    {
+        if (!bSilent)
+            cmdln.PrintHelp(std::cout);
+        return bError ? CMDLN_ARG_ERR : NO_ERROR;
+    }
+
+    // Show the capture file index
+    if (bInfo)
+    {
+        asc::CCaptureReader reader;
+        if (!reader.Open(vecFileNames[0]))
+        {
+            if (!bSilent)
+                std::cout << "ERROR: " << CAN_TRACE_READ_ERROR_MSG << std::endl;
+            return CAN_TRACE_READ_ERROR;
+        }
+        if (bSilent) return NO_ERROR;
+        std::cout << "Frames: " << reader.GetFrameCount() << std::endl;
+        std::cout << "Blocks: " << reader.GetBlocks().size() << std::endl;
+        if (!reader.GetBlocks().empty())
+            std::cout << "Time range: " << reader.GetBlocks().front().dFirstTimestamp << "s - " <<
+                reader.GetBlocks().back().dLastTimestamp << "s" << std::endl;
+        std::cout << "Channel/ID entries: " << reader.GetIds().size() << std::endl;
+        if (bVerbose)
+        {
+            for (const asc::SCaptureIdInfo& rsId : reader.GetIds())
+                std::cout << "  Channel " << std::dec << rsId.uiChannel << " ID 0x" << std::hex << rsId.uiId <<
+                    (rsId.bExtended ? "x" : "") << std::dec << ": " << rsId.uiFrames << " frames in " << rsId.vecBlocks.size() <<
+                    " blocks" << std::endl;
+        }
+        return NO_ERROR;
+    }
+
+    // Read the source (ASC or binary capture)
+    if (bVerbose)
+        std::cout << "Reading: " << vecFileNames[0].generic_u8string() << std::endl;
+    asc::CAscReader reader;
+    if (!reader.Read(vecFileNames[0]))
+    {
+        if (!bSilent)
+            std::cout << "ERROR: " << CAN_TRACE_READ_ERROR_MSG << std::endl;
+        return CAN_TRACE_READ_ERROR;
+    }
+
+    // Write the target
+    if (bVerbose)
+        std::cout << "Writing " << reader.GetMessageCount() << " frames: " << vecFileNames[1].generic_u8string() << std::endl;
+    bool bResult = true;
+    if (vecFileNames[1].extension() == asc::szCaptureExtension)
+    {
+        asc::CCaptureWriter writer;
+        bResult = writer.Open(vecFileNames[1], static_cast<uint32_t>(nBlockFrames));
+        for (reader.JumpBegin(); bResult && !reader.IsEOF(); ++reader)
+            writer.Add(reader.Get().first);
+        bResult = writer.Close() && bResult;
+    }
+    else
+    {
+        asc::CAscWriter writer;
+        for (reader.JumpBegin(); !reader.IsEOF(); ++reader)
+            writer.AddSample(reader.Get().first);
+        bResult = writer.Write(vecFileNames[1]);
+    }
+    if (!bResult)
+    {
+        if (!bSilent)
+            std::cout << "ERROR: " << CAN_TRACE_WRITE_ERROR_MSG << std::endl;
+        return CAN_TRACE_WRITE_ERROR;
+    }
+
+    if (!bSilent)
+        std::cout << "Converted " << reader.GetMessageCount() << " frames (" << std::filesystem::file_size(vecFileNames[0]) <<
+            " bytes -> " << std::filesystem::file_size(vecFileNames[1]) << " bytes)." << std::endl;
+    return NO_ERROR;
+}
@@ -31,6 +31,7 @@ struct SContext
     uint32_t                        uiInstanceID = 1000;        ///< Instance ID
     bool                            bListNoHdr = false;         ///< Do not print a header with the listing table.
     bool                            bListShort = false;         ///< Print only a shortened list with one column.
+    uint32_t                        uiMetricsInterval = 0;      ///< Interval of the repeated metrics export in ms (0 = once).
     sdv::sequence<sdv::u8string>    seqCmdLine;                 ///< The commands provided on the command line.
     std::filesystem::path           pathInstallDir;             ///< Optional installation directory.
 };
@@ -27,6 +27,7 @@
 #include "list_elements.h"
 #include "start_stop_service.h"
 #include "installation.h"
+#include "metrics.h"
 #include "../error_msg.h"
 
 /**
@@ -81,10 +82,12 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
             "verbose option. Not compatible with 'server_silent'.");
         cmdln.DefineSubOption("install_dir", sContext.pathInstallDir, "Only used with STARTUP command: Installation directory "
             "(absolute or relative to the sdv_core executable).");
-        cmdln.DefineSubOption("no_header", sContext.bListNoHdr, "Only used with LIST command: Do not print a header for the "
+        cmdln.DefineSubOption("no_header", sContext.bListNoHdr, "Only used with LIST and METRICS command: Do not print a header for the "
             "listing table.");
         cmdln.DefineSubOption("short", sContext.bListShort, "Only used with LIST command: Print only the most essential "
             "information as one column.");
+        cmdln.DefineSubOption("interval", sContext.uiMetricsInterval, "Only used with METRICS EXPORT command: Repeat the export "
+            "with the supplied interval in ms until the core process ends.");
         cmdln.DefineDefaultArgument(sContext.seqCmdLine, "COMMAND");
 
         cmdln.Parse(static_cast<size_t>(iArgc), rgszArgv);
@@ -113,7 +116,7 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
         bError = true;
     }
 
-    enum class ECommand { unknown, startup, shutdown, list, install, update, uninstall, start, stop } eCommand = ECommand::unknown;
+    enum class ECommand { unknown, startup, shutdown, list, install, update, uninstall, start, stop, metrics } eCommand = ECommand::unknown;
     if (!sContext.seqCmdLine.empty())
     {
         if (iequals(sContext.seqCmdLine[0], "STARTUP")) eCommand = ECommand::startup;
@@ -124,6 +127,7 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
         else if (iequals(sContext.seqCmdLine[0], "UNINSTALL")) eCommand = ECommand::uninstall;
         else if (iequals(sContext.seqCmdLine[0], "START")) eCommand = ECommand::start;
         else if (iequals(sContext.seqCmdLine[0], "STOP")) eCommand = ECommand::stop;
+        else if (iequals(sContext.seqCmdLine[0], "METRICS")) eCommand = ECommand::metrics;
         else
         {
             if (!sContext.bSilent)
@@ -157,6 +161,9 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
             case ECommand::uninstall:
                 InstallationHelp(sContext);
                 break;
+            case ECommand::metrics:
+                MetricsHelp(sContext);
+                break;
             default:
                 cmdln.PrintHelp(std::cout, R"code(Supported commands:
     STARTUP   Start the core application server
@@ -167,6 +174,7 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
     UNINSTALL Uninstall an installed application or service.
     START     Start a service (complex services only).
     STOP      Stop a service (complex services only).
+    METRICS   Print or export the runtime metrics of the core application server.
 )code");
                 break;
             }
@@ -224,6 +232,9 @@ Instance = )code") + std::to_string(sContext.uiInstanceID) + R"code(
     case ECommand::uninstall:
         iRet = Uninstall(sContext);
         break;
+    case ECommand::metrics:
+        iRet = Metrics(sContext);
+        break;
     default:
         std::cout << "Command missing :-(" << std::endl;
         break;
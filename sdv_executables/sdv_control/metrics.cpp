@@ -0,0 +1,174 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "metrics.h"
+#include "print_table.h"
+#include <interfaces/metrics.h>
+#include <interfaces/com.h>
+#include <interfaces/core_ps.h>
+#include <support/interface_ptr.h>
+#include <support/local_service_access.h>
+#include "../../global/cmdlnparser/cmdlnparser.h"
+#include "../../global/metrics_exposition.h"
+#include "../error_msg.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+void MetricsHelp(const SContext& rsContext)
+{
+    // First argument should be "METRICS"
+    if (rsContext.seqCmdLine.size() < 1 || !iequals(rsContext.seqCmdLine[0], "METRICS"))
+    {
+        if (!rsContext.bSilent)
+            std::cerr << "ERROR: invalid metrics command..." << std::endl;
+        return;
+    }
+
+    CCommandLine::PrintHelpText(std::cout, "Usage: sdv_control METRICS [options...]\n"
+        "       sdv_control METRICS EXPORT <file> [--interval<ms>] [options...]\n\n"
+        "Print the runtime metrics of the core process (first usage) or export the metrics to a file in the Prometheus text "
+        "exposition format (second usage). The file is replaced atomically, allowing a scraper (e.g. the textfile collector of "
+        "the node exporter) to read it at any time. With the interval option, the export is repeated until the core process "
+        "ends.\n\n");
+}
+
+int Metrics(const SContext& rsContext)
+{
+    // First argument should be "METRICS"
+    if (rsContext.seqCmdLine.empty() || !iequals(rsContext.seqCmdLine[0], "METRICS"))
+    {
+        if (!rsContext.bSilent)
+            std::cerr << "ERROR: " << CMDLN_ARG_ERR_MSG << " Invalid command: " <<
+            (rsContext.seqCmdLine.empty() ? sdv::u8string() : rsContext.seqCmdLine[0]) << std::endl;
+        return CMDLN_ARG_ERR;
+    }
+    bool bExport = rsContext.seqCmdLine.size() >= 2 && iequals(rsContext.seqCmdLine[1], "EXPORT");
+    if ((bExport && rsContext.seqCmdLine.size() != 3) || (!bExport && rsContext.seqCmdLine.size() != 1))
+    {
+        if (!rsContext.bSilent)
+            std::cerr << "ERROR: " << CMDLN_ARG_ERR_MSG << " Invalid parameters for METRICS command." << std::endl;
+        return CMDLN_ARG_ERR;
+    }
+
+    // Try to connect
+    sdv::TObjectPtr ptrRepository = sdv::com::ConnectToLocalServerRepository(rsContext.uiInstanceID);
+    if (!ptrRepository)
+    {
+        if (!rsContext.bSilent)
+            std::cerr << "ERROR: " << CONNECT_SDV_SERVER_ERROR_MSG << " Instance #" << rsContext.uiInstanceID << std::endl;
+        return CONNECT_SDV_SERVER_ERROR;
+    }
+
+    // Get access to the metrics service
+    sdv::core::IObjectAccess* pObjectAccess = ptrRepository.GetInterface<sdv::core::IObjectAccess>();
+    sdv::core::IMetricsSnapshot* pMetrics = nullptr;
+    if (pObjectAccess)
+        pMetrics = sdv::TInterfaceAccessPtr(pObjectAccess->GetObject("MetricsService")).
+        GetInterface<sdv::core::IMetricsSnapshot>();
+    if (!pMetrics)
+    {
+        if (!rsContext.bSilent)
+            std::cerr << "ERROR: " << METRICS_SERVICE_ACCESS_ERROR_MSG << std::endl;
+        return METRICS_SERVICE_ACCESS_ERROR;
+    }
+
+    // Get a snapshot; fails when the connection to the core process is lost.
+    sdv::core::SMetricsSnapshot sSnapshot;
+    auto fnGetSnapshot = [&]() -> bool
+    {
+        try
+        {
+            sSnapshot = pMetrics->GetMetricsSnapshot();
+            return true;
+        } catch (const sdv::ps::XMarshallExcept& /*rexcept*/)
+        {
+            return false;
+        }
+    };
+
+    // Print the metrics
+    if (!bExport)
+    {
+        if (!fnGetSnapshot())
+        {
+            if (!rsContext.bSilent)
+                std::cerr << "ERROR: " << CONNECT_SDV_SERVER_ERROR_MSG << " Instance #" << rsContext.uiInstanceID << std::endl;
+            return CONNECT_SDV_SERVER_ERROR;
+        }
+        std::vector<std::array<std::string, 3>> vecMetricList;
+        vecMetricList.push_back({ "Name", "Type", "Value" });
+        for (const sdv::core::SMetric& rsMetric : sSnapshot.seqMetrics)
+        {
+            switch (rsMetric.eType)
+            {
+            case sdv::core::EMetricType::counter:
+                vecMetricList.push_back({ rsMetric.ssName, "Counter", std::to_string(rsMetric.iValue) });
+                break;
+            case sdv::core::EMetricType::gauge:
+                vecMetricList.push_back({ rsMetric.ssName, "Gauge", std::to_string(rsMetric.iValue) });
+                break;
+            case sdv::core::EMetricType::histogram:
+                vecMetricList.push_back({ rsMetric.ssName, "Histogram", "count=" + std::to_string(rsMetric.uiCount) +
+                    " sum=" + std::to_string(rsMetric.uiSum) +
+                    " avg=" + std::to_string(rsMetric.uiCount ? rsMetric.uiSum / rsMetric.uiCount : 0) });
+                break;
+            default:
+                break;
+            }
+        }
+        PrintTable(vecMetricList, std::cout, rsContext.bListNoHdr);
+        return NO_ERROR;
+    }
+
+    // Export the metrics. Write to a temporary file first and replace the target afterwards; a scraper never reads a partially
+    // written file.
+    std::filesystem::path pathExport = static_cast<std::string>(rsContext.seqCmdLine[2]);
+    std::filesystem::path pathTemp = pathExport;
+    pathTemp += ".tmp";
+    while (true)
+    {
+        if (!fnGetSnapshot())
+        {
+            // With a repeated export, the end of the core process ends the export.
+            if (rsContext.uiMetricsInterval)
+            {
+                if (rsContext.bVerbose)
+                    std::cout << "The core process has ended; export finished." << std::endl;
+                return NO_ERROR;
+            }
+            if (!rsContext.bSilent)
+                std::cerr << "ERROR: " << CONNECT_SDV_SERVER_ERROR_MSG << " Instance #" << rsContext.uiInstanceID << std::endl;
+            return CONNECT_SDV_SERVER_ERROR;
+        }
+        std::ofstream fstream(pathTemp, std::ios::out | std::ios::trunc);
+        if (fstream.is_open()) WriteMetricsExposition(fstream, sSnapshot);
+        fstream.close();
+        std::error_code ec;
+        if (fstream) std::filesystem::rename(pathTemp, pathExport, ec);
+        if (!fstream || ec)
+        {
+            if (!rsContext.bSilent)
+                std::cerr << "ERROR: " << METRICS_EXPORT_ERROR_MSG << " File: " << pathExport.generic_u8string() << std::endl;
+            return METRICS_EXPORT_ERROR;
+        }
+        if (rsContext.bVerbose)
+            std::cout << "Exported " << sSnapshot.seqMetrics.size() << " metrics to " << pathExport.generic_u8string() << std::endl;
+        if (!rsContext.uiMetricsInterval) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(rsContext.uiMetricsInterval));
+    }
+
+    // All good...
+    return NO_ERROR;
+}
@@ -0,0 +1,33 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "context.h"
+
+/**
+ * @brief Help for the metrics command.
+ * @param[in] rsContext Reference to the context.
+ */
+void MetricsHelp(const SContext& rsContext);
+
+/**
+ * @brief Print the metrics snapshot of the core process or export the snapshot to a file in the text exposition format.
+ * @details The command line context includes the optional export command and file.
+ * @param[in] rsContext Reference to the context.
+ * @return The application exit code. 0 is no error.
+ */
+int Metrics(const SContext& rsContext);
+
+#endif // !defined METRICS_H
@@ -61,6 +61,7 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
     bool bVersion = false;
     bool bStandalone = false;
     bool bServer = false;
+    bool bIsoZygote = false;
     std::filesystem::path pathConfig;
     uint32_t uiInstanceID = 1000;   // Default instance is 1000
     std::filesystem::path pathInstallDir;
@@ -79,6 +80,8 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
         cmdln.DefineOption("local", bStandalone, "Start the local version (default - no IPC available).");
         cmdln.DefineOption("server", bServer, "Start the server version (not compatible with the local version).");
         cmdln.DefineSubOption("install_dir", pathInstallDir, "Installation directory (absolute or relative to this executable).");
+        cmdln.DefineSubOption("iso_zygote", bIsoZygote, "Start isolated applications through a pre-initialized zygote process "
+            "(server only; Linux only).");
         cmdln.DefineDefaultArgument(pathConfig, "Configuration file to start running (compulsory; applicable for local version only).");
         cmdln.Parse(static_cast<size_t>(iArgc), rgszArgv);
     } catch (const SArgumentParseException& rsExcept)
@@ -151,6 +154,8 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
     sstreamConfig << "[Application]" << std::endl;
     sstreamConfig << "Mode = \"" << (bServer ? "Main" : "Standalone") << "\"" << std::endl;
     sstreamConfig << "Instance = " << uiInstanceID << std::endl;
+    if (bServer && bIsoZygote)
+        sstreamConfig << "IsoZygote = true" << std::endl;
     if (!pathConfig.empty())
         sstreamConfig << "Config = \"" << pathConfig.generic_u8string() << "\"" << std::endl;
     if (!pathInstallDir.empty())
@@ -176,6 +176,7 @@ const char szHdrTemplate[] = R"code(/**
 #include <interfaces/can.h>
 #include <support/interface_ptr.h>
 #include <support/signal_support.h>
+#include <support/latency_trace.h>
 
 /**
  * @brief Data link class.
@@ -501,6 +502,7 @@ CCanDataLinkGen::CCanDataLinkGen(const std::filesystem::path& rpathOutputDir, co
     if (!sstreamReceiveSwitch.str().empty())
     {
         sstreamReceiveSwitchBegin << R"code(
+    SDV_LATENCY_TRACE(sdv::core::ETraceStage::datalink_receive, sMsg.uiID);
     switch (sMsg.uiID)
     {)code";
         sstreamReceiveSwitchEnd << R"code(
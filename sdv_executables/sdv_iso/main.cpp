@@ -21,6 +21,7 @@
 #include <support/toml.h>
 #include <support/local_service_access.h>
 #include "../error_msg.h"
+#include "../../global/process_zygote.h"
 
 /**
  * @brief Connect event callback wrapper. Calls shutdown request on disconnect or error.
@@ -99,6 +100,34 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
     if (sdv::app::CAppControl::GetComponentInstallDirectory().empty())
         sdv::app::CAppControl::SetComponentInstallDirectory(GetExecDirectory());
 
+#ifdef __unix__
+    // Zygote mode: the process control requests isolation processes through the connection. Preload the framework libraries
+    // once; every requested process is a copy of this pre-initialized process and continues with the provided arguments. The
+    // static constructors of the preloaded libraries run in the zygote; they must not start threads or open resources (see
+    // CZygoteServer::Preload).
+    std::vector<std::string> vecZygoteArgs;
+    std::vector<const char*> vecZygoteArgPtrs;
+    int iZygoteFD = iArgc == 2 ? zygote::GetZygoteFD(rgszArgv[1]) : -1;
+    if (iZygoteFD >= 0)
+    {
+        zygote::CZygoteServer zygoteServer(iZygoteFD);
+        std::filesystem::path pathRuntime = sdv::app::CAppControl::GetFrameworkRuntimeDirectory();
+        for (const char* szModule : { "core_services.sdv", "process_control.sdv", "hardware_ident.sdv", "ipc_shared_mem.sdv",
+            "ipc_com.sdv", "core_ps.sdv" })
+            zygoteServer.Preload(pathRuntime / szModule);
+
+        // Returns in the requested process only.
+        if (!zygoteServer.Run(vecZygoteArgs)) return NO_ERROR;
+
+        vecZygoteArgPtrs.push_back(rgszArgv[0]);
+        for (const std::string& rssArg : vecZygoteArgs)
+            vecZygoteArgPtrs.push_back(rssArg.c_str());
+        vecZygoteArgPtrs.push_back(nullptr);
+        iArgc = static_cast<int>(vecZygoteArgPtrs.size() - 1);
+        rgszArgv = vecZygoteArgPtrs.data();
+    }
+#endif
+
     CCommandLine cmdln(static_cast<uint32_t>(CCommandLine::EParseFlags::no_assignment_character));
     bool bHelp = false;
     bool bError = false;
@@ -210,6 +210,9 @@ void CSdvPackagerEnvironment::ReportInfo() const
         rstreamVerbose << "Copyright: " << m_ssCopyrights << std::endl;
         rstreamVerbose << "Version: " << m_ssPackageVersion << std::endl;
         rstreamVerbose << "Keep directory structure: " << (m_bKeepStructure ? "true" : "false") << std::endl;
+        if (!m_pathDeltaBase.empty())
+            rstreamVerbose << "Delta base: " << m_pathDeltaBase.generic_u8string() << std::endl;
+        if (m_uiJobs) rstreamVerbose << "Jobs: " << m_uiJobs << std::endl;
         break;
     case EOperatingMode::install:
         rstreamNormal << "Installing a package..." << std::endl;
@@ -500,6 +503,16 @@ uint32_t CSdvPackagerEnvironment::InstanceID() const
     return m_uiInstanceID;
 }
 
+const std::filesystem::path& CSdvPackagerEnvironment::DeltaBase() const
+{
+    return m_pathDeltaBase;
+}
+
+uint32_t CSdvPackagerEnvironment::Jobs() const
+{
+    return m_uiJobs;
+}
+
 bool CSdvPackagerEnvironment::Update() const
 {
     return m_bUpdate;
@@ -950,6 +963,12 @@ bool CSdvPackagerEnvironment::ProcessCommandLine(const std::vector<std::string>&
         if (!fnGetModules()) return false;
         if (!fnCheckSourceLocation()) return false;
         if (!fnCheckOutputLocation()) return false;
+        if (!m_pathDeltaBase.empty() && !std::filesystem::exists(m_pathDeltaBase))
+        {
+            m_nError = CMDLN_DELTA_BASE_ERROR;
+            m_ssArgError = std::string(CMDLN_DELTA_BASE_ERROR_MSG) + "\n  Delta base: " + m_pathDeltaBase.generic_u8string();
+            return false;
+        }
         fnGetProduct();
         if (m_pathOutputLocation.empty())
             m_pathPackage = std::filesystem::u8path(m_ssInstallName + ".sdv_package");
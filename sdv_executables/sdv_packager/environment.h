@@ -246,6 +246,13 @@ public:
      */
     const std::filesystem::path& OutputLocation() const;
 
+    /**
+     * @brief During package creation, the installation manifest of the installation to create a delta package for.
+     * @return Returns a reference to the variable containing the path to the installation manifest file or to the directory
+     * containing the installation manifest; empty when a complete package should be created.
+     */
+    const std::filesystem::path& DeltaBase() const;
+
     /**
      * @brief During package installation, base path to the package target location.
      * @return Returns a reference to the variable containing the target location.
@@ -276,6 +283,12 @@ public:
      */
     uint32_t InstanceID() const;
 
+    /**
+     * @brief The amount of threads to use for processing the package content.
+     * @return The amount of threads; 0 when the amount of processor cores should be used.
+     */
+    uint32_t Jobs() const;
+
     /**
      * @brief Update if an older version has been found.
      * @return Returns whether the update flag was specified.
@@ -444,6 +457,8 @@ private:
     std::vector<std::string>    m_vecConfigFiles;                   ///< List of configuration files (file search strings).
     std::filesystem::path       m_pathSourceLocation;               ///< Path to the input location.
     std::filesystem::path       m_pathOutputLocation;               ///< Path to the output location.
+    std::filesystem::path       m_pathDeltaBase;                    ///< Path to the manifest of the base installation (delta
+                                                                    ///< packages only).
     std::filesystem::path       m_pathTargetLocation;               ///< Path to the target location (at installation).
     std::filesystem::path       m_pathRootLocation;                 ///< Target root location (includes the instance for server
                                                                     ///< location).
@@ -452,6 +467,7 @@ private:
     std::filesystem::path       m_pathPackage;                      ///< Path to the package during installation, uninstallation,
                                                                     ///< integrity checking andcontent showing. 
     uint32_t                    m_uiInstanceID = 1000u;             ///< Instance number (optional).
+    uint32_t                    m_uiJobs = 0;                       ///< Amount of threads for package processing (optional).
     std::string                 m_ssInstallName;                    ///< Installation name.
     std::string                 m_ssProductName;                    ///< Product name (default is package name).
     std::string                 m_ssDescription;                    ///< Product description
@@ -531,11 +547,20 @@ CSdvPackagerEnvironment::CSdvPackagerEnvironment(size_t nArgs, const TCharType**
         auto& rInstance = m_cmdln.DefineSubOption("instance", m_uiInstanceID, "The instance ID of the SDV server instance when not "
             "targeting the local system (default ID is 1000).", true, 2, 3, 4, 5);
 
+        // ARGUMENT SELECTION GROUP #1, #2 & #6 - Package processing:
+        //     --jobs<n>                    Amount of threads to use (default is the amount of processor cores)
+        m_cmdln.DefineSubOption("jobs", m_uiJobs, "The amount of threads used for composing, verifying and extracting the "
+            "package content (default is the amount of processor cores).", true, 1, 2, 6);
+
         // ARGUMENT SELECTION GROUP #1 - Packing:
         //     -O<path>                     Optional destination location
+        //     --delta_base<path>           Create a delta package against the installation manifest of a previous installation
         //     --signature<path>            Path to the file to use to sign the package (not implemented yet)
         m_cmdln.DefineGroup("Package creation");
         m_cmdln.DefineOption("O", m_pathOutputLocation, "The output location (optional, default is current directory).", true, 1);
+        m_cmdln.DefineSubOption("delta_base", m_pathDeltaBase, "Create a delta package containing only the files that differ "
+            "from the installation described by the installation manifest (path to the manifest file or to the installation "
+            "directory). The installation must be updated with the package using the update or overwrite option.", true, 1);
 
         // ARGUMENT SECLECTION GROUP #1 & #3 - Packing and direct installation:
         //     -I<path>                     Optional source location
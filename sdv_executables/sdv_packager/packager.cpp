@@ -146,13 +146,33 @@ bool CPackager::Pack()
                 std::cout << "Create installation manifest..." << std::endl;
             CInstallManifest manifest = composer.ComposeInstallManifest(m_env.InstallName());
             std::filesystem::path pathOutputLocation = m_env.OutputLocation().empty() ? "." : m_env.OutputLocation();
-            return manifest.Save(pathOutputLocation);
+            if (!manifest.Save(pathOutputLocation)) return false;
+            manifest.SaveIndex(pathOutputLocation);
+            return true;
         }
         else
         {
+            if (m_env.DeltaBase().empty())
+            {
+                if (m_env.Verbose())
+                    std::cout << "Compose package..." << std::endl;
+                return composer.Compose(m_env.PackagePath(), m_env.InstallName(), m_env.Jobs());
+            }
+
+            // The delta base is either the manifest file or the installation directory containing the manifest.
+            std::filesystem::path pathBaseDir = m_env.DeltaBase();
+            if (!std::filesystem::is_directory(pathBaseDir))
+                pathBaseDir = pathBaseDir.parent_path();
+            CInstallManifest manifestBase;
+            if (!manifestBase.Load(pathBaseDir))
+            {
+                m_nError = CMDLN_DELTA_BASE_ERROR;
+                m_ssArgError = std::string(CMDLN_DELTA_BASE_ERROR_MSG) + "\n  Delta base: " + m_env.DeltaBase().generic_u8string();
+                return false;
+            }
             if (m_env.Verbose())
-                std::cout << "Compose package..." << std::endl;
-            return composer.Compose(m_env.PackagePath(), m_env.InstallName());
+                std::cout << "Compose delta package..." << std::endl;
+            return composer.ComposeDelta(m_env.PackagePath(), m_env.InstallName(), manifestBase, m_env.Jobs());
         }
     }
     catch (const sdv::XSysExcept& rexception)
@@ -176,7 +196,7 @@ bool CPackager::Unpack()
             eUpdateRule = CInstallComposer::EUpdateRules::overwrite;
         if (m_env.Update())
             eUpdateRule = CInstallComposer::EUpdateRules::update_when_new;
-        manifest = extractor.Extract(m_env.PackagePath(), m_env.InstallLocation(), eUpdateRule);
+        manifest = extractor.Extract(m_env.PackagePath(), m_env.InstallLocation(), eUpdateRule, m_env.Jobs());
 
         if (m_env.Verbose())
         {
@@ -525,7 +545,7 @@ bool CPackager::CheckIntegrity()
             std::cout << "Verify package..." << std::endl;
 
         CInstallComposer verifier;
-        bool bRet = verifier.Verify(m_env.PackagePath());
+        bool bRet = verifier.Verify(m_env.PackagePath(), m_env.Jobs());
 
         // Report count if requested
         if (!m_env.Silent())
@@ -0,0 +1,217 @@
+/********************************************************************************
+* Copyright (c) 2025-2026 ZF Friedrichshafen AG
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Contributors:
+*   Erik Verhoeven - initial API and implementation
+********************************************************************************/
+
+#include "latency_monitor.h"
+#include <interfaces/log.h>
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+    /// Traces without a trace point for this time (ns) are considered finished.
+    const uint64_t uiTraceTimeout = 10000000000ull;
+
+    /**
+     * @brief Escape a string for the use in JSON.
+     * @param[in] rssText Reference to the text.
+     * @return The escaped text.
+     */
+    std::string EscapeJSON(const std::string& rssText)
+    {
+        std::string ssEscaped;
+        for (char c : rssText)
+        {
+            if (c == '\"' || c == '\\') ssEscaped += '\\';
+            if (static_cast<unsigned char>(c) < 0x20) continue;
+            ssEscaped += c;
+        }
+        return ssEscaped;
+    }
+}
+
+CLatencyMonitor::CLatencyMonitor(uint32_t uiInstanceID, bool bKeepEvents) :
+    m_buffer(uiInstanceID), m_bKeepEvents(bKeepEvents)
+{}
+
+bool CLatencyMonitor::Start()
+{
+    return m_buffer.Create();
+}
+
+void CLatencyMonitor::Stop()
+{
+    m_buffer.Close();
+}
+
+void CLatencyMonitor::Poll()
+{
+    std::vector<SLatencyTraceRecord> vecRecords;
+    m_uiLost += m_buffer.Read(vecRecords);
+    Process(vecRecords);
+}
+
+void CLatencyMonitor::Process(std::vector<SLatencyTraceRecord>& rvecRecords)
+{
+    if (rvecRecords.empty()) return;
+
+    // The events of one trace might come from several threads; process them in chronological order.
+    std::sort(rvecRecords.begin(), rvecRecords.end(), [](const SLatencyTraceRecord& rsLeft, const SLatencyTraceRecord& rsRight)
+        { return rsLeft.uiTimestamp < rsRight.uiTimestamp; });
+    for (const SLatencyTraceRecord& rsRecord : rvecRecords)
+    {
+        if (m_bKeepEvents && m_vecEvents.size() < nMaxExportEvents)
+            m_vecEvents.push_back(rsRecord);
+
+        // The first trace point starts the trace; the latency of the other trace points is measured from the start.
+        auto itTrace = m_mapTraces.find(rsRecord.uiTraceID);
+        if (itTrace == m_mapTraces.end())
+        {
+            // Traces of which the start was lost are not measured.
+            if (rsRecord.uiStage != static_cast<uint32_t>(sdv::core::ETraceStage::can_receive)) continue;
+            itTrace = m_mapTraces.emplace(rsRecord.uiTraceID, STrace{ rsRecord.uiTimestamp, rsRecord.uiTimestamp }).first;
+        }
+        itTrace->second.uiLast = std::max(itTrace->second.uiLast, rsRecord.uiTimestamp);
+        uint64_t uiLatency = rsRecord.uiTimestamp - itTrace->second.uiStart;
+
+        SLatencies& rsLatencies = m_mapLatencies[std::make_pair(rsRecord.uiStage, rsRecord.uiKey)];
+        if (rsLatencies.vecWindow.size() < nWindowSize)
+            rsLatencies.vecWindow.push_back(uiLatency);
+        else
+            rsLatencies.vecWindow[rsLatencies.uiCount % nWindowSize] = uiLatency;
+        rsLatencies.uiCount++;
+        rsLatencies.uiMax = std::max(rsLatencies.uiMax, uiLatency);
+    }
+
+    // Remove the finished traces
+    uint64_t uiNow = rvecRecords.back().uiTimestamp;
+    for (auto itTrace = m_mapTraces.begin(); itTrace != m_mapTraces.end();)
+    {
+        if (uiNow - itTrace->second.uiLast > uiTraceTimeout)
+            itTrace = m_mapTraces.erase(itTrace);
+        else
+            ++itTrace;
+    }
+}
+
+CLatencyMonitor::SStatistics CLatencyMonitor::GetStatistics(uint32_t uiStage, uint32_t uiKey) const
+{
+    SStatistics sStatistics;
+    auto itLatencies = m_mapLatencies.find(std::make_pair(uiStage, uiKey));
+    if (itLatencies == m_mapLatencies.end() || itLatencies->second.vecWindow.empty()) return sStatistics;
+
+    std::vector<uint64_t> vecSorted = itLatencies->second.vecWindow;
+    std::sort(vecSorted.begin(), vecSorted.end());
+    auto fnPercentile = [&](size_t nPercentile) { return vecSorted[(vecSorted.size() - 1) * nPercentile / 100]; };
+    sStatistics.uiCount = itLatencies->second.uiCount;
+    sStatistics.uiP50 = fnPercentile(50);
+    sStatistics.uiP90 = fnPercentile(90);
+    sStatistics.uiP99 = fnPercentile(99);
+    sStatistics.uiMax = itLatencies->second.uiMax;
+    return sStatistics;
+}
+
+void CLatencyMonitor::PrintStatistics(std::ostream& rstream)
+{
+    auto fnMicroSec = [](uint64_t uiNanoSec)
+    {
+        std::stringstream sstream;
+        sstream << std::fixed << std::setprecision(1) << static_cast<double>(uiNanoSec) / 1000.0;
+        return sstream.str();
+    };
+
+    rstream << std::left << std::setw(18) << "Stage" << std::setw(48) << "Signal" << std::right << std::setw(10) << "Count" <<
+        std::setw(11) << "p50[us]" << std::setw(11) << "p90[us]" << std::setw(11) << "p99[us]" << std::setw(11) << "max[us]" <<
+        std::endl;
+    for (const auto& rvtLatencies : m_mapLatencies)
+    {
+        SStatistics sStatistics = GetStatistics(rvtLatencies.first.first, rvtLatencies.first.second);
+        rstream << std::left << std::setw(18) << GetStageName(rvtLatencies.first.first) << std::setw(48) <<
+            GetKeyName(rvtLatencies.first.first, rvtLatencies.first.second).substr(0, 47) << std::right << std::setw(10) <<
+            sStatistics.uiCount << std::setw(11) << fnMicroSec(sStatistics.uiP50) << std::setw(11) <<
+            fnMicroSec(sStatistics.uiP90) << std::setw(11) << fnMicroSec(sStatistics.uiP99) << std::setw(11) <<
+            fnMicroSec(sStatistics.uiMax) << std::endl;
+    }
+    if (m_uiLost)
+        rstream << "Lost trace points: " << m_uiLost << std::endl;
+}
+
+void CLatencyMonitor::ExportChromeTrace(std::ostream& rstream)
+{
+    // Order the events per trace; each trace point is shown as a slice starting at the previous trace point of the trace.
+    std::vector<SLatencyTraceRecord> vecEvents = m_vecEvents;
+    std::stable_sort(vecEvents.begin(), vecEvents.end(), [](const SLatencyTraceRecord& rsLeft, const SLatencyTraceRecord& rsRight)
+        { return rsLeft.uiTraceID < rsRight.uiTraceID ||
+            (rsLeft.uiTraceID == rsRight.uiTraceID && rsLeft.uiTimestamp < rsRight.uiTimestamp); });
+    uint64_t uiFirst = UINT64_MAX;
+    for (const SLatencyTraceRecord& rsEvent : vecEvents)
+        uiFirst = std::min(uiFirst, rsEvent.uiTimestamp);
+
+    rstream << "{\"traceEvents\":[";
+    rstream << std::fixed << std::setprecision(3);
+    for (size_t nIndex = 0; nIndex < vecEvents.size(); nIndex++)
+    {
+        const SLatencyTraceRecord& rsEvent = vecEvents[nIndex];
+        bool bFirst = !nIndex || vecEvents[nIndex - 1].uiTraceID != rsEvent.uiTraceID;
+        uint64_t uiBegin = bFirst ? rsEvent.uiTimestamp : vecEvents[nIndex - 1].uiTimestamp;
+        if (nIndex) rstream << ",";
+        rstream << "\n{\"name\":\"" << GetStageName(rsEvent.uiStage) << " " <<
+            EscapeJSON(GetKeyName(rsEvent.uiStage, rsEvent.uiKey)) << "\",\"cat\":\"latency\"";
+        if (bFirst)
+            rstream << ",\"ph\":\"i\",\"s\":\"t\"";
+        else
+            rstream << ",\"ph\":\"X\",\"dur\":" << static_cast<double>(rsEvent.uiTimestamp - uiBegin) / 1000.0;
+        rstream << ",\"ts\":" << static_cast<double>(uiBegin - uiFirst) / 1000.0 << ",\"pid\":" << rsEvent.uiProcessID <<
+            ",\"tid\":" << rsEvent.uiThreadID << ",\"args\":{\"trace_id\":" << rsEvent.uiTraceID << "}}";
+    }
+    rstream << "\n],\"displayTimeUnit\":\"ns\"}" << std::endl;
+}
+
+uint64_t CLatencyMonitor::GetLostCount() const
+{
+    return m_uiLost;
+}
+
+std::string CLatencyMonitor::GetStageName(uint32_t uiStage)
+{
+    switch (static_cast<sdv::core::ETraceStage>(uiStage))
+    {
+    case sdv::core::ETraceStage::can_receive:       return "can_receive";
+    case sdv::core::ETraceStage::datalink_receive:  return "datalink_receive";
+    case sdv::core::ETraceStage::dispatch_write:    return "dispatch_write";
+    case sdv::core::ETraceStage::dispatch_deliver:  return "dispatch_deliver";
+    case sdv::core::ETraceStage::vehicle_device:    return "vehicle_device";
+    case sdv::core::ETraceStage::basic_service:     return "basic_service";
+    case sdv::core::ETraceStage::application:       return "application";
+    default:                                        return "stage_" + std::to_string(uiStage);
+    }
+}
+
+std::string CLatencyMonitor::GetKeyName(uint32_t uiStage, uint32_t uiKey)
+{
+    std::stringstream sstream;
+    if (uiStage == static_cast<uint32_t>(sdv::core::ETraceStage::can_receive) ||
+        uiStage == static_cast<uint32_t>(sdv::core::ETraceStage::datalink_receive))
+    {
+        sstream << "CAN 0x" << std::hex << std::uppercase << uiKey;
+        return sstream.str();
+    }
+
+    // The names are registered by the processes while running; look up the names that are still unknown.
+    auto itName = m_mapNames.find(uiKey);
+    if (itName == m_mapNames.end() || itName->second.empty())
+        itName = m_mapNames.insert_or_assign(uiKey, m_buffer.FindName(uiKey)).first;
+    if (!itName->second.empty()) return itName->second;
+    sstream << "0x" << std::hex << std::uppercase << std::setw(8) << std::setfill('0') << uiKey;
+    return sstream.str();
+}
@@ -0,0 +1,151 @@
+/********************************************************************************
+* Copyright (c) 2025-2026 ZF Friedrichshafen AG
+*
+* This program and the accompanying materials are made available under the
+* terms of the Apache License Version 2.0 which is available at
+* https://www.apache.org/licenses/LICENSE-2.0
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* Contributors:
+*   Erik Verhoeven - initial API and implementation
+********************************************************************************/
+
+#ifndef LATENCY_MONITOR_H
+#define LATENCY_MONITOR_H
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../../global/latencytrace/latency_trace_buffer.h"
+
+/**
+ * @brief Latency monitor collecting the trace points of the signal path of an instance.
+ * @details The latency of a trace point is the time since the start of its trace (the reception of the CAN frame). The monitor
+ * keeps a window with the most recent latencies per stage and signal, which is used to calculate the percentiles.
+ */
+class CLatencyMonitor
+{
+public:
+    /// Amount of latencies per stage and signal used to calculate the percentiles.
+    static constexpr size_t nWindowSize = 4096;
+
+    /// Maximum amount of events kept for the export.
+    static constexpr size_t nMaxExportEvents = 1000000;
+
+    /**
+     * @brief Latency statistics of a stage and signal.
+     */
+    struct SStatistics
+    {
+        uint64_t    uiCount = 0;        ///< Amount of latencies measured.
+        uint64_t    uiP50 = 0;          ///< Median latency in ns (of the window).
+        uint64_t    uiP90 = 0;          ///< 90th percentile in ns (of the window).
+        uint64_t    uiP99 = 0;          ///< 99th percentile in ns (of the window).
+        uint64_t    uiMax = 0;          ///< Maximum latency in ns (since the start).
+    };
+
+    /**
+     * @brief Constructor
+     * @param[in] uiInstanceID The instance ID to monitor.
+     * @param[in] bKeepEvents When set, the events are kept for the export.
+     */
+    CLatencyMonitor(uint32_t uiInstanceID, bool bKeepEvents);
+
+    /**
+     * @brief Create the trace buffer; this activates the trace points in the processes of the instance.
+     * @return Returns true when successful; false otherwise.
+     */
+    bool Start();
+
+    /**
+     * @brief Deactivate the trace points and remove the trace buffer.
+     */
+    void Stop();
+
+    /**
+     * @brief Read and process the events recorded since the last call.
+     */
+    void Poll();
+
+    /**
+     * @brief Process events.
+     * @param[in] rvecRecords Reference to the events to process.
+     */
+    void Process(std::vector<SLatencyTraceRecord>& rvecRecords);
+
+    /**
+     * @brief Get the statistics of a stage and signal.
+     * @param[in] uiStage The stage.
+     * @param[in] uiKey The key of the CAN message or signal.
+     * @return The statistics; empty when no latency was measured.
+     */
+    SStatistics GetStatistics(uint32_t uiStage, uint32_t uiKey) const;
+
+    /**
+     * @brief Print a table with the statistics of all stages and signals.
+     * @param[in] rstream Reference to the stream to print to.
+     */
+    void PrintStatistics(std::ostream& rstream);
+
+    /**
+     * @brief Write the kept events as Chrome trace (JSON), which can be loaded in Perfetto and chrome://tracing.
+     * @param[in] rstream Reference to the stream to write to.
+     */
+    void ExportChromeTrace(std::ostream& rstream);
+
+    /**
+     * @brief Get the amount of events that were overwritten in the trace buffer before they could be read.
+     * @return The amount of lost events.
+     */
+    uint64_t GetLostCount() const;
+
+private:
+    /**
+     * @brief Start of a trace.
+     */
+    struct STrace
+    {
+        uint64_t    uiStart = 0;        ///< Timestamp of the first trace point.
+        uint64_t    uiLast = 0;         ///< Timestamp of the most recent trace point.
+    };
+
+    /**
+     * @brief Latencies of a stage and signal.
+     */
+    struct SLatencies
+    {
+        std::vector<uint64_t>   vecWindow;      ///< The most recent latencies (ring).
+        uint64_t                uiCount = 0;    ///< Amount of latencies measured.
+        uint64_t                uiMax = 0;      ///< Maximum latency.
+    };
+
+    /**
+     * @brief Get the display name of a stage.
+     * @param[in] uiStage The stage.
+     * @return The name of the stage.
+     */
+    static std::string GetStageName(uint32_t uiStage);
+
+    /**
+     * @brief Get the display name of the key of a stage.
+     * @param[in] uiStage The stage.
+     * @param[in] uiKey The key.
+     * @return The CAN ID for the CAN stages; the registered signal name for the other stages.
+     */
+    std::string GetKeyName(uint32_t uiStage, uint32_t uiKey);
+
+    CLatencyTraceBuffer                             m_buffer;                   ///< The trace buffer.
+    bool                                            m_bKeepEvents = false;      ///< Keep the events for the export.
+    std::vector<SLatencyTraceRecord>                m_vecEvents;                ///< Events kept for the export.
+    std::unordered_map<uint64_t, STrace>            m_mapTraces;                ///< Running traces.
+    std::map<std::pair<uint32_t, uint32_t>, SLatencies> m_mapLatencies;         ///< Latencies per stage and key.
+    std::map<uint32_t, std::string>                 m_mapNames;                 ///< Names of the signal keys.
+    uint64_t                                        m_uiLost = 0;               ///< Amount of lost events.
+};
+
+#endif // !defined LATENCY_MONITOR_H
@@ -16,10 +16,13 @@
 #include <support/app_control.h>
 #include "../../global/cmdlnparser/cmdlnparser.cpp"
 #include "../../global/tracefifo/trace_fifo.cpp"
+#include "../../global/latencytrace/latency_trace_buffer.cpp"
 #include "../../global/exec_dir_helper.h"
 #include "../error_msg.h"
+#include "latency_monitor.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <fstream>
 
 #ifdef __unix__
 #include <signal.h>
@@ -107,6 +110,8 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
     bool bHelp = false;
     bool bVersion = false;
     uint32_t uiInstanceID = 1000u;
+    bool bLatency = false;
+    std::filesystem::path pathLatencyExport;
     std::string ssArgError;
     try
     {
@@ -114,6 +119,11 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
         rArgDef.AddSubOptionName("help");
         cmdln.DefineSubOption("version", bVersion, "Show version information.");
         cmdln.DefineSubOption("instance", uiInstanceID, "The instance ID of the SDV instance (default ID is 1000).");
+        cmdln.DefineSubOption("latency", bLatency, "Monitor the latency of the signal path instead of the log messages. Shows the "
+            "latency percentiles per stage and signal measured from the reception of the CAN frame. Requires the framework and the "
+            "components to be compiled with latency tracing (CMake option SDV_ENABLE_LATENCY_TRACE).");
+        cmdln.DefineSubOption("latency_export", pathLatencyExport, "Use with --latency: write the trace points to a Chrome trace "
+            "file (JSON) when the monitor ends. The file can be viewed with Perfetto or chrome://tracing.");
 
         cmdln.Parse(static_cast<size_t>(iArgc), rgszArgv);
     } catch (const SArgumentParseException& rsExcept)
@@ -136,8 +146,6 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
     }
     std::cout << "Monitoring instance #" << uiInstanceID << std::endl;
 
-    CTraceFifoReader reader(uiInstanceID);
-
 #ifdef _WIN32
     // Register the console control handler
     if (!SetConsoleCtrlHandler(&ControlHandler, TRUE))
@@ -157,7 +165,49 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
     }
 #endif
 
+    // Latency monitoring
+    if (bLatency)
+    {
+        CLatencyMonitor monitor(uiInstanceID, !pathLatencyExport.empty());
+        if (!monitor.Start())
+        {
+            std::cerr << "ERROR: " << TRACE_MON_LATENCY_CREATE_ERROR_MSG << std::endl;
+            return TRACE_MON_LATENCY_CREATE_ERROR;
+        }
+        auto tpPrint = std::chrono::steady_clock::now();
+        while (!bShutdownSignalled)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            monitor.Poll();
+            if (std::chrono::steady_clock::now() - tpPrint < std::chrono::seconds(1)) continue;
+            tpPrint = std::chrono::steady_clock::now();
+            std::cout << std::endl;
+            monitor.PrintStatistics(std::cout);
+        }
+        monitor.Poll();
+        monitor.Stop();
+
+#ifdef _WIN32
+        SetConsoleCtrlHandler(&ControlHandler, FALSE);
+#endif
+
+        if (!pathLatencyExport.empty())
+        {
+            std::ofstream fstream(pathLatencyExport, std::ios::out | std::ios::trunc);
+            if (fstream.is_open()) monitor.ExportChromeTrace(fstream);
+            if (!fstream.is_open() || !fstream.good())
+            {
+                std::cerr << "ERROR: " << TRACE_MON_LATENCY_EXPORT_ERROR_MSG << std::endl;
+                return TRACE_MON_LATENCY_EXPORT_ERROR;
+            }
+            std::cout << "Latency trace written to " << pathLatencyExport.generic_u8string() << std::endl;
+        }
+        std::cout << "Done..." << std::endl;
+        return NO_ERROR;
+    }
+
     // Open the reader.
+    CTraceFifoReader reader(uiInstanceID);
     if (!reader.Open())
     {
         std::cerr << "ERROR: " << TRACE_MON_FIFO_OPEN_ERROR_MSG << std::endl;
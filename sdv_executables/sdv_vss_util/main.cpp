@@ -78,6 +78,7 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
     bool bSilent = false;
     bool bVerbose = false;
     bool bEnableComponents = false;
+    bool bFusedSignalPath = false;
     std::string ssVersion;
     std::string ssPrefix;
     std::string ssVSSFileName;
@@ -92,6 +93,8 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
         rArgVerboseDef.AddSubOptionName("verbose");
         cmdln.DefineSubOption("prefix", ssPrefix, "prefix, used by cmake library and signal definition in signal_identifier.h file.");
         cmdln.DefineSubOption("enable_components", bEnableComponents, "Creates additionally to the idl files the code for the components.");
+        cmdln.DefineSubOption("fused_signal_path", bFusedSignalPath, "Optional: creates the components with a direct signal path "
+            "without a per-signal mutex and a latency benchmark for the RX signals. Requires 'enable_components'.");
         cmdln.DefineSubOption("version", ssVersion, "Optional: version information for the created files.");
         cmdln.DefineOption("O", pathOutputDir, "Set output directory (required).");
         cmdln.DefineDefaultArgument(ssVSSFileName, "Excel file.");
@@ -134,12 +137,12 @@ extern "C" int main(int iArgc, const char* rgszArgv[])
     if (vdSignals.size() > 0)
     {
         makeSignalNamesUnique(vdSignals);
-        CVSSVDGenerator vssVD(vdSignals, pathOutputDir, ssPrefix, ssVersion, bEnableComponents);
+        CVSSVDGenerator vssVD(vdSignals, pathOutputDir, ssPrefix, ssVersion, bEnableComponents, bFusedSignalPath);
         vssVD.GeneratedCode();
 
         if (bsSignals.size() > 0)
         {
-            CVSSBSGenerator vssBS(bsSignals, vdSignals, pathOutputDir, ssPrefix, ssVersion, bEnableComponents);
+            CVSSBSGenerator vssBS(bsSignals, vdSignals, pathOutputDir, ssPrefix, ssVersion, bEnableComponents, bFusedSignalPath);
             vssBS.GeneratedCode();
         }
     }
@@ -89,7 +89,7 @@ void CVSSBSCodingRX::GetKeyWordMap(const SSignalBSDefinition& signal, const SSig
             break;
         auto func = signal.vecFunctions[index];
         auto funcVD = signalVD.vecFunctions[index];
-        sstreamBSGetAndSetFunctions << Code_BS_RXGetAndSetFunctions(signal.className, func, funcVD);
+        sstreamBSGetAndSetFunctions << Code_BS_RXGetAndSetFunctions(signal.className, func, funcVD, vssWithColons);
     }
     mapKeywords["rx_bs_getandsetfunctions"] = std::move(sstreamBSGetAndSetFunctions.str());
 
@@ -296,6 +296,15 @@ std::string CVSSBSCodingRX::Code_BS_RXPrivateHeaderPart(const SFunctionBSDefinit
     mapKeywords["signal_name"] = function.signalName;
     mapKeywords["value_ctype"] = GetCTypeFromIDLType(function.idlType);
 
+    if (m_bFusedSignalPath)
+    {
+        return ReplaceKeywords(R"code(
+	%value_ctype% m_%signal_name% { 0 }; ///< %signal_name% signal
+	mutable std::mutex m_%signal_name%MutexValue; ///< Mutex protecting m_%signal_name%
+	sdv::core::CCallbackArray<vss::%vssWithColons%Service::IVSS_Set%function_name%_Event> m_%signal_name%Callbacks; ///< copy-on-write collection of events to be called
+)code", mapKeywords);
+    }
+
     return ReplaceKeywords(R"code(
 	%value_ctype% m_%signal_name% { 0 }; ///< %signal_name% signal
 	mutable std::mutex m_%signal_name%MutexCallbacks; ///< Mutex protecting m_%signal_name%Callbacks
@@ -347,7 +356,7 @@ std::string CVSSBSCodingRX::Code_BS_RXDestructor(const SSignalVDDefinition& sign
 }
 
 std::string CVSSBSCodingRX::Code_BS_RXGetAndSetFunctions(const std::string& class_name, const SFunctionBSDefinition& function, 
-    const SFunctionVDDefinition& functionVD) const
+    const SFunctionVDDefinition& functionVD, const std::string& vssWithColons) const
 {
     std::string class_name_lowercase = class_name;
     std::transform(class_name_lowercase.begin(), class_name_lowercase.end(), class_name_lowercase.begin(),
@@ -362,6 +371,56 @@ std::string CVSSBSCodingRX::Code_BS_RXGetAndSetFunctions(const std::string& clas
     mapKeywords["casted_value_ctype"] = CastValueType(signalType);
     mapKeywords["value_ctype"] = GetCTypeFromIDLType(function.idlType);
     mapKeywords["class_name_lowercase"] = class_name_lowercase;
+    mapKeywords["vssWithColons"] = vssWithColons;
+
+    if (m_bFusedSignalPath)
+    {
+        return ReplaceKeywords(R"code(
+/**
+ * @brief Set %signal_name%
+ * @param[in] value %signal_name%
+ */
+void CBasicService%class_name%::Set%function_name%(%casted_value_ctype% value)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_%signal_name%MutexValue);
+		m_%signal_name% = value;
+	}
+	SDV_LATENCY_TRACE_NAME(sdv::core::ETraceStage::basic_service, "%class_name%.%function_name%");
+	m_%signal_name%Callbacks.ForEach([&](vss::%vssWithColons%Service::IVSS_Set%function_name%_Event* callback)
+	{
+		callback->Set%function_name%(value);
+	});
+}
+
+/**
+ * @brief Write %signal_name%; distributes the value directly to the callbacks
+ * @param[in] value %signal_name%
+ */
+void CBasicService%class_name%::Write%vd_function_name%(%casted_value_ctype% value)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_%signal_name%MutexValue);
+		m_%signal_name% = value;
+	}
+	SDV_LATENCY_TRACE_NAME(sdv::core::ETraceStage::basic_service, "%class_name%.%function_name%");
+	m_%signal_name%Callbacks.ForEach([&](vss::%vssWithColons%Service::IVSS_Set%function_name%_Event* callback)
+	{
+		callback->Set%function_name%(value);
+	});
+}
+
+/**
+ * @brief Get %signal_name%
+ * @return Returns the %signal_name%
+ */
+%value_ctype% CBasicService%class_name%::Get%function_name%() const
+{
+	std::lock_guard<std::mutex> lock(m_%signal_name%MutexValue);
+	return m_%signal_name%;
+}
+)code", mapKeywords);
+    }
 
     return ReplaceKeywords(R"code(
 /**
@@ -371,6 +430,7 @@ std::string CVSSBSCodingRX::Code_BS_RXGetAndSetFunctions(const std::string& clas
 void CBasicService%class_name%::Set%function_name%(%casted_value_ctype% value)
 {
 	m_%signal_name% = value;
+	SDV_LATENCY_TRACE_NAME(sdv::core::ETraceStage::basic_service, "%class_name%.%function_name%");
 	std::lock_guard<std::mutex> lock(m_%signal_name%MutexCallbacks);
 	for (auto callback : m_%signal_name%Callbacks)
 	{
@@ -420,6 +480,29 @@ std::string CVSSBSCodingRX::Code_BS_RXRegister(const std::string& class_name, co
     mapKeywords["vssWithColons"] = vssWithColons;
     mapKeywords["class_name_lowercase"] = class_name_lowercase;
 
+    if (m_bFusedSignalPath)
+    {
+        return ReplaceKeywords(R"code(
+/**
+ * @brief Register Callback on signal change
+ * @param[in] callback function
+ */
+void CBasicService%class_name%::RegisterOnSignalChangeOf%start_with_uppercase%(vss::%vssWithColons%Service::IVSS_Set%function_name%_Event* %signal_name%Callback)
+{
+	m_%signal_name%Callbacks.Add(%signal_name%Callback);
+}
+
+/**
+ * @brief Unregister Callback
+ * @param[in] callback function
+ */
+void CBasicService%class_name%::UnregisterOnSignalChangeOf%start_with_uppercase%(vss::%vssWithColons%Service::IVSS_Set%function_name%_Event* %signal_name%Callback)
+{
+	m_%signal_name%Callbacks.Remove(%signal_name%Callback);
+}
+)code", mapKeywords);
+    }
+
     return ReplaceKeywords(R"code(
 /**
  * @brief Register Callback on signal change
@@ -449,3 +532,130 @@ void CBasicService%class_name%::UnregisterOnSignalChangeOf%start_with_uppercase%
 )code", mapKeywords);
 }
 
+
+void CVSSBSCodingRX::GetBenchmarkKeyWordMap(const SSignalBSDefinition& signal, const SSignalVDDefinition& signalVD,
+    const std::string& rsPrefix, CKeywordMap& mapKeywords) const
+{
+    std::string vssWithColons = ReplaceCharacters(signal.vssDefinition, ".", "::");
+    std::string vssNoDot = ReplaceCharacters(signal.vssDefinition, ".", "");
+    std::transform(vssNoDot.begin(), vssNoDot.end(), vssNoDot.begin(),
+        [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    std::stringstream sstreamIncludes;
+    sstreamIncludes << Code_BS_RXIncludes(vssNoDot);
+    mapKeywords["benchmark_includes_list"] += sstreamIncludes.str();
+
+    std::stringstream sstreamCallbacks;
+    std::stringstream sstreamRegisterSignals;
+    std::stringstream sstreamMeasurements;
+    std::stringstream sstreamResetSignals;
+    for (uint32_t index = 0; index < signal.vecFunctions.size(); index++)
+    {
+        if (index >= signalVD.vecFunctions.size())
+            break;
+        auto func = signal.vecFunctions[index];
+        auto funcVD = signalVD.vecFunctions[index];
+        sstreamCallbacks << Code_BenchmarkCallback(signal.className, vssWithColons, func);
+        sstreamMeasurements << Code_BenchmarkMeasure(signal, vssWithColons, func, funcVD);
+
+        // Several basic services can use the same vehicle device signal; register it only once
+        auto registerSignal = Code_BenchmarkRegisterSignal(rsPrefix, funcVD);
+        if (mapKeywords["benchmark_register_signals"].find(registerSignal) == std::string::npos &&
+            sstreamRegisterSignals.str().find(registerSignal) == std::string::npos)
+        {
+            sstreamRegisterSignals << registerSignal;
+            sstreamResetSignals << "\tsignal" << funcVD.signalName << ".Reset();\n";
+        }
+    }
+    mapKeywords["benchmark_callbacks"] += sstreamCallbacks.str();
+    mapKeywords["benchmark_register_signals"] += sstreamRegisterSignals.str();
+    mapKeywords["benchmark_measurements"] += sstreamMeasurements.str();
+    mapKeywords["benchmark_reset_signals"] += sstreamResetSignals.str();
+}
+
+std::string CVSSBSCodingRX::Code_BenchmarkCallback(const std::string& class_name, const std::string& vssWithColons,
+    const SFunctionBSDefinition& function) const
+{
+    CKeywordMap mapKeywords;
+    mapKeywords["class_name"] = class_name;
+    mapKeywords["function_name"] = function.functionName;
+    mapKeywords["signal_name"] = function.signalName;
+    mapKeywords["vssWithColons"] = vssWithColons;
+    mapKeywords["casted_value_ctype"] = CastValueType(GetCTypeFromIDLType(function.idlType));
+
+    return ReplaceKeywords(R"code(
+/**
+ * @brief Callback measuring the latency of the %signal_name% signal
+ */
+class CLatency%class_name%%function_name%
+	: public vss::%vssWithColons%Service::IVSS_Set%function_name%_Event
+	, public CLatencyMeasurement
+{
+public:
+	using CLatencyMeasurement::CLatencyMeasurement;
+
+	/**
+	 * @brief Set %signal_name% signal
+	 * @param[in] value %signal_name%
+	 */
+	void Set%function_name%(%casted_value_ctype% /*value*/) override
+	{
+		Stop();
+	}
+};
+)code", mapKeywords);
+}
+
+std::string CVSSBSCodingRX::Code_BenchmarkRegisterSignal(const std::string& rsPrefix, const SFunctionVDDefinition& functionVD) const
+{
+    auto startWithUppercase = functionVD.signalName;
+    if (!startWithUppercase.empty())
+    {
+        startWithUppercase[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(startWithUppercase[0])));
+    }
+
+    CKeywordMap mapKeywords;
+    mapKeywords["object_prefix"] = rsPrefix;
+    mapKeywords["start_with_uppercase"] = startWithUppercase;
+    mapKeywords["vd_signal_name"] = functionVD.signalName;
+
+    return ReplaceKeywords(R"code(	sdv::core::CSignal signal%vd_signal_name% = dispatch.RegisterRxSignal(%object_prefix%::ds%start_with_uppercase%);
+)code", mapKeywords);
+}
+
+std::string CVSSBSCodingRX::Code_BenchmarkMeasure(const SSignalBSDefinition& signal, const std::string& vssWithColons,
+    const SFunctionBSDefinition& function, const SFunctionVDDefinition& functionVD) const
+{
+    auto startWithUppercase = function.signalName;
+    if (!startWithUppercase.empty())
+    {
+        startWithUppercase[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(startWithUppercase[0])));
+    }
+
+    CKeywordMap mapKeywords;
+    mapKeywords["vss_original"] = signal.vssDefinition;
+    mapKeywords["vssWithColons"] = vssWithColons;
+    mapKeywords["class_name"] = signal.className;
+    mapKeywords["function_name"] = function.functionName;
+    mapKeywords["start_with_uppercase"] = startWithUppercase;
+    mapKeywords["vd_signal_name"] = functionVD.signalName;
+    mapKeywords["vd_value_ctype"] = GetCTypeFromIDLType(functionVD.idlType);
+
+    return ReplaceKeywords(R"code(
+	{
+		auto p%function_name%Service = sdv::core::GetObject("%vss_original%_Service").GetInterface<vss::%vssWithColons%Service::IVSS_Get%function_name%>();
+		CLatency%class_name%%function_name% latency(nCount);
+		if (p%function_name%Service && signal%vd_signal_name%)
+		{
+			p%function_name%Service->RegisterOnSignalChangeOf%start_with_uppercase%(&latency);
+			for (size_t nIteration = 0; nIteration < nCount; nIteration++)
+			{
+				latency.Start();
+				signal%vd_signal_name%.Write(BenchmarkValue<%vd_value_ctype%>(nIteration));
+			}
+			p%function_name%Service->UnregisterOnSignalChangeOf%start_with_uppercase%(&latency);
+		}
+		bResult &= latency.Report("%vss_original%_Service::Set%function_name%", nCount);
+	}
+)code", mapKeywords);
+}
@@ -38,6 +38,12 @@ class CVSSBSCodingRX : public CCodeGeneratorBase, CVSSHelper
 {
 
 public:
+    /**
+     * @brief Constructor
+     * @param[in] bFusedSignalPath if set, the callbacks are stored in a copy-on-write array and called without locking
+     */
+    CVSSBSCodingRX(bool bFusedSignalPath = false) : m_bFusedSignalPath(bFusedSignalPath) {}
+
     /**
      * @brief create service content for the IDL file of a RX signal
      * @param[in] vssParts Interface in vss style separated in parts
@@ -135,10 +141,11 @@ protected:
      * @param[in] class_name class name which is part of the interface (Basic Service)
      * @param[in] function function definition structure (Basic Service)
      * @param[in] functionVD function definition structure (Vehicle Device)
+     * @param[in] vssWithColons vss string with colons as separator (Basic Service)
      * @return content of a single set and get function code
      */
     std::string Code_BS_RXGetAndSetFunctions(const std::string& class_name, const SFunctionBSDefinition& function, 
-        const SFunctionVDDefinition& functionVD) const;
+        const SFunctionVDDefinition& functionVD, const std::string& vssWithColons) const;
 
     /**
      * @brief create register/unregister code for basic service
@@ -149,6 +156,49 @@ protected:
      */
     std::string Code_BS_RXRegister(const std::string& class_name, const SFunctionBSDefinition& function, 
         const std::string& vssWithColons) const;
+
+public:
+    /**
+     * @brief fill the KeyWordMap of the latency benchmark with the strings required for a single basic service
+     * @param[in] signal signal definition structure of the basic service
+     * @param[in] signalVD signal definition structure from vehicle device
+     * @param[in] rsPrefix prefix, used by the signal definition in signal_identifier.h file
+     * @param[in] mapKeywords KeyWordMap to be extended
+     */
+    void GetBenchmarkKeyWordMap(const SSignalBSDefinition& signal, const SSignalVDDefinition& signalVD,
+        const std::string& rsPrefix, CKeywordMap& mapKeywords) const;
+
+protected:
+    /**
+     * @brief create the callback class of the latency benchmark receiving the values of a basic service function
+     * @param[in] class_name class name of the basic service
+     * @param[in] vssWithColons vss string with colons as separator
+     * @param[in] function function definition structure
+     * @return content of the callback class
+     */
+    std::string Code_BenchmarkCallback(const std::string& class_name, const std::string& vssWithColons,
+        const SFunctionBSDefinition& function) const;
+
+    /**
+     * @brief create the registration of the RX signal of a vehicle device function in the latency benchmark
+     * @param[in] rsPrefix prefix, used by the signal definition in signal_identifier.h file
+     * @param[in] functionVD function definition structure of the vehicle device
+     * @return content of the signal registration
+     */
+    std::string Code_BenchmarkRegisterSignal(const std::string& rsPrefix, const SFunctionVDDefinition& functionVD) const;
+
+    /**
+     * @brief create the latency measurement of a basic service function in the latency benchmark
+     * @param[in] signal signal definition structure of the basic service
+     * @param[in] vssWithColons vss string with colons as separator
+     * @param[in] function function definition structure of the basic service
+     * @param[in] functionVD function definition structure of the vehicle device
+     * @return content of the measurement
+     */
+    std::string Code_BenchmarkMeasure(const SSignalBSDefinition& signal, const std::string& vssWithColons,
+        const SFunctionBSDefinition& function, const SFunctionVDDefinition& functionVD) const;
+
+    bool m_bFusedSignalPath = false;    ///< if set, the code for the fused signal path is created
 };
 
 #endif // !defined VSS_BS_CODING_RX_H
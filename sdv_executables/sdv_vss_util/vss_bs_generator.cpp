@@ -63,6 +63,74 @@ void CVSSBSGenerator::CreateRXFiles(const std::string& ssVersion)
         }
         CreateIDLBasicServiceFileForRXSignal(rxSignal, ssVersion);
     }
+    if (m_enableComponentCreation && m_fusedSignalPath)
+    {
+        CreateLatencyBenchmarkFiles(ssVersion);
+    }
+}
+
+void CVSSBSGenerator::CreateLatencyBenchmarkFiles(const std::string& ssVersion) const
+{
+    std::string folderName = "latency_benchmark";
+    if (m_RXsignals.empty() || !CreateFolder(m_pathProject, folderName))
+    {
+        return;
+    }
+    std::filesystem::path  pathBenchmark = m_pathProject / folderName / "latency_benchmark.cpp";
+    std::filesystem::path  pathDispatchConfig = m_pathProject / folderName / "latency_benchmark_dds.toml";
+    std::filesystem::path  pathComponentsConfig = m_pathProject / folderName / "latency_benchmark_vd_bs.toml";
+    std::filesystem::path  pathCMakeLists = m_pathProject / folderName / "CMakeLists.txt";
+
+    CKeywordMap mapKeywords;
+    CVSSCodingCommon coding(m_ssPrefix);
+    coding.GetCommonKeyWordMap(m_RXsignals.front(), mapKeywords, ssVersion);
+    mapKeywords["benchmark_cpp"] = pathBenchmark.filename().generic_u8string();
+    mapKeywords["benchmark_dispatch_toml"] = pathDispatchConfig.filename().generic_u8string();
+    mapKeywords["benchmark_components_toml"] = pathComponentsConfig.filename().generic_u8string();
+
+    CVSSBSCodingRX codingRX(m_fusedSignalPath);
+    std::stringstream sstreamComponents;
+    std::vector<std::string> vecVDClasses;
+    for (const auto& rxSignal : m_RXsignals)
+    {
+        auto signalVD = GetVDSignal(rxSignal.vssVDDefinition, rxSignal.signalDirection);
+        if (!signalVD.vecFunctions.size())
+        {
+            continue;
+        }
+        codingRX.GetBenchmarkKeyWordMap(rxSignal, signalVD, m_ssPrefix, mapKeywords);
+        std::string classNameLowerCase = rxSignal.className;
+        std::transform(classNameLowerCase.begin(), classNameLowerCase.end(), classNameLowerCase.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        std::string vdClassNameLowerCase = signalVD.className;
+        std::transform(vdClassNameLowerCase.begin(), vdClassNameLowerCase.end(), vdClassNameLowerCase.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        // The vehicle device is loaded before the basic services using it
+        if (std::find(vecVDClasses.begin(), vecVDClasses.end(), signalVD.vssDefinition) == vecVDClasses.end())
+        {
+            vecVDClasses.push_back(signalVD.vssDefinition);
+            sstreamComponents << "\n[[Component]]\nPath = \"" << m_ssPrefix << "_vd_" << vdClassNameLowerCase << "_rx.sdv\"\n";
+            sstreamComponents << "Class = \"" << signalVD.vssDefinition << "_Device\"\n";
+        }
+        sstreamComponents << "\n[[Component]]\nPath = \"" << m_ssPrefix << "_bs_" << classNameLowerCase << "_rx.sdv\"\n";
+        sstreamComponents << "Class = \"" << rxSignal.vssDefinition << "_Service\"\n";
+    }
+    mapKeywords["benchmark_components"] = sstreamComponents.str();
+
+    std::ofstream fstreamBenchmark(pathBenchmark, std::ios::out | std::ios::trunc);
+    fstreamBenchmark << ReplaceKeywords(szRXLatencyBenchmarkTemplate, mapKeywords);
+    fstreamBenchmark.close();
+    std::ofstream fstreamDispatchConfig(pathDispatchConfig, std::ios::out | std::ios::trunc);
+    fstreamDispatchConfig << ReplaceKeywords(szRXLatencyBenchmarkDispatchConfigTemplate, mapKeywords);
+    fstreamDispatchConfig.close();
+    std::ofstream fstreamComponentsConfig(pathComponentsConfig, std::ios::out | std::ios::trunc);
+    fstreamComponentsConfig << ReplaceKeywords(szRXLatencyBenchmarkComponentsConfigTemplate, mapKeywords);
+    fstreamComponentsConfig.close();
+
+    auto cmakeContent = coding.Code_CMakeBenchmark(m_ssPrefix + "_latency_benchmark", "latency_benchmark",
+        pathDispatchConfig.filename().generic_u8string() + " " + pathComponentsConfig.filename().generic_u8string());
+    CreateCMakeFile(pathCMakeLists, cmakeContent);
 }
 
 void CVSSBSGenerator::CreateBasicServiceFilesForRXSignal(const SSignalBSDefinition& signal, const std::string& ssVersion)
@@ -96,7 +164,7 @@ void CVSSBSGenerator::CreateBasicServiceFilesForRXSignal(const SSignalBSDefiniti
     mapKeywords["basic_service_h"] = pathLowerCaseHeader.filename().generic_u8string();
     mapKeywords["basic_service_cpp"] = pathLowerCaseClass.filename().generic_u8string();
 
-    CVSSBSCodingRX codingRX;
+    CVSSBSCodingRX codingRX(m_fusedSignalPath);
     auto signalVD = GetVDSignal(signal.vssVDDefinition, signal.signalDirection);
     if (!signalVD.vecFunctions.size())
     {
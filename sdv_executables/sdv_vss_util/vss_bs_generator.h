@@ -32,10 +32,12 @@ public:
      * @param[in] rsPrefix used by cmake library and signal definition in signal_identifier.h file
      * @param[in] rsVersion optional version tag, will be wriiten in header of the files
      * @param[in] enableComponentCreation optional version tag, will be wriiten in header of the files 
+     * @param[in] fusedSignalPath optional, creates the components with the fused signal path
      */
     CVSSBSGenerator(const std::vector<SSignalBSDefinition>& signals, const std::vector<SSignalVDDefinition>& signalsVD, const std::filesystem::path& rpathOutputDir, const std::string& rsPrefix, 
-        const std::string& rsVersion, const bool enableComponentCreation) :
+        const std::string& rsVersion, const bool enableComponentCreation, const bool fusedSignalPath = false) :
         m_enableComponentCreation(enableComponentCreation),
+        m_fusedSignalPath(fusedSignalPath),
         m_ssPrefix(rsPrefix),
         m_ssVersion(rsVersion), 
         m_pathProject(rpathOutputDir), 
@@ -81,6 +83,12 @@ private:
      */
     void CreateBasicServiceFilesForRXSignal(const SSignalBSDefinition& signal, const std::string& ssVersion);
 
+    /**
+     * @brief create the latency benchmark of the RX signals (fused signal path only)
+     * @param[in] ssVersion optional information will be placed in the header of the files
+     */
+    void CreateLatencyBenchmarkFiles(const std::string& ssVersion) const;
+
     /**
      * @brief create IDL file of a single RX signal (basic service)
      * @param[in] signal single signal definition
@@ -164,6 +172,7 @@ private:
     }
 
     bool m_enableComponentCreation;                    ///< if set, the code for the components are created, otherwise only idl files 
+    bool m_fusedSignalPath;                            ///< if set, the components are created with the fused signal path
     std::string m_ssPrefix;                            ///< prefix, used by cmake library and signal definition in signal_identifier.h file.
     std::string m_ssVersion;                           ///< optional version tag, will be written in header of the files 
     std::filesystem::path  m_pathProject;              ///< Project file path
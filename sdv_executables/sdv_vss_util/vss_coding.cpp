@@ -263,6 +263,65 @@ add_library(${TARGET_NAME} SHARED
 set_target_properties(${TARGET_NAME} PROPERTIES PREFIX "")
 set_target_properties(${TARGET_NAME} PROPERTIES SUFFIX ".sdv")
 
+# TODO: set target name.
+#add_dependencies(${TARGET_NAME} <add_cmake_target_this_depends_on>)
+)code", mapKeywords);
+}
+
+std::string CVSSCodingCommon::Code_CMakeBenchmark(const std::string& targetExeName, const std::string& targetBenchmarkName,
+    const std::string& configFiles) const
+{
+    CKeywordMap mapKeywords;
+    mapKeywords["target_exe_name"] = targetExeName;
+    mapKeywords["benchmark_file_name"] = targetBenchmarkName;
+    mapKeywords["config_files"] = configFiles;
+    return ReplaceKeywords(R"code(# Enforce CMake version 3.20 or newer needed for path function
+cmake_minimum_required (VERSION 3.20)
+
+# Use new policy for project version settings and default warning level
+cmake_policy(SET CMP0048 NEW)   # requires CMake 3.14
+cmake_policy(SET CMP0092 NEW)   # requires CMake 3.15
+
+# Define project
+project(%target_exe_name% VERSION 1.0 LANGUAGES CXX)
+
+# Use C++17 support
+set(CMAKE_CXX_STANDARD 17)
+
+# Set target name.
+set(TARGET_NAME %target_exe_name%)
+
+# Set the SDV_FRAMEWORK_DEV_INCLUDE if not defined yet
+if (NOT DEFINED SDV_FRAMEWORK_DEV_INCLUDE)
+    if (NOT DEFINED ENV{SDV_FRAMEWORK_DEV_INCLUDE})
+        message( FATAL_ERROR "The environment variable SDV_FRAMEWORK_DEV_INCLUDE needs to be pointing to the SDV V-API development include files location!")
+    endif()
+    set (SDV_FRAMEWORK_DEV_INCLUDE "$ENV{SDV_FRAMEWORK_DEV_INCLUDE}")
+endif()
+
+# Include link to export directory of SDV V-API development include files location
+include_directories(${SDV_FRAMEWORK_DEV_INCLUDE})
+
+# Set platform specific compile flags
+if (CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
+    add_compile_options(/W4 /WX /wd4996 /wd4100 /permissive- /Zc:rvalueCast)
+else()
+    add_compile_options(-Werror -Wall -Wextra -Wshadow -Wpedantic -Wunreachable-code -fno-common)
+endif()
+
+# Add the executable
+add_executable(${TARGET_NAME} %benchmark_file_name%.cpp)
+if (WIN32)
+    target_link_libraries(${TARGET_NAME} Ws2_32 Winmm Rpcrt4.lib)
+else()
+    set(THREADS_PREFER_PTHREAD_FLAG ON)
+    find_package(Threads REQUIRED)
+    target_link_libraries(${TARGET_NAME} ${CMAKE_DL_LIBS} rt Threads::Threads)
+endif()
+
+# Copy the configuration files to the configuration folder of the executable
+file(COPY %config_files% DESTINATION ${CMAKE_BINARY_DIR}/bin/config)
+
 # TODO: set target name.
 #add_dependencies(${TARGET_NAME} <add_cmake_target_this_depends_on>)
 )code", mapKeywords);
@@ -86,6 +86,16 @@ public:
      */
     std::string Code_CMakeProject(const std::string& targetLibName, const std::string& targetComponentName) const;
 
+    /**
+     * @brief generates the cmakelist.txt file of the latency benchmark executable
+     * @param[in] targetExeName project cmake name
+     * @param[in] targetBenchmarkName is the name of the cpp file
+     * @param[in] configFiles list of the configuration files copied to the config folder of the executable
+     * @return content of the CMakeList.txt file
+     */
+    std::string Code_CMakeBenchmark(const std::string& targetExeName, const std::string& targetBenchmarkName,
+        const std::string& configFiles) const;
+
 protected:
 
     /**
@@ -26,6 +26,7 @@ const char szRXVehicleDeviceHeaderTemplate[] = R"code(/**
 #include <set>
 #include <support/component_impl.h>
 #include <support/signal_support.h>
+#include <support/latency_trace.h>
 %rx_vd_includes_list%
 #include "../signal_identifier.h"
 
@@ -116,6 +117,7 @@ const char szRXBasicServiceHeaderTemplate[] = R"code(/**
 #include <set>
 #include <support/component_impl.h>
 #include <support/signal_support.h>
+#include <support/latency_trace.h>
 %rx_bs_includes_list%
 /**
  * @brief Basic Service %vss_original%
@@ -203,3 +205,154 @@ const char szBSRXIDLTemplate[] = R"code(
 %vss_device%
 %vss_service%
 )code";
+
+/**
+ * @brief file template for the latency benchmark of the RX signals (fused signal path)
+ */
+const char szRXLatencyBenchmarkTemplate[] = R"code(/**
+ * @file %benchmark_cpp%
+ * @date %creation_date%
+ * %version%
+ */
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <support/app_control.h>
+#include <support/signal_support.h>
+%benchmark_includes_list%#include "../signal_identifier.h"
+
+/**
+ * @brief Latency measurement between writing a signal to the dispatch service and the call of the basic service callback.
+ */
+class CLatencyMeasurement
+{
+public:
+	/**
+	 * @brief Constructor
+	 * @param[in] nCount amount of samples to reserve
+	 */
+	CLatencyMeasurement(size_t nCount)
+	{
+		m_vecSamples.reserve(nCount);
+	}
+
+	/**
+	 * @brief Start a measurement; called just before the signal is written
+	 */
+	void Start()
+	{
+		m_tpWrite = std::chrono::steady_clock::now();
+	}
+
+	/**
+	 * @brief Stop the measurement; called from the callback
+	 */
+	void Stop()
+	{
+		m_vecSamples.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - m_tpWrite).count());
+	}
+
+	/**
+	 * @brief Print the results
+	 * @param[in] rssName name of the measurement
+	 * @param[in] nCount amount of written values
+	 * @return Returns 'true' when all written values were received, 'false' when not.
+	 */
+	bool Report(const std::string& rssName, size_t nCount) const
+	{
+		std::vector<double> vecSorted = m_vecSamples;
+		std::sort(vecSorted.begin(), vecSorted.end());
+		std::cout << std::left << std::setw(60) << rssName << std::right << std::fixed << std::setprecision(3);
+		if (vecSorted.empty())
+			std::cout << " no values received" << std::endl;
+		else
+			std::cout << " median " << std::setw(9) << vecSorted[vecSorted.size() / 2] << " us, p99 " << std::setw(9) <<
+				vecSorted[std::min(vecSorted.size() - 1, vecSorted.size() * 99 / 100)] << " us, max " << std::setw(9) <<
+				vecSorted.back() << " us (" << vecSorted.size() << "/" << nCount << ")" << std::endl;
+		return vecSorted.size() == nCount;
+	}
+
+private:
+	std::chrono::steady_clock::time_point m_tpWrite;    ///< Time the signal was written
+	std::vector<double> m_vecSamples;                   ///< Latency samples in microseconds
+};
+
+/**
+ * @brief Create the value written at a specific iteration
+ * @tparam TValue type of the value
+ * @param[in] nIteration iteration
+ * @return The value
+ */
+template <typename TValue>
+TValue BenchmarkValue(size_t nIteration)
+{
+	if constexpr (std::is_same_v<TValue, bool>)
+		return (nIteration & 1) != 0;
+	else if constexpr (std::is_arithmetic_v<TValue>)
+		return static_cast<TValue>(nIteration & 0x3f);   // Cyclic values
+	else
+		return TValue();
+}
+%benchmark_callbacks%
+/**
+ * @brief Measure the latency of the RX signals from the dispatch service up to the basic service callbacks
+ * @param[in] iArgc amount of arguments
+ * @param[in] rgszArgv arguments; the first optional argument is the amount of values written per signal
+ * @return Returns 0 when all values were received; -1 when not.
+ */
+int main(int iArgc, char* rgszArgv[])
+{
+	size_t nCount = iArgc > 1 ? static_cast<size_t>(std::stoul(rgszArgv[1])) : 10000;
+
+	sdv::app::CAppControl appcontrol;
+	if (!appcontrol.Startup(""))
+		return -1;
+	appcontrol.SetConfigMode();
+	appcontrol.AddConfigSearchDir("config");
+	if (appcontrol.LoadConfig("%benchmark_dispatch_toml%") != sdv::core::EConfigProcessResult::successful)
+	{
+		std::cout << "Could not load the data dispatch service" << std::endl;
+		appcontrol.Shutdown();
+		return -1;
+	}
+
+	// Register the RX signals; this is normally done by the data link.
+	sdv::core::CDispatchService dispatch;
+%benchmark_register_signals%
+	if (appcontrol.LoadConfig("%benchmark_components_toml%") != sdv::core::EConfigProcessResult::successful)
+	{
+		std::cout << "Could not load the vehicle devices and basic services" << std::endl;
+		appcontrol.Shutdown();
+		return -1;
+	}
+	appcontrol.SetRunningMode();
+
+	bool bResult = true;
+%benchmark_measurements%
+	appcontrol.SetConfigMode();
+%benchmark_reset_signals%	appcontrol.Shutdown();
+	return bResult ? 0 : -1;
+}
+)code";
+
+/**
+ * @brief file template for the configuration of the latency benchmark (data dispatch service)
+ */
+const char szRXLatencyBenchmarkDispatchConfigTemplate[] = R"code([Configuration]
+Version = 100
+
+[[Component]]
+Path = "data_dispatch_service.sdv"
+Class = "DataDispatchService"
+)code";
+
+/**
+ * @brief file template for the configuration of the latency benchmark (vehicle devices and basic services)
+ */
+const char szRXLatencyBenchmarkComponentsConfigTemplate[] = R"code([Configuration]
+Version = 100
+%benchmark_components%)code";
@@ -333,6 +333,19 @@ std::string CVSSVDCodingRX::Code_VD_RXPrivateHeaderPart(const SFunctionVDDefinit
     mapKeywords["class_name"] = class_name;
     mapKeywords["class_name_lowercase"] = class_name_lowercase;
 
+    if (m_bFusedSignalPath)
+    {
+        return ReplaceKeywords(R"code(
+	/**
+	* @brief Convert the value once and execute all callbacks
+	*/
+	void ExecuteAllCallBacksFor%start_with_uppercase%(sdv::any_t value);
+
+	sdv::core::CSignal m_%signal_name%Signal;                                                                       ///< Signal of the platform abstraction
+	sdv::core::CCallbackArray<vss::%vssWithColons%Device::IVSS_Write%function_name%_Event> m_%signal_name%Callbacks; ///< copy-on-write collection of events to be called
+)code", mapKeywords);
+    }
+
     return ReplaceKeywords(R"code(
 	/**
 	* @brief Execute all callbacks
@@ -425,6 +438,46 @@ std::string CVSSVDCodingRX::Code_VD_RXRegister( const std::string& class_name, c
         mapKeywords["convertFormula"] = formula.str();
     }
 
+    if (m_bFusedSignalPath)
+    {
+        return ReplaceKeywords(R"code(
+/**
+* @brief Register %function_name% event on signal change
+* Collect all events and call them on signal change
+* @param[in] event function
+*/
+void CVehicleDevice%class_name%::Register%function_name%Event(vss::%vssWithColons%Device::IVSS_Write%function_name%_Event* event)
+{
+	m_%signal_name%Callbacks.Add(event);
+}
+
+/**
+* @brief Unregister %function_name% event
+* @param[in] event function
+*/
+void CVehicleDevice%class_name%::Unregister%function_name%Event(vss::%vssWithColons%Device::IVSS_Write%function_name%_Event* event)
+{
+	m_%signal_name%Callbacks.Remove(event);
+}
+
+/**
+* @brief Convert the value once and execute all callbacks
+*/
+void CVehicleDevice%class_name%::ExecuteAllCallBacksFor%start_with_uppercase%(sdv::any_t value)
+{
+	if (m_%signal_name%Callbacks.Empty())
+		return;
+	SDV_LATENCY_TRACE_NAME(sdv::core::ETraceStage::vehicle_device, "%class_name%.%function_name%");
+
+%convertFormula%
+	m_%signal_name%Callbacks.ForEach([&](vss::%vssWithColons%Device::IVSS_Write%function_name%_Event* callback)
+	{
+		callback->Write%function_name%(%signal_name%);
+	});
+}
+)code", mapKeywords);
+    }
+
     return ReplaceKeywords(R"code(
 /**
 * @brief Register %function_name% event on signal change
@@ -458,6 +511,7 @@ void CVehicleDevice%class_name%::Unregister%function_name%Event(vss::%vssWithCol
 */
 void CVehicleDevice%class_name%::ExecuteAllCallBacksFor%start_with_uppercase%(sdv::any_t value)
 {
+	SDV_LATENCY_TRACE_NAME(sdv::core::ETraceStage::vehicle_device, "%class_name%.%function_name%");
 %convertFormula%
 	std::lock_guard<std::mutex> lock(m_%signal_name%MutexCallbacks);
 	for (const auto& callback : m_%signal_name%Callbacks)
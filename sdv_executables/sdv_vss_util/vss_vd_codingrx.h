@@ -38,8 +38,10 @@ public:
     /**
      * @brief Constructor
      * @param[in] rsPrefix used by cmake library and signal definition in signal_identifier.h file
+     * @param[in] bFusedSignalPath if set, the callbacks are stored in a copy-on-write array and called without locking
      */
-    CVSSVDCodingRX(const std::string& rsPrefix) : m_ssPrefix(rsPrefix) {}
+    CVSSVDCodingRX(const std::string& rsPrefix, bool bFusedSignalPath = false) :
+        m_ssPrefix(rsPrefix), m_bFusedSignalPath(bFusedSignalPath) {}
 
     /**
      * @brief create device content for the IDL file of a RX signal
@@ -156,7 +158,8 @@ protected:
      */
     std::string Code_VD_RXFormular(const SFunctionVDDefinition& function) const;
 
-    std::string m_ssPrefix; ///< prefix, used by cmake library and signal definition in signal_identifier.h file.
+    std::string m_ssPrefix;             ///< prefix, used by cmake library and signal definition in signal_identifier.h file.
+    bool m_bFusedSignalPath = false;    ///< if set, the code for the fused signal path is created
 };
 
 #endif // !defined VSS_VD_CODING_RX_H
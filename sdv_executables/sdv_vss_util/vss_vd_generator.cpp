@@ -155,7 +155,7 @@ void CVSSVDGenerator::CreateVehicleDeviceFilesForRXSignal(const SSignalVDDefinit
     mapKeywords["abstract_device_h"] = pathLowerCaseHeader.filename().generic_u8string();
     mapKeywords["abstract_device_cpp"] = pathLowerCaseClass.filename().generic_u8string();
 
-    CVSSVDCodingRX codingRX(m_ssPrefix);
+    CVSSVDCodingRX codingRX(m_ssPrefix, m_fusedSignalPath);
     codingRX.GetKeyWordMap(signal, mapKeywords);
 
     fstreamVDHeader << ReplaceKeywords(szRXVehicleDeviceHeaderTemplate, mapKeywords);
@@ -31,9 +31,11 @@ public:
      * @param[in] rsPrefix used by cmake library and signal definition in signal_identifier.h file
      * @param[in] rsVersion optional version tag, will be wriiten in header of the files 
      * @param[in] enableComponentCreation optional version tag, will be wriiten in header of the files 
+     * @param[in] fusedSignalPath optional, creates the components with the fused signal path
      */
-    CVSSVDGenerator(const std::vector<SSignalVDDefinition>& signals, const std::filesystem::path& rpathOutputDir, const std::string& rsPrefix, const std::string& rsVersion, const bool enableComponentCreation) :
+    CVSSVDGenerator(const std::vector<SSignalVDDefinition>& signals, const std::filesystem::path& rpathOutputDir, const std::string& rsPrefix, const std::string& rsVersion, const bool enableComponentCreation, const bool fusedSignalPath = false) :
         m_enableComponentCreation(enableComponentCreation),
+        m_fusedSignalPath(fusedSignalPath),
         m_ssPrefix(rsPrefix),
         m_ssVersion(rsVersion), 
         m_pathProject(rpathOutputDir), 
@@ -145,6 +147,7 @@ private:
     const std::string& interfaceList, const std::string& interfaceEntryList, const std::string& functionList, const std::string& variablePointerList) const;
 
     bool m_enableComponentCreation;                    ///< if set, the code for the components are created, otherwise only idl files 
+    bool m_fusedSignalPath;                            ///< if set, the components are created with the fused signal path
     std::string m_ssPrefix;                            ///< prefix, used by cmake library and signal definition in signal_identifier.h file.
     std::string m_ssVersion;                           ///< optional version tag, will be written in header of the files 
     std::filesystem::path  m_pathProject;              ///< Project file path
@@ -130,6 +130,27 @@ void CCANSilKit::OnShutdown()
 }
 
 void CCANSilKit::RegisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
+{
+    RegisterReceiverEx(pReceiver, {});
+}
+
+void CCANSilKit::UnregisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
+{
+    // NOTE: Normally the remove function should be called in the configuration mode. Since it doesn't give
+    // feedback and the associated caller might delete any receiving function, allow the removal to take place even
+    // when running.
+
+    if (!pReceiver)
+    {
+        return;
+    }
+
+    SDV_LOG_INFO("Unregistering VAPI CAN communication receiver...");
+
+    m_Receivers.Unregister(pReceiver);
+}
+
+void CCANSilKit::RegisterReceiverEx(/*in*/ sdv::can::IReceive* pReceiver, /*in*/ const sdv::can::SReceiverConfig& sConfig)
 {
     if (GetObjectState() != sdv::EObjectState::configuring) 
         return;
@@ -143,10 +164,8 @@ void CCANSilKit::RegisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
 
     SDV_LOG_INFO("Registering VAPI CAN communication receiver...");
 
-    std::unique_lock<std::mutex> lock(m_ReceiversMtx);
-    if (m_SetReceivers.find(pReceiver) == m_SetReceivers.end())
+    if (m_Receivers.Register(pReceiver, sConfig))
     {
-        m_SetReceivers.insert(pReceiver);
         SDV_LOG_INFO("Receiver registered successfully.");
     }
     else
@@ -155,23 +174,6 @@ void CCANSilKit::RegisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
     }
 }
 
-void CCANSilKit::UnregisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
-{
-    // NOTE: Normally the remove function should be called in the configuration mode. Since it doesn't give
-    // feedback and the associated caller might delete any receiving function, allow the removal to take place even
-    // when running.
-
-    if (!pReceiver)
-    {
-        return;
-    }
-
-    SDV_LOG_INFO("Unregistering VAPI CAN communication receiver...");
-
-    std::unique_lock<std::mutex> lock(m_ReceiversMtx);
-    m_SetReceivers.erase(pReceiver);
-}
-
 sdv::sequence<sdv::u8string> CCANSilKit::GetInterfaces() const
 {
     sdv::sequence<sdv::u8string> seqIfcNames;
@@ -377,11 +379,7 @@ void CCANSilKit::SilKitReceiveMessageHandler(const SilKit::Services::Can::CanFra
     }
 
     // Broadcast the message to the receivers
-    std::unique_lock<std::mutex> lockReceivers(m_ReceiversMtx);
-    for (sdv::can::IReceive* pReceiver : m_SetReceivers)
-    {
-        pReceiver->Receive(sSDVCanMessage, 0);
-    }
+    m_Receivers.Dispatch(sSDVCanMessage, 0);
 }
 
 void CCANSilKit::SilKitTransmitAcknowledgeHandler(const SilKit::Services::Can::CanFrameTransmitEvent& rsSilKitTransmitAcknowledge)
@@ -435,6 +433,7 @@ void CCANSilKit::Send(/*in*/ const sdv::can::SMessage& sSDVCanMessage, /*in*/ ui
         }
         silKitMessage.dataField = vecData;
         m_SilKitCanController->SendFrame(silKitMessage);
+        GetCanMetrics().counterSent.Increment();
     }
     else
     {
@@ -478,6 +477,7 @@ void CCANSilKit::SetupTimeSyncService()
                 silKitMessage.dataField = vecData;
 
                     m_SilKitCanController->SendFrame(silKitMessage);
+                    GetCanMetrics().counterSent.Increment();
                     m_MessageQueue.pop();
                 }
             }
@@ -25,6 +25,7 @@
 #include <interfaces/can.h>
 #include <support/component_impl.h>
 #include <support/timer.h>
+#include "../../global/can_receiver_list.h"
 
 //SilKit includes
 #include "silkit/SilKit.hpp"
@@ -32,12 +33,15 @@
 /**
 * @brief Component to establish Socket CAN communication between VAPI and external application
 */
-class CCANSilKit : public sdv::CSdvObject, public sdv::can::IRegisterReceiver, public sdv::can::ISend, sdv::can::IInformation
+class CCANSilKit : public sdv::CSdvObject, public sdv::can::IRegisterReceiver, public sdv::can::IRegisterReceiverEx,
+    public sdv::can::ISend, sdv::can::IInformation
 {
 public:
 
     // Interface map
     BEGIN_SDV_INTERFACE_MAP()
+        SDV_INTERFACE_ENTRY(sdv::can::IRegisterReceiver)
+        SDV_INTERFACE_ENTRY(sdv::can::IRegisterReceiverEx)
         SDV_INTERFACE_ENTRY(sdv::can::ISend)
         SDV_INTERFACE_ENTRY(sdv::can::IInformation)
     END_SDV_INTERFACE_MAP()
@@ -94,6 +98,14 @@ public:
      */
     virtual void UnregisterReceiver(/*in*/ sdv::can::IReceive* pReceiver) override;
 
+    /**
+     * @brief Register a CAN message receiver using a receiver configuration. Overload of
+     * sdv::can::IRegisterReceiverEx::RegisterReceiverEx.
+     * @param[in] pReceiver Pointer to the receiver interface.
+     * @param[in] sConfig The receiver configuration.
+     */
+    virtual void RegisterReceiverEx(/*in*/ sdv::can::IReceive* pReceiver, /*in*/ const sdv::can::SReceiverConfig& sConfig) override;
+
     /**
      * @brief Send a CAN message. Overload of sdv::can::ISend::Send.
      * @param[in] sSDVCanMessage Message that is to be sent. The source node information is ignored. The target node determines over
@@ -201,8 +213,7 @@ private:
      */
     void SilKitTransmitAcknowledgeHandler(const SilKit::Services::Can::CanFrameTransmitEvent& rsSilKitTransmitAcknowledge);
 
-    std::mutex                              m_ReceiversMtx;                     ///< Protect the receiver set.
-    std::set<sdv::can::IReceive*>           m_SetReceivers;                     ///< Set with receiver interfaces.
+    CCanReceiverList                        m_Receivers;                        ///< List with receiver interfaces.
      
     std::queue<sdv::can::SMessage>          m_MessageQueue;                     ///< Map of the messages to be sent on SilKit.
     std::mutex                              m_QueueMutex;                       ///< Protection for message map.
@@ -13,6 +13,7 @@
 
 #include "can_com_sim.h"
 #include <support/toml.h>
+#include <support/latency_trace.h>
 #include "../../global/ascformat/ascreader.cpp"
 #include "../../global/ascformat/ascwriter.cpp"
 
@@ -53,6 +54,14 @@ bool CCANSimulation::OnInitialize()
             "CAN simulator uses ASC file '" + m_pathTarget.generic_u8string() + "' to record CAN data.");
     m_writer.StartTimer();
 
+    // The binary capture format is written while recording; only the current block is kept in memory.
+    if (m_pathTarget.extension() == asc::szCaptureExtension && !m_capture.Open(m_pathTarget))
+    {
+        SDV_LOG(sdv::core::ELogSeverity::error,
+            "Failed to create capture file '" + m_pathTarget.generic_u8string() + "' for CAN recording.");
+        return false;
+    }
+
     // Initialize the ASC reader
     if (!m_pathSource.empty())
         SDV_LOG(sdv::core::ELogSeverity::info,
@@ -72,6 +81,9 @@ bool CCANSimulation::OnInitialize()
     if (!m_pathSource.empty())
         SDV_LOG(sdv::core::ELogSeverity::info,
             "CAN simulator ASC file '" + m_pathSource.generic_u8string() + "' contains ", m_reader.GetMessageCount(), " messages.");
+    if (!m_pathSource.empty() && m_dPlaybackStart > 0.0 && !m_reader.JumpTimestamp(m_dPlaybackStart))
+        SDV_LOG(sdv::core::ELogSeverity::warning,
+            "ASC file '" + m_pathSource.generic_u8string() + "' doesn't contain messages after the playback start time.");
 
     return true;
 }
@@ -85,6 +97,7 @@ void CCANSimulation::OnChangeToConfigMode()
 bool CCANSimulation::OnChangeToRunningMode()
 {
     // Start playback
+    m_reader.SetPlaybackSpeed(m_dPlaybackSpeed);
     m_reader.StartPlayback([&](const asc::SCanMessage& rsMsg) { PlaybackFunc(rsMsg); });
     return true;
 }
@@ -95,7 +108,14 @@ void CCANSimulation::OnShutdown()
     m_reader.StopPlayback();
 
     // Write the recording
-    if (m_writer.HasSamples() && !m_pathTarget.empty())
+    std::unique_lock<std::mutex> lock(m_mtxRecording);
+    if (m_capture.IsOpen())
+    {
+        if (!m_capture.Close())
+            SDV_LOG(sdv::core::ELogSeverity::error,
+                "Failed to write capture file '" + m_pathTarget.generic_u8string() + "' with CAN recording.");
+    }
+    else if (m_writer.HasSamples() && !m_pathTarget.empty())
     {
         if (!m_writer.Write(m_pathTarget))
             SDV_LOG(sdv::core::ELogSeverity::error,
@@ -108,8 +128,7 @@ void CCANSimulation::RegisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
     if (GetObjectState() != sdv::EObjectState::configuring) return;
     if (!pReceiver) return;
 
-    std::unique_lock<std::mutex> lock(m_mtxReceivers);
-    m_setReceivers.insert(pReceiver);
+    m_lstReceivers.Register(pReceiver);
 }
 
 void CCANSimulation::UnregisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
@@ -120,8 +139,15 @@ void CCANSimulation::UnregisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
 
     if (!pReceiver) return;
 
-    std::unique_lock<std::mutex> lock(m_mtxReceivers);
-    m_setReceivers.erase(pReceiver);
+    m_lstReceivers.Unregister(pReceiver);
+}
+
+void CCANSimulation::RegisterReceiverEx(/*in*/ sdv::can::IReceive* pReceiver, /*in*/ const sdv::can::SReceiverConfig& sConfig)
+{
+    if (GetObjectState() != sdv::EObjectState::configuring) return;
+    if (!pReceiver) return;
+
+    m_lstReceivers.Register(pReceiver, sConfig);
 }
 
 void CCANSimulation::Send(/*in*/ const sdv::can::SMessage& sMsg, /*in*/ uint32_t uiIfcIndex)
@@ -136,7 +162,12 @@ void CCANSimulation::Send(/*in*/ const sdv::can::SMessage& sMsg, /*in*/ uint32_t
     sAscCan.eDirection = asc::SCanMessage::EDirection::tx;
     sAscCan.uiLength = static_cast<uint32_t>(sMsg.seqData.length());
     std::copy_n(sMsg.seqData.begin(), sMsg.seqData.length(), std::begin(sAscCan.rguiData));
-    m_writer.AddSample(sAscCan);
+    GetCanMetrics().counterSent.Increment();
+    std::unique_lock<std::mutex> lock(m_mtxRecording);
+    if (m_capture.IsOpen())
+        m_capture.Add(sAscCan, true);
+    else
+        m_writer.AddSample(sAscCan);
 }
 
 sdv::sequence<sdv::u8string> CCANSimulation::GetInterfaces() const
@@ -152,6 +183,7 @@ sdv::sequence<sdv::u8string> CCANSimulation::GetInterfaces() const
 void CCANSimulation::PlaybackFunc(const asc::SCanMessage& rsMsg)
 {
     if (GetObjectState() != sdv::EObjectState::running) return;
+    SDV_LATENCY_TRACE_START(sdv::core::ETraceStage::can_receive, rsMsg.uiId);
 
     // Create sdv CAN message
     sdv::can::SMessage sSdvCan{};
@@ -161,7 +193,5 @@ void CCANSimulation::PlaybackFunc(const asc::SCanMessage& rsMsg)
     sSdvCan.seqData = sdv::sequence<uint8_t>(std::begin(rsMsg.rguiData), std::begin(rsMsg.rguiData) + rsMsg.uiLength);
 
     // Distribute the CAN message to all receivers
-    std::unique_lock<std::mutex> lock(m_mtxReceivers);
-    for (sdv::can::IReceive* pReceiver : m_setReceivers)
-        pReceiver->Receive(sSdvCan, rsMsg.uiChannel - 1);
+    m_lstReceivers.Dispatch(sSdvCan, rsMsg.uiChannel - 1);
 }
@@ -24,11 +24,14 @@
 #include <support/component_impl.h>
 #include "../../global/ascformat/ascreader.h"
 #include "../../global/ascformat/ascwriter.h"
+#include "../../global/ascformat/cancapture.h"
+#include "../../global/can_receiver_list.h"
 
 /**
 * @brief Component to establish Socket CAN communication between VAPI and external application
 */
-class CCANSimulation : public sdv::CSdvObject, public sdv::can::IRegisterReceiver, public sdv::can::ISend, sdv::can::IInformation
+class CCANSimulation : public sdv::CSdvObject, public sdv::can::IRegisterReceiver, public sdv::can::IRegisterReceiverEx,
+    public sdv::can::ISend, sdv::can::IInformation
 {
 public:
     /**
@@ -44,6 +47,7 @@ public:
     // Interface map
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::can::IRegisterReceiver)
+        SDV_INTERFACE_ENTRY(sdv::can::IRegisterReceiverEx)
         SDV_INTERFACE_ENTRY(sdv::can::ISend)
         SDV_INTERFACE_ENTRY(sdv::can::IInformation)
     END_SDV_INTERFACE_MAP()
@@ -56,8 +60,13 @@ public:
 
     // Parameter map
     BEGIN_SDV_PARAM_MAP()
-        SDV_PARAM_PATH_ENTRY(m_pathSource, "Source", "", "Path to the source ASC file.")
-        SDV_PARAM_PATH_ENTRY(m_pathTarget, "Target", "", "Path to the target ASC file.")
+        SDV_PARAM_PATH_ENTRY(m_pathSource, "Source", "", "Path to the source ASC or binary capture file.")
+        SDV_PARAM_PATH_ENTRY(m_pathTarget, "Target", "",
+            "Path to the target ASC file. A file with the extension '.cancap' is recorded in the binary capture format.")
+        SDV_PARAM_NUMBER_ENTRY(m_dPlaybackSpeed, "PlaybackSpeed", 1.0, >= 0.0, NO_LIMIT, "",
+            "Playback speed factor relative to the recording time. Use 0 to play back as fast as possible.")
+        SDV_PARAM_NUMBER_ENTRY(m_dPlaybackStart, "PlaybackStart", 0.0, >= 0.0, NO_LIMIT, "s",
+            "Timestamp within the source file to start the playback from.")
     END_SDV_PARAM_MAP()
 
     /**
@@ -98,6 +107,14 @@ public:
      */
     virtual void UnregisterReceiver(/*in*/ sdv::can::IReceive* pReceiver) override;
 
+    /**
+     * @brief Register a CAN message receiver using a receiver configuration. Overload of
+     * sdv::can::IRegisterReceiverEx::RegisterReceiverEx.
+     * @param[in] pReceiver Pointer to the receiver interface.
+     * @param[in] sConfig The receiver configuration.
+     */
+    virtual void RegisterReceiverEx(/*in*/ sdv::can::IReceive* pReceiver, /*in*/ const sdv::can::SReceiverConfig& sConfig) override;
+
     /**
      * @brief Send a CAN message. Overload of sdv::can::ISend::Send.
      * @param[in] sMsg Message that is to be sent. The source node information is ignored. The target node determines over
@@ -119,13 +136,16 @@ private:
     void PlaybackFunc(const asc::SCanMessage& rsMsg);
 
     std::thread                                 m_threadReceive;            ///< Receive thread.
-    mutable std::mutex                          m_mtxReceivers;             ///< Protect the receiver set.
-    std::set<sdv::can::IReceive*>               m_setReceivers;             ///< Set with receiver interfaces.
+    CCanReceiverList                            m_lstReceivers;             ///< List with receiver interfaces.
     mutable std::mutex                          m_mtxInterfaces;            ///< Protect the nodes set.
     std::map<int, size_t>                       m_mapIfc2Idx;               ///< Map with interface to index.
     std::vector<std::pair<int, std::string>>    m_vecInterfaces;            ///< Vector with interfaces.
     std::filesystem::path                       m_pathSource;               ///< Path to the source ASC file.
     std::filesystem::path                       m_pathTarget;               ///< Path to the target ASC file.
+    double                                      m_dPlaybackSpeed = 1.0;     ///< Playback speed factor (0 = fast as possible).
+    double                                      m_dPlaybackStart = 0.0;     ///< Playback start timestamp.
+    std::mutex                                  m_mtxRecording;             ///< Protect the recording.
+    asc::CCaptureWriter                         m_capture;                  ///< Writer for binary capture recording.
     asc::CAscReader                             m_reader;                   ///< Reader for ASC file playback.
     asc::CAscWriter                             m_writer;                   ///< Writer for ASC file recording.
 };
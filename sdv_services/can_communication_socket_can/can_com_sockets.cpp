@@ -13,6 +13,7 @@
  ********************************************************************************/
 
 #include "can_com_sockets.h"
+#include <support/latency_trace.h>
 
 bool CCANSockets::OnInitialize()
 {
@@ -218,8 +219,7 @@ void CCANSockets::RegisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
 
     SDV_LOG_INFO("Registering VAPI CAN communication receiver...");
 
-    std::unique_lock<std::mutex> lock(m_mtxReceivers);
-    m_setReceivers.insert(pReceiver);
+    m_lstReceivers.Register(pReceiver);
 }
 
 void CCANSockets::UnregisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
@@ -232,8 +232,18 @@ void CCANSockets::UnregisterReceiver(/*in*/ sdv::can::IReceive* pReceiver)
 
     SDV_LOG_INFO("Unregistering VAPI CAN communication receiver...");
 
-    std::unique_lock<std::mutex> lock(m_mtxReceivers);
-    m_setReceivers.erase(pReceiver);
+    m_lstReceivers.Unregister(pReceiver);
+}
+
+void CCANSockets::RegisterReceiverEx(/*in*/ sdv::can::IReceive* pReceiver, /*in*/ const sdv::can::SReceiverConfig& sConfig)
+{
+    if (GetObjectState() != sdv::EObjectState::configuring) return;
+    if (!pReceiver) return;
+
+    SDV_LOG_INFO("Registering VAPI CAN communication receiver with ", sConfig.seqFilters.size(), " filter(s) and queue size ",
+        sConfig.uiQueueSize, "...");
+
+    m_lstReceivers.Register(pReceiver, sConfig);
 }
 
 sdv::sequence<sdv::u8string> CCANSockets::GetInterfaces() const
@@ -292,7 +302,8 @@ void CCANSockets::Send(const sdv::can::SMessage& sMsg, uint32_t uiConfigIndex)
             {
                 sAddr.can_ifindex = socket.networkInterface;
                 sAddr.can_family  = AF_CAN;
-                sendto(socket.localSocket, &sFrame, sizeof(can_frame), 0, reinterpret_cast<sockaddr*>(&sAddr), sizeof(sAddr));
+                if (sendto(socket.localSocket, &sFrame, sizeof(can_frame), 0, reinterpret_cast<sockaddr*>(&sAddr), sizeof(sAddr)) > 0)
+                    GetCanMetrics().counterSent.Increment();
                 break;
             }            
         }
@@ -301,6 +312,8 @@ void CCANSockets::Send(const sdv::can::SMessage& sMsg, uint32_t uiConfigIndex)
 
 void CCANSockets::ReceiveThreadFunc()
 {
+    m_threadAttributes.Apply("CANSocketsReceive");
+
     while (true)
     {
         enum {retry, cont, exit} eNextStep = exit;
@@ -338,6 +351,7 @@ void CCANSockets::ReceiveThreadFunc()
                     std::this_thread::sleep_for(std::chrono::milliseconds(1));
                     continue;
                 }
+                SDV_LATENCY_TRACE_START(sdv::core::ETraceStage::can_receive, sFrame.can_id);
 
                 sdv::can::SMessage sMsg{};
                 sMsg.uiID = sFrame.can_id;
@@ -347,11 +361,7 @@ void CCANSockets::ReceiveThreadFunc()
                 }
 
                 // Broadcast the message to the receivers
-                std::unique_lock<std::mutex> lockReceivers(m_mtxReceivers);
-                for (sdv::can::IReceive* pReceiver : m_setReceivers)
-                {
-                    pReceiver->Receive(sMsg, socket.networkInterface);
-                }
+                m_lstReceivers.Dispatch(sMsg, socket.networkInterface);
             }
         }
     }
@@ -34,6 +34,8 @@
 #include <support/toml.h>
 #include <support/component_impl.h>
 #include <interfaces/can.h>
+#include "../../global/can_receiver_list.h"
+#include "../../global/thread_attributes.h"
 
 #ifndef __linux__
 // cppcheck-suppress preprocessorErrorDirective
@@ -44,7 +46,7 @@
 * @brief Component to establish Socket CAN communication between VAPI and external application
 */
 class CCANSockets : public sdv::CSdvObject, public sdv::can::IRegisterReceiver,
-    public sdv::can::ISend, sdv::can::IInformation
+    public sdv::can::IRegisterReceiverEx, public sdv::can::ISend, sdv::can::IInformation
 {
 public:
 
@@ -52,6 +54,7 @@ public:
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::IObjectControl)
         SDV_INTERFACE_ENTRY(sdv::can::IRegisterReceiver)
+        SDV_INTERFACE_ENTRY(sdv::can::IRegisterReceiverEx)
         SDV_INTERFACE_ENTRY(sdv::can::ISend)
         SDV_INTERFACE_ENTRY(sdv::can::IInformation)
     END_SDV_INTERFACE_MAP()
@@ -61,6 +64,11 @@ public:
     DECLARE_DEFAULT_OBJECT_NAME("CAN_Communication_Object")
     DECLARE_OBJECT_SINGLETON()
 
+    // Parameter map
+    BEGIN_SDV_PARAM_MAP()
+        SDV_PARAM_CHAIN_MEMBER(m_threadAttributes)
+    END_SDV_PARAM_MAP()
+
     /**
      * @brief Initialize the object. Overload of sdv::CSdvObject::OnInitialize.
      * The configuration contains either one interface name a list of interface names.
@@ -91,6 +99,14 @@ public:
      */
     virtual void UnregisterReceiver(/*in*/ sdv::can::IReceive* pReceiver) override;
 
+    /**
+     * @brief Register a CAN message receiver using a receiver configuration. Overload of
+     * sdv::can::IRegisterReceiverEx::RegisterReceiverEx.
+     * @param[in] pReceiver Pointer to the receiver interface.
+     * @param[in] sConfig The receiver configuration.
+     */
+    virtual void RegisterReceiverEx(/*in*/ sdv::can::IReceive* pReceiver, /*in*/ const sdv::can::SReceiverConfig& sConfig) override;
+
     /**
      * @brief Send a CAN message. Overload of sdv::can::ISend::Send.
      * @param[in] sMsg Message to be sent.
@@ -147,8 +163,8 @@ private:
     };
 
     std::thread                     m_threadReceive;    ///< Receive thread.
-    mutable std::mutex              m_mtxReceivers;     ///< Protect the receiver set.
-    std::set<sdv::can::IReceive*>   m_setReceivers;     ///< Set with receiver interfaces.
+    CThreadAttributes               m_threadAttributes; ///< Real-time attributes of the receive thread.
+    CCanReceiverList                m_lstReceivers;     ///< List with receiver interfaces.
     mutable std::mutex              m_mtxSockets;       ///< Protect the socket list.
     std::deque<SSocketDefinition>   m_vecSockets;       ///< Socket list
 };
@@ -120,7 +120,11 @@ bool CAppConfig::LoadInstallationManifests()
         m_manifestExe.Clear();
 
     // Done when not server application.
-    if (!bServerApp) return true;
+    if (!bServerApp)
+    {
+        IndexInstallationManifests();
+        return true;
+    }
 
     // Get the user manifests. If there is no manifest, this is not an error.
     if (!pathInstall.empty())
@@ -143,11 +147,14 @@ bool CAppConfig::LoadInstallationManifests()
             return false;
         }
     }
+    IndexInstallationManifests();
     return true;
 }
 
 void CAppConfig::UnloadInstallatonManifests()
 {
+    m_mapInstalledModules.clear();
+    m_mapInstalledClasses.clear();
     m_vecUserManifests.clear();
     m_manifestExe.Clear();
     m_manifestCore.Clear();
@@ -874,102 +881,26 @@ sdv::sequence<sdv::installation::SFileDesc> CAppConfig::GetInstallationFiles(/*i
 
 std::filesystem::path CAppConfig::FindInstalledModule(const std::filesystem::path& rpathRelModule)
 {
-    // Check for allowance
-    bool bServerApp = false;
-    switch (GetAppSettings().GetContextType())
-    {
-    case sdv::app::EAppContext::main:
-    case sdv::app::EAppContext::isolated:
-    case sdv::app::EAppContext::maintenance:
-        bServerApp = true;
-    default:
-        break;
-    }
-
-    // Search for the module in the following order:
-    // - Core manifest
-    // - Exe manifest
-    // - User manifests
-
-    std::filesystem::path pathModule = m_manifestCore.FindModule(rpathRelModule);
-    if (pathModule.empty())
-        pathModule = m_manifestExe.FindModule(rpathRelModule);
-    if (bServerApp)
-    {
-        for (const CInstallManifest& rmanifest : m_vecUserManifests)
-        {
-            if (!pathModule.empty())
-                break;
-            pathModule = rmanifest.FindModule(rpathRelModule);
-        }
-    }
-    return pathModule;
+    // The lookup contains the core, exe and user manifests (in that order of precedence).
+    auto itManifest = m_mapInstalledModules.find(CInstallManifest::ModuleKey(rpathRelModule));
+    if (itManifest == m_mapInstalledModules.end()) return {};
+    return itManifest->second->FindModule(rpathRelModule);
 }
 
 std::string CAppConfig::FindInstalledModuleManifest(const std::filesystem::path& rpathRelModule)
 {
-    // Check for allowance
-    bool bServerApp = false;
-    switch (GetAppSettings().GetContextType())
-    {
-    case sdv::app::EAppContext::main:
-    case sdv::app::EAppContext::isolated:
-    case sdv::app::EAppContext::maintenance:
-        bServerApp = true;
-    default:
-        break;
-    }
-
-    // Search for the module in the following order:
-    // - Core manifest
-    // - Exe manifest
-    // - User manifests
-
-    std::string ssManifest = m_manifestCore.FindModuleManifest(rpathRelModule);
-    if (ssManifest.empty())
-        ssManifest = m_manifestExe.FindModuleManifest(rpathRelModule);
-    if (bServerApp)
-    {
-        for (const CInstallManifest& rmanifest : m_vecUserManifests)
-        {
-            if (!ssManifest.empty())
-                break;
-            ssManifest = rmanifest.FindModuleManifest(rpathRelModule);
-        }
-    }
-    return ssManifest;
+    // The lookup contains the core, exe and user manifests (in that order of precedence).
+    auto itManifest = m_mapInstalledModules.find(CInstallManifest::ModuleKey(rpathRelModule));
+    if (itManifest == m_mapInstalledModules.end()) return {};
+    return itManifest->second->FindModuleManifest(rpathRelModule);
 }
 
 std::optional<sdv::SClassInfo> CAppConfig::FindInstalledComponent(const std::string& rssClass) const
 {
-    // Check for allowance
-    bool bServerApp = false;
-    switch (GetAppSettings().GetContextType())
-    {
-    case sdv::app::EAppContext::main:
-    case sdv::app::EAppContext::isolated:
-    case sdv::app::EAppContext::maintenance:
-        bServerApp = true;
-    default:
-        break;
-    }
-
-    // Search for the component in the following order:
-    // - Core manifest
-    // - Exe manifest
-    // - User manifests
-    auto optManifest = m_manifestCore.FindComponentByClass(rssClass);
-    if (!optManifest) optManifest = m_manifestExe.FindComponentByClass(rssClass);
-    if (bServerApp)
-    {
-        for (const CInstallManifest& rmanifest : m_vecUserManifests)
-        {
-            if (optManifest)
-                break;
-            optManifest = rmanifest.FindComponentByClass(rssClass);
-        }
-    }
-    return optManifest;
+    // The lookup contains the core, exe and user manifests (in that order of precedence).
+    auto itManifest = m_mapInstalledClasses.find(rssClass);
+    if (itManifest == m_mapInstalledClasses.end()) return {};
+    return itManifest->second->FindComponentByClass(rssClass);
 }
 
 bool CAppConfig::RemoveFromConfig(const CInstallManifest& /*rManifest*/)
@@ -1051,6 +982,30 @@ void CAppConfig::AddCurrentPath()
     if (pathExeDir != pathCoreDir) m_lstSearchPaths.push_back(pathExeDir / "config/");
 }
 
+void CAppConfig::IndexInstallationManifests()
+{
+    m_mapInstalledModules.clear();
+    m_mapInstalledClasses.clear();
+
+    auto fnIndex = [this](const CInstallManifest& rmanifest)
+    {
+        // Only manifests that were loaded from an installation can provide modules.
+        if (!rmanifest.IsValid() || rmanifest.InstallDir().empty()) return;
+        for (const std::filesystem::path& rpathModule : rmanifest.ModuleList())
+            m_mapInstalledModules.emplace(CInstallManifest::ModuleKey(rpathModule), &rmanifest);
+        for (const sdv::SClassInfo& rsClass : rmanifest.ClassList())
+        {
+            m_mapInstalledClasses.emplace(rsClass.ssName, &rmanifest);
+            for (const auto& rssAlias : rsClass.seqClassAliases)
+                m_mapInstalledClasses.emplace(rssAlias, &rmanifest);
+        }
+    };
+    fnIndex(m_manifestCore);
+    fnIndex(m_manifestExe);
+    for (const CInstallManifest& rmanifest : m_vecUserManifests)
+        fnIndex(rmanifest);
+}
+
 CAppConfig& CAppConfigService::GetAppConfig()
 {
     return ::GetAppConfig();
@@ -22,6 +22,7 @@
 #include <filesystem>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include "app_config_file.h"
 
 // @cond DOXYGEN_IGNORE
@@ -276,6 +277,13 @@ private:
      */
     void AddCurrentPath();
 
+    /**
+     * @brief Build the module and class lookup over the loaded installation manifests.
+     * @details The manifests are added in search order (core, exe and user manifests); the first manifest providing a module or
+     * class is used.
+     */
+    void IndexInstallationManifests();
+
     /**
      * @brief Installation structure
      */
@@ -291,6 +299,8 @@ private:
     CInstallManifest                                m_manifestCore;         ///< Install manifest for core components (main and isolated apps).
     CInstallManifest                                m_manifestExe;          ///< Install manifest for exe components (main and isolated apps).
     std::vector<CInstallManifest>                   m_vecUserManifests;     ///< Install manifests for user components (main and isolated apps).
+    std::unordered_map<std::string, const CInstallManifest*> m_mapInstalledModules; ///< Module key to the manifest providing the module.
+    std::unordered_map<std::string, const CInstallManifest*> m_mapInstalledClasses; ///< Class name or alias to the manifest providing the class.
     std::map<std::string, SInstallation>            m_mapInstallations;     ///< Installation map.
     std::vector<CAppConfigFile>                     m_vecSysConfigs;        ///< System configurations.
     CAppConfigFile                                  m_configUserConfig;     ///< User configuration file.
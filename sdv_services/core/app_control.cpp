@@ -205,6 +205,7 @@ bool CAppControl::Startup(/*in*/ const sdv::u8string& ssConfig, /*in*/ IInterfac
     bRet = bRet && fnCreateObject("RepositoryService", "RepositoryService", "");
     bRet = bRet && fnCreateObject("ModuleControlService", "ModuleControlService", "");
     bRet = bRet && fnCreateObject("ConfigService", "ConfigService", "");
+    bRet = bRet && fnCreateObject("MetricsService", "MetricsService", "");
     if (!bRet)
     {
         if (!GetAppSettings().IsConsoleSilent())
@@ -266,7 +267,8 @@ bool CAppControl::Startup(/*in*/ const sdv::u8string& ssConfig, /*in*/ IInterfac
 
     // Load process control
     if (bRet) bRet = fnLoadModule("process_control.sdv") ? true : false;
-    if (bRet) bRet = fnCreateObject("ProcessControlService", "", "");
+    if (bRet) bRet = fnCreateObject("ProcessControlService", "",
+        GetAppSettings().IsIsolationZygoteEnabled() ? "ZygoteModule = \"sdv_iso\"" : "");
 
     // Load RPC components
     if (bRet && bLoadRPCServer)
@@ -135,6 +135,10 @@ bool CAppSettings::ProcessAppStartupConfig(const sdv::u8string& rssConfig)
     else if (m_uiRetries < 3)
         m_uiRetries = 3;
 
+    // Isolated applications can be started through a pre-initialized zygote process (main application only).
+    if (IsMainApplication())
+        m_bIsoZygote = tableStartupConfig.GetDirect("Application.IsoZygote").GetValue();
+
     // Main and isolated apps specific information.
     if (IsMainApplication() || IsIsolatedApplication() || IsMaintenanceApplication())
     {
@@ -471,6 +475,11 @@ uint32_t CAppSettings::GetRetries() const
     return m_uiRetries;
 }
 
+bool CAppSettings::IsIsolationZygoteEnabled() const
+{
+    return m_bIsoZygote;
+}
+
 std::string CAppSettings::GetLoggerClass() const
 {
     return m_ssLoggerClass;
@@ -694,6 +703,7 @@ void CAppSettings::Reset()
     m_eSeverityFilter = sdv::core::ELogSeverity::info;
     m_eSeverityViewFilter = sdv::core::ELogSeverity::error;
     m_uiInstanceID = 0u;
+    m_bIsoZygote = false;
     m_bSilent = false;
     m_bVerbose = false;
     m_pathRootDir.clear();
@@ -202,6 +202,13 @@ public:
      */
     uint32_t GetRetries() const override;
 
+    /**
+     * @brief Should isolated applications be started through a pre-initialized zygote process?
+     * @remarks Is only valid when used in the main application; supported on Linux only.
+     * @return Returns whether the isolation zygote is enabled.
+     */
+    bool IsIsolationZygoteEnabled() const;
+
     /**
      * @brief Get the class name of a logger service, if specified in the application startup configuration.
      * @return The logger class name.
@@ -363,6 +370,7 @@ private:
     sdv::app::EAppContext       m_eContextMode = sdv::app::EAppContext::no_context; ///< The application is running as...
     uint32_t                    m_uiInstanceID = 0u;            ///< Instance number.
     uint32_t                    m_uiRetries = 0u;               ///< Number of retries to establish a connection.
+    bool                        m_bIsoZygote = false;           ///< Start isolated applications through a zygote process.
     std::string                 m_ssLoggerClass;                ///< Class name of a logger service.
     std::filesystem::path       m_pathLoggerModule;             ///< Module name of a custom logger.
     std::string                 m_ssProgramTag;                 ///< Program tag to use when logging.
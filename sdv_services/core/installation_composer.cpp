@@ -13,9 +13,16 @@
 
 #include "installation_composer.h"
 #include <ctime>
+#include <cstring>
 #include <fstream>
 #include <utility>
 #include <regex>
+#include <set>
+#include <limits>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
 #include <interfaces/serdes/config_serdes.h>
 #include "../global/path_match.h"
 
@@ -173,135 +180,27 @@ void CInstallComposer::AddProperty(const std::string& rssName, const std::string
     m_mapProperties[rssName] = rssValue;
 }
 
-sdv::pointer<uint8_t> CInstallComposer::Compose(const std::string& rssInstallName) const
+sdv::pointer<uint8_t> CInstallComposer::Compose(const std::string& rssInstallName, uint32_t uiThreads /*= 0*/) const
 {
-    if (m_lstFiles.empty()) return {};
-
-    // Installation manifest
-    CInstallManifest manifest;
-    // cppcheck warns that the following condition is always true. This is incorrect. Suppress the warning.
-    // cppcheck-suppress knownConditionTrueFalse
-    if (!manifest.Create(rssInstallName))
-    {
-        sdv::installation::XFailedManifestCreation exception;
-        exception.ssInstallName = rssInstallName;
-        throw exception;
-    }
-
-    // Create the manifest entries for the files
-    for (const auto& rsFileEntry : m_lstFiles)
-    {
-        if (!std::filesystem::exists(rsFileEntry.pathSrcModule) || !std::filesystem::is_regular_file(rsFileEntry.pathSrcModule))
-        {
-            sdv::installation::XModuleNotFound exception;
-            exception.ssPath = rsFileEntry.pathSrcModule.generic_u8string();
-            throw exception;
-        }
-
-        // Add the module to the manifest
-        if (!manifest.AddModule(rsFileEntry.pathSrcModule, rsFileEntry.pathRelDir))
-        {
-            sdv::installation::XModuleNotFound exception;
-            exception.ssPath = rsFileEntry.pathSrcModule.generic_u8string();
-            throw exception;
-        }
-    }
-
-    // Add the properties to the manifest
-    for (const auto& rvtProperty : m_mapProperties)
-        manifest.Property(rvtProperty.first, rvtProperty.second);
-
-    // Fill in the header
-    sdv::pointer<uint8_t> ptrPackage;
-    uint32_t uiChecksum = SerializePackageHeader(ptrPackage, manifest);
-
-    // Create the file description structures
-    for (const auto& rsFileEntry : m_lstFiles)
-        uiChecksum = SerializeModuleBLOB(uiChecksum, ptrPackage, rsFileEntry);
-
-    // Add the final BLOB
-    uiChecksum = SerializeFinalBLOB(uiChecksum, ptrPackage);
-
-    // Add the footer
-    SerializePackageFooter(uiChecksum, ptrPackage);
-
-    return ptrPackage;
+    return ComposeToBuffer(rssInstallName, nullptr, uiThreads);
 }
 
-bool CInstallComposer::Compose(const std::filesystem::path& rpathPackage, const std::string& rssInstallName) const
+bool CInstallComposer::Compose(const std::filesystem::path& rpathPackage, const std::string& rssInstallName,
+    uint32_t uiThreads /*= 0*/) const
 {
-    if (m_lstFiles.empty()) return false;
-
-    // Stream the package content to the file.
-    std::ofstream fstream(rpathPackage.native().c_str(), std::ios::binary);
-    if (!fstream.is_open())
-    {
-        sdv::XCannotOpenFile exception;
-        exception.ssPath = rpathPackage.generic_u8string();
-        throw exception;
-    }
-
-    // Installation manifest
-    CInstallManifest manifest;
-    // cppcheck warns that the following condition is always true. This is incorrect. Suppress the warning.
-    // cppcheck-suppress knownConditionTrueFalse
-    if (!manifest.Create(rssInstallName))
-    {
-        sdv::installation::XFailedManifestCreation exception;
-        exception.ssInstallName = rssInstallName;
-        throw exception;
-    }
-
-    // Create the manifest entries for the files
-    for (const auto& rsFileEntry : m_lstFiles)
-    {
-        if (!std::filesystem::exists(rsFileEntry.pathSrcModule) || !std::filesystem::is_regular_file(rsFileEntry.pathSrcModule))
-        {
-            sdv::installation::XModuleNotFound exception;
-            exception.ssPath = rsFileEntry.pathSrcModule.generic_u8string();
-            throw exception;
-        }
-
-        // Add the module to the manifest
-        if (!manifest.AddModule(rsFileEntry.pathSrcModule, rsFileEntry.pathRelDir))
-        {
-            sdv::installation::XModuleNotFound exception;
-            exception.ssPath = rsFileEntry.pathSrcModule.generic_u8string();
-            throw exception;
-        }
-    }
-
-    // Add the properties to the manifest
-    for (const auto& rvtProperty : m_mapProperties)
-        manifest.Property(rvtProperty.first, rvtProperty.second);
-
-    // Stream the header
-    sdv::pointer<uint8_t> ptrPackage;
-    uint32_t uiChecksum = SerializePackageHeader(ptrPackage, manifest);
-    sdv::to_stream(ptrPackage, fstream.rdbuf());
-
-    // Create the file description structures
-    for (const auto& rsFileEntry : m_lstFiles)
-    {
-        // Add the package content
-        ptrPackage.reset();
-        uiChecksum = SerializeModuleBLOB(uiChecksum, ptrPackage, rsFileEntry);
-        sdv::to_stream(ptrPackage, fstream.rdbuf());
-    }
-
-    // Add the final BLOB
-    ptrPackage.reset();
-    uiChecksum = SerializeFinalBLOB(uiChecksum, ptrPackage);
-    sdv::to_stream(ptrPackage, fstream.rdbuf());
-
-    // Add the footer
-    ptrPackage.reset();
-    SerializePackageFooter(uiChecksum, ptrPackage);
-    sdv::to_stream(ptrPackage, fstream.rdbuf());
+    return ComposeToFile(rpathPackage, rssInstallName, nullptr, uiThreads);
+}
 
-    fstream.close();
+sdv::pointer<uint8_t> CInstallComposer::ComposeDelta(const std::string& rssInstallName, const CInstallManifest& rmanifestBase,
+    uint32_t uiThreads /*= 0*/) const
+{
+    return ComposeToBuffer(rssInstallName, &rmanifestBase, uiThreads);
+}
 
-    return true;
+bool CInstallComposer::ComposeDelta(const std::filesystem::path& rpathPackage, const std::string& rssInstallName,
+    const CInstallManifest& rmanifestBase, uint32_t uiThreads /*= 0*/) const
+{
+    return ComposeToFile(rpathPackage, rssInstallName, &rmanifestBase, uiThreads);
 }
 
 CInstallManifest CInstallComposer::ComposeDirect(const std::string& rssInstallName,
@@ -414,6 +313,9 @@ CInstallManifest CInstallComposer::ComposeDirect(const std::string& rssInstallNa
     for (const auto& rvtProperty : m_mapProperties)
         manifest.Property(rvtProperty.first, rvtProperty.second);
 
+    // Add the content hashes, allowing delta packages to be created for this installation.
+    AddContentHashes(manifest, PrepareFiles(0));
+
     // Store the installation manifest (with the current creation date).
     StoreManifest(pathTargetDir, manifest, static_cast<uint64_t>(std::time(nullptr)) * 1000000ull);
 
@@ -514,21 +416,35 @@ CInstallManifest CInstallComposer::ComposeInstallManifest(const std::string& rss
 }
 
 CInstallManifest CInstallComposer::Extract(const sdv::pointer<uint8_t>& rptrPackage, const std::filesystem::path& rpathInstallDir,
-    EUpdateRules eUpdateRule /*= EUpdateRules::not_allowed*/)
+    EUpdateRules eUpdateRule /*= EUpdateRules::not_allowed*/, uint32_t uiThreads /*= 0*/)
 {
-    uint32_t uiChecksum = 0;
-    size_t nOffset = 0;
+    return Extract(rptrPackage.get(), rptrPackage.size(), rpathInstallDir, eUpdateRule, uiThreads);
+}
 
-    // Extract the header
-    sdv::installation::SPackageHeader sHeader = DeserializeHeader(rptrPackage, nOffset, uiChecksum);
+CInstallManifest CInstallComposer::Extract(const std::filesystem::path& rpathPackage, const std::filesystem::path& rpathInstallDir,
+    EUpdateRules eUpdateRule /*= EUpdateRules::not_allowed*/, uint32_t uiThreads /*= 0*/)
+{
+    // Map the package content into memory.
+    CMappedFile filePackage;
+    if (!filePackage.Open(rpathPackage))
+    {
+        sdv::XCannotOpenFile exception;
+        exception.ssPath = rpathPackage.generic_u8string();
+        throw exception;
+    }
 
-    // Read the manifest
-    CInstallManifest manifest;
-    if (!manifest.Read(sHeader.ssManifest) || !manifest.IsValid() || manifest.InstallName().empty())
-        throw sdv::installation::XInvalidManifest();
+    return Extract(reinterpret_cast<const uint8_t*>(filePackage.Data()), filePackage.Size(), rpathInstallDir, eUpdateRule,
+        uiThreads);
+}
 
+CInstallManifest CInstallComposer::Remove(const std::string& rssInstallName, const std::filesystem::path& rpathInstallDir)
+{
     // Check for the target path
-    std::filesystem::path pathTargetDir = rpathInstallDir / std::filesystem::u8path(manifest.InstallName());
+    std::filesystem::path pathTargetDir = rpathInstallDir / std::filesystem::u8path(rssInstallName);
+
+    // Read the installation manifest.
+    CInstallManifest manifest;
+    if (!manifest.Load(pathTargetDir)) return {};
 
     // Check whether there are any files in the target directory
     bool bExistingInstallation = false;
@@ -556,15 +472,6 @@ CInstallManifest CInstallComposer::Extract(const sdv::pointer<uint8_t>& rptrPack
     // Is there an existing installation?
     if (bExistingInstallation)
     {
-        // Allowed to update?
-        if (!UpdateExistingInstallation(pathTargetDir, manifest.Version(), eUpdateRule))
-        {
-            // Not allowed to update.
-            sdv::installation::XDuplicateInstall exception;
-            exception.ssInstallName = manifest.InstallName();
-            throw exception;
-        }
-
         // TODO EVE: Uninstall from the configuration...
 
         // Delete the directory (this represents the uninstallation process).
@@ -580,60 +487,118 @@ CInstallManifest CInstallComposer::Extract(const sdv::pointer<uint8_t>& rptrPack
         }
     }
 
-    // Create the target directory
-    try
-    {
-        std::filesystem::create_directories(pathTargetDir);
-    }
-    catch (const std::filesystem::filesystem_error&)
+    return manifest;
+}
+
+bool CInstallComposer::Verify(const sdv::pointer<uint8_t>& rptrPackage, uint32_t uiThreads /*= 0*/)
+{
+    Verify(rptrPackage.get(), rptrPackage.size(), uiThreads);
+    return true;
+}
+
+bool CInstallComposer::Verify(const std::filesystem::path& rpathPackage, uint32_t uiThreads /*= 0*/)
+{
+    // Map the package content into memory.
+    CMappedFile filePackage;
+    if (!filePackage.Open(rpathPackage)) return false;
+
+    Verify(reinterpret_cast<const uint8_t*>(filePackage.Data()), filePackage.Size(), uiThreads);
+    return true;
+}
+
+CInstallManifest CInstallComposer::ExtractInstallManifest(const sdv::pointer<uint8_t>& rptrPackage)
+{
+    return ExtractInstallManifest(rptrPackage.get(), rptrPackage.size());
+}
+
+CInstallManifest CInstallComposer::ExtractInstallManifest(const std::filesystem::path& rpathPackage)
+{
+    // Map the package content into memory; only the header is accessed.
+    CMappedFile filePackage;
+    if (!filePackage.Open(rpathPackage))
     {
-        sdv::XCannotCreateDir exception;
-        exception.ssPath = pathTargetDir.generic_u8string();
+        sdv::XCannotOpenFile exception;
+        exception.ssPath = rpathPackage.generic_u8string();
         throw exception;
     }
 
-    // Store the installation manifest.
-    StoreManifest(pathTargetDir, manifest, sHeader.uiCreationDate);
+    return ExtractInstallManifest(reinterpret_cast<const uint8_t*>(filePackage.Data()), filePackage.Size());
+}
 
-    // Iterate through the BLOBs
-    bool bFinal = false;
-    while (!bFinal && nOffset < rptrPackage.size())
-    {
-        sdv::installation::SPackageBLOB sBLOB = DeserializeBLOB(rptrPackage, nOffset, uiChecksum);
-        switch (sBLOB.get_switch())
-        {
-        case sdv::installation::EPackageBLOBType::binary_file:
-            StoreModuleBLOB(sBLOB, pathTargetDir);
-            break;
-        case sdv::installation::EPackageBLOBType::final_entry:
-            bFinal = true;
-            break;
-        default:
-            // Do not know how to deal with this section...
-            break;
-        }
-    }
+std::list<CInstallComposer::SComposeFile> CInstallComposer::PreparePackage(const std::string& rssInstallName,
+    const CInstallManifest* pmanifestBase, uint32_t uiThreads, sdv::pointer<uint8_t>& rptrHeader, uint32_t& ruiChecksum) const
+{
+    // Installation manifest
+    CInstallManifest manifest = ComposeInstallManifest(rssInstallName);
 
-    // When no final BLOB was extracted, the package is corrupted
-    if (!bFinal)
+    // Map the files and calculate the checksums of the file content
+    std::list<SComposeFile> lstFiles = PrepareFiles(uiThreads);
+    AddContentHashes(manifest, lstFiles);
+
+    // A delta package contains only the files that are not part of the base installation.
+    if (pmanifestBase)
     {
-        sdv::XBufferTooSmall exception;
-        exception.uiSize = nOffset;
-        exception.uiCapacity = rptrPackage.size();
-        throw exception;
+        manifest.SetDeltaBase(pmanifestBase->Version());
+        lstFiles.remove_if([&](const SComposeFile& rsFile)
+            {
+                std::filesystem::path pathRelFile = std::filesystem::u8path(static_cast<std::string>(rsFile.sBLOB.sFileDesc.ssFileName));
+                auto optHashBase = pmanifestBase->ModuleHash(pathRelFile);
+                return optHashBase && optHashBase == manifest.ModuleHash(pathRelFile);
+            });
     }
 
-    // Check for final checksum
-    DeserializeFinalChecksum(rptrPackage, nOffset, uiChecksum);
+    // Fill in the header
+    ruiChecksum = SerializePackageHeader(rptrHeader, manifest);
 
-    return manifest;
+    return lstFiles;
 }
 
-CInstallManifest CInstallComposer::Extract(const std::filesystem::path& rpathPackage, const std::filesystem::path& rpathInstallDir,
-    EUpdateRules eUpdateRule /*= EUpdateRules::not_allowed*/)
+sdv::pointer<uint8_t> CInstallComposer::ComposeToBuffer(const std::string& rssInstallName,
+    const CInstallManifest* pmanifestBase, uint32_t uiThreads) const
+{
+    if (m_lstFiles.empty()) return {};
+
+    // Prepare the manifest, the files and the header
+    sdv::pointer<uint8_t> ptrHeader;
+    uint32_t uiChecksum = 0;
+    std::list<SComposeFile> lstFiles = PreparePackage(rssInstallName, pmanifestBase, uiThreads, ptrHeader, uiChecksum);
+
+    // Calculate the size of the package, allowing the package to be allocated at once.
+    sdv::installation::SPackageBLOB sFinalBLOB{};
+    sFinalBLOB.switch_to(sdv::installation::EPackageBLOBType::final_entry);
+    size_t nSize = ptrHeader.size() + CalcBLOBSize(sFinalBLOB, 0);
+    for (const auto& rsFile : lstFiles)
+        nSize += rsFile.sBLOB.uiBLOBSize;
+    sdv::ser_size(sdv::installation::SPackageFooter{}, nSize);
+
+    // Compose the package
+    sdv::pointer<uint8_t> ptrPackage;
+    ptrPackage.resize(nSize);
+    size_t nOffset = 0;
+    WritePackage(ptrHeader, uiChecksum, lstFiles, [&](const uint8_t* pData, size_t nDataSize)
+        {
+            if (!nDataSize) return;
+            if (nOffset + nDataSize > ptrPackage.size())
+            {
+                sdv::XBufferTooSmall exception;
+                exception.uiSize = nOffset + nDataSize;
+                exception.uiCapacity = ptrPackage.size();
+                throw exception;
+            }
+            std::memcpy(ptrPackage.get() + nOffset, pData, nDataSize);
+            nOffset += nDataSize;
+        });
+
+    return ptrPackage;
+}
+
+bool CInstallComposer::ComposeToFile(const std::filesystem::path& rpathPackage, const std::string& rssInstallName,
+    const CInstallManifest* pmanifestBase, uint32_t uiThreads) const
 {
-    // Stream the package content from the file.
-    std::ifstream fstream(rpathPackage, std::ios::binary);
+    if (m_lstFiles.empty()) return false;
+
+    // Stream the package content to the file.
+    std::ofstream fstream(rpathPackage.native().c_str(), std::ios::binary);
     if (!fstream.is_open())
     {
         sdv::XCannotOpenFile exception;
@@ -641,306 +606,114 @@ CInstallManifest CInstallComposer::Extract(const std::filesystem::path& rpathPac
         throw exception;
     }
 
+    // Prepare the manifest, the files and the header
+    sdv::pointer<uint8_t> ptrHeader;
     uint32_t uiChecksum = 0;
+    std::list<SComposeFile> lstFiles = PreparePackage(rssInstallName, pmanifestBase, uiThreads, ptrHeader, uiChecksum);
 
-    // Extract the header
-    sdv::installation::SPackageHeader sHeader = DeserializeHeader(fstream, uiChecksum);
+    // Stream the package; the file content is written directly from the mapped files.
+    WritePackage(ptrHeader, uiChecksum, lstFiles, [&](const uint8_t* pData, size_t nDataSize)
+        {
+            fstream.write(reinterpret_cast<const char*>(pData), static_cast<std::streamsize>(nDataSize));
+        });
 
-    // Read the manifest
-    CInstallManifest manifest;
-    if (!manifest.Read(sHeader.ssManifest) || !manifest.IsValid() || manifest.InstallName().empty())
-        throw sdv::installation::XInvalidManifest();
+    fstream.close();
 
-    // Check for the target path
-    std::filesystem::path pathTargetDir = rpathInstallDir / std::filesystem::u8path(manifest.InstallName());
+    return true;
+}
 
-    // Check whether there are any files in the target directory
-    bool bExistingInstallation = false;
-    try
+void CInstallComposer::AddContentHashes(CInstallManifest& rmanifest, const std::list<SComposeFile>& rlstFiles)
+{
+    for (const SComposeFile& rsFile : rlstFiles)
     {
-        if (std::filesystem::is_directory(pathTargetDir))
+        CInstallManifest::SContentHash sHash;
+        sHash.uiSize = rsFile.file.Size();
+        sHash.uiChecksum = rsFile.uiContentChecksum;
+        rmanifest.ModuleHash(std::filesystem::u8path(static_cast<std::string>(rsFile.sBLOB.sFileDesc.ssFileName)), sHash);
+    }
+}
+
+std::list<CInstallComposer::SComposeFile> CInstallComposer::PrepareFiles(uint32_t uiThreads) const
+{
+    std::vector<const SFileEntry*> vecEntries;
+    for (const auto& rsFileEntry : m_lstFiles)
+        vecEntries.push_back(&rsFileEntry);
+    std::list<SComposeFile> lstFiles(vecEntries.size());
+    std::vector<SComposeFile*> vecFiles;
+    for (SComposeFile& rsFile : lstFiles)
+        vecFiles.push_back(&rsFile);
+
+    // Map the files and fill in the module BLOBs
+    ProcessParallel(vecEntries.size(), uiThreads, [&](size_t nIndex)
         {
-            for (auto const& sDirEntry : std::filesystem::directory_iterator{pathTargetDir})
+            const SFileEntry& rsEntry = *vecEntries[nIndex];
+            SComposeFile& rsFile = *vecFiles[nIndex];
+            if (!rsFile.file.Open(rsEntry.pathSrcModule))
             {
-                if (sDirEntry.path() != ".." && sDirEntry.path() != ".")
-                {
-                    bExistingInstallation = true;
-                    break;
-                }
+                sdv::XCannotOpenFile exception;
+                exception.ssPath = rsEntry.pathSrcModule.generic_u8string();
+                throw exception;
             }
-        }
-    }
-    catch (const std::filesystem::filesystem_error&)
+
+            rsFile.sBLOB.switch_to(sdv::installation::EPackageBLOBType::binary_file);
+            rsFile.sBLOB.sFileDesc.ssFileName = (rsEntry.pathRelDir / rsEntry.pathSrcModule.filename()).lexically_normal().u8string();
+            rsFile.sBLOB.sFileDesc.bAttrReadonly = IsReadOnly(rsEntry.pathSrcModule);
+            rsFile.sBLOB.sFileDesc.bAttrExecutable = IsExecutable(rsEntry.pathSrcModule);
+            rsFile.sBLOB.sFileDesc.uiCreationDate = GetCreateTime(rsEntry.pathSrcModule);
+            rsFile.sBLOB.sFileDesc.uiChangeDate = GetChangeTime(rsEntry.pathSrcModule);
+
+            // The BLOB size is limited to 32 bits
+            size_t nBLOBSize = CalcBLOBSize(rsFile.sBLOB, rsFile.file.Size());
+            if (nBLOBSize > std::numeric_limits<uint32_t>::max())
+            {
+                sdv::XBufferTooSmall exception;
+                exception.uiSize = nBLOBSize;
+                exception.uiCapacity = std::numeric_limits<uint32_t>::max();
+                throw exception;
+            }
+            rsFile.sBLOB.uiBLOBSize = static_cast<uint32_t>(nBLOBSize);
+        });
+
+    // Calculate the checksums of the file content
+    std::vector<SChecksumBlock> vecBlocks(vecFiles.size());
+    for (size_t nIndex = 0; nIndex < vecFiles.size(); nIndex++)
     {
-        sdv::XCannotRemoveDir exception;
-        exception.ssPath = pathTargetDir.generic_u8string();
-        throw exception;
+        vecBlocks[nIndex].pData = reinterpret_cast<const uint8_t*>(vecFiles[nIndex]->file.Data());
+        vecBlocks[nIndex].nSize = vecFiles[nIndex]->file.Size();
     }
+    CalcChecksums(vecBlocks, uiThreads);
+    for (size_t nIndex = 0; nIndex < vecFiles.size(); nIndex++)
+        vecFiles[nIndex]->uiContentChecksum = vecBlocks[nIndex].uiChecksum;
 
-    // Is there an existing installation?
-    if (bExistingInstallation)
-    {
-        // Allowed to update?
-        if (!UpdateExistingInstallation(pathTargetDir, manifest.Version(), eUpdateRule))
-        {
-            // Not allowed to update.
-            sdv::installation::XDuplicateInstall exception;
-            exception.ssInstallName = manifest.InstallName();
-            throw exception;
-        }
-
-        // TODO EVE: Uninstall from the configuration...
-
-        // Delete the directory (this represents the uninstallation process).
-        try
-        {
-            std::filesystem::remove_all(pathTargetDir);
-        }
-        catch (const std::filesystem::filesystem_error&)
-        {
-            sdv::XCannotRemoveDir exception;
-            exception.ssPath = pathTargetDir.generic_u8string();
-            throw exception;
-        }
-    }
-
-    // Create the target directory
-    try
-    {
-        std::filesystem::create_directories(pathTargetDir);
-    }
-    catch (const std::filesystem::filesystem_error&)
-    {
-        sdv::XCannotCreateDir exception;
-        exception.ssPath = pathTargetDir.generic_u8string();
-        throw exception;
-    }
-
-    // Store the installation manifest.
-    StoreManifest(pathTargetDir, manifest, sHeader.uiCreationDate);
-
-    // Iterate through the BLOBs
-    bool bFinal = false;
-    while (!bFinal)
-    {
-        sdv::installation::SPackageBLOB sBLOB = DeserializeBLOB(fstream, uiChecksum);
-        switch (sBLOB.get_switch())
-        {
-        case sdv::installation::EPackageBLOBType::binary_file:
-            StoreModuleBLOB(sBLOB, pathTargetDir);
-            break;
-        case sdv::installation::EPackageBLOBType::final_entry:
-            bFinal = true;
-            break;
-        default:
-            // Do not know how to deal with this section...
-            break;
-        }
-    }
-
-    // When no final BLOB was extracted, the package is corrupted
-    if (!bFinal)
-    {
-        sdv::XFileCorrupt exception;
-        exception.ssPath = rpathPackage.generic_u8string();
-        throw exception;
-    }
-
-    // Check for final checksum
-    DeserializeFinalChecksum(fstream, uiChecksum);
-
-    // Close the stream
-    fstream.close();
-
-    return manifest;
+    return lstFiles;
 }
 
-CInstallManifest CInstallComposer::Remove(const std::string& rssInstallName, const std::filesystem::path& rpathInstallDir)
+void CInstallComposer::WritePackage(const sdv::pointer<uint8_t>& rptrHeader, uint32_t uiChecksum,
+    const std::list<SComposeFile>& rlstFiles, const FnWritePackage& rfnWrite)
 {
-    // Check for the target path
-    std::filesystem::path pathTargetDir = rpathInstallDir / std::filesystem::u8path(rssInstallName);
-
-    // Read the installation manifest.
-    CInstallManifest manifest;
-    if (!manifest.Load(pathTargetDir)) return {};
+    // Add the header
+    rfnWrite(rptrHeader.get(), rptrHeader.size());
 
-    // Check whether there are any files in the target directory
-    bool bExistingInstallation = false;
-    try
-    {
-        if (std::filesystem::is_directory(pathTargetDir))
-        {
-            for (auto const& sDirEntry : std::filesystem::directory_iterator{pathTargetDir})
-            {
-                if (sDirEntry.path() != ".." && sDirEntry.path() != ".")
-                {
-                    bExistingInstallation = true;
-                    break;
-                }
-            }
-        }
-    }
-    catch (const std::filesystem::filesystem_error&)
-    {
-        sdv::XCannotRemoveDir exception;
-        exception.ssPath = pathTargetDir.generic_u8string();
-        throw exception;
-    }
-
-    // Is there an existing installation?
-    if (bExistingInstallation)
-    {
-        // TODO EVE: Uninstall from the configuration...
-
-        // Delete the directory (this represents the uninstallation process).
-        try
-        {
-            std::filesystem::remove_all(pathTargetDir);
-        }
-        catch (const std::filesystem::filesystem_error&)
-        {
-            sdv::XCannotRemoveDir exception;
-            exception.ssPath = pathTargetDir.generic_u8string();
-            throw exception;
-        }
-    }
-
-    return manifest;
-}
-
-bool CInstallComposer::Verify(const sdv::pointer<uint8_t>& rptrPackage)
-{
-    uint32_t uiChecksum = 0;
-    size_t nOffset = 0;
-
-    // Extract the header
-    sdv::installation::SPackageHeader sHeader = DeserializeHeader(rptrPackage, nOffset, uiChecksum);
-
-    // Read the manifest
-    CInstallManifest manifest;
-    if (!manifest.Read(sHeader.ssManifest) || !manifest.IsValid() || manifest.InstallName().empty())
-        throw sdv::installation::XInvalidManifest();
-
-    // Iterate through the BLOBs
-    bool bFinal = false;
-    while (!bFinal && nOffset < rptrPackage.size())
-    {
-        sdv::installation::SPackageBLOB sBLOB = DeserializeBLOB(rptrPackage, nOffset, uiChecksum);
-        switch (sBLOB.get_switch())
-        {
-        case sdv::installation::EPackageBLOBType::binary_file:
-            break;
-        case sdv::installation::EPackageBLOBType::final_entry:
-            bFinal = true;
-            break;
-        default:
-            // Do not know how to deal with this section...
-            break;
-        }
-    }
-
-    // When no final BLOB was extracted, the package is corrupted
-    if (!bFinal)
-    {
-        sdv::XBufferTooSmall exception;
-        exception.uiSize     = nOffset;
-        exception.uiCapacity = rptrPackage.size();
-        throw exception;
-    }
-
-    // Check for final checksum
-    DeserializeFinalChecksum(rptrPackage, nOffset, uiChecksum);
-
-    return true;
-}
-
-bool CInstallComposer::Verify(const std::filesystem::path& rpathPackage)
-{
-    // Stream the package content from the file.
-    std::ifstream fstream(rpathPackage, std::ios::binary);
-    if (!fstream.is_open()) return false;
-
-    uint32_t uiChecksum = 0;
-
-    // Extract the header
-    sdv::installation::SPackageHeader sHeader = DeserializeHeader(fstream, uiChecksum);
-
-    // Read the manifest
-    CInstallManifest manifest;
-    if (!manifest.Read(sHeader.ssManifest) || !manifest.IsValid() || manifest.InstallName().empty())
-        throw sdv::installation::XInvalidManifest();
+    // Add the module BLOBs
+    for (const auto& rsFile : rlstFiles)
+        uiChecksum = WriteBLOB(uiChecksum, rsFile.sBLOB, reinterpret_cast<const uint8_t*>(rsFile.file.Data()),
+            rsFile.file.Size(), rsFile.uiContentChecksum, rfnWrite);
 
-    // Iterate through the BLOBs
-    bool bFinal = false;
-    while (!bFinal)
-    {
-        sdv::installation::SPackageBLOB sBLOB = DeserializeBLOB(fstream, uiChecksum);
-        switch (sBLOB.get_switch())
-        {
-        case sdv::installation::EPackageBLOBType::binary_file:
-            break;
-        case sdv::installation::EPackageBLOBType::final_entry:
-            bFinal = true;
-            break;
-        default:
-            // Do not know how to deal with this section...
-            break;
-        }
-    }
-
-    // When no final BLOB was extracted, the package is corrupted
-    if (!bFinal) return false;
-
-    // Check for final checksum
-    DeserializeFinalChecksum(fstream, uiChecksum);
-
-    // Close the stream
-    fstream.close();
-
-    return true;
-}
-
-CInstallManifest CInstallComposer::ExtractInstallManifest(const sdv::pointer<uint8_t>& rptrPackage)
-{
-    uint32_t uiChecksum = 0;
-    size_t nOffset      = 0;
-
-    // Extract the header
-    sdv::installation::SPackageHeader sHeader = DeserializeHeader(rptrPackage, nOffset, uiChecksum);
-
-    // Read the manifest
-    CInstallManifest manifest;
-    if (!manifest.Read(sHeader.ssManifest) || !manifest.IsValid() || manifest.InstallName().empty())
-        throw sdv::installation::XInvalidManifest();
-
-    return manifest;
-}
-
-CInstallManifest CInstallComposer::ExtractInstallManifest(const std::filesystem::path& rpathPackage)
-{
-    // Stream the package content from the file.
-    std::ifstream fstream(rpathPackage, std::ios::binary);
-    if (!fstream.is_open())
-    {
-        sdv::XCannotOpenFile exception;
-        exception.ssPath = rpathPackage.generic_u8string();
-        throw exception;
-    }
-
-    uint32_t uiChecksum = 0;
-
-    // Extract the header
-    sdv::installation::SPackageHeader sHeader = DeserializeHeader(fstream, uiChecksum);
-
-    // Read the manifest
-    CInstallManifest manifest;
-    if (!manifest.Read(sHeader.ssManifest) || !manifest.IsValid() || manifest.InstallName().empty())
-        throw sdv::installation::XInvalidManifest();
-    
-    // Close the stream
-    fstream.close();
+    // Add the final BLOB
+    sdv::installation::SPackageBLOB sBLOB{};
+    sBLOB.switch_to(sdv::installation::EPackageBLOBType::final_entry);
+    sBLOB.uiBLOBSize = static_cast<uint32_t>(CalcBLOBSize(sBLOB, 0));
+    uiChecksum = WriteBLOB(uiChecksum, sBLOB, nullptr, 0, 0, rfnWrite);
 
-    return manifest;
+    // Fill in and serialize the footer
+    sdv::serializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> serializer;
+    sdv::pointer<uint8_t> ptrFooter;
+    serializer.attach(std::move(ptrFooter), 0, uiChecksum);
+    sdv::installation::SPackageFooter sFooter{};
+    sFooter.uiChecksum = uiChecksum;
+    serializer << sFooter;
+    serializer.detach(ptrFooter);
+    rfnWrite(ptrFooter.get(), ptrFooter.size());
 }
 
 uint32_t CInstallComposer::SerializePackageHeader(sdv::pointer<uint8_t>& rptrPackage, const CInstallManifest& rmanifest)
@@ -992,189 +765,70 @@ uint32_t CInstallComposer::SerializePackageHeader(sdv::pointer<uint8_t>& rptrPac
     return uiChecksum;
 }
 
-uint32_t CInstallComposer::SerializeModuleBLOB(uint32_t uiChecksumInit, sdv::pointer<uint8_t>& rptrPackage,
-    const SFileEntry& rsFile)
+uint32_t CInstallComposer::WriteBLOB(uint32_t uiChecksumInit, const sdv::installation::SPackageBLOB& rsBLOB,
+    const uint8_t* pContent, size_t nContentSize, uint32_t uiContentChecksum, const FnWritePackage& rfnWrite)
 {
-    // Fill in the module BLOB
-    sdv::installation::SPackageBLOB sBLOB{};
-    sBLOB.switch_to(sdv::installation::EPackageBLOBType::binary_file);
-    sBLOB.sFileDesc.ssFileName = (rsFile.pathRelDir / rsFile.pathSrcModule.filename()).lexically_normal().u8string();
-    sBLOB.sFileDesc.bAttrReadonly = IsReadOnly(rsFile.pathSrcModule);
-    sBLOB.sFileDesc.bAttrExecutable = IsExecutable(rsFile.pathSrcModule);
-    sBLOB.sFileDesc.uiCreationDate = GetCreateTime(rsFile.pathSrcModule);
-    sBLOB.sFileDesc.uiChangeDate = GetChangeTime(rsFile.pathSrcModule);
+    // Serialize the BLOB without the file content. BLOBs start at 8-byte aligned positions within the package; serializing
+    // from the start of a buffer results in identical alignment.
+    sdv::installation::SPackageBLOB sBLOB = rsBLOB;
     sBLOB.uiChecksumInit = uiChecksumInit;
-
-    // File content
-    std::ifstream fstream(rsFile.pathSrcModule.native().c_str(), std::ios::binary);
-    if (!fstream.is_open())
-    {
-        sdv::XCannotOpenFile exception;
-        exception.ssPath = rsFile.pathSrcModule.generic_u8string();
-        throw exception;
-    }
-    sBLOB.sFileDesc.ptrContent = sdv::from_stream(fstream.rdbuf());
-    fstream.close();
-
-    // Calculate the size of the BLOB (including padding and checksum)
-    sdv::installation::SPackageBLOBChecksum sBLOBChecksum{};
-    size_t nSize = 0;
-    sdv::ser_size(sBLOB, nSize);
-    sdv::ser_size(sBLOBChecksum, nSize);
-    if (nSize % 8) nSize += 8 - nSize % 8;
-    sBLOB.uiBLOBSize = static_cast<uint32_t>(nSize);
-
-    // Serialize the BLOB
     sdv::serializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> serializer;
-    size_t nOffset = rptrPackage.size();
-    serializer.attach(std::move(rptrPackage), nOffset, uiChecksumInit);
+    sdv::pointer<uint8_t> ptrBLOB;
+    serializer.attach(std::move(ptrBLOB));
     serializer << sBLOB;
+    serializer.detach(ptrBLOB);
 
-    // Add padding
-    while (serializer.offset() - nOffset < nSize - sizeof(sdv::installation::SPackageBLOBChecksum))
+    // The content is the last member of the BLOB. Replace the size of the empty content with the size of the file content.
+    if (sBLOB.get_switch() == sdv::installation::EPackageBLOBType::binary_file)
     {
-        uint8_t uiPadding = 0;
-        serializer << uiPadding;
+        uint64_t uiContentSize = nContentSize;
+        std::memcpy(ptrBLOB.get() + ptrBLOB.size() - sizeof(uint64_t), &uiContentSize, sizeof(uint64_t));
     }
 
-    // Fill in and serialize the checksum
-    sBLOBChecksum.uiChecksum = serializer.checksum();
-    serializer << sBLOBChecksum;
-
-    // Detach and return the current checksum calculated over the BLOB (including BLOB content checksum)
-    uint32_t uiChecksum = serializer.checksum();
-    serializer.detach(rptrPackage);
-    return uiChecksum;
-}
-
-uint32_t CInstallComposer::SerializeFinalBLOB(uint32_t uiChecksumInit, sdv::pointer<uint8_t>& rptrPackage)
-{
-    // Fill in the module BLOB
-    sdv::installation::SPackageBLOB sBLOB{};
-    sBLOB.switch_to(sdv::installation::EPackageBLOBType::final_entry);
-    sBLOB.uiChecksumInit = uiChecksumInit;
-
-    // Calculate the size of the BLOB (including padding and checksum)
+    // Calculate the BLOB checksum; the checksum of the content was calculated before.
+    sdv::crcCRC32C crc;
+    crc.set_checksum(uiChecksumInit);
+    crc.calc_checksum(ptrBLOB.get(), ptrBLOB.size());
+    crc.combine(uiContentChecksum, nContentSize);
+    const uint8_t rguiPadding[8] = {};
+    size_t nPadding = sBLOB.uiBLOBSize - sizeof(sdv::installation::SPackageBLOBChecksum) - ptrBLOB.size() - nContentSize;
+    for (size_t nRemaining = nPadding; nRemaining; nRemaining -= std::min(nRemaining, sizeof(rguiPadding)))
+        crc.calc_checksum(rguiPadding, std::min(nRemaining, sizeof(rguiPadding)));
     sdv::installation::SPackageBLOBChecksum sBLOBChecksum{};
-    size_t nSize = 0;
-    sdv::ser_size(sBLOB, nSize);
-    sdv::ser_size(sBLOBChecksum, nSize);
-    if (nSize % 8) nSize += 8 - nSize % 8;
-    sBLOB.uiBLOBSize = static_cast<uint32_t>(nSize);
-
-    // Serialize the BLOB
-    sdv::serializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> serializer;
-    size_t nOffset = rptrPackage.size();
-    serializer.attach(std::move(rptrPackage), nOffset, uiChecksumInit);
-    serializer << sBLOB;
-
-    // Add padding
-    while (serializer.offset() - nOffset < nSize - sizeof(sdv::installation::SPackageBLOBChecksum))
-    {
-        uint8_t uiPadding = 0;
-        serializer << uiPadding;
-    }
-
-    // Fill in and serialize the checksum
-    sBLOBChecksum.uiChecksum = serializer.checksum();
-    serializer << sBLOBChecksum;
-
-    // Detach and return the current checksum calculated over the BLOB (including BLOB content checksum)
-    uint32_t uiChecksum = serializer.checksum();
-    serializer.detach(rptrPackage);
-    return uiChecksum;
-}
-
-void CInstallComposer::SerializePackageFooter(uint32_t uiChecksum, sdv::pointer<uint8_t>& rptrPackage)
-{
-    // Fill in and serialize the checksum
-    sdv::serializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> serializer;
-    size_t nOffset = rptrPackage.size();
-    serializer.attach(std::move(rptrPackage), nOffset, uiChecksum);
-    sdv::installation::SPackageFooter sFooter{};
-    sFooter.uiChecksum = uiChecksum;
-    serializer << sFooter;
-
-    // Detach the package
-    serializer.detach(rptrPackage);
-}
-
-sdv::installation::SPackageHeader CInstallComposer::DeserializeHeader(std::ifstream& rfstream, uint32_t& ruiChecksum)
-{
-    // Prepare the buffer
-    sdv::pointer<uint8_t> ptrHeader;
-    size_t nPartialSize = offsetof(sdv::installation::SPackageHeader, rguiSignature) +
-        sizeof(sdv::installation::SPackageHeader::rguiSignature);
-    ptrHeader.resize(std::max(nPartialSize, sizeof(sdv::installation::SPackageHeader)));
-
-    // Partially read the header
-    rfstream.read(reinterpret_cast<char*>(ptrHeader.get()), nPartialSize);
-
-    // NOTE: The serialization process of plain data is identical to casting. Therefore, the beginning of the data fits the
-    // SPackageHeader structure until the dynamic types are added.
-    const sdv::installation::SPackageHeader* psPartialHeader = sdv::cast<sdv::installation::SPackageHeader>(ptrHeader);
-    if (!psPartialHeader) throw sdv::installation::XIncompatiblePackage();
-
-    // Check for the correct version of the package
-    const uint8_t rguiSignature[] = { 'S', 'D', 'V', '_', 'I', 'P', 'C', 'K' };
-    if (psPartialHeader->eEndian != sdv::GetPlatformEndianess() ||
-        psPartialHeader->uiVersion != SDVFrameworkInterfaceVersion ||
-        !std::equal(std::begin(rguiSignature), std::end(rguiSignature), psPartialHeader->rguiSignature))
-        throw sdv::installation::XIncompatiblePackage();
-
-    // Check the offset (max 32k, min at least the size of the two header structs).
-    sdv::installation::SPackageHeader sHeader{};
-    sdv::installation::SPackageHeaderChecksum sHeaderChecksum{};
-    if (sHeader.uiOffset > 32768)
-        throw sdv::installation::XIncompatiblePackage();
-    size_t nMinSize = 0;
-    sdv::ser_size(sHeader, nMinSize);
-    sdv::ser_size(sHeaderChecksum, nMinSize);
-    if (psPartialHeader->uiOffset < nMinSize)
-        throw sdv::installation::XIncompatiblePackage();
-
-    // Extend the buffer and read the header data (after the resize, the psPartialHeader pointer could be invalidated).
-    uint32_t uiHeaderSize = psPartialHeader->uiOffset;
-    ptrHeader.resize(uiHeaderSize);
-    if (!ptrHeader)
-    {
-        sdv::XBufferTooSmall exception;
-        exception.uiSize = uiHeaderSize;
-        exception.uiCapacity = ptrHeader.size();
-        throw exception;
-    }
-    rfstream.read(reinterpret_cast<char*>(ptrHeader.get() + nPartialSize), uiHeaderSize - nPartialSize);
-
-    // Deserialize into the header
-    sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer;
-    deserializer.attach(ptrHeader);
-    deserializer >> sHeader;
-
-    // Skip padding
-    while (deserializer.offset() < uiHeaderSize - sizeof(sdv::installation::SPackageHeaderChecksum))
-    {
-        uint8_t uiPadding = 0;
-        deserializer >> uiPadding;
-    }
+    sBLOBChecksum.uiChecksum = crc.get_checksum();
 
-    // Deserialize and check the header checksum
-    uint64_t uiChecksum = deserializer.checksum();
-    deserializer >> sHeaderChecksum;
-    if (uiChecksum != sHeaderChecksum.uiChecksum)
-        throw sdv::installation::XIncorrectCRC();
+    // Write the BLOB
+    rfnWrite(ptrBLOB.get(), ptrBLOB.size());
+    if (nContentSize) rfnWrite(pContent, nContentSize);
+    for (size_t nRemaining = nPadding; nRemaining; nRemaining -= std::min(nRemaining, sizeof(rguiPadding)))
+        rfnWrite(rguiPadding, std::min(nRemaining, sizeof(rguiPadding)));
+    rfnWrite(reinterpret_cast<const uint8_t*>(&sBLOBChecksum.uiChecksum), sizeof(sBLOBChecksum.uiChecksum));
 
-    // Update the checksum variables
-    ruiChecksum = deserializer.checksum(); // Checksum including checksum-structure of the header
+    // Return the current checksum calculated over the BLOB (including BLOB checksum)
+    return crc.calc_checksum(&sBLOBChecksum.uiChecksum, 1);
+}
 
-    return sHeader;
+size_t CInstallComposer::CalcBLOBSize(const sdv::installation::SPackageBLOB& rsBLOB, size_t nContentSize)
+{
+    // Calculate the size of the BLOB (including content, padding and checksum)
+    sdv::installation::SPackageBLOBChecksum sBLOBChecksum{};
+    size_t nSize = 0;
+    sdv::ser_size(rsBLOB, nSize);
+    nSize += nContentSize;
+    sdv::ser_size(sBLOBChecksum, nSize);
+    if (nSize % 8) nSize += 8 - nSize % 8;
+    return nSize;
 }
 
-sdv::installation::SPackageHeader CInstallComposer::DeserializeHeader(const sdv::pointer<uint8_t>& rptrPackage, size_t& rnOffset,
+sdv::installation::SPackageHeader CInstallComposer::DeserializeHeader(const uint8_t* pData, size_t nSize, size_t& rnOffset,
     uint32_t& ruiChecksum)
 {
+    if (!pData || nSize < sizeof(sdv::installation::SPackageFooter))
+        throw sdv::installation::XIncompatiblePackage();
+
     // Deserialize the package header
     sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer;
-    deserializer.attach(rptrPackage);
+    deserializer.assign(pData, nSize);
     sdv::installation::SPackageHeader sHeader{};
     sdv::installation::SPackageHeaderChecksum sHeaderChecksum{};
     deserializer >> sHeader;
@@ -1187,7 +841,7 @@ sdv::installation::SPackageHeader CInstallComposer::DeserializeHeader(const sdv:
         throw sdv::installation::XIncompatiblePackage();
 
     // Check the offset (max package size, min at least the size of the two header structs).
-    if (sHeader.uiOffset > rptrPackage.size() - sizeof(sdv::installation::SPackageFooter))
+    if (sHeader.uiOffset > nSize - sizeof(sdv::installation::SPackageFooter))
         throw sdv::installation::XIncompatiblePackage();
     size_t nMinSize = 0;
     sdv::ser_size(sHeader, nMinSize);
@@ -1215,174 +869,426 @@ sdv::installation::SPackageHeader CInstallComposer::DeserializeHeader(const sdv:
     return sHeader;
 }
 
-sdv::installation::SPackageBLOB CInstallComposer::DeserializeBLOB(std::ifstream& rfstream, uint32_t& ruiChecksum)
+std::vector<CInstallComposer::SPackageFile> CInstallComposer::DeserializeBLOBs(const uint8_t* pData, size_t nSize,
+    size_t nOffset, uint32_t uiChecksum, uint32_t uiThreads)
 {
-    // Prepare the buffer
-    sdv::installation::SPackageBLOB sBLOB{};
-    sdv::installation::SPackageBLOBChecksum sBLOBChecksum{};
-    sdv::pointer<uint8_t> ptrBLOB;
-    // NOTE: The macro offsetof works, but should not be used with non-POD structures.
-    size_t nPartialSize = reinterpret_cast<uint64_t>(&sBLOB.uiBLOBSize) - reinterpret_cast<uint64_t>(&sBLOB) + sizeof(uint32_t);
-    ptrBLOB.resize(std::max(nPartialSize, sizeof(sdv::installation::SPackageBLOB)));
+    std::vector<SPackageFile> vecFiles;
+    std::vector<SChecksumBlock> vecBlocks;
+    std::vector<uint32_t> vecBLOBChecksums;
 
-    // Partially read the header
-    rfstream.read(reinterpret_cast<char*>(ptrBLOB.get()), nPartialSize);
+    // Minimum size of a BLOB
+    sdv::installation::SPackageBLOB sFinalBLOB{};
+    sFinalBLOB.switch_to(sdv::installation::EPackageBLOBType::final_entry);
+    const size_t nMinSize = CalcBLOBSize(sFinalBLOB, 0);
 
-    // NOTE: The serialization process of plain data is identical to casting. Therefore, the beginning of the data fits the
-    // SPackageBLOB structure until the dynamic types are added.
-    const sdv::installation::SPackageBLOB* psPartialBLOB = sdv::cast<sdv::installation::SPackageBLOB>(ptrBLOB);
-    if (!psPartialBLOB) throw sdv::installation::XIncompatiblePackage();
+    // Iterate through the BLOBs. Each BLOB stores its checksum, which is the initial checksum of the following BLOB. This allows
+    // reading the BLOB structure sequentially while postponing the calculation of the checksums over the BLOB content.
+    bool bFinal = false;
+    while (!bFinal)
+    {
+        // When no final BLOB was found, the package is corrupted
+        if (nOffset > nSize || nSize - nOffset < nMinSize)
+        {
+            sdv::XBufferTooSmall exception;
+            exception.uiSize = nOffset + nMinSize;
+            exception.uiCapacity = nSize;
+            throw exception;
+        }
 
-    // Check for a correct initial checksum
-    if (psPartialBLOB->uiChecksumInit != ruiChecksum)
-        throw sdv::installation::XIncorrectCRC();
+        // Deserialize the BLOB header
+        sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer;
+        deserializer.assign(pData + nOffset, nSize - nOffset);
+        sdv::installation::EPackageBLOBType eBLOBType{};
+        uint32_t uiChecksumInit = 0;
+        uint32_t uiBLOBSize = 0;
+        deserializer >> eBLOBType >> uiChecksumInit >> uiBLOBSize;
+
+        // Check the initial checksum and the size
+        if (uiChecksumInit != uiChecksum)
+            throw sdv::installation::XIncorrectCRC();
+        if (uiBLOBSize < nMinSize || uiBLOBSize > nSize - nOffset)
+            throw sdv::installation::XIncompatiblePackage();    // Safety
+        size_t nBLOBHeaderSize = deserializer.offset();
+        deserializer.assign(pData + nOffset, uiBLOBSize);
+        deserializer.jump(nBLOBHeaderSize);
+
+        switch (eBLOBType)
+        {
+        case sdv::installation::EPackageBLOBType::binary_file:
+        {
+            // Deserialize the file description; the content remains in the package.
+            SPackageFile sFile;
+            deserializer >> sFile.sFileDesc.ssFileName;
+            deserializer >> sFile.sFileDesc.uiCreationDate;
+            deserializer >> sFile.sFileDesc.uiChangeDate;
+            deserializer >> sFile.sFileDesc.bAttrReadonly;
+            deserializer >> sFile.sFileDesc.bAttrExecutable;
+            uint64_t uiContentSize = 0;
+            deserializer >> uiContentSize;
+            if (uiContentSize > deserializer.remaining() ||
+                deserializer.offset() + uiContentSize > uiBLOBSize - sizeof(sdv::installation::SPackageBLOBChecksum))
+                throw sdv::installation::XIncompatiblePackage();
+            sFile.pContent = pData + nOffset + deserializer.offset();
+            sFile.nContentSize = static_cast<size_t>(uiContentSize);
+            vecFiles.push_back(std::move(sFile));
+            break;
+        }
+        case sdv::installation::EPackageBLOBType::final_entry:
+            bFinal = true;
+            break;
+        default:
+            // Do not know how to deal with this section...
+            break;
+        }
 
-    // Check the size
-    size_t nMinSize = 0;
-    sdv::ser_size(sBLOB, nMinSize);
-    sdv::ser_size(sBLOBChecksum, nMinSize);
-    if (psPartialBLOB->uiBLOBSize < nMinSize)
-        throw sdv::installation::XIncompatiblePackage();
+        // Deserialize the BLOB checksum
+        sdv::installation::SPackageBLOBChecksum sBLOBChecksum{};
+        deserializer.jump(uiBLOBSize - sizeof(sdv::installation::SPackageBLOBChecksum));
+        deserializer >> sBLOBChecksum;
 
-    // Extend the buffer and read the BLOB data (after the resize, the psPartialBLOB pointer could be invalidated).
-    uint32_t uiBLOBSize = psPartialBLOB->uiBLOBSize;
-    if (uiBLOBSize > 24*1024*1024)
-        throw sdv::installation::XIncompatiblePackage();    // Safety
-    ptrBLOB.resize(uiBLOBSize);
-    if (!ptrBLOB)
-    {
-        sdv::XBufferTooSmall exception;
-        exception.uiSize = uiBLOBSize;
-        exception.uiCapacity = ptrBLOB.size();
-        throw exception;
+        // The checksum over the BLOB is verified afterwards
+        SChecksumBlock sBlock;
+        sBlock.pData = pData + nOffset;
+        sBlock.nSize = uiBLOBSize - sizeof(sdv::installation::SPackageBLOBChecksum);
+        sBlock.uiChecksumInit = uiChecksumInit;
+        vecBlocks.push_back(sBlock);
+        vecBLOBChecksums.push_back(sBLOBChecksum.uiChecksum);
+
+        // Update the offset and checksum variables (checksum including checksum-structure of the BLOB)
+        sdv::crcCRC32C crc;
+        crc.set_checksum(sBLOBChecksum.uiChecksum);
+        uiChecksum = crc.calc_checksum(&sBLOBChecksum.uiChecksum, 1);
+        nOffset += uiBLOBSize;
     }
-    rfstream.read(reinterpret_cast<char*>(ptrBLOB.get() + nPartialSize), static_cast<size_t>(uiBLOBSize) - nPartialSize);
-    if (rfstream.gcount() != static_cast<std::streamsize>(uiBLOBSize) - static_cast<std::streamsize>(nPartialSize))
-        throw sdv::installation::XIncompatiblePackage();
 
-    // Deserialize into the BLOB structure
+    // Check for final checksum
     sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer;
-    deserializer.attach(ptrBLOB);
-    deserializer.jump(0, ruiChecksum);
-    deserializer >> sBLOB;
+    deserializer.assign(pData + nOffset, nSize - nOffset);
+    sdv::installation::SPackageFooter sFooter{};
+    deserializer >> sFooter;
+    if (uiChecksum != sFooter.uiChecksum)
+        throw sdv::installation::XIncorrectCRC();
 
-    // Skip padding
-    while (deserializer.offset() < uiBLOBSize - sizeof(sdv::installation::SPackageBLOBChecksum))
+    // Verify the BLOB content
+    CalcChecksums(vecBlocks, uiThreads);
+    for (size_t nIndex = 0; nIndex < vecBlocks.size(); nIndex++)
     {
-        uint8_t uiPadding = 0;
-        deserializer >> uiPadding;
+        if (vecBlocks[nIndex].uiChecksum != vecBLOBChecksums[nIndex])
+            throw sdv::installation::XIncorrectCRC();
     }
 
-    // Deserialize and check the BLOB checksum
-    uint64_t uiChecksum = deserializer.checksum();
-    deserializer >> sBLOBChecksum;
-    if (uiChecksum != sBLOBChecksum.uiChecksum)
-        throw sdv::installation::XIncorrectCRC();
-
-    // Update the checksum variables
-    ruiChecksum = deserializer.checksum(); // Checksum including checksum-structure of the BLOB
-
-    return sBLOB;
+    return vecFiles;
 }
 
-sdv::installation::SPackageBLOB CInstallComposer::DeserializeBLOB(const sdv::pointer<uint8_t>& rptrPackage, size_t& rnOffset,
-    uint32_t& ruiChecksum)
+CInstallManifest CInstallComposer::Extract(const uint8_t* pData, size_t nSize, const std::filesystem::path& rpathInstallDir,
+    EUpdateRules eUpdateRule, uint32_t uiThreads)
 {
-    // Deserialize the BLOB
-    sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer;
-    deserializer.attach(rptrPackage);
-    deserializer.jump(rnOffset, ruiChecksum);
-    sdv::installation::SPackageBLOB sBLOB{};
-    sdv::installation::SPackageBLOBChecksum sBLOBChecksum{};
-    deserializer >> sBLOB;
-    if (sBLOB.uiBLOBSize + rnOffset > rptrPackage.size())
-        throw sdv::installation::XIncompatiblePackage();    // Safety
+    uint32_t uiChecksum = 0;
+    size_t nOffset = 0;
 
-    // Check the initial checksum
-    if (sBLOB.uiChecksumInit != ruiChecksum)
-        throw sdv::installation::XIncorrectCRC();
+    // Extract the header
+    sdv::installation::SPackageHeader sHeader = DeserializeHeader(pData, nSize, nOffset, uiChecksum);
 
-    // Skip padding
-    while (deserializer.offset() - rnOffset < sBLOB.uiBLOBSize - sizeof(sdv::installation::SPackageBLOBChecksum))
+    // Read the manifest
+    CInstallManifest manifest;
+    if (!manifest.Read(sHeader.ssManifest) || !manifest.IsValid() || manifest.InstallName().empty())
+        throw sdv::installation::XInvalidManifest();
+
+    // Verify the complete package before touching the installation
+    std::vector<SPackageFile> vecFiles = DeserializeBLOBs(pData, nSize, nOffset, uiChecksum, uiThreads);
+
+    // Check for the target path
+    std::filesystem::path pathTargetDir = rpathInstallDir / std::filesystem::u8path(manifest.InstallName());
+
+    // Check the file paths
+    for (const SPackageFile& rsFile : vecFiles)
     {
-        uint8_t uiPadding = 0;
-        deserializer >> uiPadding;
+        if (IsParentPath(pathTargetDir, static_cast<std::string>(rsFile.sFileDesc.ssFileName)))
+        {
+            sdv::XInvalidPath exception;
+            exception.ssPath = rsFile.sFileDesc.ssFileName;
+            throw exception;
+        }
     }
 
-    // Deserialize and check the header checksum
-    uint64_t uiChecksum = deserializer.checksum();
-    deserializer >> sBLOBChecksum;
-    if (uiChecksum != sBLOBChecksum.uiChecksum)
-        throw sdv::installation::XIncorrectCRC();
+    // Check whether there are any files in the target directory
+    bool bExistingInstallation = false;
+    try
+    {
+        if (std::filesystem::is_directory(pathTargetDir))
+        {
+            for (auto const& sDirEntry : std::filesystem::directory_iterator{pathTargetDir})
+            {
+                if (sDirEntry.path() != ".." && sDirEntry.path() != ".")
+                {
+                    bExistingInstallation = true;
+                    break;
+                }
+            }
+        }
+    }
+    catch (const std::filesystem::filesystem_error&)
+    {
+        sdv::XCannotRemoveDir exception;
+        exception.ssPath = pathTargetDir.generic_u8string();
+        throw exception;
+    }
 
-    // Update the offset and checksum variables
-    rnOffset = deserializer.offset();
-    ruiChecksum = deserializer.checksum(); // Checksum including checksum-structure of the BLOB
+    // Is there an existing installation?
+    if (bExistingInstallation)
+    {
+        // Allowed to update?
+        if (!UpdateExistingInstallation(pathTargetDir, manifest.Version(), eUpdateRule))
+        {
+            // Not allowed to update.
+            sdv::installation::XDuplicateInstall exception;
+            exception.ssInstallName = manifest.InstallName();
+            throw exception;
+        }
+    }
+
+    // A delta package contains the changed files only; the other files are taken from the existing installation.
+    std::vector<std::filesystem::path> vecUnchangedFiles;
+    if (manifest.DeltaBase())
+    {
+        if (!bExistingInstallation)
+        {
+            sdv::installation::XInstallationNotFound exception;
+            exception.ssInstallName = manifest.InstallName();
+            throw exception;
+        }
+        vecUnchangedFiles = CollectUnchangedFiles(manifest, vecFiles, pathTargetDir);
+    }
+
+    // Compose the installation in a staging directory next to the installation directory.
+    std::filesystem::path pathStagingDir = pathTargetDir;
+    pathStagingDir += ".staging";
+    try
+    {
+        std::filesystem::remove_all(pathStagingDir);
+    }
+    catch (const std::filesystem::filesystem_error&)
+    {
+        sdv::XCannotRemoveDir exception;
+        exception.ssPath = pathStagingDir.generic_u8string();
+        throw exception;
+    }
+    try
+    {
+        // Create the staging directory
+        try
+        {
+            std::filesystem::create_directories(pathStagingDir);
+        }
+        catch (const std::filesystem::filesystem_error&)
+        {
+            sdv::XCannotCreateDir exception;
+            exception.ssPath = pathStagingDir.generic_u8string();
+            throw exception;
+        }
+
+        // Store the installation manifest; the installation is complete after the extraction.
+        manifest.ResetDeltaBase();
+        StoreManifest(pathStagingDir, manifest, sHeader.uiCreationDate);
+
+        // Create the target directories of the files before storing the files in parallel
+        std::vector<std::filesystem::path> vecRelFiles = vecUnchangedFiles;
+        for (const SPackageFile& rsFile : vecFiles)
+            vecRelFiles.push_back(std::filesystem::u8path(static_cast<std::string>(rsFile.sFileDesc.ssFileName)));
+        for (const std::filesystem::path& rpathRelFile : vecRelFiles)
+        {
+            std::filesystem::path pathDir = (pathStagingDir / rpathRelFile).parent_path();
+            if (!std::filesystem::exists(pathDir) || !std::filesystem::is_directory(pathDir))
+            {
+                try
+                {
+                    std::filesystem::create_directories(pathDir);
+                }
+                catch (const std::filesystem::filesystem_error&)
+                {
+                    sdv::XCannotCreateDir exception;
+                    exception.ssPath = pathDir.generic_u8string();
+                    throw exception;
+                }
+            }
+        }
+
+        // Store the files and take over the unchanged files
+        ProcessParallel(vecFiles.size(), uiThreads, [&](size_t nIndex) { StoreFile(vecFiles[nIndex], pathStagingDir); });
+        ProcessParallel(vecUnchangedFiles.size(), uiThreads, [&](size_t nIndex)
+            {
+                ReuseFile(pathTargetDir / vecUnchangedFiles[nIndex], pathStagingDir / vecUnchangedFiles[nIndex]);
+            });
+    }
+    catch (...)
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(pathStagingDir, ec);
+        throw;
+    }
+
+    // TODO EVE: Uninstall from the configuration...
 
-    return sBLOB;
+    // Replace the existing installation
+    ReplaceInstallation(pathStagingDir, pathTargetDir, bExistingInstallation);
+
+    // Load the manifest from the installation directory
+    CInstallManifest manifestInstalled;
+    if (!manifestInstalled.Load(pathTargetDir))
+        throw sdv::installation::XInvalidManifest();
+
+    return manifestInstalled;
 }
 
-void CInstallComposer::DeserializeFinalChecksum(std::ifstream& rfstream, uint32_t uiChecksum)
+void CInstallComposer::Verify(const uint8_t* pData, size_t nSize, uint32_t uiThreads)
 {
-    // Prepare the buffer
-    sdv::pointer<uint8_t> ptrFooter;
-    ptrFooter.resize(sizeof(sdv::installation::SPackageFooter));
+    uint32_t uiChecksum = 0;
+    size_t nOffset = 0;
 
-    // Read the footer
-    rfstream.read(reinterpret_cast<char*>(ptrFooter.get()), sizeof(sdv::installation::SPackageFooter));
+    // Extract the header
+    sdv::installation::SPackageHeader sHeader = DeserializeHeader(pData, nSize, nOffset, uiChecksum);
 
-    // Cast to the footer
-    const sdv::installation::SPackageFooter* psFooter = sdv::cast<sdv::installation::SPackageFooter>(ptrFooter);
-    if (!psFooter) throw sdv::installation::XIncompatiblePackage();
+    // Read the manifest
+    CInstallManifest manifest;
+    if (!manifest.Read(sHeader.ssManifest) || !manifest.IsValid() || manifest.InstallName().empty())
+        throw sdv::installation::XInvalidManifest();
 
-    if (uiChecksum != psFooter->uiChecksum)
-        throw sdv::installation::XIncorrectCRC();
+    // Verify the BLOBs and the final checksum
+    DeserializeBLOBs(pData, nSize, nOffset, uiChecksum, uiThreads);
 }
 
-void CInstallComposer::DeserializeFinalChecksum(const sdv::pointer<uint8_t>& rptrPackage, size_t nOffset, uint32_t uiChecksum)
+CInstallManifest CInstallComposer::ExtractInstallManifest(const uint8_t* pData, size_t nSize)
 {
-    // Deserialize the footer
-    sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer;
-    deserializer.attach(rptrPackage);
-    deserializer.jump(nOffset, uiChecksum);
-    sdv::installation::SPackageFooter sFooter{};
-    deserializer >> sFooter;
+    uint32_t uiChecksum = 0;
+    size_t nOffset = 0;
 
-    if (uiChecksum != sFooter.uiChecksum)
-        throw sdv::installation::XIncorrectCRC();
+    // Extract the header
+    sdv::installation::SPackageHeader sHeader = DeserializeHeader(pData, nSize, nOffset, uiChecksum);
+
+    // Read the manifest
+    CInstallManifest manifest;
+    if (!manifest.Read(sHeader.ssManifest) || !manifest.IsValid() || manifest.InstallName().empty())
+        throw sdv::installation::XInvalidManifest();
+
+    return manifest;
 }
 
-void CInstallComposer::StoreModuleBLOB(const sdv::installation::SPackageBLOB& rsModuleBLOB,
-    const std::filesystem::path& rpathLocation)
+std::vector<std::filesystem::path> CInstallComposer::CollectUnchangedFiles(const CInstallManifest& rmanifest,
+    const std::vector<SPackageFile>& rvecFiles, const std::filesystem::path& rpathTargetDir)
 {
-    if (rsModuleBLOB.get_switch() != sdv::installation::EPackageBLOBType::binary_file) return;
-
-    // File path
-    if (IsParentPath(rpathLocation, static_cast<std::string>(rsModuleBLOB.sFileDesc.ssFileName)))
+    // The existing installation must be the base of the delta package.
+    CInstallManifest manifestBase;
+    if (!manifestBase.Load(rpathTargetDir))
     {
-        sdv::XInvalidPath exception;
-        exception.ssPath = rsModuleBLOB.sFileDesc.ssFileName;
+        sdv::installation::XInstallationNotFound exception;
+        exception.ssInstallName = rmanifest.InstallName();
         throw exception;
-
     }
-    std::filesystem::path pathFile = rpathLocation / static_cast<std::string>(rsModuleBLOB.sFileDesc.ssFileName);
+    if (!(manifestBase.Version() == *rmanifest.DeltaBase()))
+        throw sdv::installation::XIncompatiblePackage();
 
-    // Target directory exists?
-    std::filesystem::path pathDir = pathFile.parent_path();
-    if (!std::filesystem::exists(pathDir) || !std::filesystem::is_directory(pathDir))
+    // Files contained in the package
+    std::set<std::string> setPackageFiles;
+    for (const SPackageFile& rsFile : rvecFiles)
+        setPackageFiles.insert(CInstallManifest::ModuleKey(std::filesystem::u8path(static_cast<std::string>(rsFile.sFileDesc.ssFileName))));
+
+    // All other files must be available unchanged in the existing installation.
+    std::vector<std::filesystem::path> vecUnchangedFiles;
+    for (const std::filesystem::path& rpathRelFile : rmanifest.ModuleList())
     {
-        try
+        if (setPackageFiles.count(CInstallManifest::ModuleKey(rpathRelFile))) continue;
+        if (IsParentPath(rpathTargetDir, rpathRelFile))
         {
-            std::filesystem::create_directories(pathDir);
+            sdv::XInvalidPath exception;
+            exception.ssPath = rpathRelFile.generic_u8string();
+            throw exception;
         }
-        catch (const std::filesystem::filesystem_error&)
+
+        auto optHash = rmanifest.ModuleHash(rpathRelFile);
+        auto optHashBase = manifestBase.ModuleHash(rpathRelFile);
+        std::error_code ec;
+        std::filesystem::path pathFile = rpathTargetDir / rpathRelFile;
+        if (!optHash || !(optHash == optHashBase) || !std::filesystem::is_regular_file(pathFile, ec) ||
+            std::filesystem::file_size(pathFile, ec) != optHash->uiSize)
         {
-            sdv::XCannotCreateDir exception;
-            exception.ssPath = pathDir.generic_u8string();
+            sdv::installation::XModuleNotFound exception;
+            exception.ssPath = rpathRelFile.generic_u8string();
             throw exception;
         }
+        vecUnchangedFiles.push_back(rpathRelFile);
+    }
+
+    return vecUnchangedFiles;
+}
+
+void CInstallComposer::ReuseFile(const std::filesystem::path& rpathSource, const std::filesystem::path& rpathTarget)
+{
+    // The existing installation is removed after the update; a hard link prevents copying the content.
+    std::error_code ec;
+    std::filesystem::create_hard_link(rpathSource, rpathTarget, ec);
+    if (!ec) return;
+
+    // Copy the file instead
+    if (!std::filesystem::copy_file(rpathSource, rpathTarget, std::filesystem::copy_options::overwrite_existing, ec) || ec)
+    {
+        sdv::XCannotOpenFile exception;
+        exception.ssPath = rpathTarget.generic_u8string();
+        throw exception;
+    }
+
+    // Set file times and attributes (read-only last) - so far as supported by OS
+    SetCreateTime(rpathTarget, GetCreateTime(rpathSource));
+    SetChangeTime(rpathTarget, GetChangeTime(rpathSource));
+    if (IsExecutable(rpathSource))
+        SetExecutable(rpathTarget);
+    if (IsReadOnly(rpathSource))
+        SetReadOnly(rpathTarget);
+}
+
+void CInstallComposer::ReplaceInstallation(const std::filesystem::path& rpathStagingDir,
+    const std::filesystem::path& rpathTargetDir, bool bExistingInstallation)
+{
+    std::error_code ec;
+    std::filesystem::path pathPreviousDir = rpathTargetDir;
+    pathPreviousDir += ".previous";
+
+    // Move the existing installation aside. Without installation, an empty installation directory might exist.
+    if (bExistingInstallation)
+    {
+        std::filesystem::remove_all(pathPreviousDir, ec);
+        std::filesystem::rename(rpathTargetDir, pathPreviousDir, ec);
+    }
+    else if (std::filesystem::exists(rpathTargetDir, ec))
+        std::filesystem::remove(rpathTargetDir, ec);
+    if (ec)
+    {
+        std::filesystem::remove_all(rpathStagingDir, ec);
+        sdv::XCannotRemoveDir exception;
+        exception.ssPath = rpathTargetDir.generic_u8string();
+        throw exception;
+    }
+
+    // Move the staged installation into place; restore the existing installation on failure.
+    std::filesystem::rename(rpathStagingDir, rpathTargetDir, ec);
+    if (ec)
+    {
+        if (bExistingInstallation)
+            std::filesystem::rename(pathPreviousDir, rpathTargetDir, ec);
+        std::filesystem::remove_all(rpathStagingDir, ec);
+        sdv::XCannotCreateDir exception;
+        exception.ssPath = rpathTargetDir.generic_u8string();
+        throw exception;
     }
 
+    // Remove the previous installation (this represents the uninstallation process).
+    if (bExistingInstallation)
+        std::filesystem::remove_all(pathPreviousDir, ec);
+}
+
+void CInstallComposer::StoreFile(const SPackageFile& rsFile, const std::filesystem::path& rpathLocation)
+{
+    std::filesystem::path pathFile = rpathLocation / static_cast<std::string>(rsFile.sFileDesc.ssFileName);
+
     // File content
     std::ofstream fstream(pathFile.native().c_str(), std::ios::binary);
     if (!fstream.is_open())
@@ -1391,18 +1297,103 @@ void CInstallComposer::StoreModuleBLOB(const sdv::installation::SPackageBLOB& rs
         exception.ssPath = pathFile.generic_u8string();
         throw exception;
     }
-    sdv::to_stream(rsModuleBLOB.sFileDesc.ptrContent, fstream.rdbuf());
+    fstream.write(reinterpret_cast<const char*>(rsFile.pContent), static_cast<std::streamsize>(rsFile.nContentSize));
     fstream.close();
 
     // Set file times and attributes (read-only last) - so far as supported by OS
-    SetCreateTime(pathFile, rsModuleBLOB.sFileDesc.uiCreationDate);
-    SetChangeTime(pathFile, rsModuleBLOB.sFileDesc.uiChangeDate);
-    if (rsModuleBLOB.sFileDesc.bAttrExecutable)
+    SetCreateTime(pathFile, rsFile.sFileDesc.uiCreationDate);
+    SetChangeTime(pathFile, rsFile.sFileDesc.uiChangeDate);
+    if (rsFile.sFileDesc.bAttrExecutable)
         SetExecutable(pathFile);
-    if (rsModuleBLOB.sFileDesc.bAttrReadonly)
+    if (rsFile.sFileDesc.bAttrReadonly)
         SetReadOnly(pathFile);
 }
 
+void CInstallComposer::CalcChecksums(std::vector<SChecksumBlock>& rvecBlocks, uint32_t uiThreads)
+{
+    // Split the blocks into chunks, allowing large files to be processed by multiple threads as well.
+    const size_t nChunkSize = 16ull * 1024ull * 1024ull;
+    struct SChunk
+    {
+        size_t      nBlock = 0;         ///< Index of the block.
+        size_t      nOffset = 0;        ///< Offset within the block.
+        size_t      nSize = 0;          ///< Size of the chunk.
+        uint32_t    uiChecksum = 0;     ///< Checksum of the chunk.
+    };
+    std::vector<SChunk> vecChunks;
+    for (size_t nBlock = 0; nBlock < rvecBlocks.size(); nBlock++)
+    {
+        size_t nOffset = 0;
+        do
+        {
+            SChunk sChunk;
+            sChunk.nBlock = nBlock;
+            sChunk.nOffset = nOffset;
+            sChunk.nSize = std::min(nChunkSize, rvecBlocks[nBlock].nSize - nOffset);
+            vecChunks.push_back(sChunk);
+            nOffset += sChunk.nSize;
+        } while (nOffset < rvecBlocks[nBlock].nSize);
+    }
+
+    // Calculate the checksums of the chunks; only the first chunk of a block starts with the initial checksum.
+    ProcessParallel(vecChunks.size(), uiThreads, [&](size_t nIndex)
+        {
+            SChunk& rsChunk = vecChunks[nIndex];
+            const SChecksumBlock& rsBlock = rvecBlocks[rsChunk.nBlock];
+            sdv::crcCRC32C crc;
+            if (!rsChunk.nOffset) crc.set_checksum(rsBlock.uiChecksumInit);
+            rsChunk.uiChecksum = crc.calc_checksum(rsBlock.pData + rsChunk.nOffset, rsChunk.nSize);
+        });
+
+    // Combine the checksums of the chunks
+    sdv::crcCRC32C crc;
+    for (const SChunk& rsChunk : vecChunks)
+    {
+        if (!rsChunk.nOffset)
+            crc.set_checksum(rsChunk.uiChecksum);
+        else
+            crc.combine(rsChunk.uiChecksum, rsChunk.nSize);
+        rvecBlocks[rsChunk.nBlock].uiChecksum = crc.get_checksum();
+    }
+}
+
+void CInstallComposer::ProcessParallel(size_t nCount, uint32_t uiThreads, const std::function<void(size_t)>& rfnProcess)
+{
+    if (!uiThreads) uiThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    size_t nThreads = std::min(static_cast<size_t>(uiThreads), nCount);
+
+    std::atomic_size_t  nNext = 0;
+    std::atomic_bool    bFailed = false;
+    std::mutex          mtxException;
+    std::exception_ptr  ptrException;
+    auto fnWorker = [&]()
+    {
+        for (size_t nIndex = nNext++; nIndex < nCount && !bFailed; nIndex = nNext++)
+        {
+            try
+            {
+                rfnProcess(nIndex);
+            }
+            catch (...)
+            {
+                std::unique_lock<std::mutex> lock(mtxException);
+                if (!ptrException) ptrException = std::current_exception();
+                bFailed = true;
+            }
+        }
+    };
+
+    // The current thread is one of the workers
+    std::vector<std::thread> vecThreads;
+    for (size_t nThread = 1; nThread < nThreads; nThread++)
+        vecThreads.emplace_back(fnWorker);
+    fnWorker();
+    for (std::thread& rthread : vecThreads)
+        rthread.join();
+
+    if (ptrException) std::rethrow_exception(ptrException);
+}
+
 void CInstallComposer::StoreManifest(const std::filesystem::path& rpathLocation, const CInstallManifest& rmanifest, int64_t uiCreationTime)
 {
     // Save the manifest to the target directory
@@ -1417,6 +1408,9 @@ void CInstallComposer::StoreManifest(const std::filesystem::path& rpathLocation,
     // Set the creation and change times (for supporting OSes) for the manifest file.
     SetCreateTime(rpathLocation / "install_manifest.toml", uiCreationTime);
     SetChangeTime(rpathLocation / "install_manifest.toml", uiCreationTime);
+
+    // Store the binary index for fast loading; without the index, the manifest is parsed instead.
+    rmanifest.SaveIndex(rpathLocation);
 }
 
 #ifdef _WIN32
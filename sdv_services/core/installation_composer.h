@@ -16,7 +16,10 @@
 
 #include <interfaces/config.h>
 #include "installation_manifest.h"
+#include "../../global/mapped_file.h"
 #include <list>
+#include <vector>
+#include <functional>
 #include <filesystem>
 
 /// When enabled, support the read-only flag for files. By default this flag is not enabled due to limited support by the OS.
@@ -167,9 +170,11 @@ public:
      * manifest containing the module and component details. If the module is an SDV module, the component manifest will
      * automatically extracted from the component and added to the installation manifest.
      * @param[in] rssInstallName Reference to the string containing the installation name.
+     * @param[in] uiThreads The amount of threads to use for calculating the file checksums. If 0, the amount of processor cores
+     * is used.
      * @return Returns a buffer to the package content.
      */
-    sdv::pointer<uint8_t> Compose(const std::string& rssInstallName) const;
+    sdv::pointer<uint8_t> Compose(const std::string& rssInstallName, uint32_t uiThreads = 0) const;
 
     /**
      * @brief Compose the package to disk.
@@ -179,11 +184,50 @@ public:
      * @details Compose a package from all the modules added through the AddModule function. Additionally add an installation
      * manifest containing the module and component details. If the module is an SDV module, the component manifest will
      * automatically extracted from the component and added to the installation manifest.
+     * The files are mapped into memory and streamed into the package; the memory usage doesn't depend on the size of the files.
      * @param[in] rpathPackage Reference to the path receiving the package content. Any existing package will be overwritten.
      * @param[in] rssInstallName Reference to the string containing the installation name.
+     * @param[in] uiThreads The amount of threads to use for calculating the file checksums. If 0, the amount of processor cores
+     * is used.
      * @return Returns whether the package composing was successful.
      */
-    bool Compose(const std::filesystem::path& rpathPackage, const std::string& rssInstallName) const;
+    bool Compose(const std::filesystem::path& rpathPackage, const std::string& rssInstallName, uint32_t uiThreads = 0) const;
+
+    /**
+     * @brief Compose a delta package in memory.
+     * @throw Could throw a sdv::XSysExcept based exception.
+     * @attention This function is part of the composer. Since it is loading a module to retrieve the component manifest of the
+     * module, module code could be executed. it therefore imposes a security risk. Do not call this function in sdv_core!
+     * @details Compose a package containing only the modules that were added through the AddModule function and differ from the
+     * modules of the base installation. The modules are compared by their content hash stored in the installation manifest;
+     * modules of the base installation without a content hash are considered changed. The installation manifest of the package
+     * describes the complete installation. During the extraction, the unchanged modules are taken from the existing
+     * installation, which must have the version of the base installation.
+     * @param[in] rssInstallName Reference to the string containing the installation name.
+     * @param[in] rmanifestBase Reference to the installation manifest of the installation to create the delta package for.
+     * @param[in] uiThreads The amount of threads to use for calculating the file checksums. If 0, the amount of processor cores
+     * is used.
+     * @return Returns a buffer to the package content.
+     */
+    sdv::pointer<uint8_t> ComposeDelta(const std::string& rssInstallName, const CInstallManifest& rmanifestBase,
+        uint32_t uiThreads = 0) const;
+
+    /**
+     * @brief Compose a delta package to disk.
+     * @throw Could throw a sdv::XSysExcept based exception.
+     * @attention This function is part of the composer. Since it is loading a module to retrieve the component manifest of the
+     * module, module code could be executed. it therefore imposes a security risk. Do not call this function in sdv_core!
+     * @details Compose a package containing only the modules that differ from the modules of the base installation. See the
+     * in-memory ComposeDelta function for details.
+     * @param[in] rpathPackage Reference to the path receiving the package content. Any existing package will be overwritten.
+     * @param[in] rssInstallName Reference to the string containing the installation name.
+     * @param[in] rmanifestBase Reference to the installation manifest of the installation to create the delta package for.
+     * @param[in] uiThreads The amount of threads to use for calculating the file checksums. If 0, the amount of processor cores
+     * is used.
+     * @return Returns whether the package composing was successful.
+     */
+    bool ComposeDelta(const std::filesystem::path& rpathPackage, const std::string& rssInstallName,
+        const CInstallManifest& rmanifestBase, uint32_t uiThreads = 0) const;
 
     /**
      * @brief Compose the installation directly at the target directory (without package composing and extracting).
@@ -218,25 +262,36 @@ public:
      * @brief Extract a package to an installation directory.
      * @throw Could throw a sdv::XSysExcept based exception.
      * @pre An installation directory must be available.
+     * @details The installation is composed in a staging directory next to the installation and replaces an existing
+     * installation only after all files were stored. When extracting a delta package, the unchanged files are taken from the
+     * existing installation.
      * @param[in] rptrPackage Reference to the pointer containing the package content.
      * @param[in] rpathInstallDir Reference to the installation directory.
      * @param[in] eUpdateRule Decide how to deal with updating an existing installation.
+     * @param[in] uiThreads The amount of threads to use for verifying and storing the files. If 0, the amount of processor cores
+     * is used.
      * @return Returns the installation manifest when the package extraction was successful; or an empty manifest when not.
      */
     static CInstallManifest Extract(const sdv::pointer<uint8_t>& rptrPackage, const std::filesystem::path& rpathInstallDir,
-        EUpdateRules eUpdateRule = EUpdateRules::not_allowed);
+        EUpdateRules eUpdateRule = EUpdateRules::not_allowed, uint32_t uiThreads = 0);
 
     /**
      * @brief Extract a package to an installation directory.
      * @throw Could throw a sdv::XSysExcept based exception.
      * @pre An installation directory must be available.
+     * @details The package is mapped into memory and the integrity of the complete package is verified before any file is
+     * stored. The installation is composed in a staging directory next to the installation and replaces an existing
+     * installation only after all files were stored. When extracting a delta package, the unchanged files are taken from the
+     * existing installation.
      * @param[in] rpathPackage Reference to the path of the package file.
      * @param[in] rpathInstallDir Reference to the installation directory.
      * @param[in] eUpdateRule Decide how to deal with updating an existing installation.
+     * @param[in] uiThreads The amount of threads to use for verifying and storing the files. If 0, the amount of processor cores
+     * is used.
      * @return Returns the installation manifest when the package extraction was successful; or an empty manifest when not.
      */
     static CInstallManifest Extract(const std::filesystem::path& rpathPackage, const std::filesystem::path& rpathInstallDir,
-        EUpdateRules eUpdateRule = EUpdateRules::not_allowed);
+        EUpdateRules eUpdateRule = EUpdateRules::not_allowed, uint32_t uiThreads = 0);
 
     /**
      * @brief Remove an installation.
@@ -252,17 +307,19 @@ public:
      * @brief Verify the integrity of an installation package.
      * @throw Could throw a sdv::XSysExcept based exception with information about the integrity violation.
      * @param[in] rptrPackage Reference to the pointer containing the package content.
+     * @param[in] uiThreads The amount of threads to use for the verification. If 0, the amount of processor cores is used.
      * @return Returns 'true' when the package extraction was successful; 'false' when not.
      */
-    static bool Verify(const sdv::pointer<uint8_t>& rptrPackage);
+    static bool Verify(const sdv::pointer<uint8_t>& rptrPackage, uint32_t uiThreads = 0);
 
     /**
      * @brief Verify the integrity of an installation package.
      * @throw Could throw a sdv::XSysExcept based exception with information about the integrity violation.
      * @param[in] rpathPackage Reference to the path of the package file.
+     * @param[in] uiThreads The amount of threads to use for the verification. If 0, the amount of processor cores is used.
      * @return Returns 'true' when the package extraction was successful; 'false' when not.
      */
-    static bool Verify(const std::filesystem::path& rpathPackage);
+    static bool Verify(const std::filesystem::path& rpathPackage, uint32_t uiThreads = 0);
 
     /**
      * @brief Extract an installation manifest from a package.
@@ -290,6 +347,108 @@ private:
         std::filesystem::path   pathRelDir;         ///< Relative directory within the installation.
     };
 
+    /**
+     * @brief File prepared for composing. The file is mapped into memory and the checksum of the content is calculated in
+     * advance, allowing the content to be streamed into the package without copying.
+     */
+    struct SComposeFile
+    {
+        sdv::installation::SPackageBLOB sBLOB;              ///< BLOB description (without content; with BLOB size).
+        CMappedFile                     file;               ///< Mapped file content.
+        uint32_t                        uiContentChecksum = 0;  ///< Checksum of the file content.
+    };
+
+    /**
+     * @brief File stored in a package. The content refers to the package buffer.
+     */
+    struct SPackageFile
+    {
+        sdv::installation::SFileDesc    sFileDesc;          ///< File description (without content).
+        const uint8_t*                  pContent = nullptr; ///< Pointer to the file content within the package.
+        size_t                          nContentSize = 0;   ///< Size of the file content.
+    };
+
+    /**
+     * @brief Data block to calculate a checksum for.
+     */
+    struct SChecksumBlock
+    {
+        const uint8_t*  pData = nullptr;        ///< Pointer to the data.
+        size_t          nSize = 0;              ///< Size of the data.
+        uint32_t        uiChecksumInit = 0;     ///< Initial checksum to start the calculation with.
+        uint32_t        uiChecksum = 0;         ///< The calculated checksum.
+    };
+
+    /**
+     * @brief Function receiving the package data while composing.
+     */
+    using FnWritePackage = std::function<void(const uint8_t* pData, size_t nSize)>;
+
+    /**
+     * @brief Map the files into memory, collect the file descriptions and calculate the checksums of the content.
+     * @throw Could throw a sdv::XSysExcept based exception.
+     * @param[in] uiThreads The amount of threads to use. If 0, the amount of processor cores is used.
+     * @return List with the prepared files in the order they were added.
+     */
+    std::list<SComposeFile> PrepareFiles(uint32_t uiThreads) const;
+
+    /**
+     * @brief Compose the installation manifest, prepare the files and serialize the package header.
+     * @throw Could throw a sdv::XSysExcept based exception.
+     * @param[in] rssInstallName Reference to the string containing the installation name.
+     * @param[in] pmanifestBase Pointer to the installation manifest of the base installation when composing a delta package or
+     * nullptr when composing a complete package.
+     * @param[in] uiThreads The amount of threads to use. If 0, the amount of processor cores is used.
+     * @param[out] rptrHeader Reference to the pointer receiving the serialized package header.
+     * @param[out] ruiChecksum Reference to the variable receiving the checksum calculated over the header.
+     * @return List with the prepared files to store in the package.
+     */
+    std::list<SComposeFile> PreparePackage(const std::string& rssInstallName, const CInstallManifest* pmanifestBase,
+        uint32_t uiThreads, sdv::pointer<uint8_t>& rptrHeader, uint32_t& ruiChecksum) const;
+
+    /**
+     * @brief Compose the package in memory.
+     * @throw Could throw a sdv::XSysExcept based exception.
+     * @param[in] rssInstallName Reference to the string containing the installation name.
+     * @param[in] pmanifestBase Pointer to the installation manifest of the base installation when composing a delta package or
+     * nullptr when composing a complete package.
+     * @param[in] uiThreads The amount of threads to use. If 0, the amount of processor cores is used.
+     * @return Returns a buffer to the package content.
+     */
+    sdv::pointer<uint8_t> ComposeToBuffer(const std::string& rssInstallName, const CInstallManifest* pmanifestBase,
+        uint32_t uiThreads) const;
+
+    /**
+     * @brief Compose the package to disk.
+     * @throw Could throw a sdv::XSysExcept based exception.
+     * @param[in] rpathPackage Reference to the path receiving the package content.
+     * @param[in] rssInstallName Reference to the string containing the installation name.
+     * @param[in] pmanifestBase Pointer to the installation manifest of the base installation when composing a delta package or
+     * nullptr when composing a complete package.
+     * @param[in] uiThreads The amount of threads to use. If 0, the amount of processor cores is used.
+     * @return Returns whether the package composing was successful.
+     */
+    bool ComposeToFile(const std::filesystem::path& rpathPackage, const std::string& rssInstallName,
+        const CInstallManifest* pmanifestBase, uint32_t uiThreads) const;
+
+    /**
+     * @brief Store the content hashes of the prepared files in the installation manifest.
+     * @param[in, out] rmanifest Reference to the installation manifest.
+     * @param[in] rlstFiles Reference to the prepared files.
+     */
+    static void AddContentHashes(CInstallManifest& rmanifest, const std::list<SComposeFile>& rlstFiles);
+
+    /**
+     * @brief Compose the package and provide the data in sequential order to the write function.
+     * @throw Could throw a sdv::XSysExcept based exception.
+     * @param[in] rptrHeader Reference to the serialized package header.
+     * @param[in] uiChecksum The checksum calculated over the header.
+     * @param[in] rlstFiles Reference to the prepared files.
+     * @param[in] rfnWrite Reference to the function receiving the package data.
+     */
+    static void WritePackage(const sdv::pointer<uint8_t>& rptrHeader, uint32_t uiChecksum,
+        const std::list<SComposeFile>& rlstFiles, const FnWritePackage& rfnWrite);
+
     /**
      * @brief Compose and serialize a package header.
      * @param[in, out] rptrPackage Reference to a pointer object receiving the serialized header. The pointer object will be
@@ -300,104 +459,139 @@ private:
     static uint32_t SerializePackageHeader(sdv::pointer<uint8_t>& rptrPackage, const CInstallManifest& rmanifest);
 
     /**
-     * @brief Serialize a module into a package BLOB.
-     * @param[in] uiChecksumInit The initial checksum to start calculating the BLOB checksum with.
-     * @param[in, out] rptrPackage Reference to a pointer object receiving the BLOB. The pointer object will be extended to fit
-     * the BLOB, which will be placed following the data stored in the pointer buffer. The existing data will not be touched.
-     * @param[in] rsFile Reference to the module entry to add as a BLOB.
-     * @return The checksum of data stored in the package pointer.
-     */
-    static uint32_t SerializeModuleBLOB(uint32_t uiChecksumInit, sdv::pointer<uint8_t>& rptrPackage, const SFileEntry& rsFile);
-
-    /**
-     * @brief Serialize a final BLOB. This marks the end of the BLOBs within the package.
+     * @brief Serialize a BLOB without the file content, calculate the BLOB checksum and provide the BLOB to the write function.
      * @param[in] uiChecksumInit The initial checksum to start calculating the BLOB checksum with.
-     * @param[in, out] rptrPackage Reference to a pointer object receiving the BLOB. The pointer object will be extended to fit
-     * the BLOB, which will be placed following the data stored in the pointer buffer. The existing data will not be touched.
-     * @return The checksum of data stored in the package pointer.
+     * @param[in] rsBLOB Reference to the BLOB description (including the BLOB size). The content of a file BLOB is provided
+     * separately.
+     * @param[in] pContent Pointer to the file content or nullptr when the BLOB doesn't have any content.
+     * @param[in] nContentSize Size of the file content.
+     * @param[in] uiContentChecksum The checksum calculated over the file content.
+     * @param[in] rfnWrite Reference to the function receiving the BLOB data.
+     * @return The checksum of the data following the BLOB (including BLOB checksum).
      */
-    static uint32_t SerializeFinalBLOB(uint32_t uiChecksumInit, sdv::pointer<uint8_t>& rptrPackage);
+    static uint32_t WriteBLOB(uint32_t uiChecksumInit, const sdv::installation::SPackageBLOB& rsBLOB, const uint8_t* pContent,
+        size_t nContentSize, uint32_t uiContentChecksum, const FnWritePackage& rfnWrite);
 
     /**
-     * @brief Serialize the package footer.
-     * @param[in] uiChecksum The checksum of the data to store in the footer.
-     * @param[in, out] rptrPackage Reference to a pointer object receiving the footer. The pointer object will be extended to fit
-     * the footer, which will be placed following the data stored in the pointer buffer. The existing data will not be touched.
+     * @brief Calculate the size of a BLOB.
+     * @param[in] rsBLOB Reference to the BLOB description (without content).
+     * @param[in] nContentSize Size of the file content.
+     * @return The BLOB size including padding and checksum.
      */
-    static void SerializePackageFooter(uint32_t uiChecksum, sdv::pointer<uint8_t>& rptrPackage);
+    static size_t CalcBLOBSize(const sdv::installation::SPackageBLOB& rsBLOB, size_t nContentSize);
 
     /**
-     * @brief Extracts the header from the file.
-     * @details This function reads the header from the file from the current position and checks whether the content fits the
-     * checksum.
-     * @param[in, out] rfstream Reference to the opened package stream at the initial position.
+     * @brief Extracts the header from the package.
+     * @details This function reads the header from the package and checks whether the content fits the checksum.
+     * @param[in] pData Pointer to the package content.
+     * @param[in] nSize Size of the package content.
+     * @param[out] rnOffset Reference to the variable receiving the offset location following the header.
      * @param[out] ruiChecksum Reference to the variable receiving the checksum calculated over the complete header. This checksum
      * is used as input for the checksum of the following structures.
      * @return Returns the content of the package header.
      */
-    static sdv::installation::SPackageHeader DeserializeHeader(std::ifstream& rfstream, uint32_t& ruiChecksum);
+    static sdv::installation::SPackageHeader DeserializeHeader(const uint8_t* pData, size_t nSize, size_t& rnOffset,
+        uint32_t& ruiChecksum);
 
     /**
-     * @brief Extracts the header from the file.
-     * @details This function reads the header from the file from the current position and checks whether the content fits the
-     * checksum.
-     * @param[in] rptrPackage Reference to the package containing the header.
-     * @param[out] rnOffset Reference to the variable receiving the offset location following the header.
-     * @param[out] ruiChecksum Reference to the variable receiving the checksum calculated over the complete header. This checksum
-     * is used as input for the checksum of the following structures.
-     * @return Returns the content of the package header.
+     * @brief Extracts the BLOBs and the footer from the package and verifies the checksums of the BLOBs.
+     * @details The BLOB structure is read sequentially, whereas the checksums over the BLOB content is calculated in parallel.
+     * The content is not copied.
+     * @param[in] pData Pointer to the package content.
+     * @param[in] nSize Size of the package content.
+     * @param[in] nOffset The offset of the first BLOB following the header.
+     * @param[in] uiChecksum The checksum calculated over the header.
+     * @param[in] uiThreads The amount of threads to use. If 0, the amount of processor cores is used.
+     * @return The files contained in the package.
      */
-    static sdv::installation::SPackageHeader DeserializeHeader(const sdv::pointer<uint8_t>& rptrPackage, size_t& rnOffset,
-        uint32_t& ruiChecksum);
+    static std::vector<SPackageFile> DeserializeBLOBs(const uint8_t* pData, size_t nSize, size_t nOffset, uint32_t uiChecksum,
+        uint32_t uiThreads);
 
     /**
-     * @brief Extracts the BLOB from the file.
-     * @details This function reads the BLOB from the file from the current position and checks whether the content fits the
-     * checksum.
-     * @param[in, out] rfstream Reference to the opened package stream at the current position.
-     * @param[in, out] ruiChecksum Reference to the variable receiving the checksum calculated over the complete BLOB. This
-     * checksum is used as input for the checksum of the following structures.
-     * @return Returns the content of the package header.
+     * @brief Verify the package and extract it to an installation directory.
+     * @throw Could throw a sdv::XSysExcept based exception.
+     * @param[in] pData Pointer to the package content.
+     * @param[in] nSize Size of the package content.
+     * @param[in] rpathInstallDir Reference to the installation directory.
+     * @param[in] eUpdateRule Decide how to deal with updating an existing installation.
+     * @param[in] uiThreads The amount of threads to use. If 0, the amount of processor cores is used.
+     * @return Returns the installation manifest when the package extraction was successful; or an empty manifest when not.
      */
-    static sdv::installation::SPackageBLOB DeserializeBLOB(std::ifstream& rfstream, uint32_t& ruiChecksum);
+    static CInstallManifest Extract(const uint8_t* pData, size_t nSize, const std::filesystem::path& rpathInstallDir,
+        EUpdateRules eUpdateRule, uint32_t uiThreads);
 
     /**
-     * @brief Extracts the BLOB from the file.
-     * @details This function reads the BLOB from the file from the current position and checks whether the content fits the
-     * checksum.
-     * @param[in] rptrPackage Reference to the package containing the BLOB.
-     * @param[in, out] rnOffset Reference to the variable containing the offset to the BLOB and receiving the offset following the
-     * BLOB.
-     * @param[in, out] ruiChecksum Reference to the variable receiving the checksum calculated over the complete BLOB. This
-     * checksum is used as input for the checksum of the following structures.
-     * @return Returns the content of the package header.
+     * @brief Verify the integrity of an installation package.
+     * @throw Could throw a sdv::XSysExcept based exception with information about the integrity violation.
+     * @param[in] pData Pointer to the package content.
+     * @param[in] nSize Size of the package content.
+     * @param[in] uiThreads The amount of threads to use. If 0, the amount of processor cores is used.
+     */
+    static void Verify(const uint8_t* pData, size_t nSize, uint32_t uiThreads);
+
+    /**
+     * @brief Extract an installation manifest from a package.
+     * @throw Could throw a sdv::XSysExcept based exception.
+     * @param[in] pData Pointer to the package content.
+     * @param[in] nSize Size of the package content.
+     * @return Returns the installation manifest.
+     */
+    static CInstallManifest ExtractInstallManifest(const uint8_t* pData, size_t nSize);
+
+    /**
+     * @brief Collect the files of a delta package that are taken from the existing installation.
+     * @throw Could throw a sdv::XSysExcept based exception when the existing installation doesn't fit the delta package.
+     * @param[in] rmanifest Reference to the installation manifest of the delta package.
+     * @param[in] rvecFiles Reference to the files contained in the package.
+     * @param[in] rpathTargetDir Reference to the directory of the existing installation.
+     * @return Vector with the relative paths of the files to take from the existing installation.
+     */
+    static std::vector<std::filesystem::path> CollectUnchangedFiles(const CInstallManifest& rmanifest,
+        const std::vector<SPackageFile>& rvecFiles, const std::filesystem::path& rpathTargetDir);
+
+    /**
+     * @brief Take over a file from the existing installation. The file is linked if possible and copied if not.
+     * @param[in] rpathSource Reference to the path of the file in the existing installation.
+     * @param[in] rpathTarget Reference to the path of the file in the staging directory. The target directory must exist.
+     */
+    static void ReuseFile(const std::filesystem::path& rpathSource, const std::filesystem::path& rpathTarget);
+
+    /**
+     * @brief Replace the installation by the staged installation.
+     * @details The existing installation is renamed, the staged installation is renamed to the installation directory and
+     * the previous installation is removed. If the staged installation cannot be moved, the existing installation is restored.
+     * @param[in] rpathStagingDir Reference to the staging directory.
+     * @param[in] rpathTargetDir Reference to the installation directory.
+     * @param[in] bExistingInstallation Set when an installation exists.
      */
-    static sdv::installation::SPackageBLOB DeserializeBLOB(const sdv::pointer<uint8_t>& rptrPackage, size_t& rnOffset, uint32_t& ruiChecksum);
+    static void ReplaceInstallation(const std::filesystem::path& rpathStagingDir, const std::filesystem::path& rpathTargetDir,
+        bool bExistingInstallation);
 
     /**
-     * @brief Check the final checksum using the package footer.
-     * @param[in, out] rfstream Reference to the opened package stream at the current position.
-     * @param[in] uiChecksum The calculated checksum of the package content to use for the calculation of the checksum of the
-     * footer.
+     * @brief Store the file from the package.
+     * @param[in] rsFile Reference to the file located in the package.
+     * @param[in] rpathLocation Reference to the path containing the location to store the file to. The target directory must
+     * exist.
      */
-    static void DeserializeFinalChecksum(std::ifstream& rfstream, uint32_t uiChecksum);
+    static void StoreFile(const SPackageFile& rsFile, const std::filesystem::path& rpathLocation);
 
     /**
-     * @brief Check the final checksum using the package footer.
-     * @param[in] rptrPackage Reference to the package containing the footer with the checksum.
-     * @param[in] nOffset The variable containing the offset to the footer.
-     * @param[in] uiChecksum The calculated checksum of the package content to use for the calculation of the checksum of the
-     * footer.
+     * @brief Calculate the checksums of the data blocks in parallel. Large blocks are split into chunks, of which the checksums
+     * are combined afterwards.
+     * @param[in, out] rvecBlocks Reference to the vector containing the data blocks and receiving the checksums.
+     * @param[in] uiThreads The amount of threads to use. If 0, the amount of processor cores is used.
      */
-    static void DeserializeFinalChecksum(const sdv::pointer<uint8_t>& rptrPackage, size_t nOffset, uint32_t uiChecksum);
+    static void CalcChecksums(std::vector<SChecksumBlock>& rvecBlocks, uint32_t uiThreads);
 
     /**
-     * @brief Store the module from the supplied BLOB.
-     * @param[in] rsModuleBLOB Reference to the BLOB structure containing the module. If the BLOB doesn't contain the module,
-     * nothing occurs.
-     * @param[in] rpathLocation Reference to the path containing the location to store the module to.
+     * @brief Process a function for a range of indices using multiple threads.
+     * @details The first exception thrown by the function is rethrown after all threads have finished. Following an exception,
+     * no further indices are processed.
+     * @param[in] nCount The amount of indices to process.
+     * @param[in] uiThreads The maximum amount of threads to use. If 0, the amount of processor cores is used.
+     * @param[in] rfnProcess Reference to the function processing one index.
      */
-    static void StoreModuleBLOB(const sdv::installation::SPackageBLOB& rsModuleBLOB, const std::filesystem::path& rpathLocation);
+    static void ProcessParallel(size_t nCount, uint32_t uiThreads, const std::function<void(size_t)>& rfnProcess);
 
     /**
      * @brief Store the installation manifest at the provided location and set the creation time for the manifest file.
@@ -15,6 +15,8 @@
 #include <support/component_impl.h>
 #include <support/serdes.h>
 #include <support/toml.h>
+#include <interfaces/serdes/core_serdes.h>
+#include "../global/mapped_file.h"
 
 #if defined _WIN32 && defined __GNUC__
 #pragma GCC diagnostic push
@@ -158,7 +160,10 @@ void CInstallManifest::Clear()
 {
     m_ssInstallName.clear();
     m_vecModules.clear();
+    m_mapModules.clear();
+    m_mapClasses.clear();
     m_bBlockSystemObjects = false;
+    m_optDeltaBase.reset();
 }
 
 const std::string& CInstallManifest::InstallName() const
@@ -219,8 +224,11 @@ bool CInstallManifest::Load(const std::filesystem::path& rpathInstallDir, bool b
     std::stringstream sstreamManifest;
     sstreamManifest << fstream.rdbuf();
     fstream.close();
+    std::string ssManifest = sstreamManifest.str();
 
-    return Read(sstreamManifest.str(), bBlockSystemObjects);
+    // Use the binary index if it was created for this manifest. Otherwise parse the manifest.
+    if (LoadIndex(rpathInstallDir / "install_manifest.idx", ssManifest, bBlockSystemObjects)) return true;
+    return Read(ssManifest, bBlockSystemObjects);
 }
 
 bool CInstallManifest::Save(const std::filesystem::path& rpathInstallDir) const
@@ -240,6 +248,174 @@ bool CInstallManifest::Save(const std::filesystem::path& rpathInstallDir) const
     return !ssManifest.empty();
 }
 
+bool CInstallManifest::SaveIndex(const std::filesystem::path& rpathInstallDir) const
+{
+    // The index must contain all classes.
+    if (!IsValid() || rpathInstallDir.empty() || m_bBlockSystemObjects) return false;
+
+    // Read the manifest the index is created for
+    std::ifstream fstreamManifest(rpathInstallDir / "install_manifest.toml");
+    if (!fstreamManifest.is_open()) return false;
+    std::stringstream sstreamManifest;
+    sstreamManifest << fstreamManifest.rdbuf();
+    fstreamManifest.close();
+    std::string ssManifest = sstreamManifest.str();
+
+    // Serialize the index
+    sdv::pointer<uint8_t> ptrIndex;
+    sdv::serializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> serializer;
+    serializer.attach(std::move(ptrIndex));
+    const uint8_t rguiSignature[] = { 'S', 'D', 'V', '_', 'I', 'D', 'X', '2' };
+    for (uint8_t uiSignature : rguiSignature)
+        serializer << uiSignature;
+    serializer << static_cast<uint32_t>(sdv::GetPlatformEndianess());
+    serializer << static_cast<uint32_t>(SDVFrameworkInterfaceVersion);
+    serializer << static_cast<uint64_t>(ssManifest.size());
+    serializer << ManifestChecksum(ssManifest);
+    serializer << sdv::u8string(m_ssInstallName);
+    serializer << m_optDeltaBase.has_value();
+    if (m_optDeltaBase)
+        serializer << m_optDeltaBase->uiMajor << m_optDeltaBase->uiMinor << m_optDeltaBase->uiPatch;
+    serializer << static_cast<uint32_t>(m_mapProperties.size());
+    for (const auto& rvtProperty : m_mapProperties)
+        serializer << sdv::u8string(rvtProperty.first) << sdv::u8string(rvtProperty.second);
+    serializer << static_cast<uint32_t>(m_vecModules.size());
+    for (const SModule& rsModule : m_vecModules)
+    {
+        serializer << sdv::u8string(rsModule.pathRelModule.generic_u8string()) << sdv::u8string(rsModule.ssManifest);
+        serializer << sdv::sequence<sdv::SClassInfo>(rsModule.vecClasses.begin(), rsModule.vecClasses.end());
+        serializer << rsModule.optHash.has_value();
+        if (rsModule.optHash)
+            serializer << rsModule.optHash->uiSize << rsModule.optHash->uiChecksum;
+    }
+    uint32_t uiChecksum = serializer.checksum();
+    serializer << uiChecksum;
+    serializer.detach(ptrIndex);
+
+    // Write the index file; write to a temporary file first, preventing a partial index to be read.
+    std::filesystem::path pathIndex = rpathInstallDir / "install_manifest.idx";
+    std::filesystem::path pathIndexTemp = rpathInstallDir / "install_manifest.idx.tmp";
+    std::ofstream fstreamIndex(pathIndexTemp, std::ios::binary | std::ios::trunc);
+    if (!fstreamIndex.is_open()) return false;
+    fstreamIndex.write(reinterpret_cast<const char*>(ptrIndex.get()), static_cast<std::streamsize>(ptrIndex.size()));
+    fstreamIndex.close();
+    std::error_code ec;
+    if (!fstreamIndex || (std::filesystem::rename(pathIndexTemp, pathIndex, ec), ec))
+    {
+        std::filesystem::remove(pathIndexTemp, ec);
+        return false;
+    }
+    return true;
+}
+
+bool CInstallManifest::LoadIndex(const std::filesystem::path& rpathIndex, const std::string& rssManifest,
+    bool bBlockSystemObjects)
+{
+    Clear();
+    m_bBlockSystemObjects = bBlockSystemObjects;
+
+    // Map the index file
+    CMappedFile fileIndex;
+    if (!fileIndex.Open(rpathIndex) || !fileIndex.Size()) return false;
+
+    try
+    {
+        sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer;
+        deserializer.assign(reinterpret_cast<const uint8_t*>(fileIndex.Data()), fileIndex.Size());
+
+        // Check the signature, the version and whether the index was made for this manifest.
+        const uint8_t rguiSignature[] = { 'S', 'D', 'V', '_', 'I', 'D', 'X', '2' };
+        for (uint8_t uiExpected : rguiSignature)
+        {
+            uint8_t uiSignature = 0;
+            deserializer >> uiSignature;
+            if (uiSignature != uiExpected) return false;
+        }
+        uint32_t uiEndian = 0, uiVersion = 0, uiManifestChecksum = 0;
+        uint64_t uiManifestSize = 0;
+        deserializer >> uiEndian >> uiVersion >> uiManifestSize >> uiManifestChecksum;
+        if (uiEndian != static_cast<uint32_t>(sdv::GetPlatformEndianess()) || uiVersion != SDVFrameworkInterfaceVersion ||
+            uiManifestSize != rssManifest.size() || uiManifestChecksum != ManifestChecksum(rssManifest))
+            return false;
+
+        // Read the content
+        sdv::u8string ssInstallName;
+        deserializer >> ssInstallName;
+        bool bDelta = false;
+        deserializer >> bDelta;
+        std::optional<sdv::installation::SPackageVersion> optDeltaBase;
+        if (bDelta)
+        {
+            sdv::installation::SPackageVersion sBaseVersion{};
+            deserializer >> sBaseVersion.uiMajor >> sBaseVersion.uiMinor >> sBaseVersion.uiPatch;
+            optDeltaBase = sBaseVersion;
+        }
+        uint32_t uiPropertyCount = 0;
+        deserializer >> uiPropertyCount;
+        std::map<std::string, std::string> mapProperties;
+        for (uint32_t uiIndex = 0; uiIndex < uiPropertyCount; uiIndex++)
+        {
+            sdv::u8string ssName, ssValue;
+            deserializer >> ssName >> ssValue;
+            mapProperties[ssName] = ssValue;
+        }
+        uint32_t uiModuleCount = 0;
+        deserializer >> uiModuleCount;
+        std::vector<SModule> vecModules;
+        for (uint32_t uiIndex = 0; uiIndex < uiModuleCount; uiIndex++)
+        {
+            sdv::u8string ssPath, ssModuleManifest;
+            sdv::sequence<sdv::SClassInfo> seqClasses;
+            deserializer >> ssPath >> ssModuleManifest >> seqClasses;
+            bool bHash = false;
+            deserializer >> bHash;
+            std::optional<SContentHash> optHash;
+            if (bHash)
+            {
+                SContentHash sHash;
+                deserializer >> sHash.uiSize >> sHash.uiChecksum;
+                optHash = sHash;
+            }
+            std::vector<sdv::SClassInfo> vecClasses;
+            for (sdv::SClassInfo& rsClass : seqClasses)
+            {
+                if (bBlockSystemObjects && rsClass.eType == sdv::EObjectType::system_object) continue;
+                vecClasses.push_back(std::move(rsClass));
+            }
+            vecModules.emplace_back(std::filesystem::u8path(static_cast<std::string>(ssPath)), ssModuleManifest,
+                std::move(vecClasses));
+            vecModules.back().optHash = optHash;
+        }
+
+        // Check the index checksum
+        uint32_t uiChecksum = deserializer.checksum();
+        uint32_t uiStoredChecksum = 0;
+        deserializer >> uiStoredChecksum;
+        if (uiChecksum != uiStoredChecksum || ssInstallName.empty()) return false;
+
+        // Take over the content
+        m_ssInstallName = ssInstallName;
+        m_optDeltaBase = optDeltaBase;
+        for (const auto& rvtProperty : mapProperties)
+            m_mapProperties[rvtProperty.first] = rvtProperty.second;
+        for (SModule& rsModule : vecModules)
+            AddModuleEntry(std::move(rsModule));
+    }
+    catch (const sdv::XSysExcept&)
+    {
+        // Corrupt or truncated index
+        Clear();
+        return false;
+    }
+    catch (const std::exception&)
+    {
+        Clear();
+        return false;
+    }
+
+    return true;
+}
+
 bool CInstallManifest::Read(const std::string& rssManifest, bool bBlockSystemObjects /*= false*/)
 {
     Clear();
@@ -256,6 +432,11 @@ bool CInstallManifest::Read(const std::string& rssManifest, bool bBlockSystemObj
     m_ssInstallName = nodeRoot.GetDirect("Installation.Name").GetValueAsString();
     if (m_ssInstallName.empty()) return false;
 
+    // Get the base version if the manifest belongs to a delta package.
+    sdv::toml::CNode nodeDeltaBase = nodeRoot.GetDirect("Installation.DeltaBase");
+    if (nodeDeltaBase)
+        m_optDeltaBase = InterpretVersionString(nodeDeltaBase.GetValueAsString());
+
     // Get installation properties. The properties are optional
     sdv::toml::CNodeCollection nodeProperties = nodeRoot.GetDirect("Properties");
     for (size_t nIndex = 0; nIndex < nodeProperties.GetCount(); nIndex++)
@@ -282,8 +463,20 @@ bool CInstallManifest::Read(const std::string& rssManifest, bool bBlockSystemObj
         sdv::toml::CNodeCollection nodeClasses = nodeModule.GetDirect("Class");
         if (nodeClasses) ssModuleManifest = nodeClasses.GetTOML();
 
+        // Get the content hash (if available).
+        SModule sModule(pathModule, ssModuleManifest, m_bBlockSystemObjects);
+        sdv::toml::CNode nodeSize = nodeModule.GetDirect("Size");
+        sdv::toml::CNode nodeChecksum = nodeModule.GetDirect("Checksum");
+        if (nodeSize && nodeChecksum)
+        {
+            SContentHash sHash;
+            sHash.uiSize = nodeSize.GetValue();
+            sHash.uiChecksum = nodeChecksum.GetValue();
+            sModule.optHash = sHash;
+        }
+
         // Add the module
-        m_vecModules.push_back(SModule(pathModule, ssModuleManifest, m_bBlockSystemObjects));
+        AddModuleEntry(std::move(sModule));
     }
 
     return true;
@@ -297,7 +490,11 @@ std::string CInstallManifest::Write() const
 
     // Add the installation section
     sstream << "[Installation]" << std::endl << "Version = " << SDVFrameworkSubbuildVersion << std::endl << "Name = \"" <<
-        m_ssInstallName << "\"" << std::endl << std::endl;
+        m_ssInstallName << "\"" << std::endl;
+    if (m_optDeltaBase)
+        sstream << "DeltaBase = \"" << m_optDeltaBase->uiMajor << "." << m_optDeltaBase->uiMinor << "." <<
+            m_optDeltaBase->uiPatch << "\"" << std::endl;
+    sstream << std::endl;
 
     // Add the properties section (if there are any properties)
     if (!m_mapProperties.empty())
@@ -318,6 +515,8 @@ std::string CInstallManifest::Write() const
     for (const SModule& rsEntry : m_vecModules)
     {
         sstream << "[[Module]]" << std::endl << "Path=\"" << rsEntry.pathRelModule.generic_u8string() << "\"" << std::endl;
+        if (rsEntry.optHash)
+            sstream << "Size = " << rsEntry.optHash->uiSize << std::endl << "Checksum = " << rsEntry.optHash->uiChecksum << std::endl;
 
         // Read the module manifest
         toml_parser::CParser parser(rsEntry.ssManifest);
@@ -354,6 +553,8 @@ bool CInstallManifest::AddModule(const std::filesystem::path& rpathModulePath,
         auto ptrInterfaceNode = parser.Root().Direct("Interface.Version");
         if (!ptrInterfaceNode) return false;
         if (ptrInterfaceNode->GetValue() != SDVFrameworkInterfaceVersion) return false;
+        auto ptrLayoutNode = parser.Root().Direct("Interface.Layout");
+        if (!ptrLayoutNode || ptrLayoutNode->GetValue() != SDVFrameworkLayoutVersion) return false;
         auto ptrComponentsNode = parser.Root().Direct("Class");
         if (!ptrComponentsNode) return true;    // No component available in the manifest
         if (!ptrComponentsNode->Cast<toml_parser::CArray>()) return false;
@@ -362,8 +563,7 @@ bool CInstallManifest::AddModule(const std::filesystem::path& rpathModulePath,
 
     // Store path and component
     std::filesystem::path pathRelModule = (rpathRelTargetDir / rpathModulePath.filename()).lexically_normal();
-    m_vecModules.push_back(SModule(pathRelModule,
-        ssComponentsManifest, m_bBlockSystemObjects));
+    AddModuleEntry(SModule(pathRelModule, ssComponentsManifest, m_bBlockSystemObjects));
 
     return true;
 }
@@ -374,9 +574,7 @@ std::filesystem::path CInstallManifest::FindModule(const std::filesystem::path&
         return {};
 
     // Search for the correct module
-    auto itModule = std::find_if(
-        m_vecModules.begin(), m_vecModules.end(), [&](const SModule& rsEntry) { return rsEntry.pathRelModule == rpathRelModule; });
-    if (itModule != m_vecModules.end())
+    if (m_mapModules.find(ModuleKey(rpathRelModule)) != m_mapModules.end())
         return m_pathInstallDir / rpathRelModule;
     return {};
 }
@@ -387,35 +585,18 @@ std::string CInstallManifest::FindModuleManifest(const std::filesystem::path& rp
         return {};
 
     // Search for the correct module
-    auto itModule = std::find_if(
-        m_vecModules.begin(), m_vecModules.end(), [&](const SModule& rsEntry) { return rsEntry.pathRelModule == rpathRelModule; });
-    if (itModule != m_vecModules.end())
-        return itModule->ssManifest;
+    auto itModule = m_mapModules.find(ModuleKey(rpathRelModule));
+    if (itModule != m_mapModules.end())
+        return m_vecModules[itModule->second].ssManifest;
     return {};
 }
 
 std::optional<sdv::SClassInfo> CInstallManifest::FindComponentByClass(const std::string& rssClass) const
 {
-    // Search for the correct module
-    sdv::SClassInfo sRet{};
-    auto itModule = std::find_if(m_vecModules.begin(), m_vecModules.end(), [&](const SModule& rsEntry)
-        {
-            return std::find_if(rsEntry.vecClasses.begin(), rsEntry.vecClasses.end(),
-                [&](const sdv::SClassInfo& sClass)
-                {
-                    // Note, use the class, alias and the default object name for searching...
-                    if (sClass.ssName == rssClass ||
-                        std::find(sClass.seqClassAliases.begin(), sClass.seqClassAliases.end(), rssClass) !=
-                            sClass.seqClassAliases.end())
-                    {
-                        sRet = sClass;
-                        return true;
-                    }
-                    return false;
-                }) != rsEntry.vecClasses.end();
-        });
-    if (itModule != m_vecModules.end()) return sRet;
-    return {};
+    // Search for the class using the class name and the aliases
+    auto itClass = m_mapClasses.find(rssClass);
+    if (itClass == m_mapClasses.end()) return {};
+    return m_vecModules[itClass->second.first].vecClasses[itClass->second.second];
 }
 
 std::vector<sdv::SClassInfo> CInstallManifest::ClassList() const
@@ -458,6 +639,41 @@ std::optional<std::string> CInstallManifest::Property(const std::string& rssName
     return itProperty->second;
 }
 
+bool CInstallManifest::ModuleHash(const std::filesystem::path& rpathRelModule, const SContentHash& rsHash)
+{
+    auto itModule = m_mapModules.find(ModuleKey(rpathRelModule));
+    if (itModule == m_mapModules.end()) return false;
+    m_vecModules[itModule->second].optHash = rsHash;
+    return true;
+}
+
+std::optional<CInstallManifest::SContentHash> CInstallManifest::ModuleHash(const std::filesystem::path& rpathRelModule) const
+{
+    auto itModule = m_mapModules.find(ModuleKey(rpathRelModule));
+    if (itModule == m_mapModules.end()) return {};
+    return m_vecModules[itModule->second].optHash;
+}
+
+void CInstallManifest::SetDeltaBase(sdv::installation::SPackageVersion sBaseVersion)
+{
+    m_optDeltaBase = sBaseVersion;
+}
+
+void CInstallManifest::ResetDeltaBase()
+{
+    m_optDeltaBase.reset();
+}
+
+std::optional<sdv::installation::SPackageVersion> CInstallManifest::DeltaBase() const
+{
+    return m_optDeltaBase;
+}
+
+std::string CInstallManifest::ModuleKey(const std::filesystem::path& rpathRelModule)
+{
+    return rpathRelModule.lexically_normal().generic_u8string();
+}
+
 bool CInstallManifest::NeedQuotedName(const std::string& rssName)
 {
     for (char c : rssName)
@@ -468,6 +684,32 @@ bool CInstallManifest::NeedQuotedName(const std::string& rssName)
     return false;
 }
 
+uint32_t CInstallManifest::ManifestChecksum(const std::string& rssManifest)
+{
+    sdv::crcCRC32C crc;
+    return crc.calc_checksum(reinterpret_cast<const uint8_t*>(rssManifest.data()), rssManifest.size());
+}
+
+void CInstallManifest::AddModuleEntry(SModule&& rsModule)
+{
+    size_t nModuleIndex = m_vecModules.size();
+    m_mapModules.emplace(ModuleKey(rsModule.pathRelModule), nModuleIndex);
+    for (size_t nClassIndex = 0; nClassIndex < rsModule.vecClasses.size(); nClassIndex++)
+    {
+        // Existing entries are not replaced; the first definition of a class or alias is found.
+        const sdv::SClassInfo& rsClass = rsModule.vecClasses[nClassIndex];
+        m_mapClasses.emplace(rsClass.ssName, std::make_pair(nModuleIndex, nClassIndex));
+        for (const auto& rssAlias : rsClass.seqClassAliases)
+            m_mapClasses.emplace(rssAlias, std::make_pair(nModuleIndex, nClassIndex));
+    }
+    m_vecModules.push_back(std::move(rsModule));
+}
+
+CInstallManifest::SModule::SModule(const std::filesystem::path& rpathRelModule, const std::string& rssManifest,
+    std::vector<sdv::SClassInfo>&& rvecClasses) :
+    pathRelModule(rpathRelModule), ssManifest(rssManifest), vecClasses(std::move(rvecClasses))
+{}
+
 CInstallManifest::SModule::SModule(const std::filesystem::path& rpathRelModule, const std::string& rssManifest,
     bool bBlockSystemObjects) : pathRelModule(rpathRelModule), ssManifest(rssManifest)
 {
@@ -22,6 +22,7 @@
 #include <interfaces/config.h>
 #include "toml_parser/parser_toml.h"
 #include <map>
+#include <unordered_map>
 #include <cstdlib>
 
 /**
@@ -127,6 +128,8 @@ inline bool RefersToRelativeParent(const std::filesystem::path& rpathRelative)
  * 
  * [[Module]]
  * Path = "mallard.sdv                  # Relative path to the module
+ * Size = 25088                         # Optional size of the module file
+ * Checksum = 3735928559                # Optional checksum (CRC32C) of the module file content
  *
  * [[Module.Class]]                     # Component manifest
  * Class = "Mallard class"              # The name of the class
@@ -142,6 +145,14 @@ inline bool RefersToRelativeParent(const std::filesystem::path& rpathRelative)
  * [[Module]]                           # Another module
  * Path = "large/greylag_goose.sdv      # Relative path to the module
  * @endcode
+ * A delta installation package contains only the files that changed compared to a previous installation. The manifest of such
+ * package lists all files of the installation and identifies the version of the installation it is based on:
+ * @code
+ * [Installation]
+ * Version = 100
+ * Name = "Duck"
+ * DeltaBase = "0.1.2"                  # Version of the installation the delta is based on.
+ * @endcode
  * @remarks The installation directory path is used to create relative paths to the modules. It is not stored in the manifest
  * itself allowing the manifest to be copied from one location to another as long as the relative path to the modules is maintained
  * (meaning copying the modules along with the manifest).
@@ -149,6 +160,25 @@ inline bool RefersToRelativeParent(const std::filesystem::path& rpathRelative)
 class CInstallManifest
 {
 public:
+    /**
+     * @brief Content hash of a file within the installation. Used to detect which files changed between installations.
+     */
+    struct SContentHash
+    {
+        uint64_t    uiSize = 0;         ///< Size of the file.
+        uint32_t    uiChecksum = 0;     ///< Checksum (CRC32C) of the file content.
+
+        /**
+         * @brief Equality operator.
+         * @param[in] rsHash Reference to the hash to compare with.
+         * @return Returns whether both hashes are identical.
+         */
+        bool operator==(const SContentHash& rsHash) const
+        {
+            return uiSize == rsHash.uiSize && uiChecksum == rsHash.uiChecksum;
+        }
+    };
+
     /**
      * @brief Default constructor.
      */
@@ -206,6 +236,18 @@ public:
      */
     bool Save(const std::filesystem::path& rpathInstallDir) const;
 
+    /**
+     * @brief Save the binary index of the manifest ("install_manifest.idx") next to the manifest TOML file.
+     * @details The index contains the modules, module manifests and classes in serialized form and is memory-mapped by Load
+     * instead of parsing the manifest TOML and all module manifests. The index stores the size and checksum of the manifest TOML
+     * file it was created for; an outdated or corrupt index is ignored by Load.
+     * @pre The manifest TOML file was saved in the installation directory. Manifests loaded with blocked system objects cannot
+     * be indexed.
+     * @param[in] rpathInstallDir Reference to the installation directory.
+     * @return Returns whether saving the index was successful.
+     */
+    bool SaveIndex(const std::filesystem::path& rpathInstallDir) const;
+
     /**
      * @brief Read a manifest TOML string.
      * @param[in] rssManifest Reference to the string containing the manifest.
@@ -270,6 +312,45 @@ public:
      */
     std::vector<std::pair<std::string, std::string>> PropertyList() const;
 
+    /**
+     * @brief Set the content hash of a module.
+     * @param[in] rpathRelModule Reference to the path containing the relative path to a module.
+     * @param[in] rsHash Reference to the content hash of the module file.
+     * @return Returns whether the module was found.
+     */
+    bool ModuleHash(const std::filesystem::path& rpathRelModule, const SContentHash& rsHash);
+
+    /**
+     * @brief Get the content hash of a module.
+     * @param[in] rpathRelModule Reference to the path containing the relative path to a module.
+     * @return Returns the content hash if the module was found and a hash was stored for the module.
+     */
+    std::optional<SContentHash> ModuleHash(const std::filesystem::path& rpathRelModule) const;
+
+    /**
+     * @brief Mark the manifest as manifest of a delta package.
+     * @param[in] sBaseVersion The version of the installation the delta package is based on.
+     */
+    void SetDeltaBase(sdv::installation::SPackageVersion sBaseVersion);
+
+    /**
+     * @brief Remove the delta package marking (the manifest describes a complete installation).
+     */
+    void ResetDeltaBase();
+
+    /**
+     * @brief Get the version of the installation the delta package is based on.
+     * @return Returns the base version if the manifest belongs to a delta package or no value if not.
+     */
+    std::optional<sdv::installation::SPackageVersion> DeltaBase() const;
+
+    /**
+     * @brief Get the key used to look up a module path.
+     * @param[in] rpathRelModule Reference to the path containing the relative path to a module.
+     * @return The normalized module path in generic format.
+     */
+    static std::string ModuleKey(const std::filesystem::path& rpathRelModule);
+
     /**
      * @brief Set a property value.
      * @details Set a property value, which will be included in the installation manifest. The properties "Description" and
@@ -296,6 +377,22 @@ private:
     */
     static bool NeedQuotedName(const std::string& rssName);
 
+    /**
+     * @brief Calculate the checksum of the manifest TOML used to validate the binary index.
+     * @param[in] rssManifest Reference to the string containing the manifest.
+     * @return The CRC32C checksum of the manifest.
+     */
+    static uint32_t ManifestChecksum(const std::string& rssManifest);
+
+    /**
+     * @brief Load the binary index of the manifest.
+     * @param[in] rpathIndex Reference to the path of the index file.
+     * @param[in] rssManifest Reference to the string containing the manifest TOML the index must belong to.
+     * @param[in] bBlockSystemObjects When set, system objects are not stored in the repository.
+     * @return Returns whether the index was valid and could be loaded. If not, the manifest is cleared.
+     */
+    bool LoadIndex(const std::filesystem::path& rpathIndex, const std::string& rssManifest, bool bBlockSystemObjects);
+
     /**
      * @brief Manifest information belonging to the module.
      */
@@ -309,17 +406,38 @@ private:
          */
         SModule(const std::filesystem::path& rpathRelModule, const std::string& rssManifest, bool bBlockSystemObjects);
 
+        /**
+         * @brief Constructor using already extracted class information.
+         * @param[in] rpathRelModule Reference to the relative module path.
+         * @param[in] rssManifest Reference to the manifest file.
+         * @param[in] rvecClasses Reference to the vector with the contained component classes.
+         */
+        SModule(const std::filesystem::path& rpathRelModule, const std::string& rssManifest,
+            std::vector<sdv::SClassInfo>&& rvecClasses);
+
         std::filesystem::path           pathRelModule;      ///< Relative module path (relative to the installation directory).
         std::string                     ssManifest;         ///< Manifest containing the component classes.
         std::vector<sdv::SClassInfo>    vecClasses;         ///< Vector with contained component classes.
+        std::optional<SContentHash>     optHash;            ///< Content hash of the module file (if known).
     };
 
+    /**
+     * @brief Add the module to the module list and to the module and class lookup maps.
+     * @param[in] rsModule Reference to the module to add.
+     */
+    void AddModuleEntry(SModule&& rsModule);
+
     std::string                         m_ssInstallName;                ///< Installation name.
     mutable std::filesystem::path       m_pathInstallDir;               ///< Installation directory when install manifest was
                                                                         ///< loaded or saved.
     bool                                m_bBlockSystemObjects = false;  ///< When set, do not store system objects.
     std::vector<SModule>                m_vecModules;                   ///< Vector containing the modules.
+    std::unordered_map<std::string, size_t> m_mapModules;               ///< Module key to index in the module vector.
+    std::unordered_map<std::string, std::pair<size_t, size_t>> m_mapClasses; ///< Class name and aliases to the index of the module
+                                                                        ///< and of the class within the module. The first
+                                                                        ///< definition is used.
     std::map<std::string, std::string>  m_mapProperties;                ///< Property map.
+    std::optional<sdv::installation::SPackageVersion> m_optDeltaBase;   ///< Base version when describing a delta package.
 };
 
 /**
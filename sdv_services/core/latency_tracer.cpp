@@ -0,0 +1,135 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "latency_tracer.h"
+#include "app_settings.h"
+#include <support/latency_trace.h>
+#include "../../global/latencytrace/latency_trace_buffer.cpp"
+
+namespace
+{
+    /// Interval between attempts to connect to a monitor (ns).
+    const uint64_t uiConnectInterval = 1000000000ull;
+
+    /**
+     * @brief Trace state of a thread.
+     */
+    struct SThreadTrace
+    {
+        /**
+         * @brief Destructor; releases the ring for other threads.
+         */
+        ~SThreadTrace()
+        {
+            if (pBuffer) pBuffer->ReleaseRing(uiRing);
+        }
+
+        uint64_t                uiTraceID = 0;                                  ///< Current trace ID.
+        CLatencyTraceBuffer*    pBuffer = nullptr;                              ///< Buffer the ring was claimed from.
+        uint32_t                uiRing = CLatencyTraceBuffer::nRingCount;       ///< Claimed ring.
+    };
+
+    /// Trace state of the calling thread.
+    thread_local SThreadTrace tlsTrace;
+}
+
+CLatencyTracer& GetLatencyTracer()
+{
+    static CLatencyTracer latency_tracer;
+    return latency_tracer;
+}
+
+uint32_t CLatencyTracer::RegisterTraceName(/*in*/ const sdv::u8string& ssName)
+{
+    uint32_t uiKey = sdv::core::GetLatencyTraceKey(ssName);
+    std::unique_lock<std::mutex> lock(m_mtxConnect);
+    if (m_mapNames.emplace(uiKey, ssName).second)
+    {
+        CLatencyTraceBuffer* pBuffer = m_pBuffer.load(std::memory_order_acquire);
+        if (pBuffer) pBuffer->AddName(uiKey, ssName);
+    }
+    return uiKey;
+}
+
+uint64_t CLatencyTracer::StartTrace(/*in*/ sdv::core::ETraceStage eStage, /*in*/ uint32_t uiKey)
+{
+    SLatencyTraceEvent sEvent;
+    sEvent.uiTimestamp = CLatencyTraceBuffer::GetTimestamp();
+    CLatencyTraceBuffer* pBuffer = GetBuffer(sEvent.uiTimestamp);
+    tlsTrace.uiTraceID = pBuffer ? pBuffer->NewTraceID() : 0;
+    if (!tlsTrace.uiTraceID) return 0;
+    sEvent.uiTraceID = tlsTrace.uiTraceID;
+    sEvent.uiStage = static_cast<uint32_t>(eStage);
+    sEvent.uiKey = uiKey;
+    Record(pBuffer, sEvent);
+    return tlsTrace.uiTraceID;
+}
+
+void CLatencyTracer::TracePoint(/*in*/ sdv::core::ETraceStage eStage, /*in*/ uint32_t uiKey)
+{
+    if (!tlsTrace.uiTraceID) return;
+    SLatencyTraceEvent sEvent;
+    sEvent.uiTimestamp = CLatencyTraceBuffer::GetTimestamp();
+    CLatencyTraceBuffer* pBuffer = GetBuffer(sEvent.uiTimestamp);
+    if (!pBuffer) return;
+    sEvent.uiTraceID = tlsTrace.uiTraceID;
+    sEvent.uiStage = static_cast<uint32_t>(eStage);
+    sEvent.uiKey = uiKey;
+    Record(pBuffer, sEvent);
+}
+
+uint64_t CLatencyTracer::GetTraceID() const
+{
+    return tlsTrace.uiTraceID;
+}
+
+void CLatencyTracer::SetTraceID(/*in*/ uint64_t uiTraceID)
+{
+    tlsTrace.uiTraceID = uiTraceID;
+}
+
+CLatencyTraceBuffer* CLatencyTracer::GetBuffer(uint64_t uiTimestamp)
+{
+    CLatencyTraceBuffer* pBuffer = m_pBuffer.load(std::memory_order_acquire);
+    if (pBuffer && pBuffer->IsActive(uiTimestamp)) return pBuffer;
+    if (uiTimestamp < m_uiNextConnect.load(std::memory_order_relaxed)) return nullptr;
+
+    // Only one thread tries to connect; the other threads don't wait.
+    std::unique_lock<std::mutex> lock(m_mtxConnect, std::try_to_lock);
+    if (!lock.owns_lock() || uiTimestamp < m_uiNextConnect.load(std::memory_order_relaxed)) return nullptr;
+    m_uiNextConnect.store(uiTimestamp + uiConnectInterval, std::memory_order_relaxed);
+
+    // The previous buffer is not deleted; threads might still be writing to it.
+    CLatencyTraceBuffer* pNewBuffer = new CLatencyTraceBuffer(GetAppSettings().GetInstanceID());
+    if (!pNewBuffer->Open())
+    {
+        delete pNewBuffer;
+        return nullptr;
+    }
+    for (const auto& rvtName : m_mapNames)
+        pNewBuffer->AddName(rvtName.first, rvtName.second);
+    m_pBuffer.store(pNewBuffer, std::memory_order_release);
+    return pNewBuffer;
+}
+
+void CLatencyTracer::Record(CLatencyTraceBuffer* pBuffer, const SLatencyTraceEvent& rsEvent)
+{
+    // Claim a ring in a new buffer
+    if (tlsTrace.pBuffer != pBuffer)
+    {
+        if (tlsTrace.pBuffer) tlsTrace.pBuffer->ReleaseRing(tlsTrace.uiRing);
+        tlsTrace.pBuffer = pBuffer;
+        tlsTrace.uiRing = pBuffer->ClaimRing();
+    }
+    pBuffer->Record(tlsTrace.uiRing, rsEvent);
+}
@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef LATENCY_TRACER_H
+#define LATENCY_TRACER_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <interfaces/log.h>
+#include <support/component_impl.h>
+#include "../../global/latencytrace/latency_trace_buffer.h"
+
+/**
+ * @brief Latency tracer service recording the trace points of the signal path into the buffer of the latency monitor.
+ * @details Trace points are only recorded while a monitor (sdv_trace_mon --latency) is attached to the instance; otherwise a
+ * trace point costs a few instructions. The buffer is looked up at most once per second. Each thread keeps its current trace ID
+ * and writes into a ring of its own. Buffers of previous monitor sessions are kept mapped, since threads might still be
+ * writing to them; they are released when the process ends.
+ */
+class CLatencyTracer : public sdv::IInterfaceAccess, public sdv::core::ILatencyTrace
+{
+public:
+    BEGIN_SDV_INTERFACE_MAP()
+        SDV_INTERFACE_ENTRY(sdv::core::ILatencyTrace)
+    END_SDV_INTERFACE_MAP()
+
+    /**
+     * @brief Register a name for the trace points. Overload of sdv::core::ILatencyTrace::RegisterTraceName.
+     * @param[in] ssName The name to register.
+     * @return The key to use with the trace points.
+     */
+    virtual uint32_t RegisterTraceName(/*in*/ const sdv::u8string& ssName) override;
+
+    /**
+     * @brief Start a new trace for the current thread. Overload of sdv::core::ILatencyTrace::StartTrace.
+     * @param[in] eStage The stage of the trace point.
+     * @param[in] uiKey The key of the trace point.
+     * @return The trace ID or 0 when no monitor is attached.
+     */
+    virtual uint64_t StartTrace(/*in*/ sdv::core::ETraceStage eStage, /*in*/ uint32_t uiKey) override;
+
+    /**
+     * @brief Record a trace point for the trace of the current thread. Overload of sdv::core::ILatencyTrace::TracePoint.
+     * @param[in] eStage The stage of the trace point.
+     * @param[in] uiKey The key of the trace point.
+     */
+    virtual void TracePoint(/*in*/ sdv::core::ETraceStage eStage, /*in*/ uint32_t uiKey) override;
+
+    /**
+     * @brief Get the trace ID of the current thread. Overload of sdv::core::ILatencyTrace::GetTraceID.
+     * @return The trace ID or 0 when no trace is active.
+     */
+    virtual uint64_t GetTraceID() const override;
+
+    /**
+     * @brief Set the trace ID of the current thread. Overload of sdv::core::ILatencyTrace::SetTraceID.
+     * @param[in] uiTraceID The trace ID or 0 to end the trace.
+     */
+    virtual void SetTraceID(/*in*/ uint64_t uiTraceID) override;
+
+private:
+    /**
+     * @brief Get the buffer of the attached monitor. Connects to a new monitor at most once per second.
+     * @param[in] uiTimestamp The current timestamp.
+     * @return Pointer to the buffer or NULL when no monitor is attached.
+     */
+    CLatencyTraceBuffer* GetBuffer(uint64_t uiTimestamp);
+
+    /**
+     * @brief Record an event in the ring of the calling thread.
+     * @param[in] pBuffer Pointer to the buffer.
+     * @param[in] rsEvent Reference to the event.
+     */
+    static void Record(CLatencyTraceBuffer* pBuffer, const SLatencyTraceEvent& rsEvent);
+
+    std::atomic<CLatencyTraceBuffer*>   m_pBuffer{nullptr};         ///< Buffer of the attached monitor.
+    std::atomic_uint64_t                m_uiNextConnect{0};         ///< Timestamp of the next connection attempt.
+    std::mutex                          m_mtxConnect;               ///< Protects connecting and the names.
+    std::map<uint32_t, std::string>     m_mapNames;                 ///< Registered names; published to every new monitor.
+};
+
+/**
+ * @brief Return the latency tracer.
+ * @return Reference to the latency tracer.
+ */
+CLatencyTracer& GetLatencyTracer();
+
+#endif // !defined LATENCY_TRACER_H
@@ -12,6 +12,102 @@
  ********************************************************************************/
 
 #include "memory.h"
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#ifdef MEMORY_TRACKER
+#include <iostream>
+#endif
+
+namespace
+{
+    /**
+     * @brief Header preceding every allocation. The size of the header keeps the alignment of the C runtime allocations.
+     */
+    struct SBlockHeader
+    {
+        uint32_t    uiClass;        ///< Size class or CMemoryManager::m_nSizeClassCount when not pooled.
+        uint32_t    uiMagic;        ///< Magic value to detect illegal requests.
+        uint64_t    uiSize;         ///< Requested size (bytes).
+    };
+    static_assert(sizeof(SBlockHeader) == 16);
+
+    /// Magic value of an allocated block.
+    const uint32_t uiMagicAllocated = 0x4D564453;   // 'SDVM'
+
+    /// Magic value of a freed block.
+    const uint32_t uiMagicFreed = 0x45455246;       // 'FREE'
+
+    /// Block sizes of the size classes.
+    constexpr std::array<size_t, CMemoryManager::m_nSizeClassCount> rgnClassSizes = {
+        16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096 };
+
+    /// Largest size served from the pools.
+    constexpr size_t nMaxClassSize = rgnClassSizes.back();
+
+    /**
+     * @brief Create the lookup table of the size classes; one entry per 16 bytes.
+     * @return The lookup table.
+     */
+    constexpr std::array<uint8_t, nMaxClassSize / 16 + 1> CreateClassLookup()
+    {
+        std::array<uint8_t, nMaxClassSize / 16 + 1> rguiLookup{};
+        size_t nClass = 0;
+        for (size_t nIndex = 0; nIndex < rguiLookup.size(); nIndex++)
+        {
+            while (rgnClassSizes[nClass] < nIndex * 16) nClass++;
+            rguiLookup[nIndex] = static_cast<uint8_t>(nClass);
+        }
+        return rguiLookup;
+    }
+
+    /// Lookup table of the size classes.
+    constexpr std::array<uint8_t, nMaxClassSize / 16 + 1> rguiClassLookup = CreateClassLookup();
+
+    /**
+     * @brief Get the size class of an allocation.
+     * @param[in] nSize The size of the allocation.
+     * @return The size class or CMemoryManager::m_nSizeClassCount when exceeding the largest size class.
+     */
+    inline size_t GetSizeClass(size_t nSize)
+    {
+        return nSize <= nMaxClassSize ? rguiClassLookup[(nSize + 15) / 16] : CMemoryManager::m_nSizeClassCount;
+    }
+
+    /**
+     * @brief Amount of blocks exchanged between a thread cache and the central pool at once. A thread caches at most two batches.
+     * @param[in] nClass The size class.
+     * @return The batch size.
+     */
+    inline size_t GetBatchSize(size_t nClass)
+    {
+        // Target around 16 kB per batch with at least 4 and at most 64 blocks.
+        size_t nBlocks = 16384 / (rgnClassSizes[nClass] + sizeof(SBlockHeader));
+        return nBlocks < 4 ? 4 : (nBlocks > 64 ? 64 : nBlocks);
+    }
+
+    /**
+     * @brief Get the block header of an allocation.
+     * @param[in] pData Pointer to the allocation.
+     * @return Pointer to the header.
+     */
+    inline SBlockHeader* GetHeader(void* pData)
+    {
+        return reinterpret_cast<SBlockHeader*>(reinterpret_cast<uint8_t*>(pData) - sizeof(SBlockHeader));
+    }
+
+    /**
+     * @brief Update an atomic maximum value.
+     * @param[in, out] riMax Reference to the maximum.
+     * @param[in] iValue The value to compare with.
+     */
+    inline void UpdateMax(std::atomic_int64_t& riMax, int64_t iValue)
+    {
+        int64_t iMax = riMax.load(std::memory_order_relaxed);
+        while (iValue > iMax && !riMax.compare_exchange_weak(iMax, iValue, std::memory_order_relaxed)) {}
+    }
+}
 
 CMemoryManager& GetMemoryManager()
 {
@@ -24,58 +120,340 @@ sdv::pointer<uint8_t> CMemoryManager::Allocate(uint32_t uiLength)
     return sdv::internal::make_ptr<uint8_t>(this, uiLength);
 }
 
+sdv::core::SMemoryStatistics CMemoryManager::GetMemoryStatistics() const
+{
+    // Sum the counters of all threads
+    uint64_t rguiAllocs[m_nSizeClassCount + 1] = {};
+    uint64_t rguiFrees[m_nSizeClassCount + 1] = {};
+    auto fnAdd = [&](const SThreadCounters& rsCounters)
+    {
+        for (size_t nClass = 0; nClass <= m_nSizeClassCount; nClass++)
+        {
+            rguiAllocs[nClass] += rsCounters.rguiAllocs[nClass].load(std::memory_order_relaxed);
+            rguiFrees[nClass] += rsCounters.rguiFrees[nClass].load(std::memory_order_relaxed);
+        }
+    };
+    fnAdd(m_sSharedCounters);
+    for (const SThreadCounters* psCounters = m_psCounters.load(); psCounters; psCounters = psCounters->psNext)
+        fnAdd(*psCounters);
+
+    sdv::core::SMemoryStatistics sStatistics{};
+    for (size_t nClass = 0; nClass <= m_nSizeClassCount; nClass++)
+    {
+        sdv::core::SMemorySizeClassStatistics sClass{};
+        sClass.uiAllocations = rguiAllocs[nClass];
+        sClass.uiFrees = rguiFrees[nClass];
+        sClass.uiInUse = rguiAllocs[nClass] > rguiFrees[nClass] ? rguiAllocs[nClass] - rguiFrees[nClass] : 0;
+        if (nClass < m_nSizeClassCount)
+        {
+            sClass.uiBlockSize = static_cast<uint32_t>(rgnClassSizes[nClass]);
+            sClass.uiPoolBlocks = m_rgsPools[nClass].uiPoolBlocks;
+            sClass.uiHighWater = m_rgsPools[nClass].uiHighWater;
+        }
+        else
+            sClass.uiHighWater = static_cast<uint64_t>(m_iLargeHighWater.load());
+        sStatistics.seqSizeClasses.push_back(sClass);
+    }
+    sStatistics.uiPoolBytes = m_uiPoolBytes;
+    sStatistics.uiLargeBytes = static_cast<uint64_t>(std::max<int64_t>(m_iLargeBytes.load(), 0));
+    sStatistics.uiLargeBytesHighWater = static_cast<uint64_t>(m_iLargeBytesHighWater.load());
+    return sStatistics;
+}
+
 void* CMemoryManager::Alloc(size_t nSize)
 {
-    void* pAlloc = malloc(nSize);
-#ifdef MEMORY_TRACKER
-    std::unique_lock<std::mutex> lock(m_mtxTracker);
-    if (pAlloc)
-        m_mapTracker.insert(std::make_pair(pAlloc, nSize));
-#endif
-    return pAlloc;
+    size_t nClass = GetSizeClass(nSize);
+    void* pBlock = nullptr;
+    if (nClass < m_nSizeClassCount)
+        pBlock = AllocBlock(nClass);
+    else
+    {
+        pBlock = malloc(sizeof(SBlockHeader) + nSize);
+        if (pBlock) CountLarge(static_cast<int64_t>(nSize), 1);
+    }
+    if (!pBlock) return nullptr;
+
+    SBlockHeader* psHeader = reinterpret_cast<SBlockHeader*>(pBlock);
+    psHeader->uiClass = static_cast<uint32_t>(nClass);
+    psHeader->uiMagic = uiMagicAllocated;
+    psHeader->uiSize = nSize;
+    Count(nClass, true);
+    return psHeader + 1;
 }
 
 void* CMemoryManager::Realloc(void* pData, size_t nSize)
 {
+    if (!pData) return Alloc(nSize);
+
+    SBlockHeader* psHeader = GetHeader(pData);
 #ifdef MEMORY_TRACKER
-    std::unique_lock<std::mutex> lock(m_mtxTracker);
-    auto itAlloc = m_mapTracker.find(pData);
-    if (pData && itAlloc == m_mapTracker.end())
+    if (psHeader->uiMagic != uiMagicAllocated)
     {
         std::cout << "Illegal request for resizing memory at location 0x" << (void*)pData << std::endl;
         return nullptr;
     }
-    lock.unlock();
 #endif
 
-    void* pAlloc = realloc(pData, nSize);
+    // Still fitting in the block?
+    size_t nClass = psHeader->uiClass;
+    if (nClass < m_nSizeClassCount && nSize <= rgnClassSizes[nClass])
+    {
+        psHeader->uiSize = nSize;
+        return pData;
+    }
 
-#ifdef MEMORY_TRACKER
-    if (pAlloc)
+    // Resize an allocation exceeding the largest size class in place.
+    if (nClass == m_nSizeClassCount && GetSizeClass(nSize) == m_nSizeClassCount)
     {
-        lock.lock();
-        m_mapTracker.erase(pData);
-        m_mapTracker.insert(std::make_pair(pAlloc, nSize));
+        size_t nOldSize = static_cast<size_t>(psHeader->uiSize);
+        SBlockHeader* psNewHeader = reinterpret_cast<SBlockHeader*>(realloc(psHeader, sizeof(SBlockHeader) + nSize));
+        if (!psNewHeader) return nullptr;
+        CountLarge(static_cast<int64_t>(nSize) - static_cast<int64_t>(nOldSize), 0);
+        psNewHeader->uiSize = nSize;
+        return psNewHeader + 1;
     }
-#endif
 
-    return pAlloc;
+    // Move to another size class
+    void* pNewData = Alloc(nSize);
+    if (!pNewData) return nullptr;
+    std::memcpy(pNewData, pData, std::min(static_cast<size_t>(psHeader->uiSize), nSize));
+    Free(pData);
+    return pNewData;
 }
 
 void CMemoryManager::Free(void* pData)
 {
+    if (!pData) return;
+
+    SBlockHeader* psHeader = GetHeader(pData);
 #ifdef MEMORY_TRACKER
-    std::unique_lock<std::mutex> lock(m_mtxTracker);
-    auto itAlloc = m_mapTracker.find(pData);
-    if (itAlloc == m_mapTracker.end())
+    if (psHeader->uiMagic != uiMagicAllocated)
     {
         std::cout << "Illegal request for freeing memory at location 0x" << (void*)pData << std::endl;
         return;
     }
-    else
-        m_mapTracker.erase(itAlloc);
-    lock.unlock();
 #endif
+    psHeader->uiMagic = uiMagicFreed;
+
+    size_t nClass = psHeader->uiClass;
+    Count(nClass, false);
+    if (nClass < m_nSizeClassCount)
+        FreeBlock(psHeader, nClass);
+    else
+    {
+        CountLarge(-static_cast<int64_t>(psHeader->uiSize), -1);
+        free(psHeader);
+    }
+}
+
+CMemoryManager::SThreadCache* CMemoryManager::GetThreadCache()
+{
+    // Trivially destructible; accessible during the whole lifetime of the thread.
+    static thread_local SThreadCache* psThreadCache = nullptr;
+    static thread_local bool bReleased = false;
+    if (psThreadCache || bReleased) return psThreadCache;
 
-    free(pData);
+    /**
+     * @brief Owner of the thread cache; releases the cache when the thread ends.
+     */
+    struct SOwner
+    {
+        /**
+         * @brief Constructor; creates the cache.
+         * @param[in] rMemMgr Reference to the memory manager.
+         */
+        SOwner(CMemoryManager& rMemMgr) : m_rMemMgr(rMemMgr)
+        {
+            psThreadCache = new SThreadCache;
+
+            // Reuse the counters of an ended thread or add new counters.
+            for (SThreadCounters* psCounters = m_rMemMgr.m_psCounters.load(); psCounters; psCounters = psCounters->psNext)
+            {
+                bool bInUse = false;
+                if (psCounters->bInUse.compare_exchange_strong(bInUse, true))
+                {
+                    psThreadCache->psCounters = psCounters;
+                    return;
+                }
+            }
+            SThreadCounters* psCounters = new SThreadCounters;
+            psCounters->bInUse = true;
+            while (m_rMemMgr.m_flagCounters.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+            psCounters->psNext = m_rMemMgr.m_psCounters.load();
+            m_rMemMgr.m_psCounters = psCounters;
+            m_rMemMgr.m_flagCounters.clear(std::memory_order_release);
+            psThreadCache->psCounters = psCounters;
+        }
+
+        /**
+         * @brief Destructor; releases the cache.
+         */
+        ~SOwner()
+        {
+            SThreadCache* psCache = psThreadCache;
+            psThreadCache = nullptr;
+            bReleased = true;
+            m_rMemMgr.ReleaseThreadCache(psCache);
+        }
+
+        CMemoryManager& m_rMemMgr;      ///< Reference to the memory manager.
+    };
+    static thread_local SOwner sOwner(*this);
+    return psThreadCache;
+}
+
+void CMemoryManager::ReleaseThreadCache(SThreadCache* psCache)
+{
+    if (!psCache) return;
+    for (size_t nClass = 0; nClass < m_nSizeClassCount; nClass++)
+    {
+        SFreeBlock* psFirst = psCache->rgpsFree[nClass];
+        if (!psFirst) continue;
+        SFreeBlock* psLast = psFirst;
+        while (psLast->pNext) psLast = psLast->pNext;
+        ReturnBatch(nClass, psFirst, psLast, psCache->rgnFree[nClass]);
+    }
+
+    // The counters stay in the list and are reused by the next thread.
+    if (psCache->psCounters) psCache->psCounters->bInUse = false;
+    delete psCache;
+}
+
+void* CMemoryManager::AllocBlock(size_t nClass)
+{
+    SThreadCache* psCache = GetThreadCache();
+    if (!psCache)
+    {
+        // The thread is ending; take a single block from the central pool.
+        SFreeBlock* psList = nullptr;
+        size_t nCount = FetchBatch(nClass, psList);
+        if (!nCount) return nullptr;
+        SFreeBlock* psBlock = psList;
+        psList = psList->pNext;
+        if (psList)
+        {
+            SFreeBlock* psLast = psList;
+            while (psLast->pNext) psLast = psLast->pNext;
+            ReturnBatch(nClass, psList, psLast, nCount - 1);
+        }
+        return psBlock;
+    }
+
+    if (!psCache->rgpsFree[nClass])
+    {
+        psCache->rgnFree[nClass] = FetchBatch(nClass, psCache->rgpsFree[nClass]);
+        if (!psCache->rgnFree[nClass]) return nullptr;
+    }
+    SFreeBlock* psBlock = psCache->rgpsFree[nClass];
+    psCache->rgpsFree[nClass] = psBlock->pNext;
+    psCache->rgnFree[nClass]--;
+    return psBlock;
+}
+
+void CMemoryManager::FreeBlock(void* pBlock, size_t nClass)
+{
+    SFreeBlock* psBlock = reinterpret_cast<SFreeBlock*>(pBlock);
+    SThreadCache* psCache = GetThreadCache();
+    if (!psCache)
+    {
+        // The thread is ending; return the block directly.
+        psBlock->pNext = nullptr;
+        ReturnBatch(nClass, psBlock, psBlock, 1);
+        return;
+    }
+
+    psBlock->pNext = psCache->rgpsFree[nClass];
+    psCache->rgpsFree[nClass] = psBlock;
+    psCache->rgnFree[nClass]++;
+
+    // Return a batch when the cache holds more than two batches.
+    size_t nBatchSize = GetBatchSize(nClass);
+    if (psCache->rgnFree[nClass] > 2 * nBatchSize)
+    {
+        SFreeBlock* psFirst = psCache->rgpsFree[nClass];
+        SFreeBlock* psLast = psFirst;
+        for (size_t n = 1; n < nBatchSize; n++) psLast = psLast->pNext;
+        psCache->rgpsFree[nClass] = psLast->pNext;
+        psCache->rgnFree[nClass] -= nBatchSize;
+        psLast->pNext = nullptr;
+        ReturnBatch(nClass, psFirst, psLast, nBatchSize);
+    }
+}
+
+size_t CMemoryManager::FetchBatch(size_t nClass, SFreeBlock*& rpsList)
+{
+    SCentralPool& rsPool = m_rgsPools[nClass];
+    size_t nBatchSize = GetBatchSize(nClass);
+    size_t nCount = 0;
+
+    // Take the blocks from the free list
+    while (rsPool.flagLock.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+    SFreeBlock* psFirst = rsPool.psFree;
+    SFreeBlock* psLast = nullptr;
+    for (SFreeBlock* psBlock = psFirst; psBlock && nCount < nBatchSize; psBlock = psBlock->pNext)
+    {
+        psLast = psBlock;
+        nCount++;
+    }
+    if (psLast)
+    {
+        rsPool.psFree = psLast->pNext;
+        psLast->pNext = nullptr;
+    }
+    rsPool.flagLock.clear(std::memory_order_release);
+
+    if (!nCount)
+    {
+        // Create new blocks; the memory is kept by the pool.
+        size_t nBlockSize = sizeof(SBlockHeader) + rgnClassSizes[nClass];
+        uint8_t* pSlab = reinterpret_cast<uint8_t*>(malloc(nBlockSize * nBatchSize));
+        if (!pSlab) return 0;
+        psFirst = nullptr;
+        for (size_t n = nBatchSize; n > 0; n--)
+        {
+            SFreeBlock* psBlock = reinterpret_cast<SFreeBlock*>(pSlab + (n - 1) * nBlockSize);
+            psBlock->pNext = psFirst;
+            psFirst = psBlock;
+        }
+        nCount = nBatchSize;
+        rsPool.uiPoolBlocks += nBatchSize;
+        m_uiPoolBytes += nBlockSize * nBatchSize;
+    }
+
+    uint64_t uiOutstanding = rsPool.uiOutstanding += nCount;
+    uint64_t uiHighWater = rsPool.uiHighWater.load(std::memory_order_relaxed);
+    while (uiOutstanding > uiHighWater && !rsPool.uiHighWater.compare_exchange_weak(uiHighWater, uiOutstanding)) {}
+
+    rpsList = psFirst;
+    return nCount;
+}
+
+void CMemoryManager::ReturnBatch(size_t nClass, SFreeBlock* psFirst, SFreeBlock* psLast, size_t nCount)
+{
+    SCentralPool& rsPool = m_rgsPools[nClass];
+    while (rsPool.flagLock.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+    psLast->pNext = rsPool.psFree;
+    rsPool.psFree = psFirst;
+    rsPool.flagLock.clear(std::memory_order_release);
+    rsPool.uiOutstanding -= nCount;
+}
+
+void CMemoryManager::Count(size_t nClass, bool bAlloc)
+{
+    SThreadCache* psCache = GetThreadCache();
+    if (psCache && psCache->psCounters)
+    {
+        // Only written by this thread; no read-modify-write needed.
+        std::atomic_uint64_t& ruiCounter = bAlloc ? psCache->psCounters->rguiAllocs[nClass] :
+            psCache->psCounters->rguiFrees[nClass];
+        ruiCounter.store(ruiCounter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    else
+        (bAlloc ? m_sSharedCounters.rguiAllocs[nClass] : m_sSharedCounters.rguiFrees[nClass])++;
+}
+
+void CMemoryManager::CountLarge(int64_t iBytes, int64_t iCount)
+{
+    UpdateMax(m_iLargeBytesHighWater, m_iLargeBytes += iBytes);
+    if (iCount) UpdateMax(m_iLargeHighWater, m_iLargeInUse += iCount);
 }
@@ -14,8 +14,8 @@
 #ifndef MEMORY_H
 #define MEMORY_H
 
-#include <map>
-#include <mutex>
+#include <atomic>
+#include <cstdint>
 
 #include <support/pointer.h>
 #include <interfaces/mem.h>
@@ -24,12 +24,20 @@
 
 /**
 * @brief Memory Manager service
+* @details Allocations up to the largest size class are served from pools of fixed size blocks. Each thread caches a limited amount
+* of free blocks per size class, which allows allocating and freeing without synchronization. Blocks are exchanged in batches with
+* the central pool of the class, which is protected by a spin lock. Larger allocations are passed to the C runtime. Every
+* allocation is preceded by a block header holding the size class and the requested size.
+* The pools are never returned to the system and all members are trivially destructible; memory can still be freed while the
+* process is shutting down.
 */
-class CMemoryManager : public sdv::core::IMemoryAlloc, public sdv::IInterfaceAccess, public sdv::internal::IInternalMemAlloc
+class CMemoryManager : public sdv::core::IMemoryAlloc, public sdv::core::IMemoryStatistics, public sdv::IInterfaceAccess,
+    public sdv::internal::IInternalMemAlloc
 {
 public:
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::core::IMemoryAlloc)
+        SDV_INTERFACE_ENTRY(sdv::core::IMemoryStatistics)
     END_SDV_INTERFACE_MAP()
 
     /**
@@ -39,6 +47,15 @@ public:
     */
     virtual sdv::pointer<uint8_t> Allocate(/*in*/ uint32_t uiLength) override;
 
+    /**
+     * @brief Get the allocation statistics. Overload of sdv::core::IMemoryStatistics::GetMemoryStatistics.
+     * @return The statistics.
+     */
+    virtual sdv::core::SMemoryStatistics GetMemoryStatistics() const override;
+
+    /// Amount of size classes.
+    static constexpr size_t m_nSizeClassCount = 16;
+
 private:
     /**
     * @brief Allocate memory. Overload of internal::IInternalMemAlloc::Alloc.
@@ -61,10 +78,115 @@ private:
     */
     virtual void Free(void* pData) override;
 
-#ifdef MEMORY_TRACKER
-    std::mutex m_mtxTracker;                    ///< Synchronize map access
-    std::map<void*, size_t> m_mapTracker;       ///< Memory manager allocation tracker
-#endif
+    /**
+     * @brief Free block; the link is stored in the block memory.
+     */
+    struct SFreeBlock
+    {
+        SFreeBlock*     pNext;              ///< Next free block.
+    };
+
+    /**
+     * @brief Central pool of a size class.
+     */
+    struct SCentralPool
+    {
+        std::atomic_flag        flagLock = ATOMIC_FLAG_INIT;    ///< Spin lock protecting the free list.
+        SFreeBlock*             psFree = nullptr;               ///< List of free blocks.
+        std::atomic_uint64_t    uiPoolBlocks{0};                ///< Amount of blocks created.
+        std::atomic_uint64_t    uiOutstanding{0};               ///< Amount of blocks taken from the pool.
+        std::atomic_uint64_t    uiHighWater{0};                 ///< Maximum amount of blocks taken from the pool.
+    };
+
+    /**
+     * @brief Allocation counters of a thread. Only written by the owning thread; the counters are kept after the thread ended and
+     * reused by the next thread.
+     */
+    struct SThreadCounters
+    {
+        std::atomic_uint64_t    rguiAllocs[m_nSizeClassCount + 1] = {};     ///< Allocations per size class.
+        std::atomic_uint64_t    rguiFrees[m_nSizeClassCount + 1] = {};      ///< Frees per size class.
+        std::atomic_bool        bInUse{false};                              ///< Set when owned by a thread.
+        SThreadCounters*        psNext = nullptr;                           ///< Next counters in the list.
+    };
+
+    /**
+     * @brief Thread cache with free blocks per size class.
+     */
+    struct SThreadCache
+    {
+        SFreeBlock*             rgpsFree[m_nSizeClassCount] = {};           ///< Free blocks per size class.
+        size_t                  rgnFree[m_nSizeClassCount] = {};            ///< Amount of free blocks per size class.
+        SThreadCounters*        psCounters = nullptr;                       ///< Allocation counters of the thread.
+    };
+
+    /**
+     * @brief Get the cache of the calling thread. The cache is created at the first call and released to the central pools when
+     * the thread ends.
+     * @return Pointer to the cache or NULL when the thread is ending.
+     */
+    SThreadCache* GetThreadCache();
+
+    /**
+     * @brief Return the blocks of a thread cache to the central pools and release the counters.
+     * @param[in] psCache Pointer to the cache.
+     */
+    void ReleaseThreadCache(SThreadCache* psCache);
+
+    /**
+     * @brief Allocate a block of a size class.
+     * @param[in] nClass The size class.
+     * @return Pointer to the block (including the block header) or NULL when the allocation failed.
+     */
+    void* AllocBlock(size_t nClass);
+
+    /**
+     * @brief Free a block of a size class.
+     * @param[in] pBlock Pointer to the block (including the block header).
+     * @param[in] nClass The size class.
+     */
+    void FreeBlock(void* pBlock, size_t nClass);
+
+    /**
+     * @brief Take a batch of free blocks from the central pool. Creates new blocks if the pool is empty.
+     * @param[in] nClass The size class.
+     * @param[out] rpsList Reference to the list receiving the blocks.
+     * @return The amount of blocks taken; 0 when the allocation of new blocks failed.
+     */
+    size_t FetchBatch(size_t nClass, SFreeBlock*& rpsList);
+
+    /**
+     * @brief Return a list of free blocks to the central pool.
+     * @param[in] nClass The size class.
+     * @param[in] psFirst Pointer to the first block of the list.
+     * @param[in] psLast Pointer to the last block of the list.
+     * @param[in] nCount Amount of blocks in the list.
+     */
+    void ReturnBatch(size_t nClass, SFreeBlock* psFirst, SFreeBlock* psLast, size_t nCount);
+
+    /**
+     * @brief Count an allocation or free in the counters of the calling thread.
+     * @param[in] nClass The size class or m_nSizeClassCount for the allocations exceeding the largest size class.
+     * @param[in] bAlloc Set for an allocation, cleared for a free.
+     */
+    void Count(size_t nClass, bool bAlloc);
+
+    /**
+     * @brief Account for an allocation exceeding the largest size class.
+     * @param[in] iBytes The amount of bytes allocated (positive) or freed (negative).
+     * @param[in] iCount The change of the amount of allocations in use.
+     */
+    void CountLarge(int64_t iBytes, int64_t iCount);
+
+    SCentralPool                m_rgsPools[m_nSizeClassCount];              ///< Central pools per size class.
+    std::atomic_flag            m_flagCounters = ATOMIC_FLAG_INIT;          ///< Spin lock protecting the counter list.
+    std::atomic<SThreadCounters*> m_psCounters{nullptr};                    ///< List of thread counters.
+    SThreadCounters             m_sSharedCounters;                          ///< Counters of threads that are ending.
+    std::atomic_uint64_t        m_uiPoolBytes{0};                           ///< Amount of memory reserved by the pools.
+    std::atomic_int64_t         m_iLargeBytes{0};                           ///< Memory allocated outside the pools.
+    std::atomic_int64_t         m_iLargeBytesHighWater{0};                  ///< Maximum memory allocated outside the pools.
+    std::atomic_int64_t         m_iLargeInUse{0};                           ///< Allocations in use outside the pools.
+    std::atomic_int64_t         m_iLargeHighWater{0};                       ///< Maximum allocations in use outside the pools.
 };
 
 /**
@@ -73,4 +195,4 @@ private:
  */
 CMemoryManager& GetMemoryManager();
 
-#endif // !define MEMORY_H
\ No newline at end of file
+#endif // !define MEMORY_H
@@ -0,0 +1,274 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "metrics_registry.h"
+#include "memory.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+CMetricsRegistry& GetMetricsRegistry()
+{
+    static CMetricsRegistry metrics_registry;
+    return metrics_registry;
+}
+
+uint32_t CMetricsRegistry::RegisterMetric(/*in*/ const sdv::u8string& ssName, /*in*/ const sdv::u8string& ssHelp,
+    /*in*/ sdv::core::EMetricType eType, /*in*/ const sdv::sequence<uint64_t>& seqBounds)
+{
+    if (ssName.empty()) return 0;
+
+    std::unique_lock<std::mutex> lock(m_mtxRegister);
+    auto itName = m_mapNames.find(ssName);
+    if (itName != m_mapNames.end())
+        return GetMetric(itName->second, eType) ? itName->second : 0;
+
+    // Determine the amount of cells
+    size_t nCells = 0;
+    switch (eType)
+    {
+    case sdv::core::EMetricType::counter:
+        nCells = 1;
+        break;
+    case sdv::core::EMetricType::gauge:
+        break;
+    case sdv::core::EMetricType::histogram:
+        if (seqBounds.size() > m_nMaxBuckets) return 0;
+        if (!std::is_sorted(seqBounds.begin(), seqBounds.end())) return 0;
+        nCells = seqBounds.size() + 2;     // Buckets, bucket exceeding the largest bound and the sum
+        break;
+    default:
+        return 0;
+    }
+    uint32_t uiIndex = m_uiMetricCount.load(std::memory_order_relaxed);
+    if (uiIndex >= m_nMaxMetrics || m_nCellCount + nCells > m_nMaxCells) return 0;
+
+    SMetricDef* psMetric = new SMetricDef;
+    psMetric->ssName = ssName;
+    psMetric->ssHelp = ssHelp;
+    psMetric->eType = eType;
+    if (eType == sdv::core::EMetricType::histogram)
+        psMetric->vecBounds.assign(seqBounds.begin(), seqBounds.end());
+    psMetric->nCell = m_nCellCount;
+    m_nCellCount += nCells;
+
+    // Publish the definition
+    m_rgpsMetrics[uiIndex].store(psMetric, std::memory_order_release);
+    m_uiMetricCount.store(uiIndex + 1, std::memory_order_release);
+    m_mapNames.emplace(ssName, uiIndex + 1);
+    return uiIndex + 1;
+}
+
+void CMetricsRegistry::AddCounter(/*in*/ uint32_t uiID, /*in*/ uint64_t uiValue)
+{
+    SMetricDef* psMetric = GetMetric(uiID, sdv::core::EMetricType::counter);
+    if (psMetric) AddToCell(psMetric->nCell, uiValue);
+}
+
+void CMetricsRegistry::SetGauge(/*in*/ uint32_t uiID, /*in*/ int64_t iValue)
+{
+    SMetricDef* psMetric = GetMetric(uiID, sdv::core::EMetricType::gauge);
+    if (psMetric) psMetric->iValue.store(iValue, std::memory_order_relaxed);
+}
+
+void CMetricsRegistry::AddGauge(/*in*/ uint32_t uiID, /*in*/ int64_t iValue)
+{
+    SMetricDef* psMetric = GetMetric(uiID, sdv::core::EMetricType::gauge);
+    if (psMetric) psMetric->iValue.fetch_add(iValue, std::memory_order_relaxed);
+}
+
+void CMetricsRegistry::Observe(/*in*/ uint32_t uiID, /*in*/ uint64_t uiValue)
+{
+    SMetricDef* psMetric = GetMetric(uiID, sdv::core::EMetricType::histogram);
+    if (!psMetric) return;
+    size_t nBucket = static_cast<size_t>(std::lower_bound(psMetric->vecBounds.begin(), psMetric->vecBounds.end(), uiValue) -
+        psMetric->vecBounds.begin());
+    AddToCell(psMetric->nCell + nBucket, 1);
+    AddToCell(psMetric->nCell + psMetric->vecBounds.size() + 1, uiValue);
+}
+
+uint64_t CMetricsRegistry::RegisterCollector(/*in*/ sdv::IInterfaceAccess* pCollector)
+{
+    sdv::core::IMetricsCollector* pCollectorIfc = pCollector ? pCollector->GetInterface<sdv::core::IMetricsCollector>() : nullptr;
+    if (!pCollectorIfc) return 0;
+    std::unique_lock<std::mutex> lock(m_mtxCollectors);
+    uint64_t uiCookie = m_uiNextCookie++;
+    m_mapCollectors.emplace(uiCookie, pCollectorIfc);
+    return uiCookie;
+}
+
+void CMetricsRegistry::UnregisterCollector(/*in*/ uint64_t uiCookie)
+{
+    // The collectors are called with the lock held; after the removal, the collector is not called any more.
+    std::unique_lock<std::mutex> lock(m_mtxCollectors);
+    m_mapCollectors.erase(uiCookie);
+}
+
+sdv::core::SMetricsSnapshot CMetricsRegistry::GetMetricsSnapshot() const
+{
+    // Collecting updates the metric values, which are not part of the state of the registry.
+    const_cast<CMetricsRegistry*>(this)->Collect();
+
+    sdv::core::SMetricsSnapshot sSnapshot{};
+    sSnapshot.uiTimestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+
+    // Sum the cells of all threads
+    std::unique_lock<std::mutex> lock(m_mtxRegister);
+    std::vector<uint64_t> vecCells(m_nCellCount, 0);
+    for (const SThreadCells* psCells = m_psCells.load(); psCells; psCells = psCells->psNext)
+    {
+        for (size_t nCell = 0; nCell < vecCells.size(); nCell++)
+            vecCells[nCell] += psCells->rguiCells[nCell].load(std::memory_order_relaxed);
+    }
+
+    // Create the metrics ordered by name
+    for (const auto& rvtName : m_mapNames)
+    {
+        const SMetricDef* psMetric = m_rgpsMetrics[rvtName.second - 1].load(std::memory_order_acquire);
+        if (!psMetric) continue;
+        sdv::core::SMetric sMetric{};
+        sMetric.ssName = psMetric->ssName;
+        sMetric.ssHelp = psMetric->ssHelp;
+        sMetric.eType = psMetric->eType;
+        switch (psMetric->eType)
+        {
+        case sdv::core::EMetricType::counter:
+            sMetric.iValue = static_cast<int64_t>(vecCells[psMetric->nCell]) + psMetric->iValue.load(std::memory_order_relaxed);
+            break;
+        case sdv::core::EMetricType::gauge:
+            sMetric.iValue = psMetric->iValue.load(std::memory_order_relaxed);
+            break;
+        case sdv::core::EMetricType::histogram:
+            for (size_t nBucket = 0; nBucket <= psMetric->vecBounds.size(); nBucket++)
+            {
+                sMetric.uiCount += vecCells[psMetric->nCell + nBucket];
+                sdv::core::SMetricBucket sBucket{};
+                sBucket.uiUpperBound = nBucket < psMetric->vecBounds.size() ? psMetric->vecBounds[nBucket] : UINT64_MAX;
+                sBucket.uiCount = sMetric.uiCount;
+                sMetric.seqBuckets.push_back(sBucket);
+            }
+            sMetric.uiSum = vecCells[psMetric->nCell + psMetric->vecBounds.size() + 1];
+            break;
+        default:
+            break;
+        }
+        sSnapshot.seqMetrics.push_back(std::move(sMetric));
+    }
+    return sSnapshot;
+}
+
+CMetricsRegistry::SMetricDef* CMetricsRegistry::GetMetric(uint32_t uiID, sdv::core::EMetricType eType) const
+{
+    if (!uiID || uiID > m_nMaxMetrics) return nullptr;
+    SMetricDef* psMetric = m_rgpsMetrics[uiID - 1].load(std::memory_order_acquire);
+    return psMetric && psMetric->eType == eType ? psMetric : nullptr;
+}
+
+CMetricsRegistry::SThreadCells* CMetricsRegistry::GetThreadCells()
+{
+    // Trivially destructible; accessible during the whole lifetime of the thread.
+    static thread_local SThreadCells* psThreadCells = nullptr;
+    static thread_local bool bReleased = false;
+    if (psThreadCells || bReleased) return psThreadCells;
+
+    /**
+     * @brief Owner of the thread cells; releases the cells when the thread ends.
+     */
+    struct SOwner
+    {
+        /**
+         * @brief Constructor; assigns the cells.
+         * @param[in] rRegistry Reference to the metrics registry.
+         */
+        SOwner(CMetricsRegistry& rRegistry)
+        {
+            // Reuse the cells of an ended thread or add new cells.
+            for (SThreadCells* psCells = rRegistry.m_psCells.load(); psCells; psCells = psCells->psNext)
+            {
+                bool bInUse = false;
+                if (psCells->bInUse.compare_exchange_strong(bInUse, true))
+                {
+                    psThreadCells = psCells;
+                    return;
+                }
+            }
+            SThreadCells* psCells = new SThreadCells;
+            psCells->bInUse = true;
+            while (rRegistry.m_flagCells.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+            psCells->psNext = rRegistry.m_psCells.load();
+            rRegistry.m_psCells = psCells;
+            rRegistry.m_flagCells.clear(std::memory_order_release);
+            psThreadCells = psCells;
+        }
+
+        /**
+         * @brief Destructor; releases the cells. The cells stay in the list and are reused by the next thread.
+         */
+        ~SOwner()
+        {
+            if (psThreadCells) psThreadCells->bInUse = false;
+            psThreadCells = nullptr;
+            bReleased = true;
+        }
+    };
+    static thread_local SOwner sOwner(*this);
+    return psThreadCells;
+}
+
+void CMetricsRegistry::AddToCell(size_t nCell, uint64_t uiValue)
+{
+    SThreadCells* psCells = GetThreadCells();
+    if (!psCells) return;
+
+    // Only the owning thread writes the cell; no read-modify-write operation needed.
+    std::atomic_uint64_t& ruiCell = psCells->rguiCells[nCell];
+    ruiCell.store(ruiCell.load(std::memory_order_relaxed) + uiValue, std::memory_order_relaxed);
+}
+
+void CMetricsRegistry::Collect()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mtxCollectors);
+        for (const auto& rvtCollector : m_mapCollectors)
+            rvtCollector.second->CollectMetrics();
+    }
+    CollectMemoryMetrics();
+}
+
+void CMetricsRegistry::CollectMemoryMetrics()
+{
+    // Set the collected value of a metric
+    auto fnSet = [this](const std::string& rssName, const std::string& rssHelp, sdv::core::EMetricType eType, uint64_t uiValue)
+    {
+        uint32_t uiID = RegisterMetric(rssName, rssHelp, eType, {});
+        SMetricDef* psMetric = GetMetric(uiID, eType);
+        if (psMetric) psMetric->iValue.store(static_cast<int64_t>(uiValue), std::memory_order_relaxed);
+    };
+
+    sdv::core::SMemoryStatistics sStatistics = GetMemoryManager().GetMemoryStatistics();
+    for (const sdv::core::SMemorySizeClassStatistics& rsClass : sStatistics.seqSizeClasses)
+    {
+        std::string ssLabel = "{block_size=\"" + (rsClass.uiBlockSize ? std::to_string(rsClass.uiBlockSize) : "large") + "\"}";
+        fnSet("sdv_memory_allocations_total" + ssLabel, "Amount of allocations of the memory manager per size class.",
+            sdv::core::EMetricType::counter, rsClass.uiAllocations);
+        fnSet("sdv_memory_in_use" + ssLabel, "Amount of allocations of the memory manager in use per size class.",
+            sdv::core::EMetricType::gauge, rsClass.uiInUse);
+    }
+    fnSet("sdv_memory_pool_bytes", "Memory reserved by the pools of the memory manager (bytes).",
+        sdv::core::EMetricType::gauge, sStatistics.uiPoolBytes);
+    fnSet("sdv_memory_large_bytes", "Memory allocated outside the pools of the memory manager (bytes).",
+        sdv::core::EMetricType::gauge, sStatistics.uiLargeBytes);
+    fnSet("sdv_memory_large_bytes_high_water", "Maximum memory allocated outside the pools of the memory manager (bytes).",
+        sdv::core::EMetricType::gauge, sStatistics.uiLargeBytesHighWater);
+}
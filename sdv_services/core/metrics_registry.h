@@ -0,0 +1,206 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef METRICS_REGISTRY_H
+#define METRICS_REGISTRY_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <interfaces/metrics.h>
+#include <support/component_impl.h>
+
+/**
+ * @brief Metrics registry service.
+ * @details Every metric gets one or more cells: a counter one cell, a histogram one cell per bucket and one for the sum. Each
+ * thread updating metrics owns a block with all cells, which it updates without synchronization; the snapshot sums the cells
+ * of all blocks. Blocks of ended threads are reused by the next thread, which keeps the sums intact. Gauges are not summable
+ * and are kept centrally. The metric definitions are never removed; the ID of a metric stays valid for the lifetime of the
+ * process.
+ */
+class CMetricsRegistry : public sdv::IInterfaceAccess, public sdv::core::IMetrics, public sdv::core::IMetricsSnapshot
+{
+public:
+    BEGIN_SDV_INTERFACE_MAP()
+        SDV_INTERFACE_ENTRY(sdv::core::IMetrics)
+        SDV_INTERFACE_ENTRY(sdv::core::IMetricsSnapshot)
+    END_SDV_INTERFACE_MAP()
+
+    /// Maximum amount of metrics.
+    static constexpr size_t m_nMaxMetrics = 1024;
+
+    /// Amount of cells per thread block.
+    static constexpr size_t m_nMaxCells = 4096;
+
+    /// Maximum amount of buckets of a histogram (excluding the bucket for the values exceeding the largest bound).
+    static constexpr size_t m_nMaxBuckets = 32;
+
+    /**
+     * @brief Register a metric. Overload of sdv::core::IMetrics::RegisterMetric.
+     * @param[in] ssName The name of the metric, optionally followed by labels.
+     * @param[in] ssHelp Description of the metric.
+     * @param[in] eType The type of the metric.
+     * @param[in] seqBounds The inclusive upper bounds of the buckets of a histogram in ascending order.
+     * @return The ID of the metric or 0 when the metric could not be registered.
+     */
+    virtual uint32_t RegisterMetric(/*in*/ const sdv::u8string& ssName, /*in*/ const sdv::u8string& ssHelp,
+        /*in*/ sdv::core::EMetricType eType, /*in*/ const sdv::sequence<uint64_t>& seqBounds) override;
+
+    /**
+     * @brief Increase a counter. Overload of sdv::core::IMetrics::AddCounter.
+     * @param[in] uiID The ID of the counter.
+     * @param[in] uiValue The value to add.
+     */
+    virtual void AddCounter(/*in*/ uint32_t uiID, /*in*/ uint64_t uiValue) override;
+
+    /**
+     * @brief Set a gauge. Overload of sdv::core::IMetrics::SetGauge.
+     * @param[in] uiID The ID of the gauge.
+     * @param[in] iValue The new value.
+     */
+    virtual void SetGauge(/*in*/ uint32_t uiID, /*in*/ int64_t iValue) override;
+
+    /**
+     * @brief Increase or decrease a gauge. Overload of sdv::core::IMetrics::AddGauge.
+     * @param[in] uiID The ID of the gauge.
+     * @param[in] iValue The value to add; negative to decrease.
+     */
+    virtual void AddGauge(/*in*/ uint32_t uiID, /*in*/ int64_t iValue) override;
+
+    /**
+     * @brief Add an observation to a histogram. Overload of sdv::core::IMetrics::Observe.
+     * @param[in] uiID The ID of the histogram.
+     * @param[in] uiValue The observed value.
+     */
+    virtual void Observe(/*in*/ uint32_t uiID, /*in*/ uint64_t uiValue) override;
+
+    /**
+     * @brief Register a collector. Overload of sdv::core::IMetrics::RegisterCollector.
+     * @param[in] pCollector Pointer to the object exposing the IMetricsCollector interface.
+     * @return The cookie assigned to the registration or 0 when the registration wasn't successful.
+     */
+    virtual uint64_t RegisterCollector(/*in*/ sdv::IInterfaceAccess* pCollector) override;
+
+    /**
+     * @brief Unregister a collector. Overload of sdv::core::IMetrics::UnregisterCollector.
+     * @param[in] uiCookie The cookie returned by a previous call to the registration function.
+     */
+    virtual void UnregisterCollector(/*in*/ uint64_t uiCookie) override;
+
+    /**
+     * @brief Take a snapshot of the metrics of the process. Overload of sdv::core::IMetricsSnapshot::GetMetricsSnapshot.
+     * @return The snapshot.
+     */
+    virtual sdv::core::SMetricsSnapshot GetMetricsSnapshot() const override;
+
+private:
+    /**
+     * @brief Definition of a metric.
+     */
+    struct SMetricDef
+    {
+        std::string                 ssName;             ///< Name of the metric including the labels.
+        std::string                 ssHelp;             ///< Description.
+        sdv::core::EMetricType      eType = sdv::core::EMetricType::counter;   ///< Type of the metric.
+        std::vector<uint64_t>       vecBounds;          ///< Upper bounds of the buckets of a histogram.
+        size_t                      nCell = 0;          ///< Index of the first cell (counters and histograms).
+        std::atomic_int64_t         iValue{0};          ///< Value of a gauge; for a counter the value collected on request,
+                                                        ///< which is added to the cells.
+    };
+
+    /**
+     * @brief Cells of a thread. Only written by the owning thread; the cells are kept after the thread ended and reused by the
+     * next thread.
+     */
+    struct SThreadCells
+    {
+        std::atomic_uint64_t        rguiCells[m_nMaxCells] = {};    ///< The cells.
+        std::atomic_bool            bInUse{false};                  ///< Set when owned by a thread.
+        SThreadCells*               psNext = nullptr;               ///< Next block in the list.
+    };
+
+    /**
+     * @brief Get the metric definition belonging to an ID.
+     * @param[in] uiID The ID of the metric.
+     * @param[in] eType The expected type of the metric.
+     * @return Pointer to the definition or NULL when the ID is invalid or the metric has another type.
+     */
+    SMetricDef* GetMetric(uint32_t uiID, sdv::core::EMetricType eType) const;
+
+    /**
+     * @brief Get the cells of the calling thread. The cells are assigned at the first call and released when the thread ends.
+     * @remarks The assignment is kept per thread, not per registry; the registry is only used as singleton.
+     * @return Pointer to the cells or NULL when the thread is ending.
+     */
+    SThreadCells* GetThreadCells();
+
+    /**
+     * @brief Add a value to a cell of the calling thread.
+     * @param[in] nCell The index of the cell.
+     * @param[in] uiValue The value to add.
+     */
+    void AddToCell(size_t nCell, uint64_t uiValue);
+
+    /**
+     * @brief Call the collectors and update the metrics of the memory manager. Called before a snapshot is taken.
+     */
+    void Collect();
+
+    /**
+     * @brief Update the metrics of the memory manager.
+     */
+    void CollectMemoryMetrics();
+
+    std::atomic<SMetricDef*>        m_rgpsMetrics[m_nMaxMetrics] = {};      ///< Metric definitions; index is the ID - 1.
+    std::atomic_uint32_t            m_uiMetricCount{0};                     ///< Amount of metrics.
+    size_t                          m_nCellCount = 0;                       ///< Amount of cells in use.
+    mutable std::mutex              m_mtxRegister;                          ///< Protects the registration.
+    std::map<std::string, uint32_t> m_mapNames;                             ///< Map of names to IDs.
+    std::atomic_flag                m_flagCells = ATOMIC_FLAG_INIT;         ///< Spin lock protecting the cell list.
+    std::atomic<SThreadCells*>      m_psCells{nullptr};                     ///< List of thread cells.
+    mutable std::mutex              m_mtxCollectors;                        ///< Protects the collectors.
+    std::map<uint64_t, sdv::core::IMetricsCollector*> m_mapCollectors;      ///< Registered collectors.
+    uint64_t                        m_uiNextCookie = 1;                     ///< Next collector cookie.
+};
+
+/**
+ * @brief Return the metrics registry.
+ * @return Reference to the metrics registry.
+ */
+CMetricsRegistry& GetMetricsRegistry();
+
+/**
+ * @brief Metrics service providing access to the metrics snapshot of the process.
+ */
+class CMetricsService : public sdv::CSdvObject
+{
+public:
+    CMetricsService() = default;
+
+    // Interface map
+    BEGIN_SDV_INTERFACE_MAP()
+        SDV_INTERFACE_ENTRY_MEMBER(sdv::core::IMetricsSnapshot, GetMetricsRegistry())
+    END_SDV_INTERFACE_MAP()
+
+    // Object declarations
+    DECLARE_OBJECT_CLASS_TYPE(sdv::EObjectType::system_object)
+    DECLARE_OBJECT_CLASS_NAME("MetricsService")
+    DECLARE_OBJECT_SINGLETON()
+};
+DEFINE_SDV_OBJECT(CMetricsService)
+
+#endif // !defined METRICS_REGISTRY_H
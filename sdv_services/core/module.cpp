@@ -235,6 +235,19 @@ bool CModuleInst::Load(const std::filesystem::path& rpathModule) noexcept
             return false;
         }
 
+        // Check for the memory layout of the support types - must be equal.
+        auto ptrLayout = parser.Root().Direct("Interface.Layout");
+        uint32_t uiLayout = 0;
+        if (ptrLayout) uiLayout = ptrLayout->GetValue();
+        if (!ptrLayout || uiLayout != SDVFrameworkLayoutVersion)
+        {
+            // Incompatible memory layout.
+            SDV_LOG_ERROR("Error opening SDV module: ", rpathModule.generic_u8string(), " error: incompatible layout ", uiLayout,
+                " (required ", SDVFrameworkLayoutVersion, ")");
+            Unload(true);
+            return false;
+        }
+
         // Get a pointer to the factory for the current interface.
         m_pFactory = sdv::TInterfaceAccessPtr(m_fnGetFactory(SDVFrameworkInterfaceVersion)).GetInterface<sdv::IObjectFactory>();
         if (!m_pFactory)
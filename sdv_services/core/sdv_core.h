@@ -23,6 +23,8 @@
 #include "logger_control.h"
 #include "logger.h"
 #include "app_config.h"
+#include "latency_tracer.h"
+#include "metrics_registry.h"
 
 /**
 * @brief SDV core instance class containing containing the instances for the core services.
@@ -47,6 +49,8 @@ public:
         SDV_INTERFACE_CHAIN_MEMBER(GetMemoryManager())
         SDV_INTERFACE_CHAIN_MEMBER(GetRepository())
         SDV_INTERFACE_CHAIN_MEMBER(GetLoggerControl())
+        SDV_INTERFACE_CHAIN_MEMBER(GetLatencyTracer())
+        SDV_INTERFACE_CHAIN_MEMBER(GetMetricsRegistry())
     END_SDV_INTERFACE_MAP()
 
     /**
@@ -14,19 +14,29 @@
 
 #include "character_reader_utf_8.h"
 #include "exception.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TOML_READER_SSE2
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
 
 /// The TOML parser namespace
 namespace toml_parser
 {
-    CCharacterReaderUTF8::CCharacterReaderUTF8(const std::string& rssString) : m_ssString{rssString}
+    CCharacterReaderUTF8::CCharacterReaderUTF8(std::string_view svString) : m_svString{svString}
     {
         CheckForInvalidUTF8Bytes();
         CheckForInvalidUTF8Sequences();
     }
 
-    void CCharacterReaderUTF8::Feed(const std::string& rssString)
+    void CCharacterReaderUTF8::Feed(std::string_view svString)
     {
-        m_ssString = rssString;
+        m_svString = svString;
         m_nCursor  = 0;
 
         CheckForInvalidUTF8Bytes();
@@ -35,102 +45,145 @@ namespace toml_parser
 
     void CCharacterReaderUTF8::Reset()
     {
-        m_ssString.clear();
+        m_svString = {};
         m_nCursor = 0;
     }
 
     std::string CCharacterReaderUTF8::Peek(size_t nSkip /*= 0*/, size_t nAmount /*= 1*/) const
+    {
+        return std::string(PeekView(nSkip, nAmount));
+    }
+
+    std::string_view CCharacterReaderUTF8::PeekView(size_t nSkip /*= 0*/, size_t nAmount /*= 1*/) const
     {
         if (IsEOF())
             return {};
-        size_t nOffset = 0;
-        for (size_t n = 0; n < nSkip; ++n)
-        {
-            nOffset += GetLengthOfNextCharacter(nOffset);
-            if (m_ssString.size() <= m_nCursor + nOffset)
-                return {};
-        }
-        std::string ssCharacters;
-        for (size_t n = 0; n < nAmount; n++)
-        {
-            ssCharacters += GetNextCharacter(nOffset);
-            nOffset += GetLengthOfNextCharacter(nOffset);
-        }
-        return ssCharacters;
+        size_t nBegin = SkipCharacters(m_nCursor, nSkip);
+        if (nBegin >= m_svString.size())
+            return {};
+        return m_svString.substr(nBegin, SkipCharacters(nBegin, nAmount) - nBegin);
     }
 
     std::string CCharacterReaderUTF8::PeekUntil(const std::vector<std::string>& lstCollection) const
     {
-        size_t nOffset = 0;
-        bool bFound    = false;
-        std::string accumulation;
-        while (!bFound && m_ssString.size() > m_nCursor + nOffset)
+        size_t nPosition = m_nCursor;
+        while (nPosition < m_svString.size())
         {
-            std::string ssCharacter = GetNextCharacter(nOffset);
-            nOffset += GetLengthOfNextCharacter(nOffset);
+            size_t nLength = GetLengthOfCharacter(nPosition);
+            std::string_view svCharacter = m_svString.substr(nPosition, nLength);
+            bool bFound = false;
             for (const auto& delimiter : lstCollection)
             {
-                if (delimiter == ssCharacter)
+                if (delimiter == svCharacter)
                     bFound = true;
             }
-            if (!bFound)
-                accumulation += ssCharacter;
+            if (bFound)
+                break;
+            nPosition += nLength;
         }
-        return accumulation;
+        return std::string(m_svString.substr(m_nCursor, nPosition - m_nCursor));
+    }
+
+    std::string_view CCharacterReaderUTF8::PeekViewUntil(const CByteSet& rsetDelimiters) const
+    {
+        // The delimiters are ASCII characters, which never occur within a multi-byte UTF-8 character. Scanning bytes is
+        // therefore equivalent to scanning characters.
+        size_t nPosition = m_nCursor;
+        while (nPosition < m_svString.size() && !rsetDelimiters.Contains(m_svString[nPosition]))
+            ++nPosition;
+        return m_svString.substr(m_nCursor, nPosition - m_nCursor);
     }
 
     std::string CCharacterReaderUTF8::Consume(size_t nSkip /*= 0*/, size_t nAmount /*= 1*/)
+    {
+        return std::string(ConsumeView(nSkip, nAmount));
+    }
+
+    std::string_view CCharacterReaderUTF8::ConsumeView(size_t nSkip /*= 0*/, size_t nAmount /*= 1*/)
     {
         if (IsEOF())
             return {};
-        for (size_t n = 0; n < nSkip; ++n)
-        {
-            size_t nLength = GetLengthOfNextCharacter();
-            m_nCursor += nLength;
-            if (!nLength || m_ssString.size() < m_nCursor)
-                return {};
-        }
-        std::string ssCharacters;
-        for (size_t n = 0; n < nAmount; n++)
-        {
-            ssCharacters += GetNextCharacter();
-            m_nCursor += GetLengthOfNextCharacter();
-        }
-        return ssCharacters;
+        m_nCursor = SkipCharacters(m_nCursor, nSkip);
+        if (IsEOF())
+            return {};
+        size_t nBegin = m_nCursor;
+        m_nCursor = SkipCharacters(m_nCursor, nAmount);
+        return m_svString.substr(nBegin, m_nCursor - nBegin);
+    }
+
+    std::string_view CCharacterReaderUTF8::ConsumeBytes(size_t nAmount)
+    {
+        if (IsEOF())
+            return {};
+        std::string_view svBytes = m_svString.substr(m_nCursor, nAmount);
+        m_nCursor += svBytes.size();
+        return svBytes;
     }
 
     std::string CCharacterReaderUTF8::ConsumeUntil(const std::vector<std::string>& lstCollection)
     {
+        std::string ssAccumulation = PeekUntil(lstCollection);
+        m_nCursor += ssAccumulation.size();
+        return ssAccumulation;
+    }
+
+    std::string_view CCharacterReaderUTF8::ConsumeViewUntil(const CByteSet& rsetDelimiters)
+    {
+        std::string_view svAccumulation = PeekViewUntil(rsetDelimiters);
+        m_nCursor += svAccumulation.size();
+        return svAccumulation;
+    }
+
+    std::string_view CCharacterReaderUTF8::ConsumeViewUntil(char cDelimiter)
+    {
+        if (IsEOF())
+            return {};
+        const char* pBegin = m_svString.data() + m_nCursor;
+        size_t nRemaining = m_svString.size() - m_nCursor;
+        const void* pFound = std::memchr(pBegin, cDelimiter, nRemaining);
+        size_t nLength = pFound ? static_cast<size_t>(static_cast<const char*>(pFound) - pBegin) : nRemaining;
+        m_nCursor += nLength;
+        return std::string_view(pBegin, nLength);
+    }
+
+    size_t CCharacterReaderUTF8::FindFirstOf(char c1, char c2) const
+    {
+        if (IsEOF())
+            return 0;
+        const char* pBegin = m_svString.data() + m_nCursor;
+        size_t nRemaining = m_svString.size() - m_nCursor;
         size_t nOffset = 0;
-        bool bFound    = false;
-        std::string accumulation;
-        while (!bFound && m_ssString.size() > m_nCursor + nOffset)
+#ifdef TOML_READER_SSE2
+        // Compare 16 bytes at once
+        const __m128i m128Char1 = _mm_set1_epi8(c1);
+        const __m128i m128Char2 = _mm_set1_epi8(c2);
+        for (; nOffset + 16 <= nRemaining; nOffset += 16)
         {
-            std::string ssCharacter = GetNextCharacter(nOffset);
-            nOffset += GetLengthOfNextCharacter(nOffset);
-            for (const auto& delimiter : lstCollection)
-            {
-                if (delimiter == ssCharacter)
-                {
-                    bFound = true;
-                }
-            }
-            if (!bFound)
+            __m128i m128Data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pBegin + nOffset));
+            int iMask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(m128Data, m128Char1), _mm_cmpeq_epi8(m128Data, m128Char2)));
+            if (iMask)
             {
-                accumulation += ssCharacter;
-            }
-            else
-            {
-                nOffset -= ssCharacter.size();
+#ifdef _MSC_VER
+                unsigned long ulIndex = 0;
+                _BitScanForward(&ulIndex, static_cast<unsigned long>(iMask));
+                return nOffset + ulIndex;
+#else
+                return nOffset + static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(iMask)));
+#endif
             }
         }
-        m_nCursor += nOffset;
-        return accumulation;
+#endif
+        for (; nOffset < nRemaining; ++nOffset)
+        {
+            if (pBegin[nOffset] == c1 || pBegin[nOffset] == c2)
+                return nOffset;
+        }
+        return nRemaining;
     }
 
     bool CCharacterReaderUTF8::IsEOF() const
     {
-        return m_ssString.size() < m_nCursor + 1;
+        return m_svString.size() < m_nCursor + 1;
     }
 
     void CCharacterReaderUTF8::SetBookmark()
@@ -138,9 +191,11 @@ namespace toml_parser
         m_nBookmark = m_nCursor;
     }
 
-    std::string CCharacterReaderUTF8::StringFromBookmark() const
+    std::string_view CCharacterReaderUTF8::StringFromBookmark() const
     {
-        return m_ssString.substr(m_nBookmark, (m_nCursor > m_nBookmark) ? m_nCursor - m_nBookmark : 0);
+        if (m_nBookmark >= m_svString.size())
+            return {};
+        return m_svString.substr(m_nBookmark, (m_nCursor > m_nBookmark) ? m_nCursor - m_nBookmark : 0);
     }
 
     void CCharacterReaderUTF8::CheckForInvalidUTF8Bytes() const
@@ -148,9 +203,9 @@ namespace toml_parser
         const unsigned char invalidByteC0{0xC0};
         const unsigned char invalidByteC1{0xC1};
         const unsigned char lowerBoundInvalidRegion{0xF5};
-        for (size_t i = 0; i < m_ssString.size(); ++i)
+        for (size_t i = 0; i < m_svString.size(); ++i)
         {
-            unsigned char uc = m_ssString[i];
+            unsigned char uc = m_svString[i];
             if (uc == invalidByteC0 || uc == invalidByteC1 || uc >= lowerBoundInvalidRegion)
             {
                 std::stringstream message;
@@ -244,9 +299,9 @@ namespace toml_parser
                 eCurrentState = EState::state_error;
             }
         };
-        for (size_t i = 0; i < m_ssString.size(); ++i)
+        for (size_t i = 0; i < m_svString.size(); ++i)
         {
-            uint8_t uiCurrentByte = m_ssString[i];
+            uint8_t uiCurrentByte = m_svString[i];
             switch (eCurrentState)
             {
             case EState::state_neutral:
@@ -263,8 +318,8 @@ namespace toml_parser
                 break;
             default:
                 std::stringstream sstreamMessage;
-                sstreamMessage << "Invalid character with byte " << std::hex << m_ssString[i - 1] << std::dec << "("
-                               << static_cast<int32_t>(m_ssString[i - 1]) << ") at index " << i - 1 << "\n";
+                sstreamMessage << "Invalid character with byte " << std::hex << m_svString[i - 1] << std::dec << "("
+                               << static_cast<int32_t>(m_svString[i - 1]) << ") at index " << i - 1 << "\n";
                 throw XTOMLParseException(sstreamMessage.str());
             }
         }
@@ -276,41 +331,28 @@ namespace toml_parser
         }
     }
 
-    std::string CCharacterReaderUTF8::GetNextCharacter(size_t nOffset /*= 0*/) const
+    size_t CCharacterReaderUTF8::GetLengthOfCharacter(size_t nPosition) const
     {
-        if (IsEOF())
-            return {};
-        return {m_ssString, m_nCursor + nOffset, GetLengthOfNextCharacter(nOffset)};
+        if (nPosition >= m_svString.size())
+            return 0;
+        uint8_t ui = static_cast<uint8_t>(m_svString[nPosition]);
+        if ((ui & m_uiOneByteCheckMask) == m_OneByteCheckValue)
+            return 1;
+        if ((ui & m_uiFourByteCheckMask) == m_uiFourByteCheckValue)
+            return 4;
+        if ((ui & m_uiThreeByteCheckMask) == m_uiThreeByteCheckValue)
+            return 3;
+        if ((ui & m_uiTwoByteCheckMask) == m_uiTwoByteCheckValue)
+            return 2;
+        std::stringstream sstreamMessage;
+        sstreamMessage << "Invalid character sequence with byte " << std::hex << ui << std::dec << " as start byte\n";
+        throw XTOMLParseException(sstreamMessage.str());
     }
 
-    size_t CCharacterReaderUTF8::GetLengthOfNextCharacter(size_t nOffset) const
+    size_t CCharacterReaderUTF8::SkipCharacters(size_t nPosition, size_t nAmount) const
     {
-        if (IsEOF())
-            return 0;
-        uint8_t ui    = static_cast<uint8_t>(m_ssString[m_nCursor + nOffset]);
-        int32_t uiRet = 0;
-        if ((ui & m_uiOneByteCheckMask) == m_OneByteCheckValue)
-        {
-            uiRet = 1;
-        }
-        else if ((ui & m_uiFourByteCheckMask) == m_uiFourByteCheckValue)
-        {
-            uiRet = 4;
-        }
-        else if ((ui & m_uiThreeByteCheckMask) == m_uiThreeByteCheckValue)
-        {
-            uiRet = 3;
-        }
-        else if ((ui & m_uiTwoByteCheckMask) == m_uiTwoByteCheckValue)
-        {
-            uiRet = 2;
-        }
-        else
-        {
-            std::stringstream sstreamMessage;
-            sstreamMessage << "Invalid character sequence with byte " << std::hex << ui << std::dec << " as start byte\n";
-            throw XTOMLParseException(sstreamMessage.str());
-        }
-        return uiRet;
+        for (size_t n = 0; n < nAmount && nPosition < m_svString.size(); n++)
+            nPosition += GetLengthOfCharacter(nPosition);
+        return std::min(nPosition, m_svString.size());
     }
 } // namespace toml_parser
\ No newline at end of file
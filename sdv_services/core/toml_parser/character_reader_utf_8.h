@@ -17,14 +17,48 @@
 
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 
 /// The TOML parser namespace
 namespace toml_parser
 {
+    /**
+     * @brief Set of single byte (ASCII) characters allowing classification of a byte with one table lookup.
+     */
+    class CByteSet
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param[in] svCharacters The characters belonging to the set.
+         */
+        constexpr CByteSet(std::string_view svCharacters) : m_rgbMember{}
+        {
+            for (char c : svCharacters)
+                m_rgbMember[static_cast<uint8_t>(c)] = true;
+        }
+
+        /**
+         * @brief Is the character part of the set?
+         * @param[in] c The character to check.
+         * @return Returns whether the character is part of the set.
+         */
+        constexpr bool Contains(char c) const
+        {
+            return m_rgbMember[static_cast<uint8_t>(c)];
+        }
+
+    private:
+        bool m_rgbMember[256];      ///< Membership table indexed by the byte value.
+    };
+
     /**
      * @brief Reads a given input string, interprets bytes as UTF-8 and returns UTF-8 characters or strings in order of demand.
+     * @details The reader doesn't copy the input; the string provided to the constructor or the Feed function must stay valid
+     * during the lifetime of the reader. The view based functions return parts of the input and do not allocate any memory.
      */
     class CCharacterReaderUTF8
     {
@@ -36,17 +70,17 @@ namespace toml_parser
 
         /**
          * @brief Constructs a character reader from a given string.
-         * @param[in] rssString UTF-8 input string.
+         * @param[in] svString UTF-8 input string.
          * @throw XTOMLParseException Throws an InvalidCharacterException if the input contains invalid UTF-8 characters.
          * @throw XTOMLParseException Throws an InvalidByteException if the input contains for UTF-8 invalid bytes.
          */
-        CCharacterReaderUTF8(const std::string& rssString);
+        CCharacterReaderUTF8(std::string_view svString);
 
         /**
          * @brief Feed the character reader from the given string.
-         * @param[in] rssString UTF-8 input string.
+         * @param[in] svString UTF-8 input string.
          */
-        void Feed(const std::string& rssString);
+        void Feed(std::string_view svString);
 
         /**
          * @brief Reset the character reader content.
@@ -62,6 +96,25 @@ namespace toml_parser
          */
         std::string Peek(size_t nSkip = 0, size_t nAmount = 1) const;
 
+        /**
+         * @brief Get the next n-th UTF-8 character without advancing the cursor.
+         * @param[in] nSkip Amount of characters to skip.
+         * @param[in] nAmount The amount of characters to read.
+         * @return Returns a view to one or more characters starting at the requested position after the current cursor or an
+         * empty view if the requested position is behind the last character.
+         */
+        std::string_view PeekView(size_t nSkip = 0, size_t nAmount = 1) const;
+
+        /**
+         * @brief Get the byte at the provided offset from the cursor without advancing the cursor.
+         * @param[in] nOffset The offset in bytes from the cursor.
+         * @return The byte at the requested position or '\0' when the position is behind the last byte.
+         */
+        char PeekByte(size_t nOffset = 0) const
+        {
+            return m_nCursor + nOffset < m_svString.size() ? m_svString[m_nCursor + nOffset] : '\0';
+        }
+
         /**
          * @brief Get all upcoming UTF-8 characters until a terminating character without advancing the cursor.
          * @param[in] lstCollection A collection of terminating characters.
@@ -69,6 +122,13 @@ namespace toml_parser
          */
         std::string PeekUntil(const std::vector<std::string>& lstCollection) const;
 
+        /**
+         * @brief Get all upcoming UTF-8 characters until a terminating ASCII character without advancing the cursor.
+         * @param[in] rsetDelimiters Reference to the set of terminating characters.
+         * @return Returns a view to the UTF-8 characters until (excluding) the first occurrence of one of the given characters.
+         */
+        std::string_view PeekViewUntil(const CByteSet& rsetDelimiters) const;
+
         /**
          * @brief Get the next n-th UTF-8 character and advancing the cursor by n.
          * @param[in] nSkip Amount of characters to skip.
@@ -78,6 +138,24 @@ namespace toml_parser
          */
         std::string Consume(size_t nSkip = 0, size_t nAmount = 1);
 
+        /**
+         * @brief Get the next n-th UTF-8 character and advancing the cursor by n.
+         * @param[in] nSkip Amount of characters to skip.
+         * @param[in] nAmount The amount of characters to read.
+         * @return Returns a view to one or more characters starting at the requested position after the current cursor or an
+         * empty view if the requested position is behind the last character.
+         */
+        std::string_view ConsumeView(size_t nSkip = 0, size_t nAmount = 1);
+
+        /**
+         * @brief Consume an amount of bytes.
+         * @attention The caller is responsible to end at a character boundary. This is the case when the amount was determined
+         * by searching for an ASCII character (see FindFirstOf).
+         * @param[in] nAmount The amount of bytes to consume. The amount is limited to the available bytes.
+         * @return Returns a view to the consumed bytes.
+         */
+        std::string_view ConsumeBytes(size_t nAmount);
+
         /**
          * @brief Get all upcoming UTF-8 characters until a terminating character and advancing the cursor by the number of
          * characters in the returned string.
@@ -86,6 +164,29 @@ namespace toml_parser
          */
         std::string ConsumeUntil(const std::vector<std::string>& lstCollection);
 
+        /**
+         * @brief Get all upcoming UTF-8 characters until a terminating ASCII character and advance the cursor accordingly.
+         * @param[in] rsetDelimiters Reference to the set of terminating characters.
+         * @return Returns a view to the UTF-8 characters until (excluding) the first occurrence of one of the given characters.
+         */
+        std::string_view ConsumeViewUntil(const CByteSet& rsetDelimiters);
+
+        /**
+         * @brief Get all upcoming UTF-8 characters until a terminating ASCII character and advance the cursor accordingly.
+         * @param[in] cDelimiter The terminating character.
+         * @return Returns a view to the UTF-8 characters until (excluding) the first occurrence of the given character.
+         */
+        std::string_view ConsumeViewUntil(char cDelimiter);
+
+        /**
+         * @brief Find the first occurrence of one of two ASCII characters starting at the cursor. Uses vector instructions when
+         * available.
+         * @param[in] c1 The first character to search for.
+         * @param[in] c2 The second character to search for (could be identical to the first character).
+         * @return The offset in bytes from the cursor to the found character or the amount of remaining bytes when not found.
+         */
+        size_t FindFirstOf(char c1, char c2) const;
+
         /**
          * @brief Checks if the cursor is at the end of the data to read.
          * @return Returns true if the cursor is at the end of the readable data, false otherwise.
@@ -102,7 +203,7 @@ namespace toml_parser
          * @return Returns the raw string from the last bookmark position (if set), or from the beginning of the string (if not
          * set).
          */
-        std::string StringFromBookmark() const;
+        std::string_view StringFromBookmark() const;
 
     private:
         /**
@@ -118,22 +219,21 @@ namespace toml_parser
         void CheckForInvalidUTF8Sequences() const;
 
         /**
-         * @brief Get the next character using an nOffset of nOffset bytes.
-         * @attention This function doesn't protect for an invalid nOffset when reading multi-byte characters.
+         * @brief Get the length of the character at the provided position.
          * @remarks In UTF8 one character could contain up to 4 bytes.
-         * @param[in] nOffset The nOffset in bytes to the next character to read.
-         * @return The character from the string or an empty string if there are no more characters in the string.
+         * @param[in] nPosition The position in bytes within the string.
+         * @return the length of the character in bytes or zero when there are no more characters in the string.
+         * @throw XTOMLParseException Throws an InvalidCharacterException if the input contains invalid UTF-8 characters.
          */
-        std::string GetNextCharacter(size_t nOffset = 0) const;
+        size_t GetLengthOfCharacter(size_t nPosition) const;
 
         /**
-         * @brief Get the length of the next character in bytes.
-         * @remarks In UTF8 one character could contain up to 4 bytes.
-         * @param[in] nOffset The nOffset in bytes to the next character to read.
-         * @return the length of the character in bytes or zero when there are no more characters in the string.
-         * @throw XTOMLParseException Throws an InvalidCharacterException if the input contains invalid UTF-8 characters.
+         * @brief Get the position behind a number of characters.
+         * @param[in] nPosition The position in bytes within the string to start.
+         * @param[in] nAmount The amount of characters to skip.
+         * @return The position behind the characters; limited to the size of the string.
          */
-        size_t GetLengthOfNextCharacter(size_t nOffset = 0) const;
+        size_t SkipCharacters(size_t nPosition, size_t nAmount) const;
 
         static const uint8_t m_uiOneByteCheckMask{0b10000000};    ///< Checkmask for 1-Byte UTF-8 characters
         static const uint8_t m_OneByteCheckValue{0b00000000};     ///< Value of a 1-Byte UTF-8 character
@@ -151,9 +251,9 @@ namespace toml_parser
         static const uint8_t m_uiFourByteCheckValue{0b11110000};  ///< Value of a startbyte of a 4-Byte UTF-8 character
                                                                   ///< after being or-ed with the checkmask
 
-        std::string m_ssString; ///< String containing the characters to acquire.
-        size_t m_nCursor   = 0; ///< Current position pointing to the next character.
-        size_t m_nBookmark = 0; ///< Bookmark cursor position to use to get raw string chunks.
+        std::string_view m_svString;    ///< View of the string containing the characters to acquire.
+        size_t m_nCursor   = 0;         ///< Current position pointing to the next character.
+        size_t m_nBookmark = 0;         ///< Bookmark cursor position to use to get raw string chunks.
     };
 } // namespace toml_parser
 
@@ -21,6 +21,21 @@
 /// The TOML parser namespace
 namespace toml_parser
 {
+    namespace
+    {
+        /// Characters allowed in a bare key.
+        constexpr CByteSet g_setBareKeyCharacters("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789_-");
+
+        /// Characters terminating a bare key.
+        constexpr CByteSet g_setBareKeyDelimiters(".= \t]");
+
+        /// Characters terminating a value.
+        constexpr CByteSet g_setValueDelimiters("\n\t\r ,]}#");
+
+        /// Whitespace characters (equal to std::isspace in the "C" locale).
+        constexpr CByteSet g_setWhitespaceCharacters(" \t\n\v\f\r");
+    } // namespace
+
     CNodeTokenRange::CNodeTokenRange(const CToken& rInitialToken) :
         m_refBeforeNodeBegin(rInitialToken), m_rangeExtendedNode(rInitialToken, rInitialToken),
         m_rangeNodeMain(rInitialToken, rInitialToken), m_rangeNodeFinish(rInitialToken, rInitialToken),
@@ -782,32 +797,19 @@ namespace toml_parser
             if (!token) token = ReadComment(rReader);
             if (!token)
                 token = ReadUnknownSequence(rReader);
-            auto itLocation = m_lstTokens.insert(m_lstTokens.end(), token);
+            auto itLocation = m_lstTokens.insert(m_lstTokens.end(), std::move(token));
             m_lstTokens.back().RawDataInfo(rReader.StringFromBookmark(), m_lstTokens, itLocation);
         }
     }
 
     CToken CLexer::ReadBasicQuotedKey(CCharacterReaderUTF8& rReader) const
     {
-        if (m_stackExpectations.top() != EExpectation::expect_key || rReader.Peek() != "\"") return {};
+        if (m_stackExpectations.top() != EExpectation::expect_key || rReader.PeekByte() != '\"') return {};
         try
         {
-            bool bEndOfQuote = false;
             std::string ssContent;
-            rReader.Consume();
-            while (!bEndOfQuote)
-            {
-                if (rReader.IsEOF())
-                    throw XTOMLParseException(
-                        "Unexpected End of File reached while reading multiline string");
-                std::string ssCharacter = rReader.Consume();
-                if (ssCharacter == "\\")
-                    ssContent += Unescape(rReader);
-                else if (ssCharacter == "\"")
-                    bEndOfQuote = true;
-                else
-                    ssContent += ssCharacter;
-            }
+            rReader.ConsumeBytes(1);
+            ReadBasicStringContent(rReader, ssContent, "Unexpected End of File reached while reading multiline string");
             return CToken(ETokenCategory::token_key, ssContent, ETokenStringType::quoted_string);
         }
         catch (const sdv::toml::XTOMLParseException& rexcept)
@@ -818,77 +820,50 @@ namespace toml_parser
 
     CToken CLexer::ReadLiteralQuotedKey(CCharacterReaderUTF8& rReader) const
     {
-        if (m_stackExpectations.top() != EExpectation::expect_key || rReader.Peek() != "\'") return {};
-        bool bEndOfQuote = false;
-        std::string ssContent;
-        rReader.Consume(); // get the initial "'"
-        while (!bEndOfQuote)
-        {
-            std::string ssCharacter = rReader.Consume();
-            if (ssCharacter == "\'")
-                bEndOfQuote = true;
-            else
-                ssContent += ssCharacter;
-        }
+        if (m_stackExpectations.top() != EExpectation::expect_key || rReader.PeekByte() != '\'') return {};
+        rReader.ConsumeBytes(1); // get the initial "'"
+        std::string ssContent(rReader.ConsumeBytes(rReader.FindFirstOf('\'', '\'')));
+        if (rReader.IsEOF())
+            return CToken(ETokenCategory::token_error, "Unexpected End of File reached while reading string");
+        rReader.ConsumeBytes(1); // get the closing "'"
         return CToken(ETokenCategory::token_key, ssContent, ETokenStringType::literal_string);
     }
 
     CToken CLexer::ReadBareKey(CCharacterReaderUTF8& rReader) const
     {
-        std::string ssCharacter = rReader.Peek();
-        if (m_stackExpectations.top() != EExpectation::expect_key || ssCharacter.empty() ||
-            ((ssCharacter[0] < 'A' || ssCharacter[0] > 'Z') && (ssCharacter[0] < 'a' || ssCharacter[0] > 'z')
-                && (ssCharacter[0] < '0' || ssCharacter[0] > '9') && ssCharacter[0] != '-' && ssCharacter[0] != '_'))
+        if (m_stackExpectations.top() != EExpectation::expect_key || !g_setBareKeyCharacters.Contains(rReader.PeekByte()))
             return {};
 
-        bool bEndOfKey = false;
-        std::string ssContent;
+        // NOTE: Multi-byte UTF-8 characters consist of bytes outside the ASCII range and are therefore detected as invalid
+        // characters.
+        std::string_view svContent = rReader.ConsumeViewUntil(g_setBareKeyDelimiters);
         bool bError = false;
-        while (!bEndOfKey)
+        for (char c : svContent)
         {
-            ssCharacter = rReader.Peek();
-            if (!ssCharacter.empty() && ssCharacter[0] != '.' && ssCharacter[0] != '=' && ssCharacter[0] != ' '
-                && ssCharacter[0] != '\t' && ssCharacter[0] != ']')
+            if (!g_setBareKeyCharacters.Contains(c))
             {
-                if ((ssCharacter[0] < '0' || ssCharacter[0] > '9') && (ssCharacter[0] < 'A' || ssCharacter[0] > 'Z')
-                    && (ssCharacter[0] < 'a' || ssCharacter[0] > 'z') && (ssCharacter[0] != '_') && (ssCharacter[0] != '-'))
-                    bError = true;
-                rReader.Consume();
-                ssContent += ssCharacter;
+                bError = true;
+                break;
             }
-            else
-                bEndOfKey = true;
         }
         if (bError)
-            return CToken(ETokenCategory::token_error, "Invalid bare key '" + ssContent + "'");
+            return CToken(ETokenCategory::token_error, "Invalid bare key '" + std::string(svContent) + "'");
         else
-            return CToken(ETokenCategory::token_key, ssContent);
+            return CToken(ETokenCategory::token_key, std::string(svContent));
     }
 
     CToken CLexer::ReadBasicString(CCharacterReaderUTF8& rReader)
     {
-        if (m_stackExpectations.top() == EExpectation::expect_key || rReader.Peek() != "\"" || 
-            (rReader.Peek(1) == "\"" && rReader.Peek(2) == "\""))
+        if (m_stackExpectations.top() == EExpectation::expect_key || rReader.PeekByte() != '\"' ||
+            (rReader.PeekByte(1) == '\"' && rReader.PeekByte(2) == '\"'))
             return {};
 
         CToken token;
         try
         {
-            bool bEndOfQuote = false;
             std::string ssContent;
-            rReader.Consume();
-            while (!bEndOfQuote)
-            {
-                if (rReader.IsEOF())
-                    throw XTOMLParseException("Unexpected End of File reached while reading string");
-                std::string ssCharacter = rReader.Consume();
-                if (ssCharacter == "\\")
-                    ssContent += Unescape(rReader);
-                else if (ssCharacter == "\"")
-                    bEndOfQuote = true;
-                else
-                    ssContent += ssCharacter;
-            }
+            rReader.ConsumeBytes(1);
+            ReadBasicStringContent(rReader, ssContent, "Unexpected End of File reached while reading string");
             token = CToken(ETokenCategory::token_string, ssContent, ETokenStringType::quoted_string);
         }
         catch (const sdv::toml::XTOMLParseException& rexcept)
@@ -900,10 +875,30 @@ namespace toml_parser
         return token;
     }
 
+    void CLexer::ReadBasicStringContent(CCharacterReaderUTF8& rReader, std::string& rssContent, const char* szEOFMessage)
+    {
+        while (true)
+        {
+            if (rReader.IsEOF())
+                throw XTOMLParseException(szEOFMessage);
+
+            // Copy the characters until the next quote or escape in one go.
+            size_t nRun = rReader.FindFirstOf('\"', '\\');
+            if (nRun)
+            {
+                rssContent.append(rReader.ConsumeBytes(nRun));
+                continue;
+            }
+            if (rReader.ConsumeBytes(1)[0] == '\"')
+                return;
+            rssContent += Unescape(rReader);
+        }
+    }
+
     CToken CLexer::ReadBasicMultilineString(CCharacterReaderUTF8& rReader)
     {
-        if (m_stackExpectations.top() == EExpectation::expect_key || rReader.Peek() != "\"" || rReader.Peek(1) != "\""
-            || rReader.Peek(2) != "\"")
+        if (m_stackExpectations.top() == EExpectation::expect_key || rReader.PeekByte() != '\"' || rReader.PeekByte(1) != '\"'
+            || rReader.PeekByte(2) != '\"')
             return {};
 
         std::string ssContent;
@@ -911,52 +906,60 @@ namespace toml_parser
 
         auto fnIgnoreNewLineAtTheBeginning = [&rReader]()
         {
-            if (rReader.Peek() == "\n")
-                rReader.Consume();
-            else if (rReader.Peek() == "\r" && rReader.Peek(1) == "\n")
-                rReader.Consume(1);
+            if (rReader.PeekByte() == '\n')
+                rReader.ConsumeBytes(1);
+            else if (rReader.PeekByte() == '\r' && rReader.PeekByte(1) == '\n')
+                rReader.ConsumeBytes(2);
         };
-        auto fnHandleBackslashFunctionality = [this, &rReader, &ssContent]()
+        auto fnHandleBackslashFunctionality = [&rReader, &ssContent]()
         {
-            if (rReader.Peek() == "\n" || (rReader.Peek() == "\r" && rReader.Peek(1) == "\n"))
+            if (rReader.PeekByte() == '\n' || (rReader.PeekByte() == '\r' && rReader.PeekByte(1) == '\n'))
             {
-                std::string next = rReader.Peek();
-                while (next == "\n" || (next == "\r" && rReader.Peek(1) == "\n") || next == " " || next == "\t")
+                char cNext = rReader.PeekByte();
+                while (cNext == '\n' || (cNext == '\r' && rReader.PeekByte(1) == '\n') || cNext == ' ' || cNext == '\t')
                 {
-                    rReader.Consume();
-                    next = rReader.Peek();
+                    rReader.ConsumeBytes(1);
+                    cNext = rReader.PeekByte();
                 }
                 return;
             }
             ssContent += Unescape(rReader);
         };
-        auto fnHandleTrippleDoublequotes = [this, &rReader, &ssContent, &bEndOfQuote]()
+        auto fnHandleTrippleDoublequotes = [&rReader, &ssContent, &bEndOfQuote]()
         {
-            if (rReader.Peek(2) == "\"")
+            if (rReader.PeekByte(2) == '\"')
             {
                 ssContent += '\"';
                 return;
             }
             bEndOfQuote = true;
-            rReader.Consume(1);
+            rReader.ConsumeBytes(2);
         };
 
         CToken token;
         try
         {
-            rReader.Consume(2);
+            rReader.ConsumeBytes(3);
             fnIgnoreNewLineAtTheBeginning();
             while (!bEndOfQuote)
             {
                 if (rReader.IsEOF())
                     throw XTOMLParseException("Unexpected End of File reached while reading multiline string");
-                std::string ssCharacter = rReader.Consume();
-                if (ssCharacter == "\\")
+
+                // Copy the characters until the next quote or escape in one go.
+                size_t nRun = rReader.FindFirstOf('\"', '\\');
+                if (nRun)
+                {
+                    ssContent.append(rReader.ConsumeBytes(nRun));
+                    continue;
+                }
+                char cCharacter = rReader.ConsumeBytes(1)[0];
+                if (cCharacter == '\\')
                     fnHandleBackslashFunctionality();
-                else if (ssCharacter == "\"" && rReader.Peek() == "\"" && rReader.Peek(1) == "\"")
+                else if (rReader.PeekByte() == '\"' && rReader.PeekByte(1) == '\"')
                     fnHandleTrippleDoublequotes();
                 else
-                    ssContent += ssCharacter;
+                    ssContent += cCharacter;
             }
             token = CToken(ETokenCategory::token_string, ssContent, ETokenStringType::multi_line_quoted);
         }
@@ -971,31 +974,19 @@ namespace toml_parser
 
     CToken CLexer::ReadLiteralString(CCharacterReaderUTF8& rReader)
     {
-        if (m_stackExpectations.top() == EExpectation::expect_key || rReader.Peek() != "\'"
-            || (rReader.Peek(1) == "\'" && rReader.Peek(2) == "\'"))
+        if (m_stackExpectations.top() == EExpectation::expect_key || rReader.PeekByte() != '\''
+            || (rReader.PeekByte(1) == '\'' && rReader.PeekByte(2) == '\''))
             return {};
 
         CToken token;
-        try
-        {
-            bool bEndOfQuote{false};
-            std::string ssContent;
-            rReader.Consume();
-            while (!bEndOfQuote)
-            {
-                if (rReader.IsEOF())
-                    throw XTOMLParseException("Unexpected End of File reached while reading string");
-                std::string ssCharacter = rReader.Consume();
-                if (ssCharacter == "'")
-                    bEndOfQuote = true;
-                else
-                    ssContent += ssCharacter;
-            }
-            token = CToken(ETokenCategory::token_string, ssContent, ETokenStringType::literal_string);
-        }
-        catch (const sdv::toml::XTOMLParseException& rexcept)
+        rReader.ConsumeBytes(1);
+        std::string_view svContent = rReader.ConsumeBytes(rReader.FindFirstOf('\'', '\''));
+        if (rReader.IsEOF())
+            token = CToken(ETokenCategory::token_error, "Unexpected End of File reached while reading string");
+        else
         {
-            token = CToken(ETokenCategory::token_error, rexcept);
+            rReader.ConsumeBytes(1);
+            token = CToken(ETokenCategory::token_string, std::string(svContent), ETokenStringType::literal_string);
         }
         if (m_stackExpectations.top() == EExpectation::expect_value_once)
             m_stackExpectations.pop();
@@ -1004,8 +995,8 @@ namespace toml_parser
 
     CToken CLexer::ReadLiteralMultilineString(CCharacterReaderUTF8& rReader)
     {
-        if (m_stackExpectations.top() == EExpectation::expect_key || rReader.Peek() != "\'" || rReader.Peek(1) != "\'"
-            || rReader.Peek(2) != "\'")
+        if (m_stackExpectations.top() == EExpectation::expect_key || rReader.PeekByte() != '\'' || rReader.PeekByte(1) != '\''
+            || rReader.PeekByte(2) != '\'')
             return {};
 
         CToken token;
@@ -1013,42 +1004,42 @@ namespace toml_parser
         {
             bool bEndOfQuote = false;
             std::string ssContent;
-            rReader.Consume(2);
-            if (rReader.Peek() == "\n")
-                rReader.Consume();
-            else if (rReader.Peek() == "\r" && rReader.Peek(1) == "\n")
-                rReader.Consume(1);
+            rReader.ConsumeBytes(3);
+            if (rReader.PeekByte() == '\n')
+                rReader.ConsumeBytes(1);
+            else if (rReader.PeekByte() == '\r' && rReader.PeekByte(1) == '\n')
+                rReader.ConsumeBytes(2);
             bool bConsumeWhitespace = false;
             while (!bEndOfQuote)
             {
                 if (rReader.IsEOF())
                     throw XTOMLParseException("Unexpected End of File reached while reading multiline string");
-                std::string ssCharacter = rReader.Consume();
-                if (ssCharacter == "'" && rReader.Peek() == "'" && rReader.Peek(1) == "'")
+                std::string_view svCharacter = rReader.ConsumeView();
+                if (svCharacter[0] == '\'' && rReader.PeekByte() == '\'' && rReader.PeekByte(1) == '\'')
                 {
-                    if (rReader.Peek(2) == "'")
+                    if (rReader.PeekByte(2) == '\'')
                         ssContent += '\'';
                     else
                     {
                         bEndOfQuote = true;
-                        rReader.Consume(1);
+                        rReader.ConsumeBytes(2);
                     }
                 }
-                else if (ssCharacter == "\\" && rReader.Peek() == "\n")
+                else if (svCharacter[0] == '\\' && rReader.PeekByte() == '\n')
                 {
                     bConsumeWhitespace = true;
-                    rReader.Consume();
+                    rReader.ConsumeBytes(1);
                 }
-                else if (ssCharacter == "\\" && rReader.Peek() == "\r" && rReader.Peek(1) == "\n")
+                else if (svCharacter[0] == '\\' && rReader.PeekByte() == '\r' && rReader.PeekByte(1) == '\n')
                 {
                     bConsumeWhitespace = true;
-                    rReader.Consume();
+                    rReader.ConsumeBytes(1);
                 }
                 else
                 {
-                    if (!std::isspace(ssCharacter[0]) || !bConsumeWhitespace)
+                    if (!g_setWhitespaceCharacters.Contains(svCharacter[0]) || !bConsumeWhitespace)
                     {
-                        ssContent += ssCharacter;
+                        ssContent += svCharacter;
                         bConsumeWhitespace = false;
                     }
                 }
@@ -1068,16 +1059,16 @@ namespace toml_parser
     {
         if (m_stackExpectations.top() == EExpectation::expect_key)
             return {};
-        std::string ssCharacter = rReader.PeekUntil(m_vecValueDelimiters);
-        if (ssCharacter.empty()) return {};
-        if (ssCharacter[0] != '-' && ssCharacter[0] != '+' && !std::isdigit(ssCharacter[0]))
+        std::string_view svCharacters = rReader.PeekViewUntil(g_setValueDelimiters);
+        if (svCharacters.empty()) return {};
+        if (svCharacters[0] != '-' && svCharacters[0] != '+' && !std::isdigit(svCharacters[0]))
             return {};  // Is not a number
-        if (ssCharacter.substr(0, 2) != "0x" && ssCharacter.find_first_of("eE.") != std::string::npos)
+        if (svCharacters.substr(0, 2) != "0x" && svCharacters.find_first_of("eE.") != std::string_view::npos)
             return {}; // Is float
-        if ((ssCharacter[0] == '-' || ssCharacter[0] == '+') && ssCharacter.size() > 1 && !std::isdigit(ssCharacter[1]))
+        if ((svCharacters[0] == '-' || svCharacters[0] == '+') && svCharacters.size() > 1 && !std::isdigit(svCharacters[1]))
             return {}; // Likely float
 
-        std::string ssIntegerString = rReader.ConsumeUntil(m_vecValueDelimiters);
+        std::string_view svIntegerString = rReader.ConsumeViewUntil(g_setValueDelimiters);
 
         enum class EEncoding : int64_t
         {
@@ -1111,43 +1102,43 @@ namespace toml_parser
             std::size_t nIndex = 0;
             int64_t	iSign = 1;
             int64_t	iValue = 0;
-            if (ssIntegerString[0] == '-')
+            if (svIntegerString[0] == '-')
             {
                 iSign = -1;
                 ++nIndex;
             }
-            else if (ssIntegerString[0] == '+')
+            else if (svIntegerString[0] == '+')
                 ++nIndex;
-            else if (ssIntegerString.substr(0, 2) == "0x")
+            else if (svIntegerString.substr(0, 2) == "0x")
             {
                 eEncoding = EEncoding::Hexadecimal;
                 nIndex += 2;
             }
-            else if (ssIntegerString.substr(0, 2) == "0o")
+            else if (svIntegerString.substr(0, 2) == "0o")
             {
                 eEncoding = EEncoding::Octal;
                 nIndex += 2;
             }
-            else if (ssIntegerString.substr(0, 2) == "0b")
+            else if (svIntegerString.substr(0, 2) == "0b")
             {
                 eEncoding = EEncoding::Binary;
                 nIndex += 2;
             }
 
-            if (eEncoding == EEncoding::Decimal && ssIntegerString[nIndex] == '0' && ssIntegerString.size() > nIndex + 1)
+            if (eEncoding == EEncoding::Decimal && svIntegerString.size() > nIndex + 1 && svIntegerString[nIndex] == '0')
                 throw XTOMLParseException("No leading zeros allowed!");
 
             size_t nLastUnderscore = 999;
-            for (std::size_t n = nIndex; n < ssIntegerString.size(); ++n)
+            for (std::size_t n = nIndex; n < svIntegerString.size(); ++n)
             {
-                if (ssIntegerString[n] == '_')
+                if (svIntegerString[n] == '_')
                 {
-                    if (n == (nLastUnderscore + 1) || n == nIndex || n == (ssIntegerString.size() - 1))
+                    if (n == (nLastUnderscore + 1) || n == nIndex || n == (svIntegerString.size() - 1))
                         throw XTOMLParseException("Underscore has to be enclosed in digits!");
                     nLastUnderscore = n;
                     continue;
                 }
-                iValue = iValue * static_cast<int64_t>(eEncoding) + fnConvertToDecimal(ssIntegerString[n]);
+                iValue = iValue * static_cast<int64_t>(eEncoding) + fnConvertToDecimal(svIntegerString[n]);
             }
             token = CToken(ETokenCategory::token_integer, iSign * iValue);
         }
@@ -1164,13 +1155,13 @@ namespace toml_parser
     {
         if (m_stackExpectations.top() == EExpectation::expect_key)
             return {};
-        std::string ssFloatChars = rReader.PeekUntil(m_vecValueDelimiters);
-        if (ssFloatChars.empty())
+        std::string_view svFloatChars = rReader.PeekViewUntil(g_setValueDelimiters);
+        if (svFloatChars.empty())
             return {};
 
-        bool bIsFloat = ssFloatChars == "inf" || ssFloatChars == "+inf" || ssFloatChars == "-inf" || ssFloatChars == "nan"
-            || ssFloatChars == "+nan" || ssFloatChars == "-nan";
-        for (char c : ssFloatChars)
+        bool bIsFloat = svFloatChars == "inf" || svFloatChars == "+inf" || svFloatChars == "-inf" || svFloatChars == "nan"
+            || svFloatChars == "+nan" || svFloatChars == "-nan";
+        for (char c : svFloatChars)
         {
             if (bIsFloat)
                 break;
@@ -1181,16 +1172,16 @@ namespace toml_parser
                 bIsFloat = true;
         }
         if (!bIsFloat) return {};
-    
-        rReader.ConsumeUntil(m_vecValueDelimiters);
+
+        rReader.ConsumeViewUntil(g_setValueDelimiters);
         std::string ssFloatingpointString;
 
         // Remove any underscores. Each underscore must be surrounded by one digit
-        for (size_t n = 0; n < ssFloatChars.size(); n++)
+        for (size_t n = 0; n < svFloatChars.size(); n++)
         {
-            if (ssFloatChars[n] == '_')
+            if (svFloatChars[n] == '_')
             {
-                if (n == 0 || n == (ssFloatChars.size() - 1) || !std::isdigit(ssFloatChars[n-1]) || !std::isdigit(ssFloatChars[n+1]))
+                if (n == 0 || n == (svFloatChars.size() - 1) || !std::isdigit(svFloatChars[n-1]) || !std::isdigit(svFloatChars[n+1]))
                 {
                     if (m_stackExpectations.top() == EExpectation::expect_value_once)
                         m_stackExpectations.pop();
@@ -1198,9 +1189,9 @@ namespace toml_parser
                 }
             }
             else
-                ssFloatingpointString += ssFloatChars[n];
+                ssFloatingpointString += svFloatChars[n];
         }
-    
+
         CToken token;
         size_t nDotPosition = ssFloatingpointString.find('.');
         if (nDotPosition == 0 || (nDotPosition == ssFloatingpointString.size() - 1)
@@ -1229,18 +1220,12 @@ namespace toml_parser
     {
         if (m_stackExpectations.top() == EExpectation::expect_key)
             return {};
-        std::string ssBoolChars = rReader.PeekUntil(m_vecValueDelimiters);
-        if (ssBoolChars != "true" && ssBoolChars != "false")
+        std::string_view svBoolChars = rReader.PeekViewUntil(g_setValueDelimiters);
+        if (svBoolChars != "true" && svBoolChars != "false")
             return {};
 
-        CToken token;
-        ssBoolChars = rReader.ConsumeUntil(m_vecValueDelimiters);
-        if (ssBoolChars == "true")
-            token = CToken(ETokenCategory::token_boolean, true);
-        else if (ssBoolChars == "false")
-            token = CToken(ETokenCategory::token_boolean, false);
-        else
-            token = CToken(ETokenCategory::token_error, std::string("Unable to convert '") + ssBoolChars + "' to floating point value");
+        rReader.ConsumeViewUntil(g_setValueDelimiters);
+        CToken token(ETokenCategory::token_boolean, svBoolChars == "true");
         if (m_stackExpectations.top() == EExpectation::expect_value_once)
             m_stackExpectations.pop();
         return token;
@@ -1248,39 +1233,35 @@ namespace toml_parser
 
     CToken CLexer::ReadWhitespace(CCharacterReaderUTF8& rReader) const
     {
-        bool bWhitespace = false;
-        while (rReader.Peek()[0] == ' ' || rReader.Peek()[0] == '\t')
-        {
-            // Only read whitespace
-            rReader.Consume();
-            bWhitespace = true;
-        }
-        if (!bWhitespace)
+        size_t nLength = 0;
+        while (rReader.PeekByte(nLength) == ' ' || rReader.PeekByte(nLength) == '\t')
+            ++nLength;
+        if (!nLength)
             return {};
 
+        // Only read whitespace
+        rReader.ConsumeBytes(nLength);
         return CToken(ETokenCategory::token_whitespace);
     }
 
     CToken CLexer::ReadSyntaxElement(CCharacterReaderUTF8& rReader)
     {
-        std::string ssElement = rReader.Peek();
-        if (ssElement.empty())
+        if (rReader.IsEOF())
             return {};
-    
+
         CToken token;
-        switch (ssElement[0])
+        switch (rReader.PeekByte())
         {
         case '\n':
-            rReader.Consume();
+            rReader.ConsumeBytes(1);
             token = CToken(ETokenCategory::token_syntax_new_line);
             break;
         case '\r':
-            rReader.Consume();
-            rReader.Consume();
+            rReader.ConsumeView(0, 2);
             token = CToken(ETokenCategory::token_syntax_new_line);
             break;
         case '[':
-            rReader.Consume();
+            rReader.ConsumeBytes(1);
             if (m_stackExpectations.top() != EExpectation::expect_key)
             {
                 token = CToken(ETokenCategory::token_syntax_array_open);
@@ -1288,17 +1269,17 @@ namespace toml_parser
             }
             else
             {
-                if (rReader.Peek() == "[")
+                if (rReader.PeekByte() == '[')
                 {
                     token = CToken(ETokenCategory::token_syntax_table_array_open);
-                    rReader.Consume();
+                    rReader.ConsumeBytes(1);
                 }
                 else
                     token = CToken(ETokenCategory::token_syntax_table_open);
             }
             break;
         case ']':
-            rReader.Consume();
+            rReader.ConsumeBytes(1);
             if (m_stackExpectations.top() != EExpectation::expect_key)
             {
                 token = CToken(ETokenCategory::token_syntax_array_close);
@@ -1308,37 +1289,37 @@ namespace toml_parser
             }
             else
             {
-                if (rReader.Peek() == "]")
+                if (rReader.PeekByte() == ']')
                 {
                     token = CToken(ETokenCategory::token_syntax_table_array_close);
-                    rReader.Consume();
+                    rReader.ConsumeBytes(1);
                 }
                 else
                     token = CToken(ETokenCategory::token_syntax_table_close);
             }
             break;
         case '{':
-            rReader.Consume();
+            rReader.ConsumeBytes(1);
             token = CToken(ETokenCategory::token_syntax_inline_table_open);
             m_stackExpectations.push(EExpectation::expect_key);
             break;
         case '}':
-            rReader.Consume();
+            rReader.ConsumeBytes(1);
             token = CToken(ETokenCategory::token_syntax_inline_table_close);
             m_stackExpectations.pop();
             if (!m_stackExpectations.empty() && m_stackExpectations.top() == EExpectation::expect_value_once)
                 m_stackExpectations.pop();
             break;
         case ',':
-            rReader.Consume();
+            rReader.ConsumeBytes(1);
             token = CToken(ETokenCategory::token_syntax_comma);
             break;
         case '.':
-            rReader.Consume();
+            rReader.ConsumeBytes(1);
             token = CToken(ETokenCategory::token_syntax_dot);
             break;
         case '=':
-            rReader.Consume();
+            rReader.ConsumeBytes(1);
             token = CToken(ETokenCategory::token_syntax_assignment);
             m_stackExpectations.push(EExpectation::expect_value_once);
             break;
@@ -1350,15 +1331,15 @@ namespace toml_parser
 
     CToken CLexer::ReadComment(CCharacterReaderUTF8& rReader)
     {
-        if (rReader.Peek()[0] != '#') return {};
-        rReader.ConsumeUntil({"\n"});
+        if (rReader.PeekByte() != '#') return {};
+        rReader.ConsumeViewUntil('\n');
         return CToken(ETokenCategory::token_comment);
     }
 
     CToken CLexer::ReadUnknownSequence(CCharacterReaderUTF8& rReader)
     {
-        std::string sequence = rReader.ConsumeUntil(m_vecValueDelimiters);
-        CToken token = CToken(ETokenCategory::token_error, "Invalid Sequence '" + sequence + "'");
+        std::string_view svSequence = rReader.ConsumeViewUntil(g_setValueDelimiters);
+        CToken token = CToken(ETokenCategory::token_error, "Invalid Sequence '" + std::string(svSequence) + "'");
         if (m_stackExpectations.top() == EExpectation::expect_value_once)
             m_stackExpectations.pop();
         return token;
@@ -1366,8 +1347,8 @@ namespace toml_parser
 
     std::string CLexer::Unescape(CCharacterReaderUTF8& rReader)
     {
-        std::string ssEscapeChar = rReader.Consume();
-        switch (ssEscapeChar[0])
+        std::string_view svEscapeChar = rReader.ConsumeView();
+        switch (svEscapeChar.empty() ? '\0' : svEscapeChar[0])
         {
         case 'b':
             return "\b";
@@ -1388,7 +1369,7 @@ namespace toml_parser
         case 'U':
             return EscapedUnicodeCharacterToUTF8(rReader, 8);
         default:
-            throw XTOMLParseException(("Invalid escape sequence: \\" + ssEscapeChar).c_str());
+            throw XTOMLParseException(("Invalid escape sequence: \\" + std::string(svEscapeChar)).c_str());
         }
     }
 
@@ -1398,12 +1379,12 @@ namespace toml_parser
         std::string ssHexValue;
         for (size_t n = 1; n <= nDigits; ++n)
         {
-            std::string ssChar = rReader.Consume();
-            if (ssChar.size() != 1 || !std::isxdigit(ssChar[0]))
+            std::string_view svChar = rReader.ConsumeView();
+            if (svChar.size() != 1 || !std::isxdigit(svChar[0]))
                 throw XTOMLParseException("Invalid digit in UNICODE escape string.");
-            ssHexValue += ssChar;
+            ssHexValue += svChar;
         }
         return toml_parser::EscapedUnicodeCharacterToUTF8(ssHexValue);
     }
 
-} // namespace toml_parser
\ No newline at end of file
+} // namespace toml_parser
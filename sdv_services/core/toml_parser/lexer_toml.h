@@ -303,6 +303,17 @@ namespace toml_parser
          */
         CToken ReadBasicString(CCharacterReaderUTF8& rReader);
 
+        /**
+         * @brief Read the content of a basic string or basic quoted key following the opening double quote until and including
+         * the closing double quote. Escaped characters are interpreted.
+         * @param[in] rReader Reference to the reader providing the UTF8 characters.
+         * @param[in, out] rssContent Reference to the string receiving the content.
+         * @param[in] szEOFMessage Error message used when the end of the file is reached before the closing quote.
+         * @throw XTOMLParseException Throws an exception when the end of the file was reached or an invalid escape sequence was
+         * detected.
+         */
+        static void ReadBasicStringContent(CCharacterReaderUTF8& rReader, std::string& rssContent, const char* szEOFMessage);
+
         /**
          * @brief Read a multi-line basic string. A basic string may contain any unicode character. Some characters need to be
          * escaped. The multi-line basis string is surrounded by three double quotes before and behind the string.
@@ -414,11 +425,6 @@ namespace toml_parser
         };
         enum_stack<EExpectation, EExpectation::undefined>
             m_stackExpectations; ///< Tracking of key or value expectations in nested structures
-
-        const std::vector<std::string>
-            m_vecKeyDelimiters{"\n", "\t", "\r", " ", "", ".", "=", "]"}; ///< Characters that delimit a key
-        const std::vector<std::string>
-            m_vecValueDelimiters{"\n", "\t", "\r", " ", ",", "", "]", "}", "#"}; ///< Characters that delimit a value
     };
 } // namespace toml_parser
 #endif // LEXER_TOML_H
@@ -465,9 +465,9 @@ namespace toml_parser
         return m_uiIndex;
     }
 
-    void CToken::RawDataInfo(const std::string& rssString, const TTokenList& rTokenList, const TTokenListIterator& ritLocation)
+    void CToken::RawDataInfo(std::string_view svString, const TTokenList& rTokenList, const TTokenListIterator& ritLocation)
     {
-        m_ssRawString = rssString;
+        m_ssRawString.assign(svString.data(), svString.size());
         m_optTokenList = rTokenList;
         m_optLocation = std::cref(ritLocation);
     }
@@ -16,6 +16,7 @@
 #define LEXER_TOML_TOKEN_H
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <list>
 #include <optional>
@@ -294,11 +295,11 @@ namespace toml_parser
     private:
         /**
          * @brief Set the string chunk from the original TOML belonging to this token and the location within the lexer token list.
-         * @param[in] rssString Reference to the string containing the "raw" value of the token.
+         * @param[in] svString View of the source string containing the "raw" value of the token.
          * @param[in] rTokenList Reference to the token list the iterator is referring to.
          * @param[in] ritLocation The location in the lexer list.
          */
-        void RawDataInfo(const std::string& rssString, const TTokenList& rTokenList, const TTokenListIterator& ritLocation);
+        void RawDataInfo(std::string_view svString, const TTokenList& rTokenList, const TTokenListIterator& ritLocation);
 
         /**
          * @brief Return the location in the lexer token list.
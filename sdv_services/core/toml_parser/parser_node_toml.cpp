@@ -246,6 +246,11 @@ namespace toml_parser
         return m_ssName;
     }
 
+    const std::string& CNode::Name() const
+    {
+        return m_ssName;
+    }
+
     sdv::u8string CNode::GetPath(bool bResolveArrays) const
     {
         bool bRoot = dynamic_cast<const CRootTable*>(this) ? true : false;
@@ -460,9 +465,10 @@ namespace toml_parser
 
         m_ptrParent = rptrParent;
         if (!rptrParent) return;
-        auto itNode = std::find(rptrParent->m_lstNodes.begin(), rptrParent->m_lstNodes.end(), shared_from_this());
-        if (itNode == rptrParent->m_lstNodes.end())
-            rptrParent->m_lstNodes.push_back(shared_from_this());
+
+        // A node is only part of the node list of its parent. Since the parent changed, the node cannot be part of the list yet.
+        // This prevents a linear search for each node being added, which becomes noticeable with large tables and table arrays.
+        rptrParent->m_lstNodes.push_back(shared_from_this());
     }
 
     std::shared_ptr<CNodeCollection> CNode::GetParentPtr() const
@@ -953,7 +959,7 @@ namespace toml_parser
         for (const auto& rptrNode : m_lstNodes)
         {
             if (!rptrNode) continue;
-            if (rptrNode->GetName() == prKey.first)
+            if (rptrNode->Name() == prKey.first)
             {
                 ptrNode = rptrNode;
                 break;
@@ -974,6 +980,58 @@ namespace toml_parser
         return static_cast<sdv::IInterfaceAccess*>(ptrNode.get());
     }
 
+    sdv::sequence<sdv::toml::SKeyValue> CNodeCollection::GetFlattened(/*in*/ bool bIncludeArrays) const
+    {
+        // Collect the values in a vector first; the sequence reallocates its buffer with every added element.
+        std::vector<sdv::toml::SKeyValue> vecKeyValues;
+        Flatten(std::string(), bIncludeArrays, vecKeyValues);
+        sdv::sequence<sdv::toml::SKeyValue> seqKeyValues(vecKeyValues.size());
+        std::move(vecKeyValues.begin(), vecKeyValues.end(), seqKeyValues.begin());
+        return seqKeyValues;
+    }
+
+    void CNodeCollection::Flatten(const std::string& rssPrefix, bool bIncludeArrays,
+        std::vector<sdv::toml::SKeyValue>& rvecKeyValues) const
+    {
+        auto fnAddNode = [&](const std::shared_ptr<CNode>& rptrNode, const std::string& rssKey)
+        {
+            switch (rptrNode->GetType())
+            {
+            case sdv::toml::ENodeType::node_array:
+                if (!bIncludeArrays) break;
+                [[fallthrough]];
+            case sdv::toml::ENodeType::node_table:
+                {
+                    auto ptrCollection = rptrNode->Cast<CNodeCollection>();
+                    if (ptrCollection) ptrCollection->Flatten(rssKey, bIncludeArrays, rvecKeyValues);
+                }
+                break;
+            case sdv::toml::ENodeType::node_invalid:
+                break;
+            default:
+                rvecKeyValues.push_back(sdv::toml::SKeyValue{rssKey, rptrNode->GetValue()});
+                break;
+            }
+        };
+
+        // Array elements are addressed by their index in the node order. Tables use the list of direct child nodes; the node order
+        // of a table could also contain grand children of implicitly defined tables.
+        if (GetType() == sdv::toml::ENodeType::node_array)
+        {
+            for (size_t nIndex = 0; nIndex < m_vecNodeOrder.size(); nIndex++)
+            {
+                if (m_vecNodeOrder[nIndex])
+                    fnAddNode(m_vecNodeOrder[nIndex], rssPrefix + "[" + std::to_string(nIndex) + "]");
+            }
+            return;
+        }
+        for (const std::shared_ptr<CNode>& rptrNode : m_lstNodes)
+        {
+            if (rptrNode)
+                fnAddNode(rptrNode, rssPrefix.empty() ? rptrNode->Name() : rssPrefix + "." + rptrNode->Name());
+        }
+    }
+
     sdv::IInterfaceAccess* CNodeCollection::InsertValue(uint32_t uiIndex, const sdv::u8string& ssName, sdv::any_t anyValue)
     {
         std::stringstream sstreamTOML;
@@ -300,6 +300,12 @@ namespace toml_parser
          */
         virtual sdv::u8string GetName() const override;
 
+        /**
+         * @brief Get a reference to the node name without creating a copy (no conversion to a literal or quoted key is made).
+         * @return Reference to the string containing the name of the node.
+         */
+        const std::string& Name() const;
+
         /**
          * @brief Get the node path following the key rules for bar, literal and quoted keys. Overload of
          * sdv::toml::INodeInfo::GetPath.
@@ -920,7 +926,7 @@ namespace toml_parser
      * @brief Base structure for arrays and tables.
      */
     class CNodeCollection : public CNode, public sdv::toml::INodeCollection, public sdv::toml::INodeCollectionInsert,
-        public sdv::toml::INodeCollectionConvert
+        public sdv::toml::INodeCollectionConvert, public sdv::toml::INodeCollectionFlatten
     {
         // Friend class CNode.
         friend CNode;
@@ -939,6 +945,7 @@ namespace toml_parser
             SDV_INTERFACE_ENTRY(sdv::toml::INodeCollection)
             SDV_INTERFACE_ENTRY(sdv::toml::INodeCollectionInsert)
             SDV_INTERFACE_ENTRY(sdv::toml::INodeCollectionConvert)
+            SDV_INTERFACE_ENTRY(sdv::toml::INodeCollectionFlatten)
             SDV_INTERFACE_CHAIN_BASE(CNode)
         END_SDV_INTERFACE_MAP()
 
@@ -993,6 +1000,17 @@ namespace toml_parser
          */
         virtual sdv::IInterfaceAccess* GetNodeDirect(/*in*/ const sdv::u8string& ssPath) const override;
 
+        /**
+         * @brief Get all values of the collection and of its child collections with one call. Overload of
+         * sdv::toml::INodeCollectionFlatten::GetFlattened.
+         * @details The keys are composed of the node names separated by a dot; array elements are addressed by their index
+         * in brackets. The keys are not quoted. The values are returned in the order they are defined.
+         * @param[in] bIncludeArrays When set, the elements of arrays and table arrays are included as well. Otherwise arrays
+         * and their content are skipped.
+         * @return Sequence with the key/value pairs.
+         */
+        virtual sdv::sequence<sdv::toml::SKeyValue> GetFlattened(/*in*/ bool bIncludeArrays) const override;
+
         /**
          * @brief Insert a value into the collection at the location before the supplied index. Overload of
          * sdv::toml::INodeCollectionInsert::InsertValue.
@@ -1192,6 +1210,15 @@ namespace toml_parser
         virtual bool Reduce(const std::shared_ptr<CNodeCollection>& rptrCollection) = 0;
 
     private:
+        /**
+         * @brief Add the values of the child nodes to the flattened key/value sequence (recursively).
+         * @param[in] rssPrefix Reference to the key prefix of the child nodes; empty for the collection the flattening started
+         * with.
+         * @param[in] bIncludeArrays When set, the elements of arrays and table arrays are included as well.
+         * @param[in, out] rvecKeyValues Reference to the vector the key/value pairs are added to.
+         */
+        void Flatten(const std::string& rssPrefix, bool bIncludeArrays, std::vector<sdv::toml::SKeyValue>& rvecKeyValues) const;
+
         /**
          * @brief When set, the child nodes need grouping (values following each other, tables and table arrays at the end).
          */
@@ -1586,9 +1613,10 @@ namespace toml_parser
         auto prKey = SplitNodeKey(rrangeKeyPath);
 
         // Find the node if it exists.
+        const std::string ssKey = prKey.first.get().StringValue();
         auto itNode = std::find_if(m_lstNodes.begin(),
             m_lstNodes.end(),
-            [&](const std::shared_ptr<CNode>& rptrNode) { return rptrNode->GetName() == prKey.first.get().StringValue(); });
+            [&](const std::shared_ptr<CNode>& rptrNode) { return rptrNode->Name() == ssKey; });
 
         // Is this the target node?
         std::shared_ptr<CNode> ptrNode;
@@ -35,10 +35,21 @@ namespace toml_parser
     }
 
     bool CParser::Process(/*in*/ const sdv::u8string& ssContent)
+    {
+        return ProcessContent(ssContent, false);
+    }
+
+    bool CParser::ProcessReadOnly(/*in*/ const sdv::u8string& ssContent)
+    {
+        return ProcessContent(ssContent, true);
+    }
+
+    bool CParser::ProcessContent(const std::string& rssContent, bool bReadOnly)
     {
         // Process the TOML string
         Clear();
-        m_lexer.Feed(ssContent);
+        m_bReadOnly = bReadOnly;
+        m_lexer.Feed(rssContent);
 
         // Create the root node.
         m_ptrRoot = std::make_shared<CRootTable>(*this);
@@ -100,7 +111,7 @@ namespace toml_parser
         }
 
         // In case there are no nodes any more, but still comments and whitespace, attach this to the root node.
-        if (refStartNodeToken.get() != m_lexer.Peek())
+        if (!m_bReadOnly && refStartNodeToken.get() != m_lexer.Peek())
         {
             rangeRootTokens.NodeMain(CTokenRange(refStartNodeToken, refStartNodeToken));
             rangeRootTokens.LinesBehindNode(m_lexer.Peek());
@@ -151,14 +162,14 @@ namespace toml_parser
 
         // Assign the main token range to the node token range and let the lexer determine the extended token range
         rNodeRange.NodeMain(rangeMain);
-        m_lexer.SmartExtendNodeRange(rNodeRange);
+        if (!m_bReadOnly) m_lexer.SmartExtendNodeRange(rNodeRange);
 
         // Add the table to the root
         auto ptrTable = m_ptrRoot->Insert<CTable>(sdv::toml::npos, rangeKeyPath, false);
         if (ptrTable)
         {
             m_ptrCurrentCollection = ptrTable->Cast<CTable>();
-            ptrTable->UpdateNodeCode(rNodeRange);
+            if (!m_bReadOnly) ptrTable->UpdateNodeCode(rNodeRange);
         }
     }
 
@@ -173,14 +184,14 @@ namespace toml_parser
 
         // Assign the main token range to the node token range and let the lexer determine the extended token range
         rNodeRange.NodeMain(rangeMain);
-        m_lexer.SmartExtendNodeRange(rNodeRange);
+        if (!m_bReadOnly) m_lexer.SmartExtendNodeRange(rNodeRange);
 
         // Add the table array to the root
         auto ptrTableArray = m_ptrRoot->Insert<CTableArray>(sdv::toml::npos, rangeKeyPath);
         if (ptrTableArray)
         {
             m_ptrCurrentCollection = ptrTableArray->Cast<CNodeCollection>();
-            ptrTableArray->UpdateNodeCode(rNodeRange);
+            if (!m_bReadOnly) ptrTableArray->UpdateNodeCode(rNodeRange);
         }
     }
 
@@ -290,7 +301,7 @@ namespace toml_parser
         }
 
         // let the lexer determine the extended token range and update the node
-        m_lexer.SmartExtendNodeRange(rNodeRange);
+        if (!m_bReadOnly) m_lexer.SmartExtendNodeRange(rNodeRange);
 
         // Deal with the next value if expecting
         std::reference_wrapper<const CToken> refToken = m_lexer.Peek();
@@ -341,7 +352,7 @@ namespace toml_parser
                 throw XTOMLParseException("Invalid Token after value assignment; newline needed");
             }
         }
-        if (ptrNode) ptrNode->UpdateNodeCode(rNodeRange);
+        if (ptrNode && !m_bReadOnly) ptrNode->UpdateNodeCode(rNodeRange);
     }
 
     void CParser::ProcessArray(CNodeTokenRange& rNodeRange)
@@ -30,7 +30,7 @@ namespace toml_parser
     /**
      * @brief Creates a tree structure from input of UTF-8 encoded TOML source data
      */
-    class CParser : public sdv::IInterfaceAccess, public sdv::toml::ITOMLParser
+    class CParser : public sdv::IInterfaceAccess, public sdv::toml::ITOMLParser, public sdv::toml::ITOMLParserReadOnly
     {
     public:
         /**
@@ -42,6 +42,7 @@ namespace toml_parser
         // Interface map
         BEGIN_SDV_INTERFACE_MAP()
             SDV_INTERFACE_ENTRY(sdv::toml::ITOMLParser)
+            SDV_INTERFACE_ENTRY(sdv::toml::ITOMLParserReadOnly)
             SDV_INTERFACE_CHAIN_MEMBER(m_ptrRoot)
         END_SDV_INTERFACE_MAP()
 
@@ -60,6 +61,14 @@ namespace toml_parser
          */
         virtual bool Process(/*in*/ const sdv::u8string& ssContent) override;
 
+        /**
+         * @brief Process the configuration from the supplied content string without preserving comments and whitespace. Overload
+         * of sdv::toml::ITOMLParserReadOnly.
+         * @param[in] ssContent Configuration string.
+         * @return Returns 'true' when the configuration could be read successfully, false when not.
+         */
+        virtual bool ProcessReadOnly(/*in*/ const sdv::u8string& ssContent) override;
+
         /**
          * @brief Get the lexer containing the token list.
          * @return A reference to the lexer containing the token list.
@@ -86,6 +95,14 @@ namespace toml_parser
         std::string GenerateTOML(const std::string& rssPrefixKey = std::string()) const;
 
     private:
+        /**
+         * @brief Process the configuration from the supplied content string.
+         * @param[in] rssContent Reference to the configuration string.
+         * @param[in] bReadOnly When set, the code snippets containing comments and whitespace are not extracted for the nodes.
+         * @return Returns 'true' when the configuration could be read successfully, false when not.
+         */
+        bool ProcessContent(const std::string& rssContent, bool bReadOnly);
+
         /**
          * @brief Process a table declaration.
          * @param[in, out] rNodeRange Reference to the extended token range of the node.
@@ -143,6 +160,7 @@ namespace toml_parser
         std::shared_ptr<CRootTable>                     m_ptrRoot;              ///< The one root node.
         std::shared_ptr<CNodeCollection>                m_ptrCurrentCollection; ///< The current collection node.
         CLexer                                          m_lexer;                ///< Lexer.
+        bool                                            m_bReadOnly = false;    ///< When set, no code snippets are extracted.
     };
 } // namespace toml_parser
 
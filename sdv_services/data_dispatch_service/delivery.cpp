@@ -0,0 +1,235 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "delivery.h"
+#include <support/latency_trace.h>
+
+namespace
+{
+    /**
+     * @brief Update an atomic maximum value.
+     * @param[in, out] ruiMax Reference to the maximum.
+     * @param[in] uiValue The value to compare with.
+     */
+    void UpdateMax(std::atomic_uint64_t& ruiMax, uint64_t uiValue)
+    {
+        uint64_t uiMax = ruiMax.load(std::memory_order_relaxed);
+        while (uiValue > uiMax && !ruiMax.compare_exchange_weak(uiMax, uiValue, std::memory_order_relaxed)) {}
+    }
+}
+
+CDeliveryQueue::CDeliveryQueue(CDeliveryExecutor& rExecutor, sdv::core::ISignalReceiveEvent* pEvent, size_t nSize,
+    bool bCoalesce, uint32_t uiTraceKey /*= 0*/) :
+    m_rExecutor(rExecutor), m_pEvent(pEvent), m_bCoalesce(bCoalesce), m_uiTraceKey(uiTraceKey)
+{
+    if (!m_bCoalesce)
+    {
+        size_t nRingSize = 1;
+        while (nRingSize < nSize) nRingSize <<= 1;
+        m_vecRing.resize(nRingSize);
+    }
+}
+
+void CDeliveryQueue::Push(const sdv::any_t& ranyVal)
+{
+    if (m_bStop) return;
+
+    if (m_bCoalesce)
+    {
+        while (m_flagPending.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+        m_sPending.anyVal = ranyVal;
+        m_sPending.tpPushed = std::chrono::steady_clock::now();
+        m_sPending.uiTraceID = SDV_LATENCY_TRACE_GET_ID();
+        bool bReplaced = m_bPending.exchange(true);
+        m_flagPending.clear(std::memory_order_release);
+        if (bReplaced)
+        {
+            m_uiCoalesced++;
+            m_rExecutor.GetMetrics().counterCoalesced.Increment();
+        }
+        else
+            UpdateMax(m_uiMaxDepth, 1);
+    }
+    else
+    {
+        size_t nHead = m_nHead.load(std::memory_order_relaxed);
+        size_t nTail = m_nTail.load(std::memory_order_acquire);
+        if (nHead - nTail >= m_vecRing.size())
+        {
+            m_uiDropped++;
+            m_rExecutor.GetMetrics().counterDropped.Increment();
+            return;
+        }
+        SEntry& rsEntry = m_vecRing[nHead & (m_vecRing.size() - 1)];
+        rsEntry.anyVal = ranyVal;
+        rsEntry.tpPushed = std::chrono::steady_clock::now();
+        rsEntry.uiTraceID = SDV_LATENCY_TRACE_GET_ID();
+        m_nHead.store(nHead + 1);
+        UpdateMax(m_uiMaxDepth, nHead + 1 - nTail);
+    }
+
+    // Schedule the queue unless already scheduled. The executor clears the flag before checking for pending values, which
+    // prevents a value from being left in the queue.
+    if (!m_bScheduled.exchange(true))
+        m_rExecutor.Schedule(shared_from_this());
+}
+
+void CDeliveryQueue::Stop()
+{
+    m_bStop = true;
+
+    // Wait for a running delivery to finish, unless called from within the delivery.
+    if (m_idDeliveryThread.load() == std::this_thread::get_id()) return;
+    std::unique_lock<std::mutex> lock(m_mtxDelivery);
+}
+
+void CDeliveryQueue::Drain(size_t nMaxCount)
+{
+    for (size_t n = 0; n < nMaxCount && !m_bStop; n++)
+    {
+        SEntry sEntry;
+        if (!Pop(sEntry)) break;
+
+        std::unique_lock<std::mutex> lock(m_mtxDelivery);
+        if (m_bStop) break;
+        uint64_t uiLatency = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - sEntry.tpPushed).count());
+        m_uiLatencySum += uiLatency;
+        UpdateMax(m_uiMaxLatency, uiLatency);
+        m_rExecutor.GetMetrics().histLatency.Observe(uiLatency);
+        m_idDeliveryThread = std::this_thread::get_id();
+
+        // Continue the latency trace of the writing thread
+        SDV_LATENCY_TRACE_SET_ID(sEntry.uiTraceID);
+        SDV_LATENCY_TRACE(sdv::core::ETraceStage::dispatch_deliver, m_uiTraceKey);
+        m_pEvent->Receive(sEntry.anyVal);
+        SDV_LATENCY_TRACE_SET_ID(0);
+        m_idDeliveryThread = std::thread::id();
+        m_uiDelivered++;
+        m_rExecutor.GetMetrics().counterDelivered.Increment();
+    }
+
+    // Release the queue and reschedule when values arrived in the mean time (or the maximum count was reached).
+    m_bScheduled = false;
+    if (!m_bStop && HasPending() && !m_bScheduled.exchange(true))
+        m_rExecutor.Schedule(shared_from_this());
+}
+
+void CDeliveryQueue::GetStatistics(sdv::core::SSubscriptionStatistics& rsStatistics) const
+{
+    rsStatistics.uiDelivered += m_uiDelivered;
+    rsStatistics.uiDropped = m_uiDropped;
+    rsStatistics.uiCoalesced = m_uiCoalesced;
+    rsStatistics.uiQueueDepth = m_bCoalesce ? (m_bPending ? 1 : 0) : m_nHead.load() - m_nTail.load();
+    rsStatistics.uiMaxQueueDepth = m_uiMaxDepth;
+    uint64_t uiDelivered = m_uiDelivered;
+    rsStatistics.uiAvgLatency = uiDelivered ? m_uiLatencySum / uiDelivered : 0;
+    rsStatistics.uiMaxLatency = m_uiMaxLatency;
+}
+
+bool CDeliveryQueue::Pop(SEntry& rsEntry)
+{
+    if (m_bCoalesce)
+    {
+        if (!m_bPending) return false;
+        while (m_flagPending.test_and_set(std::memory_order_acquire)) std::this_thread::yield();
+        rsEntry = std::move(m_sPending);
+        m_sPending.anyVal.clear();
+        m_bPending = false;
+        m_flagPending.clear(std::memory_order_release);
+        return true;
+    }
+
+    size_t nTail = m_nTail.load(std::memory_order_relaxed);
+    if (nTail == m_nHead.load(std::memory_order_acquire)) return false;
+    SEntry& rsRingEntry = m_vecRing[nTail & (m_vecRing.size() - 1)];
+    rsEntry = std::move(rsRingEntry);
+    rsRingEntry.anyVal.clear();
+    m_nTail.store(nTail + 1, std::memory_order_release);
+    return true;
+}
+
+bool CDeliveryQueue::HasPending() const
+{
+    return m_bCoalesce ? m_bPending.load() : m_nHead.load() != m_nTail.load();
+}
+
+CDeliveryExecutor::~CDeliveryExecutor()
+{
+    Stop();
+}
+
+void CDeliveryExecutor::Start(size_t nThreads)
+{
+    std::unique_lock<std::mutex> lock(m_mtxQueues);
+    if (!m_vecThreads.empty()) return;
+    m_bStop = false;
+    if (!nThreads) nThreads = 1;
+    for (size_t n = 0; n < nThreads; n++)
+        m_vecThreads.emplace_back(&CDeliveryExecutor::ThreadFunc, this);
+}
+
+void CDeliveryExecutor::Stop()
+{
+    std::vector<std::thread> vecThreads;
+    std::unique_lock<std::mutex> lock(m_mtxQueues);
+    m_bStop = true;
+    m_dequeQueues.clear();
+    vecThreads = std::move(m_vecThreads);
+    m_vecThreads.clear();
+    lock.unlock();
+    m_cvQueues.notify_all();
+    for (std::thread& rthread : vecThreads)
+    {
+        if (rthread.get_id() == std::this_thread::get_id())
+            rthread.detach();
+        else if (rthread.joinable())
+            rthread.join();
+    }
+}
+
+void CDeliveryExecutor::Schedule(std::shared_ptr<CDeliveryQueue> ptrQueue)
+{
+    std::unique_lock<std::mutex> lock(m_mtxQueues);
+    if (m_bStop || m_vecThreads.empty()) return;
+    m_dequeQueues.push_back(std::move(ptrQueue));
+    lock.unlock();
+    m_cvQueues.notify_one();
+}
+
+CDeliveryExecutor::SMetrics& CDeliveryExecutor::GetMetrics()
+{
+    return m_sMetrics;
+}
+
+void CDeliveryExecutor::ThreadFunc()
+{
+    // Maximum amount of values delivered to one subscriber before servicing the next scheduled queue.
+    const size_t nBatchSize = 64;
+
+    std::unique_lock<std::mutex> lock(m_mtxQueues);
+    while (!m_bStop)
+    {
+        if (m_dequeQueues.empty())
+        {
+            m_cvQueues.wait(lock);
+            continue;
+        }
+        std::shared_ptr<CDeliveryQueue> ptrQueue = std::move(m_dequeQueues.front());
+        m_dequeQueues.pop_front();
+        lock.unlock();
+        ptrQueue->Drain(nBatchSize);
+        ptrQueue.reset();
+        lock.lock();
+    }
+}
@@ -0,0 +1,202 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef DELIVERY_H
+#define DELIVERY_H
+
+#include <interfaces/dispatch.h>
+#include <support/metrics.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Forward declaration
+class CDeliveryExecutor;
+
+/**
+ * @brief Asynchronous delivery queue of a subscription. The thread writing the signal (producer) stores the values in a fixed size
+ * ring buffer, which is emptied by a thread of the delivery executor calling the subscriber. This prevents a slow subscriber from
+ * delaying the writer and the other subscribers of the signal.
+ * @details The producers are serialized by the signal (the consumer map is locked during distribution) and only one executor
+ * thread drains the queue at a time, so the ring buffer is a single-producer single-consumer queue. When the ring buffer is full,
+ * the value is dropped. With coalescing, the queue only holds the most recent value; a pending value that was not delivered yet
+ * is replaced by the newer value.
+ */
+class CDeliveryQueue : public std::enable_shared_from_this<CDeliveryQueue>
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param[in] rExecutor Reference to the executor draining the queue.
+     * @param[in] pEvent Pointer to the receive event interface of the subscriber.
+     * @param[in] nSize The minimum amount of values the queue can hold; rounded up to the next power of two.
+     * @param[in] bCoalesce When set, only the most recent value is kept.
+     * @param[in] uiTraceKey Key of the signal used for the latency trace points.
+     */
+    CDeliveryQueue(CDeliveryExecutor& rExecutor, sdv::core::ISignalReceiveEvent* pEvent, size_t nSize, bool bCoalesce,
+        uint32_t uiTraceKey = 0);
+
+    /**
+     * @brief Add a value to the queue and schedule the queue at the executor if not scheduled already.
+     * @param[in] ranyVal Reference to the value.
+     */
+    void Push(const sdv::any_t& ranyVal);
+
+    /**
+     * @brief Stop the delivery. Values still in the queue are discarded. After the function returns, the subscriber is not called
+     * any more. If called from within the delivery to this subscriber, the delivery ends after returning from the subscriber.
+     */
+    void Stop();
+
+    /**
+     * @brief Deliver the pending values to the subscriber. Called by the executor.
+     * @param[in] nMaxCount The maximum amount of values to deliver before returning; allows the executor to service other queues.
+     */
+    void Drain(size_t nMaxCount);
+
+    /**
+     * @brief Add the delivery statistics of the queue to the subscription statistics.
+     * @param[in, out] rsStatistics Reference to the statistics to update.
+     */
+    void GetStatistics(sdv::core::SSubscriptionStatistics& rsStatistics) const;
+
+private:
+    /**
+     * @brief Queue entry.
+     */
+    struct SEntry
+    {
+        sdv::any_t                              anyVal;         ///< The value.
+        std::chrono::steady_clock::time_point   tpPushed;       ///< Time the value was added to the queue.
+        uint64_t                                uiTraceID = 0;  ///< Latency trace ID of the writing thread.
+    };
+
+    /**
+     * @brief Take the next value from the queue.
+     * @param[out] rsEntry Reference to the entry receiving the value.
+     * @return Returns whether a value was available.
+     */
+    bool Pop(SEntry& rsEntry);
+
+    /**
+     * @brief Returns whether values are pending.
+     * @return Returns 'true' when at least one value is waiting for delivery.
+     */
+    bool HasPending() const;
+
+    CDeliveryExecutor&                  m_rExecutor;                        ///< Executor draining the queue.
+    sdv::core::ISignalReceiveEvent*     m_pEvent = nullptr;                 ///< Subscriber receive event interface.
+    bool                                m_bCoalesce = false;                ///< Keep only the most recent value.
+    uint32_t                            m_uiTraceKey = 0;                   ///< Latency trace key of the signal.
+    std::vector<SEntry>                 m_vecRing;                          ///< Ring buffer; the size is a power of two.
+    alignas(64) std::atomic<size_t>     m_nHead{0};                         ///< Write position (only incremented).
+    alignas(64) std::atomic<size_t>     m_nTail{0};                         ///< Read position (only incremented).
+    std::atomic_flag                    m_flagPending = ATOMIC_FLAG_INIT;   ///< Protects the pending coalesced value.
+    SEntry                              m_sPending;                         ///< Pending coalesced value.
+    std::atomic_bool                    m_bPending{false};                  ///< Set when the coalesced value is pending.
+    std::atomic_bool                    m_bScheduled{false};                ///< Set while scheduled at or drained by the executor.
+    std::atomic_bool                    m_bStop{false};                     ///< Set when the delivery is stopped.
+    std::mutex                          m_mtxDelivery;                      ///< Held during the delivery to the subscriber.
+    std::atomic<std::thread::id>        m_idDeliveryThread{};               ///< Thread currently delivering.
+    std::atomic_uint64_t                m_uiDelivered{0};                   ///< Amount of delivered values.
+    std::atomic_uint64_t                m_uiDropped{0};                     ///< Amount of values dropped (queue full).
+    std::atomic_uint64_t                m_uiCoalesced{0};                   ///< Amount of values replaced by a newer value.
+    std::atomic_uint64_t                m_uiMaxDepth{0};                    ///< Maximum observed queue depth.
+    std::atomic_uint64_t                m_uiLatencySum{0};                  ///< Sum of the delivery latencies (us).
+    std::atomic_uint64_t                m_uiMaxLatency{0};                  ///< Maximum delivery latency (us).
+};
+
+/**
+ * @brief Executor draining the delivery queues of the asynchronous subscriptions with a small pool of threads. A queue is
+ * scheduled when it receives a value while not being scheduled; one thread at a time drains a queue, which maintains the order of
+ * the values of a subscription.
+ */
+class CDeliveryExecutor
+{
+public:
+    /**
+     * @brief Runtime metrics of the asynchronous delivery; updated by the queues.
+     */
+    struct SMetrics
+    {
+        /// Amount of asynchronous deliveries to subscribers.
+        sdv::core::CMetricCounter   counterDelivered{"sdv_dispatch_deliveries_total{mode=\"async\"}",
+            "Amount of signal values delivered to subscribers."};
+
+        /// Amount of values dropped because the delivery queue was full.
+        sdv::core::CMetricCounter   counterDropped{"sdv_dispatch_delivery_dropped_total",
+            "Amount of signal values dropped because the delivery queue of a subscriber was full."};
+
+        /// Amount of values replaced by a newer value before being delivered.
+        sdv::core::CMetricCounter   counterCoalesced{"sdv_dispatch_delivery_coalesced_total",
+            "Amount of signal values replaced by a newer value before delivery to a subscriber."};
+
+        /// Latency between writing and delivering a value.
+        sdv::core::CMetricHistogram histLatency{"sdv_dispatch_delivery_latency_us",
+            "Latency between writing a signal value and delivering it to an asynchronous subscriber (us).",
+            sdv::core::GetMetricDurationBounds()};
+    };
+
+    /**
+     * @brief Default constructor.
+     */
+    CDeliveryExecutor() = default;
+
+    /**
+     * @brief Destructor; stops the threads.
+     */
+    ~CDeliveryExecutor();
+
+    /**
+     * @brief Start the delivery threads if not started already.
+     * @param[in] nThreads The amount of threads to start.
+     */
+    void Start(size_t nThreads);
+
+    /**
+     * @brief Stop the delivery threads. Scheduled queues are not drained any more.
+     */
+    void Stop();
+
+    /**
+     * @brief Schedule a queue for delivery.
+     * @param[in] ptrQueue Shared pointer to the queue.
+     */
+    void Schedule(std::shared_ptr<CDeliveryQueue> ptrQueue);
+
+    /**
+     * @brief Get the runtime metrics of the asynchronous delivery.
+     * @return Reference to the metrics.
+     */
+    SMetrics& GetMetrics();
+
+private:
+    /**
+     * @brief Delivery thread function.
+     */
+    void ThreadFunc();
+
+    std::mutex                                      m_mtxQueues;            ///< Protection of the scheduled queue list.
+    std::condition_variable                         m_cvQueues;             ///< Signals scheduled queues.
+    std::deque<std::shared_ptr<CDeliveryQueue>>     m_dequeQueues;          ///< Scheduled queues.
+    std::vector<std::thread>                        m_vecThreads;           ///< Delivery threads.
+    bool                                            m_bStop = false;        ///< Set when the threads should end.
+    SMetrics                                        m_sMetrics;             ///< Runtime metrics.
+};
+
+#endif // !defined DELIVERY_H
@@ -12,6 +12,7 @@
  ********************************************************************************/
 
 #include "dispatchservice.h"
+#include <algorithm>
 
 
 CDispatchService::CDispatchService()
@@ -93,6 +94,19 @@ sdv::IInterfaceAccess* CDispatchService::AddSignalSubscription(/*in*/ const sdv:
     return itSignal->second.CreateConsumer(pSubscriber);
 }
 
+sdv::IInterfaceAccess* CDispatchService::AddSignalSubscriptionEx(/*in*/ const sdv::u8string& ssSignalName,
+    /*in*/ sdv::IInterfaceAccess* pSubscriber, /*in*/ const sdv::core::SSubscriptionPolicy& sPolicy)
+{
+    if (GetObjectState() != sdv::EObjectState::configuring) return nullptr;
+
+    std::unique_lock<std::mutex> lock(m_mtxSignals);
+    auto itSignal = m_mapRxSignals.find(ssSignalName);
+    if (itSignal == m_mapRxSignals.end()) return nullptr;
+    if (itSignal->second.GetDirection() != sdv::core::ESignalDirection::sigdir_rx)
+        return nullptr;
+    return itSignal->second.CreateConsumer(pSubscriber, &sPolicy);
+}
+
 sdv::sequence<sdv::core::SSignalRegistration> CDispatchService::GetRegisteredSignals() const
 {
     sdv::sequence<sdv::core::SSignalRegistration> seqRegistrations;
@@ -110,12 +124,31 @@ sdv::IInterfaceAccess* CDispatchService::CreateTransaction()
     // operation mode.
 
     std::unique_lock<std::mutex> lock(m_mtxTransactions);
-    auto itTransaction = m_lstTransactions.emplace(m_lstTransactions.end(), *this);
+    std::list<CTransaction>::iterator itTransaction;
+    if (!m_lstTransactionPool.empty())
+    {
+        // Reuse a finished transaction object; moving the list node prevents an allocation.
+        itTransaction = m_lstTransactionPool.begin();
+        m_lstTransactions.splice(m_lstTransactions.end(), m_lstTransactionPool, itTransaction);
+        itTransaction->Reset();
+    }
+    else
+        itTransaction = m_lstTransactions.emplace(m_lstTransactions.end(), *this);
     if (itTransaction == m_lstTransactions.end()) return nullptr;
     itTransaction->SetIterator(itTransaction);
     return &(*itTransaction);
 }
 
+sdv::core::SSignalHistoryStatistics CDispatchService::GetHistoryStatistics() const
+{
+    sdv::core::SSignalHistoryStatistics sStatistics{};
+    sStatistics.uiSnapshotReads = m_sHistoryCounters.uiSnapshotReads;
+    sStatistics.uiSnapshotTooOld = m_sHistoryCounters.uiSnapshotTooOld;
+    sStatistics.uiHistoryExtensions = m_sHistoryCounters.uiHistoryExtensions;
+    sStatistics.uiHistoryLimitHits = m_sHistoryCounters.uiHistoryLimitHits;
+    return sStatistics;
+}
+
 uint64_t CDispatchService::GetNextTransactionID()
 {
     return m_uiTransactionCnt++;
@@ -131,15 +164,64 @@ uint64_t CDispatchService::GetDirectTransactionID() const
     return m_uiDirectTransactionID;
 }
 
+void CDispatchService::UpdateReadEpoch()
+{
+    std::unique_lock<std::mutex> lock(m_mtxTransactions);
+    CalcReadEpoch();
+}
+
+uint64_t CDispatchService::GetReadEpoch() const
+{
+    return m_uiReadEpoch;
+}
+
+size_t CDispatchService::GetHistoryDepth() const
+{
+    return m_uiHistoryDepth;
+}
+
+size_t CDispatchService::GetHistoryMaxDepth() const
+{
+    return std::max(m_uiHistoryDepth, m_uiHistoryMaxDepth);
+}
+
+CDispatchService::SHistoryCounters& CDispatchService::GetHistoryCounters()
+{
+    return m_sHistoryCounters;
+}
+
+CDispatchService::SMetrics& CDispatchService::GetMetrics()
+{
+    return m_sMetrics;
+}
+
+CDeliveryExecutor& CDispatchService::GetDeliveryExecutor()
+{
+    m_executor.Start(m_uiDeliveryThreads);
+    return m_executor;
+}
+
+void CDispatchService::CalcReadEpoch()
+{
+    uint64_t uiReadEpoch = UINT64_MAX;
+    for (const CTransaction& rTransaction : m_lstTransactions)
+    {
+        if (rTransaction.IsReadTransaction())
+            uiReadEpoch = std::min(uiReadEpoch, rTransaction.GetReadTransactionID());
+    }
+    m_uiReadEpoch = uiReadEpoch;
+}
+
 bool CDispatchService::OnInitialize()
 {
-    m_scheduler.Start();
+    m_scheduler.Start(m_threadAttributes);
     return true;
 }
 
 void CDispatchService::OnShutdown()
 {
     m_scheduler.Stop();
+    m_executor.Stop();
 }
 
 void CDispatchService::UnregisterSignal(/*in*/ const sdv::u8string& ssSignalName, sdv::core::ESignalDirection eDirection)
@@ -179,9 +261,16 @@ void CDispatchService::FinishTransaction(const CTransaction* pTransaction)
 
     std::unique_lock<std::mutex> lock(m_mtxTransactions);
 
-    // Delete the transaction
+    // Return the transaction to the pool for reuse or delete the transaction when the pool is full.
     auto itTransaction = pTransaction->GetIterator();
-    m_lstTransactions.erase(itTransaction);
+    bool bReadTransaction = pTransaction->IsReadTransaction();
+    if (m_lstTransactionPool.size() < m_nTransactionPoolSize)
+        m_lstTransactionPool.splice(m_lstTransactionPool.end(), m_lstTransactions, itTransaction);
+    else
+        m_lstTransactions.erase(itTransaction);
+
+    // The values kept for the read transaction can be reclaimed.
+    if (bReadTransaction) CalcReadEpoch();
 }
 
 CScheduler& CDispatchService::GetScheduler()
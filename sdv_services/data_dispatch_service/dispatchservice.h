@@ -16,10 +16,12 @@
 
 #include <interfaces/dispatch.h>
 #include <support/component_impl.h>
+#include <support/metrics.h>
 #include <memory>
 #include <map>
 #include <list>
 #include <set>
+#include <vector>
 
 // Data dispatch service for CAN:
 //
@@ -36,14 +38,45 @@
 #include "transaction.h"
 #include "signal.h"
 #include "trigger.h"
+#include "delivery.h"
 
 /**
 * @brief data dispatch service to read/write and react on signal changes
 */
 class CDispatchService : public sdv::CSdvObject, public sdv::core::ISignalTransmission, public sdv::core::ISignalAccess,
-    public sdv::core::IDispatchTransaction
+    public sdv::core::IDispatchTransaction, public sdv::core::ISignalHistoryStatistics, public sdv::core::ISignalAccessEx
 {
 public:
+    /**
+     * @brief Counters of the signal value history; updated by the signals.
+     */
+    struct SHistoryCounters
+    {
+        std::atomic_uint64_t    uiSnapshotReads{0};         ///< Amount of reads using a read transaction.
+        std::atomic_uint64_t    uiSnapshotTooOld{0};        ///< Amount of reads with a transaction older than the history.
+        std::atomic_uint64_t    uiHistoryExtensions{0};     ///< Amount of history extensions for active read transactions.
+        std::atomic_uint64_t    uiHistoryLimitHits{0};      ///< Amount of overwrites of values needed by read transactions.
+    };
+
+    /**
+     * @brief Runtime metrics of the dispatch service; updated by the signals and triggers. The asynchronous delivery has metrics
+     * of its own (see CDeliveryExecutor::SMetrics).
+     */
+    struct SMetrics
+    {
+        /// Amount of signal values written by the providers.
+        sdv::core::CMetricCounter   counterWrites{"sdv_dispatch_signal_writes_total",
+            "Amount of signal values written by the providers."};
+
+        /// Amount of synchronous deliveries to subscribers.
+        sdv::core::CMetricCounter   counterDelivered{"sdv_dispatch_deliveries_total{mode=\"sync\"}",
+            "Amount of signal values delivered to subscribers."};
+
+        /// Amount of trigger executions.
+        sdv::core::CMetricCounter   counterTriggers{"sdv_dispatch_trigger_executions_total",
+            "Amount of executed transmit triggers."};
+    };
+
     /**
      * @brief Constructor
      */
@@ -53,7 +86,9 @@ public:
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::core::ISignalTransmission)
         SDV_INTERFACE_ENTRY(sdv::core::ISignalAccess)
+        SDV_INTERFACE_ENTRY(sdv::core::ISignalAccessEx)
         SDV_INTERFACE_ENTRY(sdv::core::IDispatchTransaction)
+        SDV_INTERFACE_ENTRY(sdv::core::ISignalHistoryStatistics)
     END_SDV_INTERFACE_MAP()
 
     // Object declarations
@@ -62,6 +97,17 @@ public:
     DECLARE_OBJECT_SINGLETON()
     DECLARE_OBJECT_DEPENDENCIES("TaskTimerService")
 
+    // Parameter map
+    BEGIN_SDV_PARAM_MAP()
+        SDV_PARAM_NUMBER_ENTRY(m_uiHistoryDepth, "HistoryDepth", 16u, >= 2u, <= 4096u, "",
+            "Amount of values kept per signal for read transactions.")
+        SDV_PARAM_NUMBER_ENTRY(m_uiHistoryMaxDepth, "HistoryMaxDepth", 64u, >= 2u, <= 4096u, "",
+            "Amount of values a signal history can grow to while the oldest value is still needed by a read transaction.")
+        SDV_PARAM_NUMBER_ENTRY(m_uiDeliveryThreads, "DeliveryThreads", 2u, >= 1u, <= 64u, "",
+            "Amount of threads delivering signal values to subscriptions with asynchronous delivery.")
+        SDV_PARAM_CHAIN_MEMBER(m_threadAttributes)
+    END_SDV_PARAM_MAP()
+
     /**
     * @brief Create a TX trigger object that defines how to trigger the signal transmission. Overload of
     * sdv::core::ISignalTransmission::CreateTxTrigger.
@@ -122,6 +168,18 @@ public:
      */
     virtual sdv::IInterfaceAccess* AddSignalSubscription(/*in*/ const sdv::u8string& ssSignalName, /*in*/ sdv::IInterfaceAccess* pSubscriber) override;
 
+    /**
+     * @brief Add a registered signal for subscription (receive signal) using a subscription policy. Overload of
+     * sdv::core::ISignalAccessEx::AddSignalSubscriptionEx.
+     * @param[in] ssSignalName Name of the signal.
+     * @param[in] pSubscriber Pointer to the IInterfaceAccess of the subscriber. The subscriber should implement the
+     * ISignalReceiveEvent interface.
+     * @param[in] sPolicy The subscription policy being evaluated before the value is delivered to the subscriber.
+     * @return Returns an interface that can be used to manage the subscription.  Use IObjectDestroy to destroy the signal object.
+     */
+    virtual sdv::IInterfaceAccess* AddSignalSubscriptionEx(/*in*/ const sdv::u8string& ssSignalName,
+        /*in*/ sdv::IInterfaceAccess* pSubscriber, /*in*/ const sdv::core::SSubscriptionPolicy& sPolicy) override;
+
     /**
      * @brief Get a list of registered signals.
      * @return List of registration functions.
@@ -137,6 +195,13 @@ public:
     */
     virtual sdv::IInterfaceAccess* CreateTransaction() override;
 
+    /**
+     * @brief Get the statistics of the signal value history since the start of the dispatch service. Overload of
+     * sdv::core::ISignalHistoryStatistics::GetHistoryStatistics.
+     * @return The statistics.
+     */
+    virtual sdv::core::SSignalHistoryStatistics GetHistoryStatistics() const override;
+
     /**
      * @brief Get the next transaction ID.
      * @return Returns the next transaction ID.
@@ -156,6 +221,48 @@ public:
      */
     uint64_t GetDirectTransactionID() const;
 
+    /**
+     * @brief Update the read epoch after a transaction became a read transaction.
+     */
+    void UpdateReadEpoch();
+
+    /**
+     * @brief Get the read epoch; the transaction ID of the oldest active read transaction. Signal values written before this
+     * transaction ID and superseded by a value written before this ID are not visible to any reader any more.
+     * @return The read epoch or the maximum transaction ID when no read transaction is active.
+     */
+    uint64_t GetReadEpoch() const;
+
+    /**
+     * @brief Get the initial depth of the signal value history.
+     * @return The history depth.
+     */
+    size_t GetHistoryDepth() const;
+
+    /**
+     * @brief Get the maximum depth the signal value history can grow to.
+     * @return The maximum history depth.
+     */
+    size_t GetHistoryMaxDepth() const;
+
+    /**
+     * @brief Get the counters of the signal value history.
+     * @return Reference to the counters.
+     */
+    SHistoryCounters& GetHistoryCounters();
+
+    /**
+     * @brief Get the runtime metrics.
+     * @return Reference to the metrics.
+     */
+    SMetrics& GetMetrics();
+
+    /**
+     * @brief Get the executor for asynchronous delivery to subscribers. The executor threads are started at the first request.
+     * @return Reference to the executor.
+     */
+    CDeliveryExecutor& GetDeliveryExecutor();
+
     /**
      * @brief Initialization event, called after object configuration was loaded. Overload of sdv::CSdvObject::OnInitialize.
      * @return Returns 'true' when the initialization was successful, 'false' when not.
@@ -202,13 +309,31 @@ public:
     void RemoveTxTrigger(CTrigger* pTrigger);
 
 private:
+    /**
+     * @brief Calculate the read epoch from the active transactions. The transaction list must be locked.
+     */
+    void CalcReadEpoch();
+
+    static constexpr size_t                         m_nTransactionPoolSize = 64;            ///< Maximum amount of finished
+                                                                                            ///< transactions kept for reuse.
+    CDeliveryExecutor                               m_executor;                             ///< Asynchronous delivery executor.
     mutable std::mutex                              m_mtxSignals;                           ///< Signal object map protection.
     std::map<sdv::u8string, CSignal>                m_mapRxSignals;                         ///< Signal object map.
     std::map<sdv::u8string, CSignal>                m_mapTxSignals;                         ///< Signal object map.
     std::atomic_uint64_t                            m_uiTransactionCnt = 1ull;              ///< Transaction counter.
     std::mutex                                      m_mtxTransactions;                      ///< List with transactions access.
     std::list<CTransaction>                         m_lstTransactions;                      ///< List with transactions.
+    std::list<CTransaction>                         m_lstTransactionPool;                   ///< List with finished transactions
+                                                                                            ///< available for reuse.
     uint64_t                                        m_uiDirectTransactionID;                ///< Current direct transaction ID.
+    std::atomic_uint64_t                            m_uiReadEpoch = UINT64_MAX;             ///< Oldest active read transaction.
+    uint32_t                                        m_uiHistoryDepth = 16u;                 ///< Initial signal history depth.
+    uint32_t                                        m_uiHistoryMaxDepth = 64u;              ///< Maximum signal history depth.
+    uint32_t                                        m_uiDeliveryThreads = 2u;               ///< Amount of delivery threads.
+    SHistoryCounters                                m_sHistoryCounters;                     ///< Signal history counters.
+    SMetrics                                        m_sMetrics;                             ///< Runtime metrics.
+    CThreadAttributes                               m_threadAttributes;                     ///< Real-time attributes of the
+                                                                                            ///< scheduler tick.
     CScheduler                                      m_scheduler;                            ///< Scheduler for trigger execution.
     mutable std::mutex                              m_mtxTriggers;                          ///< Trigger object map protection.
     std::map<CTrigger*, std::unique_ptr<CTrigger>>  m_mapTriggers;                          ///< Trigger object map.
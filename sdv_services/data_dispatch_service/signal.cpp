@@ -15,6 +15,9 @@
 #include "signal.h"
 #include "trigger.h"
 #include "transaction.h"
+#include <support/latency_trace.h>
+#include <algorithm>
+#include <cmath>
 
 CProvider::CProvider(CSignal& rSignal) : m_rSignal(rSignal)
 {}
@@ -36,19 +39,34 @@ void CProvider::Write(/*in*/ sdv::any_t anyVal, /*in*/ sdv::IInterfaceAccess* pT
 
     // Write the value
     // Note, explicitly convert to uint64_t to resolve ambiguous function selection under Linux.
-    std::set<CTrigger*> setTriggers;
-    m_rSignal.WriteFromProvider(anyVal, static_cast<uint64_t>(0), setTriggers);
+    std::vector<CTrigger*> vecTriggers;
+    m_rSignal.WriteFromProvider(anyVal, static_cast<uint64_t>(0), vecTriggers);
 
     // Execute the triggers
-    for (CTrigger* pTrigger : setTriggers)
+    for (CTrigger* pTrigger : vecTriggers)
         pTrigger->Execute();
 
 }
 
-CConsumer::CConsumer(CSignal& rSignal, sdv::IInterfaceAccess* pEvent /*= nullptr*/) :
+CConsumer::CConsumer(CSignal& rSignal, sdv::IInterfaceAccess* pEvent /*= nullptr*/,
+    const sdv::core::SSubscriptionPolicy* psPolicy /*= nullptr*/, CDeliveryExecutor* pExecutor /*= nullptr*/) :
     m_rSignal(rSignal)
 {
     if (pEvent) m_pEvent = pEvent->GetInterface<sdv::core::ISignalReceiveEvent>();
+    if (psPolicy)
+    {
+        m_sPolicy = *psPolicy;
+        m_bPolicy = m_sPolicy.bOnChangeOnly || m_sPolicy.dAbsDeadband > 0.0 || m_sPolicy.dRelDeadband > 0.0 ||
+            m_sPolicy.uiMinInterval;
+        if (m_pEvent && pExecutor && m_sPolicy.uiQueueSize)
+            m_ptrQueue = std::make_shared<CDeliveryQueue>(*pExecutor, m_pEvent, m_sPolicy.uiQueueSize, m_sPolicy.bCoalesce,
+                rSignal.GetTraceKey());
+    }
+}
+
+CConsumer::~CConsumer()
+{
+    if (m_ptrQueue) m_ptrQueue->Stop();
 }
 
 void CConsumer::DestroyObject()
@@ -65,20 +83,116 @@ sdv::any_t CConsumer::Read(/*in*/ sdv::IInterfaceAccess* pTransaction) const
     if (pTransactionObj) uiTransactionID = pTransactionObj->GetReadTransactionID();
 
     // Request a read from the signal
-    return m_rSignal.ReadFromConsumer(uiTransactionID);
+    bool bSnapshotTooOld = false;
+    sdv::any_t anyVal = m_rSignal.ReadFromConsumer(uiTransactionID, &bSnapshotTooOld);
+    if (bSnapshotTooOld && pTransactionObj) pTransactionObj->ReportSnapshotTooOld();
+    return anyVal;
 }
 
 void CConsumer::Distribute(const sdv::any_t& ranyVal)
 {
-    if (m_pEvent) m_pEvent->Receive(ranyVal);
+    if (!m_pEvent) return;
+
+    // Apply the subscription policy
+    if (m_bPolicy && !EvaluatePolicy(ranyVal))
+    {
+        m_uiSuppressed++;
+        return;
+    }
+
+    // Asynchronous delivery
+    if (m_ptrQueue)
+    {
+        m_ptrQueue->Push(ranyVal);
+        return;
+    }
+
+    m_uiDelivered++;
+    m_rSignal.GetDispatchService().GetMetrics().counterDelivered.Increment();
+    SDV_LATENCY_TRACE(sdv::core::ETraceStage::dispatch_deliver, m_rSignal.GetTraceKey());
+    m_pEvent->Receive(ranyVal);
+}
+
+sdv::core::SSubscriptionStatistics CConsumer::GetSubscriptionStatistics() const
+{
+    sdv::core::SSubscriptionStatistics sStatistics{};
+    sStatistics.uiDelivered = m_uiDelivered;
+    sStatistics.uiSuppressed = m_uiSuppressed;
+    if (m_ptrQueue) m_ptrQueue->GetStatistics(sStatistics);
+    return sStatistics;
+}
+
+namespace
+{
+    /**
+     * @brief Is the value numeric?
+     * @param[in] ranyVal Reference to the value.
+     * @return Returns whether the value is an integral, floating point or fixed point value.
+     */
+    bool IsNumeric(const sdv::any_t& ranyVal)
+    {
+        switch (ranyVal.eValType)
+        {
+        case sdv::any_t::EValType::val_type_int8:
+        case sdv::any_t::EValType::val_type_uint8:
+        case sdv::any_t::EValType::val_type_int16:
+        case sdv::any_t::EValType::val_type_uint16:
+        case sdv::any_t::EValType::val_type_int32:
+        case sdv::any_t::EValType::val_type_uint32:
+        case sdv::any_t::EValType::val_type_int64:
+        case sdv::any_t::EValType::val_type_uint64:
+        case sdv::any_t::EValType::val_type_float:
+        case sdv::any_t::EValType::val_type_double:
+        case sdv::any_t::EValType::val_type_long_double:
+        case sdv::any_t::EValType::val_type_fixed:
+            return true;
+        default:
+            return false;
+        }
+    }
+}
+
+bool CConsumer::EvaluatePolicy(const sdv::any_t& ranyVal)
+{
+    // Called with the consumer map of the signal locked; no additional protection needed.
+    std::chrono::steady_clock::time_point tpNow = std::chrono::steady_clock::now();
+    if (m_bDelivered)
+    {
+        // Rate limit
+        if (m_sPolicy.uiMinInterval && tpNow - m_tpLastDelivered < std::chrono::milliseconds(m_sPolicy.uiMinInterval))
+            return false;
+
+        // Change only
+        if (m_sPolicy.bOnChangeOnly && ranyVal == m_anyLastDelivered)
+            return false;
+
+        // Deadband
+        if ((m_sPolicy.dAbsDeadband > 0.0 || m_sPolicy.dRelDeadband > 0.0) && IsNumeric(ranyVal) &&
+            IsNumeric(m_anyLastDelivered))
+        {
+            double dLast = m_anyLastDelivered.get<double>();
+            double dDiff = std::fabs(ranyVal.get<double>() - dLast);
+            if (m_sPolicy.dAbsDeadband > 0.0 && dDiff <= m_sPolicy.dAbsDeadband)
+                return false;
+            if (m_sPolicy.dRelDeadband > 0.0 && dDiff <= m_sPolicy.dRelDeadband * std::fabs(dLast))
+                return false;
+        }
+    }
+
+    m_bDelivered = true;
+    m_anyLastDelivered = ranyVal;
+    m_tpLastDelivered = tpNow;
+    return true;
 }
 
 CSignal::CSignal(CDispatchService& rDispatchSvc, const sdv::u8string& rssName, sdv::core::ESignalDirection eDirection,
     sdv::any_t anyDefVal /*= sdv::any_t()*/) :
-    m_rDispatchSvc(rDispatchSvc), m_ssName(rssName), m_eDirection(eDirection), m_anyDefVal(anyDefVal)
+    m_rDispatchSvc(rDispatchSvc), m_ssName(rssName), m_eDirection(eDirection), m_anyDefVal(anyDefVal),
+    m_vecVal(std::max<size_t>(rDispatchSvc.GetHistoryDepth(), 2), std::make_pair(0ull, anyDefVal))
 {
-    for (auto& rprVal : m_rgprVal)
-        rprVal = {0, anyDefVal};
+#if ENABLE_LATENCY_TRACE != 0
+    m_uiTraceKey = sdv::core::RegisterLatencyTraceName(m_ssName);
+#endif
 }
 
 CSignal::~CSignal()
@@ -94,6 +208,16 @@ sdv::core::ESignalDirection CSignal::GetDirection() const
     return m_eDirection;
 }
 
+uint32_t CSignal::GetTraceKey() const
+{
+    return m_uiTraceKey;
+}
+
+CDispatchService& CSignal::GetDispatchService() const
+{
+    return m_rDispatchSvc;
+}
+
 sdv::any_t CSignal::GetDefVal() const
 {
     return m_anyDefVal;
@@ -126,10 +250,12 @@ void CSignal::RemoveProvider(CProvider* pProvider)
         m_rDispatchSvc.UnregisterSignal(m_ssName, m_eDirection);
 }
 
-CConsumer* CSignal::CreateConsumer(sdv::IInterfaceAccess* pEvent /*= nullptr*/)
+CConsumer* CSignal::CreateConsumer(sdv::IInterfaceAccess* pEvent /*= nullptr*/,
+    const sdv::core::SSubscriptionPolicy* psPolicy /*= nullptr*/)
 {
     std::unique_lock<std::mutex> lock(m_mtxSignalObjects);
-    auto ptrConsumer = std::make_unique<CConsumer>(*this, pEvent);
+    CDeliveryExecutor* pExecutor = psPolicy && psPolicy->uiQueueSize ? &m_rDispatchSvc.GetDeliveryExecutor() : nullptr;
+    auto ptrConsumer = std::make_unique<CConsumer>(*this, pEvent, psPolicy, pExecutor);
     // Ignore cppcheck warning; normally the returned pointer should always have a value at this stage (otherwise an exception was
     // triggered).
     // cppcheck-suppress knownConditionTrueFalse
@@ -155,6 +281,7 @@ void CSignal::RemoveConsumer(CConsumer* pConsumer)
         {
             CTrigger* pTrigger = *m_setTriggers.begin();
             m_setTriggers.erase(m_setTriggers.begin());
+            if (!m_bDefault) pTrigger->UpdateActivity(false);
             lockTrigger.unlock();
 
             // Remove this signal from the trigger.
@@ -170,66 +297,94 @@ void CSignal::RemoveConsumer(CConsumer* pConsumer)
         m_rDispatchSvc.UnregisterSignal(m_ssName, m_eDirection);
 }
 
-void CSignal::WriteFromProvider(const sdv::any_t& ranyVal, uint64_t uiTransactionID, std::set<CTrigger*>& rsetTriggers)
+void CSignal::WriteFromProvider(const sdv::any_t& ranyVal, uint64_t uiTransactionID, std::vector<CTrigger*>& rvecTriggers)
 {
     if (m_rDispatchSvc.GetObjectState() != sdv::EObjectState::running) return;
+    SDV_LATENCY_TRACE(sdv::core::ETraceStage::dispatch_write, m_uiTraceKey);
+    m_rDispatchSvc.GetMetrics().counterWrites.Increment();
 
     uint64_t uiTransactionIDTemp = uiTransactionID;
     if (!uiTransactionIDTemp) uiTransactionIDTemp = m_rDispatchSvc.GetDirectTransactionID();
 
     // Store the value
     std::unique_lock<std::mutex> lock(m_mtxVal);
-    if (m_nValIndex >= std::extent_v<decltype(m_rgprVal)>) m_nValIndex = 0;     // TODO: This is a serious error.
     size_t nTargetIndex = m_nValIndex;
 
     // Create an entry with the current transaction ID
-    if (m_rgprVal[nTargetIndex].first < uiTransactionIDTemp)
+    if (m_vecVal[nTargetIndex].first < uiTransactionIDTemp)
     {
-        nTargetIndex = (nTargetIndex + 1) % std::extent_v<decltype(m_rgprVal)>;
-        m_rgprVal[nTargetIndex].first = uiTransactionIDTemp;
+        nTargetIndex = (nTargetIndex + 1) % m_vecVal.size();
+
+        // The entry to reuse contains the oldest value. This value is still visible to the read transactions started before
+        // the next entry was written. If there is such a transaction, extend the history instead of reclaiming the entry.
+        size_t nNextIndex = (nTargetIndex + 1) % m_vecVal.size();
+        if (m_rDispatchSvc.GetReadEpoch() < m_vecVal[nNextIndex].first)
+        {
+            if (m_vecVal.size() < m_rDispatchSvc.GetHistoryMaxDepth())
+            {
+                m_vecVal.emplace(m_vecVal.begin() + static_cast<std::ptrdiff_t>(nTargetIndex));
+                m_rDispatchSvc.GetHistoryCounters().uiHistoryExtensions++;
+            }
+            else
+                m_rDispatchSvc.GetHistoryCounters().uiHistoryLimitHits++;
+        }
+
+        m_vecVal[nTargetIndex].first = uiTransactionIDTemp;
         m_nValIndex = nTargetIndex;
     }
 
     // Update the value
-    m_rgprVal[nTargetIndex].second = ranyVal;
+    m_vecVal[nTargetIndex].second = ranyVal;
+
+    // Update the activity of the TX signal and inform the triggers when it changed. This is done while still holding the value
+    // lock to keep the state in the order of the writes.
+    if (m_eDirection == sdv::core::ESignalDirection::sigdir_tx)
+    {
+        bool bDefault = ranyVal == m_anyDefVal;
+        std::unique_lock<std::mutex> lockTriggers(m_mtxTriggers);
+        if (m_bDefault != bDefault)
+        {
+            m_bDefault = bDefault;
+            for (CTrigger* pTrigger : m_setTriggers)
+                pTrigger->UpdateActivity(!bDefault);
+        }
+    }
     lock.unlock();
 
-    // Add all triggers to the set of triggers
+    // Add all triggers to the triggers to execute
     std::unique_lock<std::mutex> lockTriggers(m_mtxTriggers);
     for (CTrigger* pTrigger : m_setTriggers)
-        rsetTriggers.insert(pTrigger);
+    {
+        if (std::find(rvecTriggers.begin(), rvecTriggers.end(), pTrigger) == rvecTriggers.end())
+            rvecTriggers.push_back(pTrigger);
+    }
     lockTriggers.unlock();
 
     // Trigger the update event.
     DistributeToConsumers(ranyVal);
 }
 
-sdv::any_t CSignal::ReadFromConsumer(uint64_t uiTransactionID) const
+sdv::any_t CSignal::ReadFromConsumer(uint64_t uiTransactionID, bool* pbSnapshotTooOld /*= nullptr*/) const
 {
     std::unique_lock<std::mutex> lock(m_mtxVal);
 
-    if (m_nValIndex >= std::extent_v<decltype(m_rgprVal)>) return {};   // TODO: This is a serious error.
+    // Most up-to-date value requested?
+    if (!uiTransactionID) return m_vecVal[m_nValIndex].second;
+    m_rDispatchSvc.GetHistoryCounters().uiSnapshotReads++;
 
-    // Determine the transaction ID to use
-    uint64_t uiTransactionIDCopy = uiTransactionID;
+    // Find the value with the same or lower transaction ID, starting with the most up-to-date value.
     size_t nTargetIndex = m_nValIndex;
-    if (!uiTransactionIDCopy) uiTransactionIDCopy = m_rgprVal[nTargetIndex].first;
-
-    // Find the signal with the same or lower transaction ID
-    while (m_rgprVal[m_nValIndex].first > uiTransactionIDCopy)  // Value too new
+    for (size_t n = 0; n < m_vecVal.size(); n++)
     {
-        // Search for the index with the transaction ID.
-        // Ignore cppcheck comparison operator (template is interpreted as > operator)
-        // cppcheck-suppress compareBoolExpressionWithInt
-        // cppcheck-suppress knownConditionTrueFalse
-        nTargetIndex = (nTargetIndex + std::extent_v<decltype(m_rgprVal)> - 1) % std::extent_v<decltype(m_rgprVal)>;
-        if (nTargetIndex == m_nValIndex) return m_anyDefVal; // Transaction too old... cannot update
+        if (m_vecVal[nTargetIndex].first <= uiTransactionID)
+            return m_vecVal[nTargetIndex].second;
+        nTargetIndex = (nTargetIndex + m_vecVal.size() - 1) % m_vecVal.size();
     }
 
-    // Fitting transaction found. Get the value.
-    sdv::any_t anyVal = m_rgprVal[nTargetIndex].second;
-
-    return anyVal;
+    // Transaction too old; the history was reclaimed. Return the oldest available value.
+    m_rDispatchSvc.GetHistoryCounters().uiSnapshotTooOld++;
+    if (pbSnapshotTooOld) *pbSnapshotTooOld = true;
+    return m_vecVal[(m_nValIndex + 1) % m_vecVal.size()].second;
 }
 
 void CSignal::DistributeToConsumers(const sdv::any_t& ranyVal)
@@ -243,17 +398,21 @@ void CSignal::DistributeToConsumers(const sdv::any_t& ranyVal)
 
 void CSignal::AddTrigger(CTrigger* pTrigger)
 {
+    if (!pTrigger) return;
     std::unique_lock<std::mutex> lock(m_mtxTriggers);
-    m_setTriggers.emplace(pTrigger);
+    if (m_setTriggers.emplace(pTrigger).second && !m_bDefault)
+        pTrigger->UpdateActivity(true);
 }
 
 void CSignal::RemoveTrigger(CTrigger* pTrigger)
 {
+    if (!pTrigger) return;
     std::unique_lock<std::mutex> lock(m_mtxTriggers);
-    m_setTriggers.erase(pTrigger);
+    if (m_setTriggers.erase(pTrigger) && !m_bDefault)
+        pTrigger->UpdateActivity(false);
 }
 
 bool CSignal::EqualsDefaultValue() const
 {
-    return ReadFromConsumer(0) == m_anyDefVal;
+    return m_bDefault;
 }
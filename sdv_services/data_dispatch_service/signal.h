@@ -16,7 +16,12 @@
 
 #include <support/interface_ptr.h>
 #include <interfaces/dispatch.h>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include "trigger.h"
+#include "delivery.h"
 
 // Forward declaration
 class CDispatchService;
@@ -68,20 +73,30 @@ private:
 /**
 * @brief Class implementing the signal consumer. Needed for consumer interface implementation.
 */
-class CConsumer : public sdv::IInterfaceAccess, public sdv::IObjectDestroy, public sdv::core::ISignalRead
+class CConsumer : public sdv::IInterfaceAccess, public sdv::IObjectDestroy, public sdv::core::ISignalRead,
+    public sdv::core::ISubscriptionStatistics
 {
 public:
     /**
     * @brief Constructor
     * @param[in] rSignal Reference to the signal instance.
     * @param[in] pEvent The event to be triggered on a signal change. Optional.
+    * @param[in] psPolicy Pointer to the subscription policy to apply before triggering the event. Optional.
+    * @param[in] pExecutor Pointer to the executor for asynchronous delivery. Required when the policy requests a delivery queue.
     */
-    CConsumer(CSignal& rSignal, sdv::IInterfaceAccess* pEvent = nullptr);
+    CConsumer(CSignal& rSignal, sdv::IInterfaceAccess* pEvent = nullptr, const sdv::core::SSubscriptionPolicy* psPolicy = nullptr,
+        CDeliveryExecutor* pExecutor = nullptr);
+
+    /**
+    * @brief Destructor; stops the asynchronous delivery.
+    */
+    ~CConsumer();
 
     // Interface map
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::IObjectDestroy)
         SDV_INTERFACE_ENTRY(sdv::core::ISignalRead)
+        SDV_INTERFACE_ENTRY(sdv::core::ISubscriptionStatistics)
     END_SDV_INTERFACE_MAP()
 
     /**
@@ -105,15 +120,37 @@ public:
     void Write(const sdv::any_t& ranyVal, uint64_t uiTransactionID);
 
     /**
-    * @brief Distribute a value to all consumers.
+    * @brief Distribute a value to all consumers. The value is suppressed when it doesn't pass the subscription policy. With
+    * asynchronous delivery the value is added to the delivery queue.
     * @param[in] ranyVal Reference of the value to consumers.
     */
     void Distribute(const sdv::any_t& ranyVal);
 
+    /**
+     * @brief Get the subscription statistics. Overload of sdv::core::ISubscriptionStatistics::GetSubscriptionStatistics.
+     * @return The statistics.
+     */
+    virtual sdv::core::SSubscriptionStatistics GetSubscriptionStatistics() const override;
+
 private:
+    /**
+     * @brief Evaluate the subscription policy for the value and update the last delivered value when passed.
+     * @param[in] ranyVal Reference to the value to deliver.
+     * @return Returns whether the value should be delivered.
+     */
+    bool EvaluatePolicy(const sdv::any_t& ranyVal);
+
     sdv::CLifetimeCookie    m_cookie = sdv::CreateLifetimeCookie(); ///< Lifetime cookie to manage the module lifetime.
     CSignal&                            m_rSignal;                  ///< Reference to the signal class
     sdv::core::ISignalReceiveEvent*     m_pEvent = nullptr;         ///< Receive event interface if available.
+    bool                                m_bPolicy = false;          ///< Set when a subscription policy is applied.
+    sdv::core::SSubscriptionPolicy      m_sPolicy{};                ///< The subscription policy.
+    bool                                m_bDelivered = false;       ///< Set when a value has been delivered.
+    sdv::any_t                          m_anyLastDelivered;         ///< The last delivered value.
+    std::chrono::steady_clock::time_point m_tpLastDelivered{};      ///< Time of the last delivery.
+    std::atomic_uint64_t                m_uiDelivered = 0ull;       ///< Amount of delivered values.
+    std::atomic_uint64_t                m_uiSuppressed = 0ull;      ///< Amount of suppressed values.
+    std::shared_ptr<CDeliveryQueue>     m_ptrQueue;                 ///< Delivery queue for asynchronous delivery.
 };
 
 /**
@@ -160,6 +197,18 @@ public:
      */
     sdv::core::ESignalDirection GetDirection() const;
 
+    /**
+     * @brief Get the key of the signal used for the latency trace points.
+     * @return The key or 0 when latency tracing is disabled.
+     */
+    uint32_t GetTraceKey() const;
+
+    /**
+     * @brief Get the dispatch service the signal belongs to.
+     * @return Reference to the dispatch service.
+     */
+    CDispatchService& GetDispatchService() const;
+
     /**
      * @brief Get the signal default value.
      * @return Any structure with default value.
@@ -182,9 +231,10 @@ public:
     /**
      * @brief Create a consumer object.
      * @param[in] pEvent The event to be triggered on a signal change. Optional.
+     * @param[in] psPolicy Pointer to the subscription policy to apply before triggering the event. Optional.
      * @return Returns a pointer to the consumer object or NULL when the signal is not configured to be a consumer.
      */
-    CConsumer* CreateConsumer(sdv::IInterfaceAccess* pEvent = nullptr);
+    CConsumer* CreateConsumer(sdv::IInterfaceAccess* pEvent = nullptr, const sdv::core::SSubscriptionPolicy* psPolicy = nullptr);
 
     /**
      * @brief Remove a consumer object.
@@ -197,16 +247,21 @@ public:
      * @brief Update the signal value with the transaction ID supplied. A new entry will be created if the transaction is larger.
      * @param[in] ranyVal Reference to the value to update the signal with.
      * @param[in] uiTransactionID The transaction ID or 0 for current transaction ID.
-     * @param[in] rsetTriggers Set of triggers to execute on a spontaneous write.
+     * @param[in] rvecTriggers Triggers to execute on a spontaneous write. Triggers of this signal are added when not in the
+     * vector already.
      */
-    void WriteFromProvider(const sdv::any_t& ranyVal, uint64_t uiTransactionID, std::set<CTrigger*>& rsetTriggers);
+    void WriteFromProvider(const sdv::any_t& ranyVal, uint64_t uiTransactionID, std::vector<CTrigger*>& rvecTriggers);
 
     /**
      * @brief Get the signal value.
+     * @details With a transaction ID, the most recent value written at or before the transaction is returned. When the
+     * history doesn't contain such a value any more, the oldest available value is returned and the snapshot is reported to
+     * be too old.
      * @param[in] uiTransactionID The transaction ID or 0 for current transaction ID.
+     * @param[out] pbSnapshotTooOld When not NULL, set when the transaction is older than the history.
      * @return Returns the value.
      */
-    sdv::any_t ReadFromConsumer(uint64_t uiTransactionID) const;
+    sdv::any_t ReadFromConsumer(uint64_t uiTransactionID, bool* pbSnapshotTooOld = nullptr) const;
 
     /**
      * @brief Distribute a value to all consumers.
@@ -215,7 +270,8 @@ public:
     void DistributeToConsumers(const sdv::any_t& ranyVal);
 
     /**
-     * @brief Add a trigger to the signal. This trigger will be returned when creating a trigger list.
+     * @brief Add a trigger to the signal. This trigger will be returned when creating a trigger list. The trigger is informed
+     * about the activity of the signal (whether the signal differs from the default value).
      * @param[in] pTrigger Pointer to the trigger object.
      */
     void AddTrigger(CTrigger* pTrigger);
@@ -227,7 +283,7 @@ public:
     void RemoveTrigger(CTrigger* pTrigger);
 
     /**
-     * @brief Returns whether the signal equals the default value.
+     * @brief Returns whether the signal equals the default value. The state is determined when writing the signal.
      * @return Return the result of the comparison.
      */
     bool EqualsDefaultValue() const;
@@ -238,9 +294,13 @@ private:
     sdv::u8string                   m_ssName;                                               ///< Signal name
     sdv::core::ESignalDirection     m_eDirection = sdv::core::ESignalDirection::sigdir_tx;  ///< Signal direction
     sdv::any_t                      m_anyDefVal;                                            ///< Default value
+    uint32_t                        m_uiTraceKey = 0;                                       ///< Latency trace key
     mutable std::mutex              m_mtxVal;                                               ///< Signal value protection
-    mutable std::pair<uint64_t, sdv::any_t> m_rgprVal[16];                                  ///< The signal value
-    mutable size_t                  m_nValIndex = 0;                                        ///< Most up-to-date-index
+    std::vector<std::pair<uint64_t, sdv::any_t>> m_vecVal;                                  ///< The signal value history (ring)
+                                                                                            ///< with transaction ID and value.
+    size_t                          m_nValIndex = 0;                                        ///< Most up-to-date-index
+    std::atomic_bool                m_bDefault = true;                                      ///< Set when the most up-to-date
+                                                                                            ///< value equals the default value.
     mutable std::mutex              m_mtxSignalObjects;                                     ///< Signal object map protection.
     std::map<CProvider*, std::unique_ptr<CProvider>> m_mapProviders;                        ///< Map with signal objects.
     std::map<CConsumer*, std::unique_ptr<CConsumer>> m_mapConsumers;                        ///< Map with signal objects.
@@ -15,11 +15,22 @@
 #include "transaction.h"
 #include "trigger.h"
 #include "signal.h"
+#include <algorithm>
 
 CTransaction::CTransaction(CDispatchService& rDispatchSvc) :
     m_rDispatchSvc(rDispatchSvc), m_uiReadTransactionID(rDispatchSvc.GetNextTransactionID())
 {}
 
+void CTransaction::Reset()
+{
+    m_eTransactionType = ETransactionType::undefined;
+    m_uiReadTransactionID = m_rDispatchSvc.GetNextTransactionID();
+    m_bSnapshotTooOld = false;
+    std::unique_lock<std::mutex> lock(m_mtxDeferredWrites);
+    m_vecDeferredWrites.clear();
+    m_vecTriggers.clear();
+}
+
 void CTransaction::DestroyObject()
 {
     FinalizeWrite();
@@ -28,66 +39,79 @@ void CTransaction::DestroyObject()
 
 uint64_t CTransaction::GetReadTransactionID() const
 {
-    // Set transaction to write if not done so.
-    if (m_eTransactionType != ETransactionType::read_transaction)
+    // Set transaction to read if not done so. The type is read by other threads calculating the read epoch.
+    ETransactionType eType = ETransactionType::undefined;
+    if (m_eTransactionType.compare_exchange_strong(eType, ETransactionType::read_transaction))
     {
-        if (m_eTransactionType == ETransactionType::undefined)
-        {
-            m_eTransactionType = ETransactionType::read_transaction;
-
-            // Create a new direct transaction ID to prevent the current values from overwriting
-            m_rDispatchSvc.CreateDirectTransactionID();
-        }
-        else
-            return 0ull;
+        // Create a new direct transaction ID to prevent the current values from overwriting
+        m_rDispatchSvc.CreateDirectTransactionID();
+
+        // Prevent the values visible to this transaction from being reclaimed
+        m_rDispatchSvc.UpdateReadEpoch();
     }
+    else if (eType != ETransactionType::read_transaction)
+        return 0ull;
 
     return m_uiReadTransactionID;
 }
 
+bool CTransaction::IsReadTransaction() const
+{
+    return m_eTransactionType == ETransactionType::read_transaction;
+}
+
+void CTransaction::ReportSnapshotTooOld() const
+{
+    m_bSnapshotTooOld = true;
+}
+
+bool CTransaction::IsSnapshotTooOld() const
+{
+    return m_bSnapshotTooOld;
+}
+
 void CTransaction::DeferWrite(CSignal& rSignal, sdv::any_t& ranyVal)
 {
     // Set transaction to write if not done so.
-    if (m_eTransactionType != ETransactionType::write_transaction)
-    {
-        if (m_eTransactionType == ETransactionType::undefined)
-            m_eTransactionType = ETransactionType::write_transaction;
-        else
-            return;
-    }
+    ETransactionType eType = ETransactionType::undefined;
+    if (!m_eTransactionType.compare_exchange_strong(eType, ETransactionType::write_transaction) &&
+        eType != ETransactionType::write_transaction)
+        return;
 
-    // Add the value to the deferred signal map.
-    std::unique_lock<std::mutex> lock(m_mtxDeferredWriteSignalMap);
-    m_mapDeferredWriteSignalMap.insert_or_assign(&rSignal, ranyVal);
+    // Add the value to the deferred write buffer or overwrite the value of a previous write to the same signal.
+    std::unique_lock<std::mutex> lock(m_mtxDeferredWrites);
+    auto itDeferredWrite = std::find_if(m_vecDeferredWrites.begin(), m_vecDeferredWrites.end(),
+        [&](const auto& rprDeferredWrite) { return rprDeferredWrite.first == &rSignal; });
+    if (itDeferredWrite != m_vecDeferredWrites.end())
+        itDeferredWrite->second = ranyVal;
+    else
+        m_vecDeferredWrites.emplace_back(&rSignal, ranyVal);
 }
 
 void CTransaction::FinalizeWrite()
 {
     // Set transaction to write if not done so.
-    if (m_eTransactionType != ETransactionType::write_transaction)
-    {
-        if (m_eTransactionType == ETransactionType::undefined)
-            m_eTransactionType = ETransactionType::write_transaction;
-        else
-            return;
-    }
+    ETransactionType eType = ETransactionType::undefined;
+    if (!m_eTransactionType.compare_exchange_strong(eType, ETransactionType::write_transaction) &&
+        eType != ETransactionType::write_transaction)
+        return;
 
     // Get the next transaction ID
     uint64_t uiWriteTransaction = m_rDispatchSvc.GetNextTransactionID();
 
     // Write the signals with the transaction ID.
-    std::unique_lock<std::mutex> lock(m_mtxDeferredWriteSignalMap);
-    std::set<CTrigger*> setTriggers;
-    for (auto& rvtDeferredSignal : m_mapDeferredWriteSignalMap)
+    std::unique_lock<std::mutex> lock(m_mtxDeferredWrites);
+    m_vecTriggers.clear();
+    for (auto& rprDeferredWrite : m_vecDeferredWrites)
     {
-        if (!rvtDeferredSignal.first) continue;
-        rvtDeferredSignal.first->WriteFromProvider(rvtDeferredSignal.second, uiWriteTransaction, setTriggers);
+        if (!rprDeferredWrite.first) continue;
+        rprDeferredWrite.first->WriteFromProvider(rprDeferredWrite.second, uiWriteTransaction, m_vecTriggers);
     }
-    m_mapDeferredWriteSignalMap.clear();
+    m_vecDeferredWrites.clear();
     lock.unlock();
 
     // Execute the triggers
-    for (CTrigger* pTrigger : setTriggers)
+    for (CTrigger* pTrigger : m_vecTriggers)
         pTrigger->Execute();
 }
 
@@ -15,10 +15,15 @@
 #define TRANSACTION_H
 
 #include <support/interface_ptr.h>
+#include <interfaces/dispatch.h>
+#include <atomic>
+#include <list>
+#include <vector>
 
 // Forward declaration
 class CDispatchService;
 class CSignal;
+class CTrigger;
 
 /**
  * @brief Transaction administration
@@ -35,7 +40,7 @@ class CSignal;
  * The written values are stored in a ringbuffer in the signal class. The latest position in the ring buffer contains the last
  * distributed transaction.
  */
-class CTransaction : public sdv::IInterfaceAccess, public sdv::IObjectDestroy
+class CTransaction : public sdv::IInterfaceAccess, public sdv::IObjectDestroy, public sdv::core::ITransactionSnapshot
 {
 public:
     /**
@@ -48,6 +53,7 @@ public:
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::IInterfaceAccess)
         SDV_INTERFACE_ENTRY(sdv::IObjectDestroy)
+        SDV_INTERFACE_ENTRY(sdv::core::ITransactionSnapshot)
     END_SDV_INTERFACE_MAP()
 
     /**
@@ -55,6 +61,12 @@ public:
     */
     virtual void DestroyObject() override;
 
+    /**
+     * @brief Reset the transaction to allow reuse of the transaction object. The transaction will receive a new read
+     * transaction ID and the transaction type is undefined again. The allocated deferred write buffer is kept.
+     */
+    void Reset();
+
     /**
      * @brief When called, enables the transaction as read-transaction. This would only happen when the transaction is still in
      * undefined state.
@@ -62,9 +74,28 @@ public:
      */
     uint64_t GetReadTransactionID() const;
 
+    /**
+     * @brief Returns whether the transaction is a read transaction.
+     * @return Returns 'true' when the transaction was used for reading.
+     */
+    bool IsReadTransaction() const;
+
+    /**
+     * @brief Report that a signal read with this transaction didn't find the transaction in the signal history any more.
+     */
+    void ReportSnapshotTooOld() const;
+
+    /**
+     * @brief Returns whether the transaction was used to read a signal for which the history didn't contain the transaction
+     * any more. Overload of sdv::core::ITransactionSnapshot::IsSnapshotTooOld.
+     * @return Returns 'true' when the snapshot was too old for at least one signal; 'false' otherwise.
+     */
+    virtual bool IsSnapshotTooOld() const override;
+
     /**
      * @brief When called, enables the transaction as write-transaction. This would only happen when the transaction is still in
-     * undefined state. In that case, the value will be added to the deferred signal map. Any previous value will be overwritten.
+     * undefined state. In that case, the value will be added to the deferred write buffer. Any previous value will be
+     * overwritten.
      * @param[in] rSignal Reference to the signal class.
      * @param[in] ranyVal Reference to the value.
     */
@@ -102,10 +133,16 @@ private:
 
     sdv::CLifetimeCookie                m_cookie = sdv::CreateLifetimeCookie();             ///< Lifetime cookie to manage the module lifetime.
     CDispatchService&                   m_rDispatchSvc;                                     ///< Reference to dispatch service.
-    mutable ETransactionType            m_eTransactionType = ETransactionType::undefined;   ///< Transaction type.
-    std::mutex                          m_mtxDeferredWriteSignalMap;                        ///< Deferred write signal map access.
-    std::map<CSignal*, sdv::any_t>      m_mapDeferredWriteSignalMap;                        ///< Deferred write signal map.
+    mutable std::atomic<ETransactionType> m_eTransactionType{ETransactionType::undefined}; ///< Transaction type; read by the
+                                                                                            ///< dispatch service to calculate
+                                                                                            ///< the read epoch.
+    std::mutex                          m_mtxDeferredWrites;                                ///< Deferred write buffer access.
+    std::vector<std::pair<CSignal*, sdv::any_t>> m_vecDeferredWrites;                       ///< Deferred write buffer; one entry
+                                                                                            ///< per signal.
+    std::vector<CTrigger*>              m_vecTriggers;                                      ///< Triggers to execute on finalize.
     uint64_t                            m_uiReadTransactionID = 0ull;                       ///< Read transaction ID.
+    mutable std::atomic_bool            m_bSnapshotTooOld = false;                          ///< Set when the read transaction
+                                                                                            ///< was older than a signal history.
     std::list<CTransaction>::iterator m_itTransaction{};                                    ///< Iterator of the transaction in the transaction list.
 };
 
@@ -20,8 +20,11 @@ CScheduler::~CScheduler()
     Stop();
 }
 
-void CScheduler::Start()
+void CScheduler::Start(const CThreadAttributes& rThreadAttributes)
 {
+    m_pThreadAttributes = &rThreadAttributes;
+    m_bAttributesApplied = false;
+
     // Start the timer at 1ms rate
     m_timer = sdv::core::CTaskTimer(1, [&]() { EvaluateAndExecute(); });
 }
@@ -63,6 +66,14 @@ void CScheduler::Schedule(CTrigger* pTrigger, EExecutionFlag eExecFlag, std::chr
 
 void CScheduler::EvaluateAndExecute()
 {
+    // Each timer has its own thread; apply the attributes at the first tick.
+    if (!m_bAttributesApplied)
+    {
+        m_bAttributesApplied = true;
+        if (m_pThreadAttributes && m_pThreadAttributes->IsConfigured())
+            m_pThreadAttributes->Apply("DispatchScheduler");
+    }
+
     // Run until there is nothing to execute for the moment
     while (true)
     {
@@ -168,6 +179,19 @@ void CTrigger::RemoveSignal(/*in*/ const sdv::u8string& ssSignalName)
     if (pSignal) pSignal->RemoveTrigger(this);
 }
 
+void CTrigger::SetInactiveRepetitions(/*in*/ uint32_t uiRepetitions)
+{
+    m_uiInactiveRepetitionLimit = uiRepetitions;
+}
+
+void CTrigger::UpdateActivity(bool bActive)
+{
+    if (bActive)
+        m_nActiveSignals++;
+    else
+        m_nActiveSignals--;
+}
+
 void CTrigger::Execute(EExecutionFlag eExecFlag /*= EExecutionFlag::spontaneous*/)
 {
     if (m_rDispatchSvc.GetObjectState() != sdv::EObjectState::running) return;
@@ -196,23 +220,20 @@ void CTrigger::Execute(EExecutionFlag eExecFlag /*= EExecutionFlag::spontaneous*
     // counter.
     if (m_uiBehaviorFlags & static_cast<uint32_t>(sdv::core::ISignalTransmission::ETxTriggerBehavior::periodic_if_active))
     {
-        // Check whether content is active
-        std::unique_lock<std::mutex> lock(m_mtxSignals);
-        bool bDefault = true;
-        for (const auto& rvtSignal : m_mapSignals)
-            bDefault &= rvtSignal.second->EqualsDefaultValue();
+        // Check whether content is active. The signals keep the amount of active signals up-to-date when being written.
+        bool bDefault = m_nActiveSignals == 0;
 
         // Reset or increase repetition counter based on activity
         m_nInactiveRepetition = bDefault ? m_nInactiveRepetition + 1 : 0;
 
         // Based on the inactive repitions, decide to execute.
-        // FIXED VALUE: Inactive repitions is set to 1... could be defined dynamic in the future
-        if (eExecFlag == EExecutionFlag::periodic && m_nInactiveRepetition > 1) return;
+        if (eExecFlag == EExecutionFlag::periodic && m_nInactiveRepetition > m_uiInactiveRepetitionLimit) return;
     }
 
     // Execution is allowed, update execution timepoint
     m_tpLast = tpNow;
 
     // Execute the trigger
+    m_rDispatchSvc.GetMetrics().counterTriggers.Increment();
     if (m_pCallback) m_pCallback->Execute();
 }
@@ -16,6 +16,8 @@
 
 #include <support/interface_ptr.h>
 #include <support/timer.h>
+#include "../../global/thread_attributes.h"
+#include <atomic>
 
 // Forward declaration
 class CDispatchService;
@@ -49,8 +51,10 @@ public:
 
     /**
      * @brief Start the scheduler. This will start the scheduler timer at a 1ms rate.
+     * @param[in] rThreadAttributes Reference to the real-time attributes applied to the thread executing the scheduler tick.
+     * When not configured, the thread keeps the attributes assigned by the task timer service.
      */
-    void Start();
+    void Start(const CThreadAttributes& rThreadAttributes);
 
     /**
      * @brief Stop the scheduler. This will stop the scheduler timer and clear all pending schedule jobs.
@@ -88,6 +92,8 @@ private:
     using CSchedulerMMap = std::multimap<std::chrono::high_resolution_clock::time_point, CObjectMap::iterator>;
 
     sdv::core::CTaskTimer       m_timer;                ///< 1ms timer
+    const CThreadAttributes*    m_pThreadAttributes = nullptr; ///< Real-time attributes of the timer thread.
+    bool                        m_bAttributesApplied = false;  ///< Set when the attributes were applied to the timer thread.
     std::mutex                  m_mtxScheduler;         ///< Protection of the schedule list
     CObjectMap                  m_mapTriggers;          ///< Map with the currently scheduled trigger objects (prevents new
                                                         ///< triggers to be scheduled for the same trigger object).
@@ -97,7 +103,8 @@ private:
 /**
  * @brief Trigger object, managing the triggering.
  */
-class CTrigger : public sdv::IInterfaceAccess, public sdv::core::ITxTrigger, public sdv::IObjectDestroy
+class CTrigger : public sdv::IInterfaceAccess, public sdv::core::ITxTrigger, public sdv::core::ITxTriggerConfig,
+    public sdv::IObjectDestroy
 {
 public:
     /**
@@ -117,6 +124,7 @@ public:
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::IInterfaceAccess)
         SDV_INTERFACE_ENTRY(sdv::core::ITxTrigger)
+        SDV_INTERFACE_ENTRY(sdv::core::ITxTriggerConfig)
         SDV_INTERFACE_ENTRY(sdv::IObjectDestroy)
     END_SDV_INTERFACE_MAP()
 
@@ -145,6 +153,21 @@ public:
      */
     virtual void RemoveSignal(/*in*/ const sdv::u8string& ssSignalName) override;
 
+    /**
+     * @brief Set the amount of periodic executions that still take place after all signals have returned to their default
+     * value. Overload of sdv::core::ITxTriggerConfig::SetInactiveRepetitions.
+     * @param[in] uiRepetitions The amount of inactive repetitions.
+     */
+    virtual void SetInactiveRepetitions(/*in*/ uint32_t uiRepetitions) override;
+
+    /**
+     * @brief Update the activity administration. Called by the signal when an assigned signal changes from or to the default
+     * value or when an active signal is added or removed.
+     * @param[in] bActive When set, the signal became active (differs from the default value); otherwise the signal became
+     * inactive.
+     */
+    void UpdateActivity(bool bActive);
+
     /**
      * @brief This function is triggered every ms.
      * @param[in] eExecFlag When set, the trigger was caused by the periodic timer.
@@ -160,6 +183,9 @@ private:
     size_t                              m_nDelay = 0ull;                        ///< The minimum delay between two triggers.
     uint32_t                            m_uiBehaviorFlags = 0ul;                ///< Additional behavior
     size_t                              m_nInactiveRepetition = 0ull;           ///< Count the amount of inactive executions.
+    std::atomic<uint32_t>               m_uiInactiveRepetitionLimit = 1ul;      ///< Amount of inactive executions to allow.
+    std::atomic<size_t>                 m_nActiveSignals = 0ull;                ///< Amount of assigned signals differing from the
+                                                                                ///< default value.
     sdv::core::ITxTriggerCallback*      m_pCallback = nullptr;                  ///< Callback pointer
     std::mutex                          m_mtxSignals;                           ///< Signal map protection.
     std::map<sdv::u8string, CSignal*>   m_mapSignals;                           ///< Assigned signals.
@@ -239,20 +239,22 @@ sdv::ps::TMarshallID CCommunicationControl::GetStub(/*in*/ sdv::interface_t ifc)
 std::shared_ptr<CMarshallObject> CCommunicationControl::CreateProxy(sdv::interface_id id, sdv::ps::TMarshallID tStubID,
     CChannelConnector& rConnector)
 {
-    std::unique_lock<std::recursive_mutex> lock(m_mtxObjects);
-
     // Create the marshall object.
-    size_t nIndex = m_vecMarshallObjects.size();
     auto ptrMarshallObject = std::make_shared<CMarshallObject>(*this);
     // Ignore cppcheck warning; normally the returned pointer should always have a value at this stage (otherwise an
     // exception was triggered).
     // cppcheck-suppress knownConditionTrueFalse
     if (!ptrMarshallObject)
         return {};
-    m_vecMarshallObjects.push_back(ptrMarshallObject);
-    if (!ptrMarshallObject->InitializeAsProxy(static_cast<uint32_t>(nIndex), id, tStubID, rConnector))
-        ptrMarshallObject.reset();
-    if (!ptrMarshallObject) return {};
+
+    // Assign a slot in the marshall object table.
+    auto sSlot = m_tableMarshallObjects.Add(ptrMarshallObject);
+    if (!sSlot.uiGeneration) return {};
+    if (!ptrMarshallObject->InitializeAsProxy(sSlot.uiIndex, sSlot.uiGeneration, id, tStubID, rConnector))
+    {
+        m_tableMarshallObjects.Remove(sSlot.uiIndex, sSlot.uiGeneration);
+        return {};
+    }
     return ptrMarshallObject;
 }
 
@@ -271,15 +273,22 @@ std::shared_ptr<CMarshallObject> CCommunicationControl::GetOrCreateStub(sdv::int
         auto prMarshallObject = m_mapStubObjects.try_emplace(ifc, std::make_shared<CMarshallObject>(*this));
         if (!prMarshallObject.second) return {};
         itMarshallObject = prMarshallObject.first;
-        size_t nIndex = m_vecMarshallObjects.size();
-        m_vecMarshallObjects.push_back(itMarshallObject->second);
-        if (!itMarshallObject->second->InitializeAsStub(static_cast<uint32_t>(nIndex), ifc))
+        auto sSlot = m_tableMarshallObjects.Add(itMarshallObject->second);
+        if (!sSlot.uiGeneration || !itMarshallObject->second->InitializeAsStub(sSlot.uiIndex, sSlot.uiGeneration, ifc))
+        {
+            m_tableMarshallObjects.Remove(sSlot.uiIndex, sSlot.uiGeneration);
             itMarshallObject->second.reset();
+        }
     }
 
     return itMarshallObject->second;
 }
 
+void CCommunicationControl::RemoveMarshallObject(const sdv::ps::TMarshallID& tMarshallID)
+{
+    m_tableMarshallObjects.Remove(tMarshallID.uiIdent, tMarshallID.uiControl);
+}
+
 uint64_t CCommunicationControl::CreateUniqueCallIndex()
 {
     // Return the next call count.
@@ -295,11 +304,8 @@ void CCommunicationControl::SetConnectorContext(CChannelConnector* pConnectorCon
 sdv::sequence<sdv::pointer<uint8_t>> CCommunicationControl::CallStub(sdv::ps::TMarshallID tStubID,
     sdv::sequence<sdv::pointer<uint8_t>>& seqInputData)
 {
-    // Find stub and call the function
-    std::unique_lock<std::recursive_mutex> lock(m_mtxObjects);
-    if (tStubID.uiIdent >= m_vecMarshallObjects.size()) throw sdv::ps::XMarshallIntegrity();
-    auto ptrMarshallObject = m_vecMarshallObjects[tStubID.uiIdent].lock();
-    lock.unlock();
+    // Find stub (the control value is the generation of the slot) and call the function
+    auto ptrMarshallObject = m_tableMarshallObjects.Find(tStubID.uiIdent, tStubID.uiControl);
 
     // Check for a valid object
     if (!ptrMarshallObject) throw sdv::ps::XMarshallIntegrity();
@@ -17,6 +17,7 @@
 #include <support/pssup.h>
 #include <support/component_impl.h>
 #include <interfaces/com.h>
+#include "marshall_table.h"
 
 // Forward declaration
 class CChannelConnector;
@@ -164,6 +165,13 @@ public:
      */
     std::shared_ptr<CMarshallObject> GetOrCreateStub(sdv::interface_t ifc);
 
+    /**
+     * @brief Remove the marshall object from the marshall object table; called when the object is destroyed. The slot of the
+     * object is reused for the next marshall object (with another control value).
+     * @param[in] tMarshallID The ID of the marshall object to remove.
+     */
+    void RemoveMarshallObject(const sdv::ps::TMarshallID& tMarshallID);
+
     /**
      * @brief To identify the send and receive packets belonging to one call, the call is identified with a unique index, which
      * is created here.
@@ -179,6 +187,8 @@ public:
 
     /**
      * @brief Call the stub function.
+     * @remarks The stub is looked up without locking; the index and control value of the stub ID address the slot in the
+     * marshall object table.
      * @remarks This function call is synchronous and does not return until the call has been finalized or a timeout
      * exception has occurred.
      * @remarks The sequence contains all data to make the call. It is important that the data in the sequence is
@@ -194,11 +204,12 @@ public:
     sdv::sequence<sdv::pointer<uint8_t>> CallStub(sdv::ps::TMarshallID tStubID, sdv::sequence<sdv::pointer<uint8_t>>& seqInputData);
 
 private:
+    CMarshallObjectTable<CMarshallObject>           m_tableMarshallObjects;         ///< Table with marshall objects; lifetime is handled by
+                                                                                    ///< channel. Declared first to be destroyed last.
     std::mutex                                      m_mtxChannels;                  ///< Protect the channel map.
     std::vector<std::shared_ptr<CChannelConnector>> m_vecChannels;                  ///< Channel vector.
     std::vector<std::thread>                        m_vecInitialConnectMon;         ///< Initial connection monitor.
-    std::recursive_mutex                            m_mtxObjects;                   ///< Protect object vectors.
-    std::vector<std::weak_ptr<CMarshallObject>>     m_vecMarshallObjects;           ///< Vector with marshall objects; lifetime is handled by channel.
+    std::recursive_mutex                            m_mtxObjects;                   ///< Protect the stub object map.
     std::map<sdv::interface_t, std::shared_ptr<CMarshallObject>> m_mapStubObjects;  ///< Map of interfaces to stub objects
     std::atomic_uint64_t                            m_uiCurrentCallCnt = 0;         ///< The current call count.
     thread_local static CChannelConnector*          m_pConnectorContext;            ///< The current connector; variable local to each thread.
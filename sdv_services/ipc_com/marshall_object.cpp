@@ -21,7 +21,9 @@ CMarshallObject::CMarshallObject(CCommunicationControl& rcontrol) : m_rcontrol(r
 
 CMarshallObject::~CMarshallObject()
 {
-
+    // Release the slot in the marshall object table.
+    if (IsValid())
+        m_rcontrol.RemoveMarshallObject(m_tMarshallID);
 }
 
 bool CMarshallObject::IsValid() const
@@ -39,15 +41,15 @@ void CMarshallObject::Reset()
     m_pConnector = nullptr;
 }
 
-sdv::interface_t CMarshallObject::InitializeAsProxy(uint32_t uiProxyIndex, sdv::interface_id id,
+sdv::interface_t CMarshallObject::InitializeAsProxy(uint32_t uiProxyIndex, uint32_t uiControl, sdv::interface_id id,
     sdv::ps::TMarshallID tStubID, CChannelConnector& rConnector)
 {
+    if (!uiControl) return {};
+
     m_eType = EType::proxy;
 
-    // Create marshall ID from index and a random number.
-    sdv::ps::TMarshallID tMarshallID = { 0, GetProcessID(), uiProxyIndex, 0 };
-    while (!tMarshallID.uiControl)
-        tMarshallID.uiControl = static_cast<uint32_t>(rand());
+    // Create marshall ID from index and control value.
+    sdv::ps::TMarshallID tMarshallID = { 0, GetProcessID(), uiProxyIndex, uiControl };
 
     // Get the stub creation interface from the repository
     sdv::core::IRepositoryMarshallCreate* pMarshallCreate =
@@ -106,16 +108,14 @@ sdv::interface_t CMarshallObject::InitializeAsProxy(uint32_t uiProxyIndex, sdv::
     return m_ifcProxy;
 }
 
-bool CMarshallObject::InitializeAsStub(uint32_t uiStubIndex, sdv::interface_t ifc)
+bool CMarshallObject::InitializeAsStub(uint32_t uiStubIndex, uint32_t uiControl, sdv::interface_t ifc)
 {
-    if (!ifc) return false;
+    if (!ifc || !uiControl) return false;
 
     m_eType = EType::stub;
 
-    // Create marshall ID from index and a random number.
-    sdv::ps::TMarshallID tMarshallID = { 0, GetProcessID(), uiStubIndex, static_cast<uint32_t>(rand()) };
-    while (!tMarshallID.uiControl)
-        tMarshallID.uiControl = static_cast<uint32_t>(rand());
+    // Create marshall ID from index and control value.
+    sdv::ps::TMarshallID tMarshallID = { 0, GetProcessID(), uiStubIndex, uiControl };
 
     // Get the stub creation interface from the repository
     sdv::core::IRepositoryMarshallCreate* pMarshallCreate =
@@ -66,28 +66,30 @@ public:
     /**
      * @brief Initialize the marshall object as proxy.
      * @param[in] uiProxyIndex The index of this proxy; becoming part of the Proxy ID.
+     * @param[in] uiControl The control value of this proxy (the slot generation); becoming part of the Proxy ID. Must not be 0.
      * @param[in] id The ID of the interface this object marshalls the calls for.
      * @param[in] tStubID The stub ID this proxy is communicating to.
      * @param[in] rConnector Reference to channel connector.
      * @return Returns a pointer to proxy interface or empty when the initialization failed.
      */
-    sdv::interface_t InitializeAsProxy(uint32_t uiProxyIndex, sdv::interface_id id, sdv::ps::TMarshallID tStubID,
-        CChannelConnector& rConnector);
+    sdv::interface_t InitializeAsProxy(uint32_t uiProxyIndex, uint32_t uiControl, sdv::interface_id id,
+        sdv::ps::TMarshallID tStubID, CChannelConnector& rConnector);
 
     /**
      * @brief Initialize the marshall object as stub.
      * @param[in] uiStubIndex The index of this stub; becoming part of the Stub ID.
+     * @param[in] uiControl The control value of this stub (the slot generation); becoming part of the Stub ID. Must not be 0.
      * @param[in] ifc Interface to the object to be marshalled to.
      * @return Returns 'true' when initialization was successful; 'false' when not.
      */
-    bool InitializeAsStub(uint32_t uiStubIndex, sdv::interface_t ifc);
+    bool InitializeAsStub(uint32_t uiStubIndex, uint32_t uiControl, sdv::interface_t ifc);
 
     /**
      * @brief Return the proxy/stub ID.
      * @details The marshall ID consist of an index to easily access the marshalling details and a control value to increase higher
-     * security. The control value is a randomly generated value used in the communication to check whether the marshall object ID
-     * is valid. Both index and control value must be known by the caller for the call to succeed. If one is wrong, the call won't
-     * be made.
+     * security. The control value is the generation of the slot in the marshall object table; it starts at a random value and
+     * changes each time the slot is reused. Both index and control value must be known by the caller for the call to succeed. If
+     * one is wrong, the call won't be made.
      * @return The ID of this marshall object.
      */
     sdv::ps::TMarshallID GetMarshallID() const;
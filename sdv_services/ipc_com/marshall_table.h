@@ -0,0 +1,246 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef MARSHALL_TABLE_H
+#define MARSHALL_TABLE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Generation-tagged slot table for marshall objects.
+ * @details The table assigns each object a slot index and a generation. Together these form the marshall ID, so an
+ * incoming call can be dispatched without searching. When an object is removed, its slot goes onto a free list and is
+ * reused by the next object. The generation of a reused slot is incremented, so calls to the old ID are rejected.
+ * Memory stays bounded by the largest number of objects alive at the same time, not by the number ever created.
+ * The slots are stored in blocks that are never moved or freed while the table exists. Therefore the lookup does not
+ * need a lock. It registers itself as a reader in the slot state with one atomic operation while copying the object
+ * pointer. Adding and removing objects are serialized by a mutex.
+ * @tparam TObject The object type stored in the table.
+ */
+template <typename TObject>
+class CMarshallObjectTable
+{
+public:
+    /**
+     * @brief Slot assigned to an object.
+     */
+    struct SSlotID
+    {
+        uint32_t    uiIndex = 0;            ///< Index of the slot.
+        uint32_t    uiGeneration = 0;       ///< Generation of the slot; never 0 for an assigned slot.
+    };
+
+    /// Amount of slots per block.
+    static constexpr uint32_t nBlockSize = 256;
+
+    /// Maximum amount of blocks; limits the table to 1M simultaneously existing objects.
+    static constexpr uint32_t nMaxBlocks = 4096;
+
+    /**
+     * @brief Default constructor.
+     */
+    CMarshallObjectTable() = default;
+
+    /**
+     * @brief Copy constructor is not allowed.
+     */
+    CMarshallObjectTable(const CMarshallObjectTable&) = delete;
+
+    /**
+     * @brief Destructor. Frees the slot blocks.
+     */
+    ~CMarshallObjectTable()
+    {
+        for (std::atomic<SSlot*>& rptrBlock : m_rgptrBlocks)
+            delete[] rptrBlock.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Copy assignment is not allowed.
+     * @return Reference to this table.
+     */
+    CMarshallObjectTable& operator=(const CMarshallObjectTable&) = delete;
+
+    /**
+     * @brief Add an object to the table. A released slot is reused before a new slot is created.
+     * @remarks The table doesn't control the object lifetime. Only a weak reference to the object is stored.
+     * @param[in] rptrObject Reference to the shared pointer of the object to add.
+     * @return The assigned slot, or a slot with generation 0 if the table is full or the object is empty.
+     */
+    SSlotID Add(const std::shared_ptr<TObject>& rptrObject)
+    {
+        if (!rptrObject) return {};
+        std::unique_lock<std::mutex> lock(m_mtxModify);
+
+        // Use a released slot or create a new one
+        uint32_t uiIndex = 0;
+        if (!m_vecFreeSlots.empty())
+        {
+            uiIndex = m_vecFreeSlots.back();
+            m_vecFreeSlots.pop_back();
+        }
+        else
+        {
+            uiIndex = m_uiSlotCount;
+            if (uiIndex / nBlockSize >= nMaxBlocks) return {};
+            if (!m_rgptrBlocks[uiIndex / nBlockSize].load(std::memory_order_relaxed))
+            {
+                // The first generation is random; this makes guessing a valid marshall ID harder.
+                SSlot* pBlock = new SSlot[nBlockSize];
+                for (uint32_t uiSlot = 0; uiSlot < nBlockSize; uiSlot++)
+                    pBlock[uiSlot].uiState.store(static_cast<uint64_t>(NextGeneration(static_cast<uint32_t>(std::rand())))
+                        << 32, std::memory_order_relaxed);
+                m_rgptrBlocks[uiIndex / nBlockSize].store(pBlock, std::memory_order_release);
+            }
+            m_uiSlotCount++;
+        }
+
+        // Store the object and publish the slot.
+        SSlot& rsSlot = m_rgptrBlocks[uiIndex / nBlockSize].load(std::memory_order_relaxed)[uiIndex % nBlockSize];
+        uint32_t uiGeneration = static_cast<uint32_t>(rsSlot.uiState.load(std::memory_order_relaxed) >> 32);
+        rsSlot.ptrObject = rptrObject;
+        rsSlot.uiState.store(static_cast<uint64_t>(uiGeneration) << 32 | uiOccupiedFlag, std::memory_order_release);
+        m_nObjectCount++;
+        return SSlotID{ uiIndex, uiGeneration };
+    }
+
+    /**
+     * @brief Remove an object from the table and release its slot for reuse.
+     * @details The slot generation is incremented, so lookups with the old generation fail from now on. Lookups that
+     * are copying the object pointer at this moment are allowed to finish before the slot is cleared.
+     * @param[in] uiIndex Index of the slot.
+     * @param[in] uiGeneration Generation of the slot. Nothing is removed if the generation doesn't match.
+     */
+    void Remove(uint32_t uiIndex, uint32_t uiGeneration)
+    {
+        std::unique_lock<std::mutex> lock(m_mtxModify);
+        SSlot* pSlot = GetSlot(uiIndex);
+        if (!pSlot) return;
+
+        // Invalidate the slot by moving to the next generation; the reader count is kept.
+        uint64_t uiState = pSlot->uiState.load(std::memory_order_acquire);
+        do
+        {
+            if (!(uiState & uiOccupiedFlag) || static_cast<uint32_t>(uiState >> 32) != uiGeneration) return;
+        } while (!pSlot->uiState.compare_exchange_weak(uiState,
+            static_cast<uint64_t>(NextGeneration(uiGeneration)) << 32 | (uiState & uiReaderMask), std::memory_order_acq_rel,
+            std::memory_order_acquire));
+
+        // Wait for the readers still copying the object pointer. This takes no longer than a weak_ptr::lock call.
+        while (pSlot->uiState.load(std::memory_order_acquire) & uiReaderMask)
+            std::this_thread::yield();
+
+        pSlot->ptrObject.reset();
+        m_vecFreeSlots.push_back(uiIndex);
+        m_nObjectCount--;
+    }
+
+    /**
+     * @brief Find an object. This function doesn't lock and can be called concurrently with Add and Remove.
+     * @param[in] uiIndex Index of the slot.
+     * @param[in] uiGeneration Generation of the slot.
+     * @return The object. Empty if the slot doesn't exist, its generation doesn't match or the object was destroyed.
+     */
+    std::shared_ptr<TObject> Find(uint32_t uiIndex, uint32_t uiGeneration) const
+    {
+        SSlot* pSlot = GetSlot(uiIndex);
+        if (!pSlot) return {};
+
+        // Register as reader; only possible while the slot is occupied with the requested generation.
+        uint64_t uiState = pSlot->uiState.load(std::memory_order_acquire);
+        do
+        {
+            if (!(uiState & uiOccupiedFlag) || static_cast<uint32_t>(uiState >> 32) != uiGeneration) return {};
+        } while (!pSlot->uiState.compare_exchange_weak(uiState, uiState + 1, std::memory_order_acquire,
+            std::memory_order_acquire));
+
+        std::shared_ptr<TObject> ptrObject = pSlot->ptrObject.lock();
+        pSlot->uiState.fetch_sub(1, std::memory_order_release);
+        return ptrObject;
+    }
+
+    /**
+     * @brief Get the amount of objects currently stored in the table.
+     * @return The amount of objects.
+     */
+    size_t GetObjectCount() const
+    {
+        std::unique_lock<std::mutex> lock(m_mtxModify);
+        return m_nObjectCount;
+    }
+
+    /**
+     * @brief Get the amount of slots created by the table (occupied and released).
+     * @return The amount of slots.
+     */
+    size_t GetSlotCount() const
+    {
+        std::unique_lock<std::mutex> lock(m_mtxModify);
+        return m_uiSlotCount;
+    }
+
+private:
+    /**
+     * @brief Slot containing the object and the slot state.
+     * @details The state holds the generation in the upper 32 bits. Bit 31 is set while the slot is occupied. The lower 31
+     * bits count the lookups that are copying the object pointer.
+     */
+    struct SSlot
+    {
+        std::atomic_uint64_t        uiState{0};     ///< Slot state.
+        std::weak_ptr<TObject>      ptrObject;      ///< The object.
+    };
+
+    /// Occupied flag in the slot state.
+    static constexpr uint64_t uiOccupiedFlag = 0x80000000ull;
+
+    /// Reader count mask in the slot state.
+    static constexpr uint64_t uiReaderMask = 0x7fffffffull;
+
+    /**
+     * @brief Get the next generation; the generation 0 is skipped.
+     * @param[in] uiGeneration The current generation.
+     * @return The next generation.
+     */
+    static uint32_t NextGeneration(uint32_t uiGeneration)
+    {
+        return ++uiGeneration ? uiGeneration : 1;
+    }
+
+    /**
+     * @brief Get the slot for the index.
+     * @param[in] uiIndex Index of the slot.
+     * @return Pointer to the slot or nullptr when the slot doesn't exist.
+     */
+    SSlot* GetSlot(uint32_t uiIndex) const
+    {
+        if (uiIndex / nBlockSize >= nMaxBlocks) return nullptr;
+        SSlot* pBlock = m_rgptrBlocks[uiIndex / nBlockSize].load(std::memory_order_acquire);
+        return pBlock ? pBlock + uiIndex % nBlockSize : nullptr;
+    }
+
+    std::array<std::atomic<SSlot*>, nMaxBlocks> m_rgptrBlocks = {};    ///< Slot blocks; created on demand, never moved.
+    mutable std::mutex                          m_mtxModify;            ///< Serializes adding and removing objects.
+    std::vector<uint32_t>                       m_vecFreeSlots;         ///< Released slots available for reuse.
+    uint32_t                                    m_uiSlotCount = 0;      ///< Amount of created slots.
+    size_t                                      m_nObjectCount = 0;     ///< Amount of occupied slots.
+};
+
+#endif // !defined MARSHALL_TABLE_H
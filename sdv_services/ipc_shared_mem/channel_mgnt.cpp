@@ -36,7 +36,7 @@ sdv::ipc::SChannelEndpoint CSharedMemChannelMgnt::CreateEndpoint(/*in*/ const sd
     }
 
     // Create a connection
-    std::shared_ptr<CConnection> ptrConnection = std::make_shared<CConnection>(m_watchdog, uiSize, ssName, true);
+    std::shared_ptr<CConnection> ptrConnection = std::make_shared<CConnection>(m_watchdog, m_threadAttributes, uiSize, ssName, true);
     // Ignore cppcheck warning; normally the returned pointer should always have a value at this stage (otherwise an
     // exception was triggered).
     // cppcheck-suppress knownConditionTrueFalse
@@ -60,11 +60,11 @@ sdv::IInterfaceAccess* CSharedMemChannelMgnt::Access(const sdv::u8string& ssConn
     // to connect to the shared memory.
     std::shared_ptr<CConnection> ptrConnection;
     if (parser.GetDirect("Provider").IsValid())
-        ptrConnection = std::make_shared<CConnection>(m_watchdog, ssConnectString.c_str());
+        ptrConnection = std::make_shared<CConnection>(m_watchdog, m_threadAttributes, ssConnectString.c_str());
     else
     {
         std::string ssName = static_cast<std::string>(parser.GetDirect("IpcChannel.Name").GetValue());
-        ptrConnection = std::make_shared<CConnection>(m_watchdog, 0,ssName, false);
+        ptrConnection = std::make_shared<CConnection>(m_watchdog, m_threadAttributes, 0, ssName, false);
     }
     if (!ptrConnection) return {};
     m_watchdog.AddConnection(ptrConnection);
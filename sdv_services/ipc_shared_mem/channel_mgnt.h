@@ -20,6 +20,7 @@
 #include "shared_mem_buffer_posix.h"
 #include "shared_mem_buffer_windows.h"
 #include "watchdog.h"
+#include "../../global/thread_attributes.h"
 #include "connection.h"
 
 #define TEST_DECLARE_OBJECT_CLASS_ALIAS(...)                                                                                       \
@@ -48,6 +49,11 @@ public:
     DECLARE_DEFAULT_OBJECT_NAME("LocalChannelControl")
     DECLARE_OBJECT_SINGLETON()
 
+    // Parameter map
+    BEGIN_SDV_PARAM_MAP()
+        SDV_PARAM_CHAIN_MEMBER(m_threadAttributes)
+    END_SDV_PARAM_MAP()
+
     /**
      * @brief Shutdown the object. Overload of sdv::CSdvObject::OnShutdown.
      */
@@ -104,6 +110,7 @@ private:
         CSharedMemBufferRx  bufferTargetRx;     ///< Target Rx channel
     };
 
+    CThreadAttributes           m_threadAttributes;                         ///< Real-time attributes of the receive threads.
     std::map<std::string, std::unique_ptr<SChannel>>    m_mapChannels;      ///< Map with channels.
     CWatchDog                   m_watchdog;                                 ///< Process monitor for connections.
 };
@@ -44,8 +44,9 @@ inline std::string ConnectState2String(sdv::ipc::EConnectState eState)
     }
 }
 
-CConnection::CConnection(CWatchDog& rWatchDog, uint32_t uiSize, const std::string& rssName, bool bServer) :
-    m_rWatchDog(rWatchDog), m_sender(uiSize, rssName, bServer), m_receiver(uiSize, rssName, bServer), m_bServer(bServer)
+CConnection::CConnection(CWatchDog& rWatchDog, const CThreadAttributes& rThreadAttributes, uint32_t uiSize,
+    const std::string& rssName, bool bServer) :
+    m_rWatchDog(rWatchDog), m_rThreadAttributes(rThreadAttributes), m_sender(uiSize, rssName, bServer), m_receiver(uiSize, rssName, bServer), m_bServer(bServer)
 {
 #if ENABLE_REPORTING >= 1
     TRACE("Accessing ", bServer ? "server" : "client", " connection with shared mem buffer of ", uiSize, " bytes and names \"",
@@ -53,8 +54,9 @@ CConnection::CConnection(CWatchDog& rWatchDog, uint32_t uiSize, const std::strin
 #endif
 }
 
-CConnection::CConnection(CWatchDog& rWatchDog, const std::string& rssConnectionString) :
-    m_rWatchDog(rWatchDog), m_sender(rssConnectionString), m_receiver(rssConnectionString)
+CConnection::CConnection(CWatchDog& rWatchDog, const CThreadAttributes& rThreadAttributes,
+    const std::string& rssConnectionString) :
+    m_rWatchDog(rWatchDog), m_rThreadAttributes(rThreadAttributes), m_sender(rssConnectionString), m_receiver(rssConnectionString)
 {
     // Interpret the connection string
     sdv::toml::CTOMLParser config(rssConnectionString);
@@ -340,6 +342,8 @@ bool CConnection::SendData(/*inout*/ sdv::sequence<sdv::pointer<uint8_t>>& seqDa
         return false;
     }
 
+    GetMetrics().counterMessagesSent.Increment();
+    GetMetrics().counterBytesSent.Increment(uiRequiredSize);
     return true;
 }
 
@@ -557,6 +561,12 @@ bool CConnection::IsServer() const
     return m_bServer;
 }
 
+CConnection::SMetrics& CConnection::GetMetrics()
+{
+    static SMetrics sMetrics;
+    return sMetrics;
+}
+
 void CConnection::ReceiveMessages()
 {
     m_bStarted = true;
@@ -571,6 +581,7 @@ void CConnection::ReceiveMessages()
     // Increase thread priority
     SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_ABOVE_NORMAL);
 #endif
+    m_rThreadAttributes.Apply("SharedMemReceive");
 
     if (!m_sender.IsValid() || !m_receiver.IsValid())
     {
@@ -820,6 +831,9 @@ bool CConnection::ReadDataChunk(CMessage& rMessage, uint32_t uiOffset, SDataCont
 
             if (rsDataCtxt.nChunkIndex == rsDataCtxt.seqDataChunks.size())
             {
+                GetMetrics().counterMessagesReceived.Increment();
+                GetMetrics().counterBytesReceived.Increment(rsDataCtxt.uiTotalSize);
+
 #if ENABLE_REPORTING >= 4
                 for (size_t nChunkIndex = 0; nChunkIndex < rsDataCtxt.seqDataChunks.size(); nChunkIndex++)
                 {
@@ -852,10 +866,14 @@ bool CConnection::ReadDataChunk(CMessage& rMessage, uint32_t uiOffset, SDataCont
 
                 // Queue the data...
                 m_queueReceive.push(std::move(rsDataCtxt.seqDataChunks));
+                GetMetrics().gaugeQueueDepth.Set(static_cast<int64_t>(m_queueReceive.size()));
 
                 m_cvReceiveAvailable.notify_all();
 #else
+                auto tpProcess = std::chrono::steady_clock::now();
                 if (m_pReceiver) m_pReceiver->ReceiveData(rsDataCtxt.seqDataChunks);
+                GetMetrics().histReceiveProcessing.Observe(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tpProcess).count()));
                 rsDataCtxt = SDataContext();    // Reset
 #endif
                 break;  // Done...
@@ -868,6 +886,8 @@ bool CConnection::ReadDataChunk(CMessage& rMessage, uint32_t uiOffset, SDataCont
 #if ENABLE_DECOUPLING > 0
 void CConnection::DecoupleReceive()
 {
+    m_rThreadAttributes.Apply("SharedMemDecoupleReceive");
+
     while (m_eConnectState != sdv::ipc::EConnectState::terminating)
     {
         // Wait for data
@@ -881,6 +901,7 @@ void CConnection::DecoupleReceive()
         // Get the top most data
         sdv::sequence<sdv::pointer<uint8_t>> seqData = std::move(m_queueReceive.front());
         m_queueReceive.pop();
+        GetMetrics().gaugeQueueDepth.Set(static_cast<int64_t>(m_queueReceive.size()));
         lock.unlock();
 
 #if ENABLE_REPORTING >= 3
@@ -891,7 +912,10 @@ void CConnection::DecoupleReceive()
 #endif
 
         // Process the data
+        auto tpProcess = std::chrono::steady_clock::now();
         if (m_pReceiver) m_pReceiver->ReceiveData(seqData);
+        GetMetrics().histReceiveProcessing.Observe(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tpProcess).count()));
 
         // Data processed.
         m_cvReceiveProcessed.notify_all();
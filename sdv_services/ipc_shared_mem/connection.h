@@ -39,9 +39,11 @@
 #include <support/interface_ptr.h>
 #include <support/local_service_access.h>
 #include <support/component_impl.h>
+#include <support/metrics.h>
 #include <queue>
 #include <list>
 #include "../../global/trace.h"
+#include "../../global/thread_attributes.h"
 
 #ifdef _MSC_VER
 #pragma comment(lib, "Ws2_32.lib")
@@ -59,22 +61,57 @@ class CConnection : public std::enable_shared_from_this<CConnection>, public sdv
     public sdv::ipc::IDataSend, public sdv::ipc::IConnect
 {
 public:
+    /**
+     * @brief Runtime metrics of the shared memory connections; shared by all connections of the process.
+     */
+    struct SMetrics
+    {
+        /// Amount of data messages sent.
+        sdv::core::CMetricCounter   counterMessagesSent{"sdv_ipc_messages_sent_total",
+            "Amount of data messages sent over shared memory connections."};
+
+        /// Amount of data bytes sent.
+        sdv::core::CMetricCounter   counterBytesSent{"sdv_ipc_bytes_sent_total",
+            "Amount of data bytes (including the chunk table) sent over shared memory connections."};
+
+        /// Amount of data messages received.
+        sdv::core::CMetricCounter   counterMessagesReceived{"sdv_ipc_messages_received_total",
+            "Amount of data messages received over shared memory connections."};
+
+        /// Amount of data bytes received.
+        sdv::core::CMetricCounter   counterBytesReceived{"sdv_ipc_bytes_received_total",
+            "Amount of data bytes (including the chunk table) received over shared memory connections."};
+
+        /// Processing time of the received data messages; blocks the receive loop unless decoupled.
+        sdv::core::CMetricHistogram histReceiveProcessing{"sdv_ipc_receive_processing_us",
+            "Processing time of a received data message by the receiver (us).", sdv::core::GetMetricDurationBounds()};
+
+#if ENABLE_DECOUPLING > 0
+        /// Amount of data messages waiting for the decoupled processing.
+        sdv::core::CMetricGauge     gaugeQueueDepth{"sdv_ipc_receive_queue_depth",
+            "Amount of received data messages waiting to be processed."};
+#endif
+    };
+
     /**
      * @brief default constructor used by create endpoint - allocates new buffers m_Sender and m_Receiver
      * @param[in] rWatchDog Reference to the watch dog object monitoring the connected processes.
+     * @param[in] rThreadAttributes Reference to the real-time attributes of the receive threads.
      * @param[in] uiSize Optional size of the buffer. If zero, a default buffer size of 10k is configured.
      * @param[in] rssName Optional name to be used for the connection. If empty, a random name is generated.
      * @param[in] bServer When set, the connection is the server connection; otherwise it is the client connection (determines the
      * initial communication).
      */
-    CConnection(CWatchDog& rWatchDog, uint32_t uiSize, const std::string& rssName, bool bServer);
+    CConnection(CWatchDog& rWatchDog, const CThreadAttributes& rThreadAttributes, uint32_t uiSize, const std::string& rssName,
+        bool bServer);
 
     /**
      * @brief Access existing connection
      * @param[in] rWatchDog Reference to the watch dog object monitoring the connected processes.
+     * @param[in] rThreadAttributes Reference to the real-time attributes of the receive threads.
      * @param[in] rssConnectionString Reference to string with connection information.
      */
-    CConnection(CWatchDog& rWatchDog, const std::string& rssConnectionString);
+    CConnection(CWatchDog& rWatchDog, const CThreadAttributes& rThreadAttributes, const std::string& rssConnectionString);
 
     /**
     * @brief Virtual destructor needed for "delete this;".
@@ -173,6 +210,12 @@ public:
      */
     bool IsServer() const;
 
+    /**
+     * @brief Get the runtime metrics of the connections.
+     * @return Reference to the metrics.
+     */
+    static SMetrics& GetMetrics();
+
 #ifdef TIME_TRACKING
     /**
      * @brief Get the last fragment sent time. Used to detect gaps.
@@ -254,6 +297,7 @@ private:
 
     CWatchDog&                              m_rWatchDog;                    ///< Reference to the watch dog object monitoring
                                                                             ///< the connected processes.
+    const CThreadAttributes&                m_rThreadAttributes;            ///< Real-time attributes of the receive threads.
     sdv::CLifetimeCookie                    m_cookie = sdv::CreateLifetimeCookie(); ///< Lifetime cookie to manage module lifetime.
     CSharedMemBufferTx                      m_sender;                       ///< Shared buffer for sending.
     CSharedMemBufferRx                      m_receiver;                     ///< Shared buffer for receiving.
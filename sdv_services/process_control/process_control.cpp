@@ -45,6 +45,13 @@
 #include <sys/wait.h>
 #include <signal.h>
 #include <spawn.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <poll.h>
+#include <cerrno>
+#include <cstring>
+#include <array>
 #else
 #error OS is not supported!
 #endif
@@ -58,6 +65,26 @@ CProcessControl::~CProcessControl()
 
 bool CProcessControl::OnInitialize()
 {
+#ifdef __unix__
+    // Create the epoll instance and the wakeup event. Termination of processes is signalled through process file descriptors
+    // being added to the epoll instance.
+    m_iEpollFD = epoll_create1(EPOLL_CLOEXEC);
+    m_iWakeupFD = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_iEpollFD < 0 || m_iWakeupFD < 0)
+    {
+        SDV_LOG_ERROR("Failed to create the process monitor event handling: ", std::strerror(errno));
+        if (m_iEpollFD >= 0) close(m_iEpollFD);
+        if (m_iWakeupFD >= 0) close(m_iWakeupFD);
+        m_iEpollFD = -1;
+        m_iWakeupFD = -1;
+        return false;
+    }
+    epoll_event sEvent{};
+    sEvent.events = EPOLLIN;
+    sEvent.data.u64 = 0;    // Process ID 0 is reserved for the wakeup event.
+    epoll_ctl(m_iEpollFD, EPOLL_CTL_ADD, m_iWakeupFD, &sEvent);
+#endif
+
     // Without monitor no trigger...
     m_threadMonitor = std::thread(&CProcessControl::MonitorThread, this);
 
@@ -70,8 +97,26 @@ void CProcessControl::OnShutdown()
 
     // Shutdown the monitor
     m_bShutdown = true;
+#ifdef __unix__
+    WakeupMonitor();
+#endif
     if (m_threadMonitor.joinable())
         m_threadMonitor.join();
+
+#ifdef __unix__
+    // End the zygote
+    m_zygote.Close();
+
+    // Close the process file descriptors and the event handling.
+    std::unique_lock<std::mutex> lock(m_mtxProcesses);
+    for (auto& rvtProcess : m_mapProcesses)
+        UnwatchProcess(*rvtProcess.second);
+    lock.unlock();
+    if (m_iWakeupFD >= 0) close(m_iWakeupFD);
+    if (m_iEpollFD >= 0) close(m_iEpollFD);
+    m_iWakeupFD = -1;
+    m_iEpollFD = -1;
+#endif
 }
 
 bool CProcessControl::AllowProcessControl() const
@@ -148,6 +193,9 @@ uint32_t CProcessControl::RegisterMonitor(/*in*/ sdv::process::TProcessID tProce
         }
         SDV_LOG_TRACE(GetTimestamp(), "Monitor now added... (PID#", tProcessID, ")");
         itProcess = prInsert.first;
+#ifdef __unix__
+        WatchProcess(*ptrNewProcess);
+#endif
     }
     auto ptrProcess = itProcess->second;
 
@@ -207,22 +255,14 @@ bool CProcessControl::WaitForTerminate(/*in*/ sdv::process::TProcessID tProcessI
     std::unique_lock<std::mutex> lockProcess(ptrProcess->mtxProcess);
     if (!ptrProcess->bRunning) return true;
 
-    // Wait for termination
-    std::chrono::high_resolution_clock::time_point tpStart = std::chrono::high_resolution_clock::now();
-	bool bTimeout = false;
-    // False warning from cppcheck. bRunning is set by the monitor thread. Suppress warning.
-    // cppcheck-suppress knownConditionTrueFalse
-    while (ptrProcess->bRunning)
+    // Wait for termination (the monitor thread notifies the condition variable).
+    auto fnTerminated = [&]() { return !ptrProcess->bRunning; };
+    if (uiWaitMs == 0xffffffff)
     {
-        ptrProcess->cvWaitForProcess.wait_for(lockProcess, std::chrono::milliseconds(10));
-        if (std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - tpStart).count() > static_cast<double>(uiWaitMs))
-		{
-			bTimeout = true;
-            break;
-		}
+        ptrProcess->cvWaitForProcess.wait(lockProcess, fnTerminated);
+        return true;
     }
-
-    return !bTimeout;
+    return ptrProcess->cvWaitForProcess.wait_for(lockProcess, std::chrono::milliseconds(uiWaitMs), fnTerminated);
 }
 
 sdv::process::TProcessID CProcessControl::Execute(/*in*/ const sdv::u8string& ssModule,
@@ -340,50 +380,48 @@ sdv::process::TProcessID CProcessControl::Execute(/*in*/ const sdv::u8string& ss
 
 #elif defined __unix__
 
-    // Create the argument list
-    std::vector<char*> vecArgs;
-    auto seqTempArgs = seqArgs;
-    std::string ssModuleTemp = pathModule.native();
-    seqTempArgs.insert(seqTempArgs.begin(), &ssModuleTemp.front());
-    for (auto& rssArg : seqTempArgs)
-        vecArgs.push_back(&rssArg.front());
-    vecArgs.push_back(nullptr);
-
-    // Create environment variable list
-    std::vector<char*> vecEnv;
-    vecEnv.push_back(nullptr);
-
-    // TODO: Update rights and environment vars
-
-    // Fork the process
-    int pid = vfork();
-    switch (pid)
+    // Use the zygote for the configured module. The zygote creates a copy of its pre-initialized process, which becomes a child
+    // of this process. Fall back to starting the process directly if the zygote is not available.
+    if (!m_ssZygoteModule.empty() && pathModule.filename() == std::filesystem::path(m_ssZygoteModule).filename() &&
+        m_zygote.Start(pathModule))
     {
-    case -1:    // Error called in parent process; cannot continue
-        return 0;
-    case 0:     // Child process is executing with pid == 0
+        std::vector<std::string> vecZygoteArgs;
+        for (const sdv::u8string& rssArg : seqArgs)
+            vecZygoteArgs.push_back(rssArg);
+        tProcessID = static_cast<sdv::process::TProcessID>(m_zygote.Spawn(vecZygoteArgs, bReduceRights));
+        if (!tProcessID)
+            SDV_LOG_WARNING("Zygote of \"", m_ssZygoteModule, "\" failed to create a process; starting the process directly.");
+    }
+
+    if (!tProcessID)
     {
-        // Reduce rights
+        // Create the argument list
+        std::vector<char*> vecArgs;
+        auto seqTempArgs = seqArgs;
+        std::string ssModuleTemp = pathModule.native();
+        seqTempArgs.insert(seqTempArgs.begin(), &ssModuleTemp.front());
+        for (auto& rssArg : seqTempArgs)
+            vecArgs.push_back(&rssArg.front());
+        vecArgs.push_back(nullptr);
+
+        // Create environment variable list
+        std::vector<char*> vecEnv;
+        vecEnv.push_back(nullptr);
+
+        // TODO: Update environment vars
+
+        // Reduce rights: the effective user and group are reset to the real user and group of this process.
+        posix_spawnattr_t sAttr;
+        posix_spawnattr_init(&sAttr);
         if (bReduceRights)
-        {
-#ifdef __GNUC__
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-result"
-#endif
-            setgid(getgid());
-            setuid(getuid());
-#ifdef __GNUC__
-#pragma GCC diagnostic pop
-#endif
-        }
+            posix_spawnattr_setflags(&sAttr, POSIX_SPAWN_RESETIDS);
 
-        execve(pathModule.native().c_str(), &vecArgs.front(), &vecEnv.front());
-        std::abort(); // Child process only comes here on error
-    }
-    default:
-        // Parent process is executing with pid != 0
+        // Spawn the process. In contrast to fork/exec, posix_spawn doesn't copy the page tables of this process.
+        pid_t pid = 0;
+        int iResult = posix_spawn(&pid, pathModule.native().c_str(), nullptr, &sAttr, &vecArgs.front(), &vecEnv.front());
+        posix_spawnattr_destroy(&sAttr);
+        if (iResult != 0) return 0;
         tProcessID = static_cast<sdv::process::TProcessID>(pid);
-        break;
     }
 #else
 #error OS is not supported!
@@ -403,7 +441,11 @@ sdv::process::TProcessID CProcessControl::Execute(/*in*/ const sdv::u8string& ss
 #ifdef _WIN32
     ptrNewProcess->hProcess = sProcessInfo.hProcess;
 #endif
+    std::unique_lock<std::mutex> lock(m_mtxProcesses);
     m_mapProcesses[tProcessID] = ptrNewProcess;
+#ifdef __unix__
+    WatchProcess(*ptrNewProcess);
+#endif
 
     return tProcessID;
 }
@@ -429,113 +471,211 @@ bool CProcessControl::Terminate(/*in*/ sdv::process::TProcessID tProcessID)
     return true;
 }
 
-void CProcessControl::MonitorThread()
+#ifdef __unix__
+void CProcessControl::WatchProcess(SProcessHelper& rsProcess)
 {
-    while (!m_bShutdown)
+    if (rsProcess.iPidFD >= 0 || m_iEpollFD < 0) return;
+
+    // Request a process file descriptor. The descriptor becomes readable when the process terminates. Linux kernels older than
+    // 5.3 do not support pidfd_open; the process will be polled by the monitor thread instead.
+#ifdef SYS_pidfd_open
+    int iPidFD = static_cast<int>(syscall(SYS_pidfd_open, static_cast<pid_t>(rsProcess.tProcessID), 0));
+    if (iPidFD >= 0)
     {
-        // Run through the list of processes and determine which process has been terminated.
-        std::unique_lock<std::mutex> lock(m_mtxProcesses);
-        std::vector<std::shared_ptr<SProcessHelper>> m_vecTerminatedProcesses;
-        for (auto& vtProcess : m_mapProcesses)
-        {
-            // Update only once
-            if (!vtProcess.second->bRunning) continue;
+        epoll_event sEvent{};
+        sEvent.events = EPOLLIN;
+        sEvent.data.u64 = rsProcess.tProcessID;
+        if (epoll_ctl(m_iEpollFD, EPOLL_CTL_ADD, iPidFD, &sEvent) == 0)
+            rsProcess.iPidFD = iPidFD;
+        else
+            close(iPidFD);
+    }
+#endif
+    if (rsProcess.iPidFD >= 0) return;
+
+    // Let the monitor thread switch to polling.
+    SDV_LOG_TRACE(getpid(), " Process ", rsProcess.tProcessID, " cannot be monitored by event; using polling...");
+    WakeupMonitor();
+}
 
+void CProcessControl::UnwatchProcess(SProcessHelper& rsProcess)
+{
+    if (rsProcess.iPidFD < 0) return;
+    if (m_iEpollFD >= 0)
+        epoll_ctl(m_iEpollFD, EPOLL_CTL_DEL, rsProcess.iPidFD, nullptr);
+    close(rsProcess.iPidFD);
+    rsProcess.iPidFD = -1;
+}
+
+void CProcessControl::WakeupMonitor()
+{
+    if (m_iWakeupFD < 0) return;
+    uint64_t uiValue = 1;
+    [[maybe_unused]] auto nSize = write(m_iWakeupFD, &uiValue, sizeof(uiValue));
+}
+#endif
+
+bool CProcessControl::CheckProcessTerminated(SProcessHelper& rsProcess)
+{
 #ifdef _WIN32
-            DWORD dwExitCode = 0;
-            if (GetExitCodeProcess(vtProcess.second->hProcess, &dwExitCode) && dwExitCode != STILL_ACTIVE)
-//            if (WaitForSingleObject(vtProcess.second->hProcess, 0) == WAIT_OBJECT_0)
-            {
-                // Get the exit code
-                //DWORD dwExitCode = 0;
-                //GetExitCodeProcess(vtProcess.second->hProcess, &dwExitCode);
-                vtProcess.second->iRetVal = static_cast<int>(dwExitCode);   // Do not convert to 64-bit!
+    DWORD dwExitCode = 0;
+    if (GetExitCodeProcess(rsProcess.hProcess, &dwExitCode) && dwExitCode != STILL_ACTIVE)
+    {
+        rsProcess.iRetVal = static_cast<int>(dwExitCode);   // Do not convert to 64-bit!
 
-                // Close the process handle
-                CloseHandle(vtProcess.second->hProcess);
-                vtProcess.second->hProcess = 0;
-                m_vecTerminatedProcesses.push_back(vtProcess.second);
+        // Close the process handle
+        CloseHandle(rsProcess.hProcess);
+        rsProcess.hProcess = 0;
 
-                TRACE(GetTimestamp(), "Adding process PID#", vtProcess.second->tProcessID, " to termination map with exit code ", vtProcess.second->iRetVal);
-            }
+        TRACE(GetTimestamp(), "Adding process PID#", rsProcess.tProcessID, " to termination map with exit code ", rsProcess.iRetVal);
+        return true;
+    }
+    return false;
 #elif defined __unix__
-            // There are two ways of checking whether a process is still running. If the monitor process is the parent process, the
-            // waitpid function should be used to request the process state. If the process was not created by the parent process,
-            // the kill function returns information about the process.
-            // After termination a process will stay dorment until the parent process has received the exit value of the process.
-            // This is also the reason why the kill function is not working with the parent process, since it is only returning
-            // a result after the process is not available at all any more (also not dorment).
-            // Use a flag to indicate that the process is not a child process of the monitor process.
-            if (!vtProcess.second->bNotAChild)
-            {
-                // Check with waitpid first
-                int iStatus = 0;
+    // There are two ways of checking whether a process is still running. If the monitor process is the parent process, the
+    // waitpid function should be used to request the process state. If the process was not created by the parent process,
+    // the kill function returns information about the process.
+    // After termination a process will stay dorment until the parent process has received the exit value of the process.
+    // This is also the reason why the kill function is not working with the parent process, since it is only returning
+    // a result after the process is not available at all any more (also not dorment).
+    // Use a flag to indicate that the process is not a child process of the monitor process.
+    bool bTerminated = false;
+    if (!rsProcess.bNotAChild)
+    {
+        // Check with waitpid first
+        int iStatus = 0;
 #ifdef WCONTINUED
-                pid_t pid = waitpid(vtProcess.second->tProcessID, &iStatus, WCONTINUED | WNOHANG);
+        pid_t pid = waitpid(static_cast<pid_t>(rsProcess.tProcessID), &iStatus, WCONTINUED | WNOHANG);
 #else
-                pid_t pid = waitpid(vtProcess.second->tProcessID, &iStatus, WNOHANG);
+        pid_t pid = waitpid(static_cast<pid_t>(rsProcess.tProcessID), &iStatus, WNOHANG);
 #endif
-                switch (pid)
-                {
-                case -1:
-                    // Not a child process of the monitor process. Or a signal is returned to the calling process. Use kill instead.
-                    vtProcess.second->bNotAChild = true;
-                    SDV_LOG_TRACE(getpid(), " Process ", vtProcess.second->tProcessID, " is not child process...");
-                    break;
-                case 0:
-                    // Process still running, no status available.
-                    break;
-                default:
-                    if (WIFEXITED(iStatus))
-                    {
-                        m_vecTerminatedProcesses.push_back(vtProcess.second);
-                        vtProcess.second->iRetVal = static_cast<int8_t>(WEXITSTATUS(iStatus));
-                        SDV_LOG_TRACE(getpid(), " Normal exit detected for process ", vtProcess.second->tProcessID);
-                    }
-                    else if (WIFSIGNALED(iStatus))
-                    {
-                        m_vecTerminatedProcesses.push_back(vtProcess.second);
-                        // Note: The status is not reported by the process, since it was terminated without return value.
-                        //vtProcess.second->iRetVal = static_cast<int8_t>(WTERMSIG(iStatus));
-                        vtProcess.second->iRetVal = -100;
-                        SDV_LOG_TRACE(getpid(), " Signalled stop detected for process ", vtProcess.second->tProcessID);
-                    }
-                    else if (WIFSTOPPED(iStatus))
-                    {
-                        m_vecTerminatedProcesses.push_back(vtProcess.second);
-                        vtProcess.second->iRetVal = static_cast<int8_t>(WSTOPSIG(iStatus));
-                        SDV_LOG_TRACE(getpid(), " Terminate exit detected for process ", vtProcess.second->tProcessID);
-                    }
-                    SDV_LOG_TRACE(GetTimestamp(), "Exit detected with exit code ", vtProcess.second->iRetVal);
-                }
+        switch (pid)
+        {
+        case -1:
+            // Not a child process of the monitor process. Or a signal is returned to the calling process. Use kill instead.
+            rsProcess.bNotAChild = true;
+            SDV_LOG_TRACE(getpid(), " Process ", rsProcess.tProcessID, " is not child process...");
+            break;
+        case 0:
+            // Process still running, no status available.
+            break;
+        default:
+            if (WIFEXITED(iStatus))
+            {
+                bTerminated = true;
+                rsProcess.iRetVal = static_cast<int8_t>(WEXITSTATUS(iStatus));
+                SDV_LOG_TRACE(getpid(), " Normal exit detected for process ", rsProcess.tProcessID);
             }
-
-            // For a process not being the child of the monitor process, check with the kill function.
-            // Note: check for the bNotAChild flag once more, since it might be set by the waitpid analysis.
-            if (vtProcess.second->bNotAChild)
+            else if (WIFSIGNALED(iStatus))
             {
-                // Use "kill" to detect the existence of the process
-                // Notice: this doesn't kill the process.
-                kill(vtProcess.first, 0);
-                if (errno == ESRCH)
-                {
-                    m_vecTerminatedProcesses.push_back(vtProcess.second);
+                bTerminated = true;
+                // Note: The status is not reported by the process, since it was terminated without return value.
+                //rsProcess.iRetVal = static_cast<int8_t>(WTERMSIG(iStatus));
+                rsProcess.iRetVal = -100;
+                SDV_LOG_TRACE(getpid(), " Signalled stop detected for process ", rsProcess.tProcessID);
+            }
+            else if (WIFSTOPPED(iStatus))
+            {
+                bTerminated = true;
+                rsProcess.iRetVal = static_cast<int8_t>(WSTOPSIG(iStatus));
+                SDV_LOG_TRACE(getpid(), " Terminate exit detected for process ", rsProcess.tProcessID);
+            }
+            SDV_LOG_TRACE(GetTimestamp(), "Exit detected with exit code ", rsProcess.iRetVal);
+        }
+    }
 
-                    SDV_LOG_TRACE(getpid(), " Non-child exit detected for process ", vtProcess.second->tProcessID);
+    // For a process not being the child of the monitor process, check the process file descriptor or use the kill function.
+    // Note: check for the bNotAChild flag once more, since it might be set by the waitpid analysis.
+    if (rsProcess.bNotAChild)
+    {
+        if (rsProcess.iPidFD >= 0)
+        {
+            // The process file descriptor is readable when the process has terminated.
+            pollfd sPoll{};
+            sPoll.fd = rsProcess.iPidFD;
+            sPoll.events = POLLIN;
+            bTerminated = poll(&sPoll, 1, 0) > 0 && (sPoll.revents & POLLIN);
+        }
+        else
+        {
+            // Use "kill" to detect the existence of the process
+            // Notice: this doesn't kill the process.
+            bTerminated = kill(static_cast<pid_t>(rsProcess.tProcessID), 0) != 0 && errno == ESRCH;
+        }
 
-                    // No exit code available...
-                }
-            }
+        // No exit code available...
+        if (bTerminated)
+            SDV_LOG_TRACE(getpid(), " Non-child exit detected for process ", rsProcess.tProcessID);
+    }
+
+    // The process file descriptor is not needed any more.
+    if (bTerminated)
+        UnwatchProcess(rsProcess);
+    return bTerminated;
 #else
 #error OS is not supported!
 #endif
+}
+
+void CProcessControl::MonitorThread()
+{
+#ifdef __unix__
+    std::array<epoll_event, 32> rgsEvents{};
+    std::set<sdv::process::TProcessID> setSignalled;
+    bool bPolling = false;
+#endif
+    while (!m_bShutdown)
+    {
+#ifdef __unix__
+        // Wait for a process termination event or a wakeup. Process file descriptors are level triggered; a process that
+        // terminated before its descriptor was added is reported immediately. Only when processes need to be polled (no process
+        // file descriptor available), wait for 100ms at the most.
+        setSignalled.clear();
+        int iCount = epoll_wait(m_iEpollFD, rgsEvents.data(), static_cast<int>(rgsEvents.size()), bPolling ? 100 : -1);
+        for (int iIndex = 0; iIndex < iCount; iIndex++)
+        {
+            const epoll_event& rsEvent = rgsEvents[static_cast<size_t>(iIndex)];
+            if (rsEvent.data.u64)
+            {
+                setSignalled.insert(rsEvent.data.u64);
+                continue;
+            }
+
+            // Reset the wakeup event
+            uint64_t uiValue = 0;
+            [[maybe_unused]] auto nSize = read(m_iWakeupFD, &uiValue, sizeof(uiValue));
+        }
+        if (m_bShutdown) break;
+        bPolling = false;
+#endif
+
+        // Run through the list of processes and determine which process has been terminated.
+        std::unique_lock<std::mutex> lock(m_mtxProcesses);
+        std::vector<std::shared_ptr<SProcessHelper>> vecTerminatedProcesses;
+        for (auto& vtProcess : m_mapProcesses)
+        {
+            // Update only once
+            if (!vtProcess.second->bRunning) continue;
+
+#ifdef __unix__
+            // Processes with a process file descriptor are evaluated only after the descriptor has been signalled.
+            if (vtProcess.second->iPidFD >= 0)
+            {
+                if (setSignalled.find(vtProcess.first) == setSignalled.end()) continue;
+            }
+            else
+                bPolling = true;
+#endif
+
+            if (CheckProcessTerminated(*vtProcess.second))
+                vecTerminatedProcesses.push_back(vtProcess.second);
         }
 
         // Allow changes
         lock.unlock();
 
         // Is there a vector of terminated process IDs?
-        for (auto ptrTerminatedProcess : m_vecTerminatedProcesses)
+        for (auto ptrTerminatedProcess : vecTerminatedProcesses)
         {
             std::unique_lock<std::mutex> lockProcess(ptrTerminatedProcess->mtxProcess);
 
@@ -569,8 +709,9 @@ void CProcessControl::MonitorThread()
             ptrTerminatedProcess->cvWaitForProcess.notify_all();
         }
 
+#ifndef __unix__
         // Wait for 100ms until next check
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
+#endif
     }
 }
-
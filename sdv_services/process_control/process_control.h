@@ -20,6 +20,7 @@
 #include <set>
 #include <condition_variable>
 #include <atomic>
+#include "../../global/process_zygote.h"
 
 /**
  * @brief Process control service class
@@ -51,6 +52,12 @@ public:
     DECLARE_OBJECT_CLASS_NAME("ProcessControlService")
     DECLARE_OBJECT_SINGLETON()
 
+    // Parameter map
+    BEGIN_SDV_PARAM_MAP()
+        SDV_PARAM_ENTRY(m_ssZygoteModule, "ZygoteModule", "", "", "Executable started through a pre-initialized zygote process "
+            "(e.g. sdv_iso); empty when disabled. Supported on Linux only.")
+    END_SDV_PARAM_MAP()
+
     /**
      * @brief Initialization event, called after object configuration was loaded. Overload of sdv::CSdvObject::OnInitialize.
      * @return Returns 'true' when the initialization was successful, 'false' when not.
@@ -124,6 +131,39 @@ public:
      */
     void MonitorThread();
 
+    struct SProcessHelper;
+
+#ifdef __unix__
+    /**
+     * @brief Add the process to the event based monitoring. A process file descriptor is requested for the process and
+     * registered with the epoll instance of the monitor thread. If the kernel doesn't support process file descriptors, the
+     * process is checked periodically instead.
+     * @remarks The m_mtxProcesses mutex must be locked when calling this function.
+     * @param[in] rsProcess Reference to the process helper structure.
+     */
+    void WatchProcess(SProcessHelper& rsProcess);
+
+    /**
+     * @brief Remove the process from the event based monitoring and close the process file descriptor.
+     * @remarks The m_mtxProcesses mutex must be locked when calling this function.
+     * @param[in] rsProcess Reference to the process helper structure.
+     */
+    void UnwatchProcess(SProcessHelper& rsProcess);
+
+    /**
+     * @brief Wake up the monitor thread (e.g. to evaluate a newly added process or to shut down).
+     */
+    void WakeupMonitor();
+#endif
+
+    /**
+     * @brief Check whether the process has terminated and if so, store the exit code.
+     * @remarks The m_mtxProcesses mutex must be locked when calling this function.
+     * @param[in] rsProcess Reference to the process helper structure.
+     * @return Returns 'true' when the process has terminated; 'false' when it is still running.
+     */
+    bool CheckProcessTerminated(SProcessHelper& rsProcess);
+
     /**
      * @brief Process helper structure
      */
@@ -134,6 +174,7 @@ public:
         HANDLE                    hProcess = 0;                 ///< process handle
 #elif defined __unix__
         bool                      bNotAChild = false;           ///< When set, the process is not a child of the monitor process.
+        int                       iPidFD = -1;                  ///< Process file descriptor; -1 when the process is polled.
 #else
 #error OS is not supported!
 #endif
@@ -157,6 +198,12 @@ public:
     std::map<uint32_t, std::shared_ptr<SProcessHelper>> m_mapMonitors; ///< Map with monitors.
     std::atomic_bool              m_bShutdown = false;          ///< Set to shutdown the monitor thread.
     std::thread                   m_threadMonitor;              ///< Monitor thread.
+    std::string                   m_ssZygoteModule;             ///< Executable to start through the zygote.
+#ifdef __unix__
+    zygote::CZygoteClient         m_zygote;                     ///< Zygote used to start the zygote module.
+    int                           m_iEpollFD = -1;              ///< Epoll instance waiting for process termination events.
+    int                           m_iWakeupFD = -1;             ///< Event file descriptor to wake up the monitor thread.
+#endif
 };
 DEFINE_SDV_OBJECT(CProcessControl)
 
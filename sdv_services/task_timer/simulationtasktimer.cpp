@@ -15,13 +15,13 @@
 #include <fstream>
 #include <functional>
 
-CSimulationTimer::CSimulationTimer(CSimulationTaskTimerService& rtimersvc, uint32_t uiPeriod, sdv::core::ITaskExecute* pExecute) :
+CSimulationTimer::CSimulationTimer(CSimulationTaskTimerService& rtimersvc, uint64_t uiPeriodUs, sdv::core::ITaskExecute* pExecute) :
     m_rtimersvc(rtimersvc), m_pExecute(pExecute)
 {
     if (!pExecute) return;
 
-    m_uiInitializedPeriod = static_cast<uint64_t>(uiPeriod) * 1000;
-    m_uiPeriod = static_cast<uint64_t>(uiPeriod) * 1000;
+    m_uiInitializedPeriod = uiPeriodUs;
+    m_uiPeriod = uiPeriodUs;
     if(m_uiInitializedPeriod != 0)
         m_bRunning = true;
 }
@@ -94,15 +94,23 @@ void CSimulationTaskTimerService::OnShutdown()
 }
 
 sdv::IInterfaceAccess* CSimulationTaskTimerService::CreateTimer(uint32_t uiPeriod, sdv::IInterfaceAccess* pTask)
+{
+    sdv::core::STimerConfig sConfig;
+    sConfig.uiPeriodUs = static_cast<uint64_t>(uiPeriod) * 1000ull;
+    sConfig.ePolicy = sdv::core::EOverrunPolicy::catch_up;
+    return CreateTimerEx(sConfig, pTask);
+}
+
+sdv::IInterfaceAccess* CSimulationTaskTimerService::CreateTimerEx(const sdv::core::STimerConfig& sConfig, sdv::IInterfaceAccess* pTask)
 {
     if (GetObjectState() != sdv::EObjectState::configuring) return nullptr;
-    if (!uiPeriod) return nullptr;
+    if (!sConfig.uiPeriodUs) return nullptr;
     if (!pTask) return nullptr;
     sdv::core::ITaskExecute* pExecute = pTask->GetInterface<sdv::core::ITaskExecute>();
     if (!pExecute) return nullptr;
 
     std::unique_lock<std::mutex> lock(m_mtxTasks);
-    auto ptrTimer = std::make_unique<CSimulationTimer>(*this, uiPeriod, pExecute);
+    auto ptrTimer = std::make_unique<CSimulationTimer>(*this, sConfig.uiPeriodUs, pExecute);
     // Ignore cppcheck warning; normally the returned pointer should always have a value at this stage (otherwise an
     // exception was triggered).
     // cppcheck-suppress knownConditionTrueFalse
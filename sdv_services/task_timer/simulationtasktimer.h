@@ -62,10 +62,10 @@ public:
     /**
      * @brief Constructor
      * @param[in] rtimersvc Reference to the task timer service.
-     * @param[in] uiPeriod The period of the task timer (must not be 0) in ms.
+     * @param[in] uiPeriodUs The period of the task timer (must not be 0) in us.
      * @param[in] pExecute Pointer to the interface containing the execution function.
      */
-    CSimulationTimer(CSimulationTaskTimerService& rtimersvc, uint32_t uiPeriod, sdv::core::ITaskExecute* pExecute);
+    CSimulationTimer(CSimulationTaskTimerService& rtimersvc, uint64_t uiPeriodUs, sdv::core::ITaskExecute* pExecute);
 
     // Interface map
     BEGIN_SDV_INTERFACE_MAP()
@@ -110,7 +110,8 @@ private:
 /**
 * @brief Task timer class to execute task periodically
 */
-class CSimulationTaskTimerService : public sdv::CSdvObject, public sdv::core::ITaskTimer, public sdv::core::ITimerSimulationStep
+class CSimulationTaskTimerService : public sdv::CSdvObject, public sdv::core::ITaskTimer, public sdv::core::ITaskTimerEx,
+    public sdv::core::ITimerSimulationStep
 {
 public:
     /**
@@ -126,6 +127,7 @@ public:
     // Interface map
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::core::ITaskTimer)
+        SDV_INTERFACE_ENTRY(sdv::core::ITaskTimerEx)
         SDV_INTERFACE_ENTRY(sdv::core::ITimerSimulationStep)
     END_SDV_INTERFACE_MAP()
 
@@ -154,6 +156,18 @@ public:
      */
     virtual sdv::IInterfaceAccess* CreateTimer(uint32_t uiPeriod, sdv::IInterfaceAccess* pTask) override;
 
+    /**
+     * @brief Method to execute the user-defined task periodically using a timer configuration. Overload of
+     * sdv::core::ITaskTimerEx::CreateTimerEx.
+     * @remarks The simulation steps execute all ticks that passed (catch-up); the overrun policy is not used.
+     * @param[in] sConfig The timer configuration.
+     * @param[in] pTask Interface to the task object exposing the ITaskExecute interface. The object must be kept alive
+     * until the timer has been destroyed.
+     * @return Returns an interface to the task timer object. Use sdv::IObjectDestroy to terminate the timer.
+     */
+    virtual sdv::IInterfaceAccess* CreateTimerEx(/*in*/ const sdv::core::STimerConfig& sConfig,
+        /*in*/ sdv::IInterfaceAccess* pTask) override;
+
     /**
      * @brief Method to set the time which has past from the last simulation step.
      * @param[in] uiSimulationStep the time in microseconds which has past from the last simulation step.
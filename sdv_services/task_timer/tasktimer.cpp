@@ -14,109 +14,181 @@
 #include "tasktimer.h"
 #include <fstream>
 #include <functional>
+#include <algorithm>
 
-CTimer::CTimer(CTaskTimerService& rtimersvc, uint32_t uiPeriod, sdv::core::ITaskExecute* pExecute) :
-    m_rtimersvc(rtimersvc), m_pExecute(pExecute)
+CTimer::CTimer(CTaskTimerService& rtimersvc, const sdv::core::STimerConfig& rsConfig, sdv::core::ITaskExecute* pExecute,
+    sdv::core::ITaskDeadlineMiss* pDeadlineMiss) :
+    m_rtimersvc(rtimersvc), m_pExecute(pExecute), m_pDeadlineMiss(pDeadlineMiss), m_sConfig(rsConfig)
 {
-    if (!pExecute) return;
-
-#ifdef _WIN32
-    // Use a lambda function without capture as function pointer.
-    // NOTE: Casting is unsafe... but a necessity when working with Windows API functions.
-    m_uiTimerID = timeSetEvent(uiPeriod, 0, [](UINT, UINT, DWORD_PTR dwUser, DWORD_PTR, DWORD_PTR)
-        {
-            CTimer* pTimer = reinterpret_cast<CTimer*>(dwUser);
-            pTimer->ExecuteCallback();
-        }, reinterpret_cast<DWORD_PTR>(this), TIME_PERIODIC | TIME_KILL_SYNCHRONOUS);
-#elif defined __unix__
-    // Configure the signal event for timer expiration
-    sigevent sev{};
-    sev.sigev_notify = SIGEV_THREAD;
-    sev.sigev_notify_function = [](sigval sv)
-    {
-        CTimer* pTimer = reinterpret_cast<CTimer*>(sv.sival_ptr);
-        std::unique_lock<std::mutex> lock(pTimer->m_mtxExecution);
-        if (!pTimer->m_bRunning) return;
-        sdv::core::ITaskExecute* pExecuteLocal = reinterpret_cast<sdv::core::ITaskExecute*>(pTimer->m_pExecute);
-        pExecuteLocal->Execute();
-    };
-    sev.sigev_value.sival_ptr = this;
-    sev.sigev_notify_attributes = nullptr;
-
-    // Create the timer
-    if (timer_create(CLOCK_MONOTONIC, &sev, &m_timerid) != 0)
-        return;
-
-    //split up period in full seconds and remaining nanoseconds
-    //find out how many full seconds period contains
-    uint32_t uiFullSeconds = uiPeriod / 1000;
-    //determine remainder in nanoseconds
-    uint32_t uiRemainderNS = (uiPeriod % 1000)*1000000;
-
-    // Configure the timer
-    itimerspec its{};
-    its.it_value.tv_sec = uiFullSeconds;
-    its.it_value.tv_nsec = uiRemainderNS;
-    its.it_interval.tv_sec = uiFullSeconds;
-    its.it_interval.tv_nsec = uiRemainderNS;
-
-    // Start the timer
-    if (timer_settime(m_timerid, 0, &its, nullptr) != 0)
-    {
-        timer_delete(m_timerid);
-        return;
-    }
+    ResetStatistics();
+    if (!pExecute || !rsConfig.uiPeriodUs) return;
 
     m_bRunning = true;
-#endif
+    m_threadTimer = std::thread(&CTimer::TimerThread, this);
+}
+
+CTimer::~CTimer()
+{
+    Stop();
 }
 
 void CTimer::DestroyObject()
 {
-#ifdef _WIN32
-    // Terminate the timer
-    if (m_uiTimerID)
-        timeKillEvent(m_uiTimerID);
-    m_uiTimerID = 0ul;
-#elif defined __unix__
-    // Terminate the timer
-    if (m_bRunning)
+    // Called from within the task execution; let the timer thread remove the timer after the execution has finished.
+    if (std::this_thread::get_id() == m_threadTimer.get_id())
     {
-        std::unique_lock<std::mutex> lock(m_mtxExecution);
+        m_bDestroy = true;
         m_bRunning = false;
-        timer_delete(m_timerid);
-        m_timerid = 0ul;
-        lock.unlock();
-
-        // Sleep 20ms to allow all outstanding tasks to end.
-        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return;
     }
-#endif
+
+    // Terminate the timer; waits for an execution in progress.
+    Stop();
 
     // Delete the object
     m_rtimersvc.RemoveTimer(this);
 }
 
+sdv::core::STimerStatistics CTimer::GetStatistics() const
+{
+    std::unique_lock<std::mutex> lock(m_mtxStatistics);
+    sdv::core::STimerStatistics sStatistics = m_sStatistics;
+    if (m_uiPeriodCount)
+        sStatistics.uiPeriodAvgUs = m_uiPeriodSumUs / m_uiPeriodCount;
+    else
+        sStatistics.uiPeriodMinUs = 0;
+    if (sStatistics.uiExecutions)
+        sStatistics.uiExecutionAvgUs = m_uiExecutionSumUs / sStatistics.uiExecutions;
+    else
+        sStatistics.uiExecutionMinUs = 0;
+    return sStatistics;
+}
+
+void CTimer::ResetStatistics()
+{
+    std::unique_lock<std::mutex> lock(m_mtxStatistics);
+    m_sStatistics = sdv::core::STimerStatistics{};
+    m_sStatistics.uiPeriodMinUs = UINT64_MAX;
+    m_sStatistics.uiExecutionMinUs = UINT64_MAX;
+    m_uiPeriodSumUs = 0;
+    m_uiPeriodCount = 0;
+    m_uiExecutionSumUs = 0;
+}
+
 CTimer::operator bool() const
 {
-#ifdef _WIN32
-    return m_uiTimerID ? true : false;
-#elif defined __unix__
     return m_bRunning;
-#endif
 }
 
-#ifdef _WIN32
-void CTimer::ExecuteCallback()
+void CTimer::Stop()
 {
-    if (m_rtimersvc.GetObjectState() != sdv::EObjectState::running) return;
-    if (!m_pExecute) return;
-    if (!m_bPrioritySet)
-        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
-    m_bPrioritySet = true;
-    if (m_pExecute) m_pExecute->Execute();
+    std::unique_lock<std::mutex> lock(m_mtxTimer);
+    m_bRunning = false;
+    lock.unlock();
+    m_cvTimer.notify_all();
+    if (!m_threadTimer.joinable()) return;
+
+    // The timer thread cannot join itself
+    if (std::this_thread::get_id() == m_threadTimer.get_id())
+        m_threadTimer.detach();
+    else
+        m_threadTimer.join();
 }
+
+void CTimer::TimerThread()
+{
+#ifdef _WIN32
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
 #endif
+    m_rtimersvc.GetThreadAttributes().Apply("TaskTimer");
+
+    const std::chrono::microseconds durPeriod(m_sConfig.uiPeriodUs);
+    std::chrono::steady_clock::time_point tpTick = std::chrono::steady_clock::now() + durPeriod;
+    std::unique_lock<std::mutex> lock(m_mtxTimer);
+    while (m_bRunning)
+    {
+        // Wait for the tick; a tick in the past returns immediately.
+        if (m_cvTimer.wait_until(lock, tpTick, [this]() { return !m_bRunning; })) break;
+        lock.unlock();
+
+        // The task is only executed when the service is running.
+        if (m_rtimersvc.GetObjectState() == sdv::EObjectState::running)
+            ExecuteTask(tpTick + durPeriod);
+        else
+            m_tpLastStart = std::chrono::steady_clock::time_point();
+        tpTick += durPeriod;
+
+        // Apply the overrun policy when the next tick passed during the execution. Skip drops all passed ticks, queue drops all
+        // but the last passed tick and catch-up keeps all of them.
+        std::chrono::steady_clock::time_point tpNow = std::chrono::steady_clock::now();
+        if (tpNow > tpTick)
+        {
+            uint64_t uiMissed = static_cast<uint64_t>((tpNow - tpTick) / durPeriod);
+            if (m_sConfig.ePolicy == sdv::core::EOverrunPolicy::skip) uiMissed++;
+            if (m_sConfig.ePolicy != sdv::core::EOverrunPolicy::catch_up && uiMissed)
+            {
+                tpTick += durPeriod * uiMissed;
+                m_rtimersvc.GetMetrics().counterSkipped.Increment(uiMissed);
+                std::unique_lock<std::mutex> lockStatistics(m_mtxStatistics);
+                m_sStatistics.uiSkippedTicks += uiMissed;
+            }
+        }
+
+        lock.lock();
+    }
+    lock.unlock();
+
+    // Destruction was requested from within the task execution. This deletes the timer; the members must not be accessed
+    // anymore.
+    if (m_bDestroy)
+        m_rtimersvc.RemoveTimer(this);
+}
+
+void CTimer::ExecuteTask(std::chrono::steady_clock::time_point tpDeadline)
+{
+    CTaskTimerService::SMetrics& rsMetrics = m_rtimersvc.GetMetrics();
+    std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+    int64_t iPeriod = -1;
+    if (m_tpLastStart != std::chrono::steady_clock::time_point())
+    {
+        iPeriod = std::chrono::duration_cast<std::chrono::microseconds>(tpStart - m_tpLastStart).count();
+        int64_t iJitter = iPeriod - static_cast<int64_t>(m_sConfig.uiPeriodUs);
+        rsMetrics.histJitter.Observe(static_cast<uint64_t>(iJitter < 0 ? -iJitter : iJitter));
+    }
+    m_tpLastStart = tpStart;
+
+    m_pExecute->Execute();
+
+    std::chrono::steady_clock::time_point tpEnd = std::chrono::steady_clock::now();
+    uint64_t uiExecution = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        tpEnd - tpStart).count());
+    rsMetrics.counterExecutions.Increment();
+    rsMetrics.histExecution.Observe(uiExecution);
+    bool bOverrun = tpEnd > tpDeadline;
+    if (bOverrun) rsMetrics.counterOverruns.Increment();
+
+    // Update the statistics
+    std::unique_lock<std::mutex> lock(m_mtxStatistics);
+    m_sStatistics.uiExecutions++;
+    m_sStatistics.uiExecutionMinUs = std::min(m_sStatistics.uiExecutionMinUs, uiExecution);
+    m_sStatistics.uiExecutionMaxUs = std::max(m_sStatistics.uiExecutionMaxUs, uiExecution);
+    m_uiExecutionSumUs += uiExecution;
+    if (iPeriod >= 0)
+    {
+        m_sStatistics.uiPeriodMinUs = std::min(m_sStatistics.uiPeriodMinUs, static_cast<uint64_t>(iPeriod));
+        m_sStatistics.uiPeriodMaxUs = std::max(m_sStatistics.uiPeriodMaxUs, static_cast<uint64_t>(iPeriod));
+        m_uiPeriodSumUs += static_cast<uint64_t>(iPeriod);
+        m_uiPeriodCount++;
+    }
+    if (!bOverrun) return;
+    m_sStatistics.uiOverruns++;
+    lock.unlock();
+
+    // Inform the task about the deadline miss
+    if (m_pDeadlineMiss)
+        m_pDeadlineMiss->DeadlineMissed(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            tpEnd - tpDeadline).count()));
+}
 
 CTaskTimerService::CTaskTimerService()
 {
@@ -124,6 +196,12 @@ CTaskTimerService::CTaskTimerService()
 
 CTaskTimerService::~CTaskTimerService()
 {
+    // Stop the remaining timers outside the lock; a timer thread ending with a deferred destruction removes itself.
+    std::map<CTimer*, std::unique_ptr<CTimer>> mapTasks;
+    std::unique_lock<std::mutex> lock(m_mtxTasks);
+    mapTasks.swap(m_mapTasks);
+    lock.unlock();
+    mapTasks.clear();
 }
 
 bool CTaskTimerService::OnInitialize()
@@ -146,16 +224,25 @@ void CTaskTimerService::OnShutdown()
 }
 
 sdv::IInterfaceAccess* CTaskTimerService::CreateTimer(uint32_t uiPeriod, sdv::IInterfaceAccess* pTask)
+{
+    sdv::core::STimerConfig sConfig;
+    sConfig.uiPeriodUs = static_cast<uint64_t>(uiPeriod) * 1000ull;
+    sConfig.ePolicy = sdv::core::EOverrunPolicy::skip;
+    return CreateTimerEx(sConfig, pTask);
+}
+
+sdv::IInterfaceAccess* CTaskTimerService::CreateTimerEx(const sdv::core::STimerConfig& sConfig, sdv::IInterfaceAccess* pTask)
 {
     if (GetObjectState() != sdv::EObjectState::configuring) return nullptr;
 
-    if (!uiPeriod) return nullptr;
+    if (!sConfig.uiPeriodUs) return nullptr;
     if (!pTask) return nullptr;
     sdv::core::ITaskExecute* pExecute = pTask->GetInterface<sdv::core::ITaskExecute>();
     if (!pExecute) return nullptr;
+    sdv::core::ITaskDeadlineMiss* pDeadlineMiss = pTask->GetInterface<sdv::core::ITaskDeadlineMiss>();
 
     std::unique_lock<std::mutex> lock(m_mtxTasks);
-    auto ptrTimer = std::make_unique<CTimer>(*this, uiPeriod, pExecute);
+    auto ptrTimer = std::make_unique<CTimer>(*this, sConfig, pExecute, pDeadlineMiss);
     // Ignore cppcheck warning; normally the returned pointer should always have a value at this stage (otherwise an
     // exception was triggered).
     // cppcheck-suppress knownConditionTrueFalse
@@ -172,3 +259,13 @@ void CTaskTimerService::RemoveTimer(CTimer* pTimer)
     std::unique_lock<std::mutex> lock(m_mtxTasks);
     m_mapTasks.erase(pTimer);
 }
+
+CTaskTimerService::SMetrics& CTaskTimerService::GetMetrics()
+{
+    return m_sMetrics;
+}
+
+const CThreadAttributes& CTaskTimerService::GetThreadAttributes() const
+{
+    return m_threadAttributes;
+}
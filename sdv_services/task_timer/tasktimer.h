@@ -18,10 +18,16 @@
 #include <interfaces/timer.h>
 #include <support/interface_ptr.h>
 #include <support/component_impl.h>
+#include <support/metrics.h>
+#include "../../global/thread_attributes.h"
 #include <map>
 #include <set>
 #include <fstream>
 #include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #ifdef _WIN32
 // Resolve conflict
@@ -42,11 +48,7 @@
 #undef GetClassInfo
 #endif
 #elif defined __unix__
-#include <signal.h>
 #include <unistd.h>
-#include <mutex>
-#include <time.h>
-#include <sys/times.h>
 #else
 #error OS is not supported!
 #endif
@@ -55,59 +57,98 @@
 class CTaskTimerService;
 
 /**
- * @brief Timer object managing the lifetime of the timer.
+ * @brief Timer object managing the lifetime of the timer. The task is executed by a dedicated thread waiting for absolute
+ * deadlines, which prevents the period from drifting and allows detecting and handling missed ticks.
 */
-class CTimer : public sdv::IInterfaceAccess, public sdv::IObjectDestroy
+class CTimer : public sdv::IInterfaceAccess, public sdv::IObjectDestroy, public sdv::core::ITimerStatistics
 {
 public:
     /**
      * @brief Constructor
      * @param[in] rtimersvc Reference to the task timer service.
-     * @param[in] uiPeriod The period of the task timer (must not be 0) in ms.
+     * @param[in] rsConfig Reference to the timer configuration (the period must not be 0).
      * @param[in] pExecute Pointer to the interface containing the execution function.
+     * @param[in] pDeadlineMiss Pointer to the interface to inform about deadline misses. Could be NULL.
+     */
+    CTimer(CTaskTimerService& rtimersvc, const sdv::core::STimerConfig& rsConfig, sdv::core::ITaskExecute* pExecute,
+        sdv::core::ITaskDeadlineMiss* pDeadlineMiss);
+
+    /**
+     * @brief Destructor; stops the timer thread if still running.
      */
-    CTimer(CTaskTimerService& rtimersvc, uint32_t uiPeriod, sdv::core::ITaskExecute* pExecute);
+    ~CTimer();
 
     // Interface map
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::IObjectDestroy)
+        SDV_INTERFACE_ENTRY(sdv::core::ITimerStatistics)
     END_SDV_INTERFACE_MAP()
 
     /**
      * @brief Destroy the object. Overload of sdv::IObjectDestroy::DestroyObject.
+     * @remarks When called from within the task execution, the destruction is deferred until the timer thread has finished
+     * the execution.
      */
     virtual void DestroyObject() override;
 
+    /**
+     * @brief Get the statistics of the timer. Overload of sdv::core::ITimerStatistics::GetStatistics.
+     * @return The timer statistics since the creation of the timer or the last reset.
+     */
+    virtual sdv::core::STimerStatistics GetStatistics() const override;
+
+    /**
+     * @brief Reset the statistics of the timer. Overload of sdv::core::ITimerStatistics::ResetStatistics.
+     */
+    virtual void ResetStatistics() override;
+
     /**
      * @brief Operator returning info about the validity of the timer.
     */
     operator bool() const;
 
 private:
-#ifdef _WIN32
     /**
-     * @brief Execution function called by the timer.
+     * @brief Stop the timer thread and wait until it has ended. When called from the timer thread itself, the thread is
+     * detached instead.
      */
-    void ExecuteCallback();
-#endif
+    void Stop();
 
-    sdv::CLifetimeCookie        m_cookie = sdv::CreateLifetimeCookie(); ///< Lifetime cookie to manage the module lifetime.
-    CTaskTimerService&          m_rtimersvc;                            ///< Reference to the task timer service
-    sdv::core::ITaskExecute*    m_pExecute = nullptr;                   ///< Pointer to the execution callback interface.
-#ifdef _WIN32
-    UINT                        m_uiTimerID = 0ul;                      ///< Timer ID
-    std::atomic_bool            m_bPrioritySet = false;                 ///< When set, the priority of the task was increased.
-#elif defined __unix__
-    timer_t                     m_timerid = 0;                          ///< Timer ID.
-    std::atomic_bool            m_bRunning = false;                     ///< When set, the timer is running.
-    std::mutex                  m_mtxExecution;                         ///< Prevent killing the timer when in execution.
-#endif
+    /**
+     * @brief Timer thread function waiting for the ticks and applying the overrun policy.
+     */
+    void TimerThread();
+
+    /**
+     * @brief Execute the task and update the statistics of the timer and the runtime metrics of the timer service.
+     * @param[in] tpDeadline The time the execution should have finished (the next tick).
+     */
+    void ExecuteTask(std::chrono::steady_clock::time_point tpDeadline);
+
+    sdv::CLifetimeCookie            m_cookie = sdv::CreateLifetimeCookie(); ///< Lifetime cookie to manage the module lifetime.
+    CTaskTimerService&              m_rtimersvc;                        ///< Reference to the task timer service
+    sdv::core::ITaskExecute*        m_pExecute = nullptr;               ///< Pointer to the execution callback interface.
+    sdv::core::ITaskDeadlineMiss*   m_pDeadlineMiss = nullptr;          ///< Pointer to the deadline miss callback interface.
+    sdv::core::STimerConfig         m_sConfig{};                        ///< The timer configuration.
+    std::thread                     m_threadTimer;                      ///< Timer thread.
+    std::mutex                      m_mtxTimer;                         ///< Protect the running flag while waiting.
+    std::condition_variable         m_cvTimer;                          ///< Wake up the timer thread when stopping.
+    std::atomic_bool                m_bRunning = false;                 ///< When set, the timer is running.
+    std::atomic_bool                m_bDestroy = false;                 ///< When set, the timer thread removes the timer when
+                                                                        ///< it has ended.
+    mutable std::mutex              m_mtxStatistics;                    ///< Protect the statistics.
+    sdv::core::STimerStatistics     m_sStatistics{};                    ///< Timer statistics; min values are UINT64_MAX when not
+                                                                        ///< measured yet.
+    uint64_t                        m_uiPeriodSumUs = 0;                ///< Sum of the measured periods.
+    uint64_t                        m_uiPeriodCount = 0;                ///< Amount of measured periods.
+    uint64_t                        m_uiExecutionSumUs = 0;             ///< Sum of the execution times.
+    std::chrono::steady_clock::time_point m_tpLastStart;                ///< Start time of the previous execution.
 };
 
 /**
 * @brief Task timer class to execute task periodically
 */
-class CTaskTimerService : public sdv::CSdvObject, public sdv::core::ITaskTimer
+class CTaskTimerService : public sdv::CSdvObject, public sdv::core::ITaskTimer, public sdv::core::ITaskTimerEx
 {
 public:
     /**
@@ -120,9 +161,36 @@ public:
     */
     virtual ~CTaskTimerService() override;
 
+    /**
+     * @brief Runtime metrics of the task timers; updated by the timers.
+     */
+    struct SMetrics
+    {
+        /// Amount of task executions.
+        sdv::core::CMetricCounter   counterExecutions{"sdv_task_timer_executions_total", "Amount of executed timer tasks."};
+
+        /// Amount of executions not finishing before the next tick.
+        sdv::core::CMetricCounter   counterOverruns{"sdv_task_timer_overruns_total",
+            "Amount of timer task executions that did not finish before the next tick."};
+
+        /// Amount of ticks dropped by the overrun policy.
+        sdv::core::CMetricCounter   counterSkipped{"sdv_task_timer_skipped_ticks_total",
+            "Amount of timer ticks dropped by the overrun policy."};
+
+        /// Execution time of the tasks.
+        sdv::core::CMetricHistogram histExecution{"sdv_task_timer_execution_us", "Execution time of the timer tasks (us).",
+            sdv::core::GetMetricDurationBounds()};
+
+        /// Deviation of the time between two executions from the period.
+        sdv::core::CMetricHistogram histJitter{"sdv_task_timer_jitter_us",
+            "Absolute deviation of the time between two timer task executions from the timer period (us).",
+            sdv::core::GetMetricDurationBounds()};
+    };
+
     // Interface map
     BEGIN_SDV_INTERFACE_MAP()
         SDV_INTERFACE_ENTRY(sdv::core::ITaskTimer)
+        SDV_INTERFACE_ENTRY(sdv::core::ITaskTimerEx)
     END_SDV_INTERFACE_MAP()
 
     // Object declarations
@@ -130,6 +198,11 @@ public:
     DECLARE_OBJECT_CLASS_NAME("TaskTimerService")
     DECLARE_OBJECT_SINGLETON()
 
+    // Parameter map
+    BEGIN_SDV_PARAM_MAP()
+        SDV_PARAM_CHAIN_MEMBER(m_threadAttributes)
+    END_SDV_PARAM_MAP()
+
     /**
      * @brief Initialization event, called after object configuration was loaded. Overload of sdv::CSdvObject::OnInitialize.
      * @return Returns 'true' when the initialization was successful, 'false' when not.
@@ -147,16 +220,46 @@ public:
      * @param[in] pTask Interface to the task object exposing the ITaskExecute interface. The object must be kept alive
      * until the timer has been destroyed.
      * @return Returns an interface to the task timer object. Use sdv::IObjectDestroy to terminate the timer.
+     * @remarks The timer can only be created in configuration mode. On all platforms the task is only executed while the
+     * service is in running mode; ticks outside running mode are dropped.
      */
     virtual sdv::IInterfaceAccess* CreateTimer(uint32_t uiPeriod, sdv::IInterfaceAccess* pTask) override;
 
+    /**
+     * @brief Method to execute the user-defined task periodically using a timer configuration. Overload of
+     * sdv::core::ITaskTimerEx::CreateTimerEx.
+     * @param[in] sConfig The timer configuration.
+     * @param[in] pTask Interface to the task object exposing the ITaskExecute interface and optionally the ITaskDeadlineMiss
+     * interface. The object must be kept alive until the timer has been destroyed.
+     * @return Returns an interface to the task timer object. Use sdv::IObjectDestroy to terminate the timer and
+     * ITimerStatistics to request the statistics of the timer.
+     * @remarks The timer can only be created in configuration mode. On all platforms the task is only executed while the
+     * service is in running mode; ticks outside running mode are dropped and not counted as skipped ticks.
+     */
+    virtual sdv::IInterfaceAccess* CreateTimerEx(/*in*/ const sdv::core::STimerConfig& sConfig,
+        /*in*/ sdv::IInterfaceAccess* pTask) override;
+
     /**
      * @brief Remove the timer from from the timer map.
      * @param[in] pTimer Pointer to the timer object to remove.
      */
     void RemoveTimer(CTimer* pTimer);
 
+    /**
+     * @brief Get the runtime metrics.
+     * @return Reference to the metrics.
+     */
+    SMetrics& GetMetrics();
+
+    /**
+     * @brief Get the real-time attributes of the timer threads.
+     * @return Reference to the thread attributes.
+     */
+    const CThreadAttributes& GetThreadAttributes() const;
+
 private:
+    SMetrics                                    m_sMetrics;         ///< Runtime metrics; used by the timers until destroyed.
+    CThreadAttributes                           m_threadAttributes; ///< Real-time attributes of the timer threads.
     std::mutex                                  m_mtxTasks;         ///< Mutex for tasks
     std::map<CTimer*, std::unique_ptr<CTimer>>  m_mapTasks;         ///< Set to get the active tasks
 };
@@ -0,0 +1,323 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "benchmark.h"
+#include <support/any.h>
+#include <support/string.h>
+#include <support/sequence.h>
+#include <support/serdes.h>
+#include <support/app_control.h>
+#include <vector>
+
+/**
+ * @brief Basic types benchmark; the types are allocated through the memory manager of the framework.
+ */
+class CBasicTypesBenchmark : public ::testing::Test
+{
+public:
+    /**
+     * @brief Start the framework.
+     */
+    virtual void SetUp() override
+    {
+        ASSERT_TRUE(m_appcontrol.Startup(""));
+    }
+
+    /**
+     * @brief Stop the framework.
+     */
+    virtual void TearDown() override
+    {
+        m_appcontrol.Shutdown();
+    }
+
+private:
+    sdv::app::CAppControl m_appcontrol;     ///< Application control.
+};
+
+namespace
+{
+    /**
+     * @brief CRC class not calculating any checksum; used to measure the serialization without the CRC calculation.
+     */
+    struct SNoCRC
+    {
+        using TCRCType = uint16_t;  ///< CRC type
+
+        /**
+         * @brief Add one value to the calculation (ignored).
+         * @tparam T Type of the value.
+         */
+        template <typename T>
+        void add(T) noexcept {}
+
+        /**
+         * @brief Get the checksum.
+         * @return Always 0.
+         */
+        TCRCType get_checksum() const noexcept { return 0; }
+
+        /**
+         * @brief Set a checksum (ignored).
+         */
+        void set_checksum(TCRCType) noexcept {}
+    };
+
+    /**
+     * @brief Payload used for the serialization benchmark, resembling a marshalled call with a mix of types.
+     */
+    struct SPayload
+    {
+        uint32_t                uiId = 0;           ///< Identifier.
+        double                  dValue = 0.0;       ///< Value.
+        sdv::u8string           ssName;             ///< Name.
+        sdv::sequence<uint32_t> seqData;            ///< Data.
+        sdv::sequence<double>   seqSamples;         ///< Samples.
+    };
+
+    /**
+     * @brief Create the payload.
+     * @param[in] nElements Amount of elements in the data and samples sequences.
+     * @return The payload.
+     */
+    SPayload CreatePayload(size_t nElements)
+    {
+        SPayload sPayload;
+        sPayload.uiId = 1234;
+        sPayload.dValue = 3.14159;
+        sPayload.ssName = "Vehicle.Chassis.Axle.Row1.Wheel.Left.Speed";
+        for (size_t n = 0; n < nElements; n++)
+        {
+            sPayload.seqData.push_back(static_cast<uint32_t>(n * 2654435761u));
+            sPayload.seqSamples.push_back(static_cast<double>(n) * 0.25);
+        }
+        return sPayload;
+    }
+
+    /**
+     * @brief Measure the serialization and deserialization throughput of the payload.
+     * @tparam TCRC The CRC type to use.
+     * @param[in] szName Name of the CRC variant.
+     * @param[in] rsPayload Reference to the payload.
+     */
+    template <typename TCRC>
+    void MeasureSerdes(const char* szName, const SPayload& rsPayload)
+    {
+        CBenchmarkReport& rReport = CBenchmarkReport::Get();
+        const size_t nCount = rReport.Scale(2000);
+
+        // Determine the size of the serialized payload
+        size_t nSize = 0;
+        {
+            sdv::serializer<sdv::GetPlatformEndianess(), TCRC> serializer;
+            serializer << rsPayload.uiId << rsPayload.dValue << rsPayload.ssName << rsPayload.seqData << rsPayload.seqSamples;
+            nSize = serializer.buffer().size();
+        }
+
+        sdv::pointer<uint8_t> ptrBuffer;
+        typename TCRC::TCRCType uiChecksum = 0;
+        SBenchmarkResult sResult = rReport.MeasureTime(std::string("Serialize_") + szName, nCount, [&]()
+            {
+                for (size_t n = 0; n < nCount; n++)
+                {
+                    sdv::serializer<sdv::GetPlatformEndianess(), TCRC> serializer;
+                    serializer << rsPayload.uiId << rsPayload.dValue << rsPayload.ssName << rsPayload.seqData <<
+                        rsPayload.seqSamples;
+                    ptrBuffer = serializer.buffer();
+                    uiChecksum = serializer.checksum();
+                }
+            });
+        rReport.AddSamples(std::string("SerializeBandwidth_") + szName, "MB/s",
+            { static_cast<double>(nSize) * 1000.0 / sResult.dMedian }, true);
+
+        sResult = rReport.MeasureTime(std::string("Deserialize_") + szName, nCount, [&]()
+            {
+                for (size_t n = 0; n < nCount; n++)
+                {
+                    SPayload sPayload;
+                    sdv::deserializer<sdv::GetPlatformEndianess(), TCRC> deserializer;
+                    deserializer.attach(ptrBuffer, uiChecksum);
+                    deserializer >> sPayload.uiId >> sPayload.dValue >> sPayload.ssName >> sPayload.seqData >>
+                        sPayload.seqSamples;
+                    DoNotOptimize(sPayload.uiId);
+                }
+            });
+        rReport.AddSamples(std::string("DeserializeBandwidth_") + szName, "MB/s",
+            { static_cast<double>(nSize) * 1000.0 / sResult.dMedian }, true);
+    }
+}
+
+TEST_F(CBasicTypesBenchmark, AnyConstruct)
+{
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nCount = rReport.Scale(1000000);
+    sdv::u8string ssValue = "Vehicle.Speed";
+
+    rReport.MeasureTime("Int32", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+            {
+                sdv::any_t anyVal(static_cast<int32_t>(n));
+                DoNotOptimize(anyVal);
+            }
+        });
+    rReport.MeasureTime("Double", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+            {
+                sdv::any_t anyVal(static_cast<double>(n));
+                DoNotOptimize(anyVal);
+            }
+        });
+    rReport.MeasureTime("U8String", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+            {
+                sdv::any_t anyVal(ssValue);
+                DoNotOptimize(anyVal);
+            }
+        });
+    sdv::any_t anyDouble(123.456);
+    rReport.MeasureTime("CopyDouble", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+            {
+                sdv::any_t anyVal(anyDouble);
+                DoNotOptimize(anyVal);
+            }
+        });
+}
+
+TEST_F(CBasicTypesBenchmark, AnyCompare)
+{
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nCount = rReport.Scale(1000000);
+    sdv::any_t anyInt1(static_cast<int32_t>(100)), anyInt2(static_cast<int32_t>(100));
+    sdv::any_t anyDouble(100.0);
+    sdv::any_t anyString1(sdv::u8string("Vehicle.Speed")), anyString2(sdv::u8string("Vehicle.Speed"));
+
+    size_t nEqual = 0;
+    rReport.MeasureTime("SameType", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+                nEqual += anyInt1 == anyInt2 ? 1 : 0;
+        });
+    rReport.MeasureTime("MixedType", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+                nEqual += anyInt1 == anyDouble ? 1 : 0;
+        });
+    rReport.MeasureTime("String", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+                nEqual += anyString1 == anyString2 ? 1 : 0;
+        });
+    EXPECT_EQ(nEqual, nCount * 3 * (rReport.Repetitions() + 1));
+}
+
+TEST_F(CBasicTypesBenchmark, AnyConvert)
+{
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nCount = rReport.Scale(1000000);
+    sdv::any_t anyInt(static_cast<int32_t>(100));
+    sdv::any_t anyString(sdv::u8string("12345"));
+
+    rReport.MeasureTime("Int32ToDouble", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+            {
+                double dValue = anyInt;
+                DoNotOptimize(dValue);
+            }
+        });
+    rReport.MeasureTime("Int32ToString", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+            {
+                sdv::u8string ssValue = anyInt.get<sdv::u8string>();
+                DoNotOptimize(ssValue);
+            }
+        });
+    rReport.MeasureTime("StringToInt32", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+            {
+                int32_t iValue = anyString;
+                DoNotOptimize(iValue);
+            }
+        });
+}
+
+TEST_F(CBasicTypesBenchmark, U8String)
+{
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nCount = rReport.Scale(100000);
+    std::vector<std::string> vecShort, vecLong;
+    for (size_t n = 0; n < 100; n++)
+    {
+        vecShort.push_back("Speed_" + std::to_string(n));
+        vecLong.push_back("Vehicle.Chassis.Axle.Row1.Wheel.Left.Speed_" + std::to_string(n));
+    }
+
+    for (const auto& rprSet : { std::make_pair("Short", &vecShort), std::make_pair("Long", &vecLong) })
+    {
+        const std::vector<std::string>& rvecSource = *rprSet.second;
+        std::vector<sdv::u8string> vecStrings(rvecSource.size());
+        rReport.MeasureTime(std::string("Construct") + rprSet.first, nCount, [&]()
+            {
+                for (size_t n = 0; n < nCount; n++)
+                    vecStrings[n % vecStrings.size()] = sdv::u8string(rvecSource[n % rvecSource.size()]);
+            });
+
+        std::vector<sdv::u8string> vecCopies(vecStrings.size());
+        rReport.MeasureTime(std::string("Copy") + rprSet.first, nCount, [&]()
+            {
+                for (size_t n = 0; n < nCount; n++)
+                    vecCopies[n % vecCopies.size()] = vecStrings[n % vecStrings.size()];
+            });
+
+        size_t nEqual = 0;
+        rReport.MeasureTime(std::string("Compare") + rprSet.first, nCount, [&]()
+            {
+                for (size_t n = 0; n < nCount; n++)
+                    nEqual += vecStrings[n % vecStrings.size()] == vecCopies[n % vecCopies.size()] ? 1 : 0;
+            });
+        EXPECT_EQ(nEqual, nCount * (rReport.Repetitions() + 1));
+
+        rReport.MeasureTime(std::string("Append") + rprSet.first, nCount, [&]()
+            {
+                for (size_t n = 0; n < nCount; n++)
+                {
+                    sdv::u8string ssPath = vecStrings[n % vecStrings.size()];
+                    ssPath += ".Value";
+                    DoNotOptimize(ssPath);
+                }
+            });
+
+        size_t nFound = 0;
+        rReport.MeasureTime(std::string("Find") + rprSet.first, nCount, [&]()
+            {
+                for (size_t n = 0; n < nCount; n++)
+                    nFound += vecStrings[n % vecStrings.size()].find('_') != sdv::u8string::npos ? 1 : 0;
+            });
+        EXPECT_EQ(nFound, nCount * (rReport.Repetitions() + 1));
+    }
+}
+
+TEST_F(CBasicTypesBenchmark, Serdes)
+{
+    SPayload sPayload = CreatePayload(1024);
+    MeasureSerdes<SNoCRC>("NoCRC", sPayload);
+    MeasureSerdes<sdv::crcCCITT_FALSE>("CRC16", sPayload);
+    MeasureSerdes<sdv::crcCRC32C>("CRC32C", sPayload);
+}
@@ -0,0 +1,249 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "benchmark.h"
+#include <interfaces/core_types.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    /**
+     * @brief Escape a string to be used in a JSON document.
+     * @param[in] rss Reference to the string.
+     * @return The escaped string including the quotes.
+     */
+    std::string JSONString(const std::string& rss)
+    {
+        std::stringstream sstream;
+        sstream << '\"';
+        for (char c : rss)
+        {
+            switch (c)
+            {
+            case '\"':  sstream << "\\\"";  break;
+            case '\\':  sstream << "\\\\";  break;
+            case '\n':  sstream << "\\n";   break;
+            case '\r':  sstream << "\\r";   break;
+            case '\t':  sstream << "\\t";   break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                    sstream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                else
+                    sstream << c;
+                break;
+            }
+        }
+        sstream << '\"';
+        return sstream.str();
+    }
+
+    /**
+     * @brief Get the name of the compiler used to build the benchmarks.
+     * @return The compiler name and version.
+     */
+    std::string CompilerName()
+    {
+        std::stringstream sstream;
+#if defined(__clang__)
+        sstream << "clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
+#elif defined(__GNUC__)
+        sstream << "gcc " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__;
+#elif defined(_MSC_VER)
+        sstream << "msvc " << _MSC_VER;
+#else
+        sstream << "unknown";
+#endif
+        return sstream.str();
+    }
+
+    /**
+     * @brief Get the current time formatted as ISO 8601 (UTC).
+     * @return The time string.
+     */
+    std::string CurrentTime()
+    {
+        std::time_t tNow = std::time(nullptr);
+        std::tm sTime{};
+#ifdef _WIN32
+        gmtime_s(&sTime, &tNow);
+#else
+        gmtime_r(&tNow, &sTime);
+#endif
+        std::stringstream sstream;
+        sstream << std::put_time(&sTime, "%Y-%m-%dT%H:%M:%SZ");
+        return sstream.str();
+    }
+}
+
+CBenchmarkReport& CBenchmarkReport::Get()
+{
+    static CBenchmarkReport report;
+    return report;
+}
+
+void CBenchmarkReport::ProcessCommandLine(int& rargc, char* argv[])
+{
+    int iTarget = 1;
+    for (int iIndex = 1; iIndex < rargc; iIndex++)
+    {
+        if (argv[iIndex] && ProcessArgument(argv[iIndex])) continue;
+        argv[iTarget++] = argv[iIndex];
+    }
+    rargc = iTarget;
+}
+
+void CBenchmarkReport::ProcessCommandLine(int& rargc, wchar_t* argv[])
+{
+    int iTarget = 1;
+    for (int iIndex = 1; iIndex < rargc; iIndex++)
+    {
+        if (argv[iIndex])
+        {
+            // The options only consist of ASCII characters.
+            std::string ssArg;
+            for (const wchar_t* pc = argv[iIndex]; *pc; pc++)
+                ssArg += static_cast<char>(*pc);
+            if (ProcessArgument(ssArg)) continue;
+        }
+        argv[iTarget++] = argv[iIndex];
+    }
+    rargc = iTarget;
+}
+
+size_t CBenchmarkReport::Repetitions() const
+{
+    return m_nRepetitions;
+}
+
+size_t CBenchmarkReport::Scale(size_t nOperations) const
+{
+    return m_bQuick ? std::max<size_t>(nOperations / 10, 1) : nOperations;
+}
+
+SBenchmarkResult CBenchmarkReport::MeasureTime(const std::string& rssName, size_t nOperations,
+    const std::function<void()>& fnRun)
+{
+    // Warm up caches, allocators and lazily created objects.
+    fnRun();
+
+    std::vector<double> vecSamples;
+    for (size_t nRepetition = 0; nRepetition < m_nRepetitions; nRepetition++)
+    {
+        auto tpStart = std::chrono::steady_clock::now();
+        fnRun();
+        double dDuration = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - tpStart).count();
+        vecSamples.push_back(dDuration / static_cast<double>(std::max<size_t>(nOperations, 1)));
+    }
+    return AddSamples(rssName, "ns/op", std::move(vecSamples), false, nOperations);
+}
+
+SBenchmarkResult CBenchmarkReport::AddSamples(const std::string& rssName, const std::string& rssUnit,
+    std::vector<double> vecSamples, bool bHigherIsBetter /*= false*/, size_t nOperations /*= 1*/)
+{
+    SBenchmarkResult sResult;
+    const ::testing::TestInfo* pTestInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+    if (pTestInfo)
+        sResult.ssName = std::string(pTestInfo->test_suite_name()) + "." + pTestInfo->name() + "/";
+    sResult.ssName += rssName;
+    sResult.ssUnit = rssUnit;
+    sResult.bHigherIsBetter = bHigherIsBetter;
+    sResult.nOperations = nOperations;
+    sResult.nSamples = vecSamples.size();
+    if (!vecSamples.empty())
+    {
+        std::sort(vecSamples.begin(), vecSamples.end());
+        size_t nCount = vecSamples.size();
+        sResult.dMedian = nCount % 2 ? vecSamples[nCount / 2] : (vecSamples[nCount / 2 - 1] + vecSamples[nCount / 2]) / 2.0;
+        double dSum = 0.0;
+        for (double dSample : vecSamples) dSum += dSample;
+        sResult.dMean = dSum / static_cast<double>(nCount);
+        sResult.dMin = vecSamples.front();
+        sResult.dMax = vecSamples.back();
+        sResult.dP99 = vecSamples[std::min(nCount - 1, (nCount * 99) / 100)];
+    }
+
+    std::cout << "[ BENCH    ] " << sResult.ssName << ": " << std::fixed << std::setprecision(1) << sResult.dMedian << " " <<
+        sResult.ssUnit << " (min " << sResult.dMin << ", max " << sResult.dMax;
+    if (sResult.nSamples >= 100)
+        std::cout << ", p99 " << sResult.dP99;
+    std::cout << ")" << std::endl;
+
+    std::unique_lock<std::mutex> lock(m_mtxResults);
+    m_vecResults.push_back(sResult);
+    return sResult;
+}
+
+bool CBenchmarkReport::WriteJSON() const
+{
+    if (m_ssJSONFile.empty()) return true;
+
+    std::ofstream fstream(m_ssJSONFile, std::ios::out | std::ios::trunc);
+    if (!fstream.is_open())
+    {
+        std::cerr << "Cannot write the benchmark results to: " << m_ssJSONFile << std::endl;
+        return false;
+    }
+
+    fstream << "{\n";
+    fstream << "  \"framework\": { \"interface_version\": " << SDVFrameworkInterfaceVersion << ", \"build_version\": " <<
+        SDVFrameworkBuildVersion << ", \"subbuild_version\": " << SDVFrameworkSubbuildVersion << " },\n";
+    fstream << "  \"environment\": { \"compiler\": " << JSONString(CompilerName()) << ", \"optimized\": " <<
+#ifdef NDEBUG
+        "true"
+#else
+        "false"
+#endif
+        << ", \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ", \"timestamp\": " <<
+        JSONString(CurrentTime()) << " },\n";
+    fstream << "  \"settings\": { \"repetitions\": " << m_nRepetitions << ", \"quick\": " << (m_bQuick ? "true" : "false") <<
+        " },\n";
+    fstream << "  \"results\": [";
+    std::unique_lock<std::mutex> lock(m_mtxResults);
+    bool bFirst = true;
+    fstream << std::setprecision(17);
+    for (const SBenchmarkResult& rsResult : m_vecResults)
+    {
+        fstream << (bFirst ? "\n" : ",\n");
+        bFirst = false;
+        fstream << "    { \"name\": " << JSONString(rsResult.ssName) << ", \"unit\": " << JSONString(rsResult.ssUnit) <<
+            ", \"higher_is_better\": " << (rsResult.bHigherIsBetter ? "true" : "false") << ", \"operations\": " <<
+            rsResult.nOperations << ", \"samples\": " << rsResult.nSamples << ", \"median\": " << rsResult.dMedian <<
+            ", \"mean\": " << rsResult.dMean << ", \"min\": " << rsResult.dMin << ", \"max\": " << rsResult.dMax <<
+            ", \"p99\": " << rsResult.dP99 << " }";
+    }
+    fstream << "\n  ]\n}\n";
+    return fstream.good();
+}
+
+bool CBenchmarkReport::ProcessArgument(const std::string& rssArg)
+{
+    const std::string ssJSON = "--benchmark_json=";
+    const std::string ssRepetitions = "--benchmark_repetitions=";
+    if (rssArg.compare(0, ssJSON.size(), ssJSON) == 0)
+        m_ssJSONFile = rssArg.substr(ssJSON.size());
+    else if (rssArg.compare(0, ssRepetitions.size(), ssRepetitions) == 0)
+        m_nRepetitions = std::max<size_t>(std::strtoul(rssArg.c_str() + ssRepetitions.size(), nullptr, 10), 1);
+    else if (rssArg == "--benchmark_quick")
+        m_bQuick = true;
+    else
+        return false;
+    return true;
+}
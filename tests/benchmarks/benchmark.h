@@ -0,0 +1,150 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#ifndef SDV_BENCHMARK_H
+#define SDV_BENCHMARK_H
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Result of a benchmark measurement.
+ */
+struct SBenchmarkResult
+{
+    std::string     ssName;                 ///< Name of the measurement: <test suite>.<test>/<measurement>.
+    std::string     ssUnit;                 ///< Unit of the values (e.g. "ns/op", "us" or "MB/s").
+    bool            bHigherIsBetter = false;///< Set when a higher value is an improvement (throughput).
+    size_t          nOperations = 0;        ///< Amount of operations per sample.
+    size_t          nSamples = 0;           ///< Amount of samples.
+    double          dMedian = 0.0;          ///< Median of the samples.
+    double          dMean = 0.0;            ///< Mean of the samples.
+    double          dMin = 0.0;             ///< Smallest sample.
+    double          dMax = 0.0;             ///< Largest sample.
+    double          dP99 = 0.0;             ///< 99th percentile of the samples.
+};
+
+/**
+ * @brief Benchmark report collecting the measurements of all benchmarks and writing them to the console and to a JSON file.
+ * @details Every measurement is preceded by a warm-up run and repeated a configurable amount of times; the median of the
+ * repetitions is the value to compare between releases. The following command line options are processed and removed before
+ * the command line is passed to Google Test:
+ * - --benchmark_json=<file>        Write the results to the JSON file.
+ * - --benchmark_repetitions=<n>    Amount of repetitions per measurement (default 5).
+ * - --benchmark_quick              Reduce the amount of operations by a factor of 10 (smoke test of the benchmarks).
+ */
+class CBenchmarkReport
+{
+public:
+    /**
+     * @brief Get the report instance.
+     * @return Reference to the report.
+     */
+    static CBenchmarkReport& Get();
+
+    /**
+     * @brief Process the benchmark options of the command line. The processed options are removed.
+     * @param[in, out] rargc Reference to the amount of arguments.
+     * @param[in, out] argv Array of arguments.
+     */
+    void ProcessCommandLine(int& rargc, char* argv[]);
+
+    /**
+     * @brief Process the benchmark options of the command line. The processed options are removed.
+     * @param[in, out] rargc Reference to the amount of arguments.
+     * @param[in, out] argv Array of arguments.
+     */
+    void ProcessCommandLine(int& rargc, wchar_t* argv[]);
+
+    /**
+     * @brief Get the amount of repetitions per measurement.
+     * @return The amount of repetitions.
+     */
+    size_t Repetitions() const;
+
+    /**
+     * @brief Scale the amount of operations of a measurement; reduces the amount in quick mode.
+     * @param[in] nOperations The amount of operations for a full run.
+     * @return The amount of operations to execute.
+     */
+    size_t Scale(size_t nOperations) const;
+
+    /**
+     * @brief Measure the duration of a function executing a fixed amount of operations. The function is called once to warm up
+     * followed by the configured amount of repetitions. The result is recorded in nanoseconds per operation.
+     * @param[in] rssName Reference to the name of the measurement; prefixed with the name of the running test.
+     * @param[in] nOperations The amount of operations executed by one call of the function.
+     * @param[in] fnRun Function executing the operations.
+     * @return The recorded result.
+     */
+    SBenchmarkResult MeasureTime(const std::string& rssName, size_t nOperations, const std::function<void()>& fnRun);
+
+    /**
+     * @brief Record a series of samples measured by the benchmark itself (e.g. round-trip latencies).
+     * @param[in] rssName Reference to the name of the measurement; prefixed with the name of the running test.
+     * @param[in] rssUnit Reference to the unit of the samples.
+     * @param[in] vecSamples The samples.
+     * @param[in] bHigherIsBetter Set when a higher value is an improvement.
+     * @param[in] nOperations The amount of operations represented by one sample.
+     * @return The recorded result.
+     */
+    SBenchmarkResult AddSamples(const std::string& rssName, const std::string& rssUnit, std::vector<double> vecSamples,
+        bool bHigherIsBetter = false, size_t nOperations = 1);
+
+    /**
+     * @brief Write the collected results to the JSON file provided on the command line (if any).
+     * @return Returns 'false' when the file could not be written; 'true' otherwise.
+     */
+    bool WriteJSON() const;
+
+private:
+    /**
+     * @brief Default constructor.
+     */
+    CBenchmarkReport() = default;
+
+    /**
+     * @brief Process one command line argument.
+     * @param[in] rssArg Reference to the argument.
+     * @return Returns whether the argument was a benchmark option.
+     */
+    bool ProcessArgument(const std::string& rssArg);
+
+    mutable std::mutex              m_mtxResults;           ///< Protect the result list.
+    std::vector<SBenchmarkResult>   m_vecResults;           ///< Recorded results.
+    std::string                     m_ssJSONFile;           ///< JSON file to write the results to.
+    size_t                          m_nRepetitions = 5;     ///< Repetitions per measurement.
+    bool                            m_bQuick = false;       ///< Quick mode.
+};
+
+/**
+ * @brief Prevent the compiler from optimizing away a value that is calculated by the benchmark.
+ * @tparam T Type of the value.
+ * @param[in] rtValue Reference to the value.
+ */
+template <typename T>
+inline void DoNotOptimize(const T& rtValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(rtValue) : "memory");
+#else
+    static const void* volatile pSink = nullptr;
+    pSink = &rtValue;
+#endif
+}
+
+#endif // !defined SDV_BENCHMARK_H
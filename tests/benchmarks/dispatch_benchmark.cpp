@@ -0,0 +1,161 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "benchmark.h"
+#include <support/signal_support.h>
+#include <interfaces/dispatch.h>
+#include <support/app_control.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Data dispatch service benchmark.
+ */
+class CDispatchBenchmark : public ::testing::Test
+{
+public:
+    /**
+     * @brief Start the framework and load the data dispatch service.
+     */
+    virtual void SetUp() override
+    {
+        ASSERT_TRUE(m_appcontrol.Startup(""));
+        m_appcontrol.SetConfigMode();
+        ASSERT_EQ(m_appcontrol.LoadConfig("benchmark_dds_config.toml"), sdv::core::EConfigProcessResult::successful);
+    }
+
+    /**
+     * @brief Stop the framework.
+     */
+    virtual void TearDown() override
+    {
+        m_appcontrol.Shutdown();
+    }
+
+protected:
+    sdv::app::CAppControl m_appcontrol;     ///< Application control.
+};
+
+namespace
+{
+    /**
+     * @brief Measure the latency between writing a signal and the call of the subscriber.
+     * @param[in] rdispatch Reference to the dispatch service.
+     * @param[in] rappcontrol Reference to the application control.
+     * @param[in] szName Name of the measurement.
+     * @param[in] rsPolicy Reference to the subscription policy.
+     */
+    void MeasureWriteLatency(sdv::core::CDispatchService& rdispatch, sdv::app::CAppControl& rappcontrol, const char* szName,
+        const sdv::core::SSubscriptionPolicy& rsPolicy)
+    {
+        CBenchmarkReport& rReport = CBenchmarkReport::Get();
+        const size_t nCount = rReport.Scale(10000);
+
+        rappcontrol.SetConfigMode();
+        std::string ssName = std::string("bench_latency_") + szName;
+        sdv::core::CSignal signalRx = rdispatch.RegisterRxSignal(ssName);
+        ASSERT_TRUE(signalRx);
+        std::atomic<int64_t> iReceived{-1};
+        std::chrono::steady_clock::time_point tpReceived;
+        sdv::core::CSignal signalSubscription = rdispatch.Subscribe(ssName, [&](sdv::any_t anyVal)
+            {
+                tpReceived = std::chrono::steady_clock::now();
+                iReceived.store(anyVal.get<int64_t>(), std::memory_order_release);
+            }, rsPolicy);
+        ASSERT_TRUE(signalSubscription);
+        rappcontrol.SetRunningMode();
+
+        std::vector<double> vecSamples;
+        vecSamples.reserve(nCount);
+        for (size_t n = 0; n < nCount + 100; n++)
+        {
+            auto tpWrite = std::chrono::steady_clock::now();
+            signalRx.Write(static_cast<int64_t>(n));
+            auto tpTimeout = tpWrite + std::chrono::seconds(1);
+            while (iReceived.load(std::memory_order_acquire) != static_cast<int64_t>(n))
+            {
+                if (std::chrono::steady_clock::now() > tpTimeout) break;
+                std::this_thread::yield();
+            }
+            ASSERT_EQ(iReceived.load(), static_cast<int64_t>(n));
+
+            // The first samples are used to warm up.
+            if (n >= 100)
+                vecSamples.push_back(std::chrono::duration<double, std::micro>(tpReceived - tpWrite).count());
+        }
+        rReport.AddSamples(szName, "us", std::move(vecSamples));
+
+        rappcontrol.SetConfigMode();
+        signalSubscription.Reset();
+        signalRx.Reset();
+    }
+}
+
+TEST_F(CDispatchBenchmark, WriteToSubscriberLatency)
+{
+    sdv::core::CDispatchService dispatch;
+    MeasureWriteLatency(dispatch, m_appcontrol, "Direct", sdv::core::SSubscriptionPolicy{});
+    sdv::core::SSubscriptionPolicy sPolicy{};
+    sPolicy.uiQueueSize = 64;
+    MeasureWriteLatency(dispatch, m_appcontrol, "Queued", sPolicy);
+}
+
+TEST_F(CDispatchBenchmark, Transactions)
+{
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nCount = rReport.Scale(100000);
+
+    // Register the signals of one message and subscribe to them (similar to the data link receiving a CAN frame)
+    const size_t nSignalCount = 8;
+    sdv::core::CDispatchService dispatch;
+    std::vector<sdv::core::CSignal> vecRxSignals;
+    std::vector<sdv::core::CSignal> vecSubscriptions;
+    std::atomic<int32_t> rgiValues[nSignalCount] = {};
+    for (size_t n = 0; n < nSignalCount; n++)
+    {
+        std::string ssName = "bench_" + std::to_string(n);
+        vecRxSignals.push_back(dispatch.RegisterRxSignal(ssName));
+        ASSERT_TRUE(vecRxSignals.back());
+        vecSubscriptions.push_back(dispatch.Subscribe(ssName, rgiValues[n]));
+        ASSERT_TRUE(vecSubscriptions.back());
+    }
+    m_appcontrol.SetRunningMode();
+
+    // One transaction per received message
+    SBenchmarkResult sResult = rReport.MeasureTime("Transaction8Signals", nCount, [&]()
+        {
+            for (size_t nTransaction = 0; nTransaction < nCount; nTransaction++)
+            {
+                sdv::core::CTransaction transaction = dispatch.CreateTransaction();
+                for (size_t n = 0; n < nSignalCount; n++)
+                    vecRxSignals[n].Write(static_cast<int32_t>(nTransaction + n), transaction);
+                transaction.Finish();
+            }
+        });
+    for (size_t n = 0; n < nSignalCount; n++)
+        EXPECT_EQ(rgiValues[n], static_cast<int32_t>(nCount - 1 + n));
+    rReport.AddSamples("TransactionsPerSecond", "1/s", { 1000000000.0 / sResult.dMedian }, true);
+
+    // Single writes without transaction
+    rReport.MeasureTime("Write", nCount, [&]()
+        {
+            for (size_t n = 0; n < nCount; n++)
+                vecRxSignals[0].Write(static_cast<int32_t>(n));
+        });
+
+    m_appcontrol.SetConfigMode();
+    vecSubscriptions.clear();
+    vecRxSignals.clear();
+}
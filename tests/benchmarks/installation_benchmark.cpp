@@ -0,0 +1,116 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "benchmark.h"
+#include "../../sdv_services/core/installation_manifest.cpp"
+#include "../../sdv_services/core/installation_composer.cpp"
+#include <support/app_control.h>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+/**
+ * @brief Installation package benchmark; the packages are allocated through the memory manager of the framework.
+ */
+class CInstallationBenchmark : public ::testing::Test
+{
+public:
+    /**
+     * @brief Start the framework and create the directories.
+     */
+    virtual void SetUp() override
+    {
+        ASSERT_TRUE(m_appcontrol.Startup(""));
+        std::filesystem::remove_all(m_pathRoot);
+        std::filesystem::create_directories(m_pathRoot / "source");
+    }
+
+    /**
+     * @brief Remove the directories and stop the framework.
+     */
+    virtual void TearDown() override
+    {
+        std::filesystem::remove_all(m_pathRoot);
+        m_appcontrol.Shutdown();
+    }
+
+protected:
+    /// Root directory of the source files, the package and the extracted files.
+    std::filesystem::path   m_pathRoot = std::filesystem::temp_directory_path() / "sdv_benchmark_installation";
+
+private:
+    sdv::app::CAppControl   m_appcontrol;   ///< Application control.
+};
+
+namespace
+{
+    /**
+     * @brief Create a file with pseudo random content.
+     * @param[in] rpathFile Reference to the path of the file.
+     * @param[in] nSize Size of the file.
+     * @param[in] uiSeed Seed of the pseudo random generator.
+     */
+    void CreateBenchmarkFile(const std::filesystem::path& rpathFile, size_t nSize, uint64_t uiSeed)
+    {
+        std::vector<uint64_t> vecData(nSize / sizeof(uint64_t));
+        uint64_t uiValue = uiSeed | 1;
+        for (uint64_t& ruiData : vecData)
+        {
+            uiValue ^= uiValue << 13;
+            uiValue ^= uiValue >> 7;
+            uiValue ^= uiValue << 17;
+            ruiData = uiValue;
+        }
+        std::ofstream fstream(rpathFile.native().c_str(), std::ios::binary);
+        fstream.write(reinterpret_cast<const char*>(vecData.data()), static_cast<std::streamsize>(vecData.size() * sizeof(uint64_t)));
+    }
+}
+
+TEST_F(CInstallationBenchmark, ComposeVerifyExtract)
+{
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nFileCount = 8;
+    const size_t nFileSize = rReport.Scale(16 * 1024 * 1024);
+    for (size_t n = 0; n < nFileCount; n++)
+        CreateBenchmarkFile(m_pathRoot / "source" / ("file" + std::to_string(n) + ".bin"), nFileSize, n + 1);
+    const double dSize = static_cast<double>(nFileCount * nFileSize);
+    std::filesystem::path pathPackage = m_pathRoot / "Benchmark.sdv_package";
+
+    CInstallComposer composer;
+    ASSERT_EQ(composer.AddModule(m_pathRoot / "source", "*.bin").size(), nFileCount);
+
+    // Compose with one thread and with all processor cores
+    SBenchmarkResult sResult = rReport.MeasureTime("ComposeSingleThread", 1, [&]()
+        {
+            EXPECT_TRUE(composer.Compose(pathPackage, "Benchmark", 1));
+        });
+    rReport.AddSamples("ComposeSingleThreadThroughput", "MB/s", { dSize * 1000.0 / sResult.dMedian }, true);
+    sResult = rReport.MeasureTime("Compose", 1, [&]()
+        {
+            EXPECT_TRUE(composer.Compose(pathPackage, "Benchmark"));
+        });
+    rReport.AddSamples("ComposeThroughput", "MB/s", { dSize * 1000.0 / sResult.dMedian }, true);
+
+    // Verify and extract
+    sResult = rReport.MeasureTime("Verify", 1, [&]()
+        {
+            EXPECT_TRUE(CInstallComposer::Verify(pathPackage));
+        });
+    rReport.AddSamples("VerifyThroughput", "MB/s", { dSize * 1000.0 / sResult.dMedian }, true);
+    sResult = rReport.MeasureTime("Extract", 1, [&]()
+        {
+            std::filesystem::remove_all(m_pathRoot / "target");
+            EXPECT_TRUE(CInstallComposer::Extract(pathPackage, m_pathRoot / "target").IsValid());
+        });
+    rReport.AddSamples("ExtractThroughput", "MB/s", { dSize * 1000.0 / sResult.dMedian }, true);
+}
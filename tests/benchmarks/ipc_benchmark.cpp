@@ -0,0 +1,301 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "benchmark.h"
+#include "../../sdv_services/ipc_shared_mem/channel_mgnt.h"
+#include "../../sdv_services/ipc_shared_mem/connection.h"
+#include "../../sdv_services/ipc_shared_mem/watchdog.h"
+#include "../../sdv_services/ipc_shared_mem/connection.cpp"
+#include "../../sdv_services/ipc_shared_mem/channel_mgnt.cpp"
+#include "../../sdv_services/ipc_shared_mem/watchdog.cpp"
+#include "../../sdv_services/ipc_shared_mem/mem_buffer_accessor.cpp"
+#ifdef __unix__
+#include "../../sdv_services/uds_unix_sockets/channel_mgnt.h"
+#endif
+#include <support/app_control.h>
+#include <interfaces/ipc.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+/**
+ * @brief Receiver used by the IPC benchmarks. Either echoes the received data back to the sender or counts the received data.
+ */
+class CBenchmarkReceiver : public sdv::IInterfaceAccess, public sdv::ipc::IDataReceiveCallback
+{
+public:
+    /**
+     * @brief Destructor
+     */
+    ~CBenchmarkReceiver()
+    {
+        std::unique_lock<std::mutex> lock(m_mtxData);
+        m_bShutdown = true;
+        lock.unlock();
+        m_cvData.notify_all();
+        if (m_threadEcho.joinable())
+            m_threadEcho.join();
+    }
+
+    // Interface map
+    BEGIN_SDV_INTERFACE_MAP()
+        SDV_INTERFACE_ENTRY(sdv::ipc::IDataReceiveCallback)
+    END_SDV_INTERFACE_MAP()
+
+    /**
+     * @brief Echo the received data using the provided send interface. The data is sent from a separate thread; the connection
+     * does not allow sending from within the receive callback.
+     * @param[in] pSend Pointer to the sending interface.
+     */
+    void EnableEcho(sdv::ipc::IDataSend* pSend)
+    {
+        m_pSend = pSend;
+        m_threadEcho = std::thread(&CBenchmarkReceiver::EchoThreadFunc, this);
+    }
+
+    /**
+     * @brief Callback to be called by the IPC connection when receiving a data packet. Overload
+     * sdv::ipc::IDataReceiveCallback::ReceiveData.
+     * @param[inout] seqData Sequence of data buffers to received.
+     */
+    virtual void ReceiveData(/*inout*/ sdv::sequence<sdv::pointer<uint8_t>>& seqData) override
+    {
+        std::unique_lock<std::mutex> lock(m_mtxData);
+        for (const sdv::pointer<uint8_t>& rptrData : seqData)
+            m_nBytes += rptrData.size();
+        m_nMessages++;
+        if (m_pSend)
+            m_queueEcho.push(std::move(seqData));
+        lock.unlock();
+        m_cvData.notify_all();
+    }
+
+    /**
+     * @brief Wait until the amount of messages was received.
+     * @param[in] nMessages The amount of messages to wait for.
+     * @param[in] uiTimeoutMs Timeout in milliseconds.
+     * @return Returns whether the messages were received.
+     */
+    bool WaitForMessages(size_t nMessages, uint32_t uiTimeoutMs = 5000)
+    {
+        std::unique_lock<std::mutex> lock(m_mtxData);
+        return m_cvData.wait_for(lock, std::chrono::milliseconds(uiTimeoutMs), [&]() { return m_nMessages >= nMessages; });
+    }
+
+    /**
+     * @brief Get the amount of received messages.
+     * @return The amount of messages.
+     */
+    size_t GetMessageCount() const
+    {
+        std::unique_lock<std::mutex> lock(m_mtxData);
+        return m_nMessages;
+    }
+
+private:
+    /**
+     * @brief Echo thread function.
+     */
+    void EchoThreadFunc()
+    {
+        std::unique_lock<std::mutex> lock(m_mtxData);
+        while (!m_bShutdown)
+        {
+            if (m_queueEcho.empty())
+            {
+                m_cvData.wait(lock);
+                continue;
+            }
+            auto seqData = std::move(m_queueEcho.front());
+            m_queueEcho.pop();
+            lock.unlock();
+            m_pSend->SendData(seqData);
+            lock.lock();
+        }
+    }
+
+    sdv::ipc::IDataSend*                    m_pSend = nullptr;      ///< Send interface used to echo the data.
+    mutable std::mutex                      m_mtxData;              ///< Protect the data access.
+    std::condition_variable                 m_cvData;               ///< Signals received data.
+    size_t                                  m_nMessages = 0;        ///< Amount of received messages.
+    size_t                                  m_nBytes = 0;           ///< Amount of received bytes.
+    std::queue<sdv::sequence<sdv::pointer<uint8_t>>> m_queueEcho;   ///< Data queue for echoing.
+    std::thread                             m_threadEcho;           ///< Echo thread.
+    bool                                    m_bShutdown = false;    ///< Shutdown the echo thread.
+};
+
+namespace
+{
+    /**
+     * @brief Create a message with one buffer.
+     * @param[in] nSize Size of the buffer.
+     * @return The message.
+     */
+    sdv::sequence<sdv::pointer<uint8_t>> CreateMessage(size_t nSize)
+    {
+        sdv::pointer<uint8_t> ptrData;
+        ptrData.resize(nSize);
+        for (size_t n = 0; n < nSize; n++)
+            ptrData[n] = static_cast<uint8_t>(n);
+        sdv::sequence<sdv::pointer<uint8_t>> seqData;
+        seqData.push_back(ptrData);
+        return seqData;
+    }
+
+    /**
+     * @brief Measure the round-trip latency and the bandwidth of an established connection.
+     * @param[in] rptrServer Reference to the server connection; the receiver of the server is echoing.
+     * @param[in] rreceiverServer Reference to the receiver of the server connection.
+     * @param[in] rptrClient Reference to the client connection.
+     * @param[in] rreceiverClient Reference to the receiver of the client connection.
+     */
+    void MeasureConnection(sdv::TObjectPtr& rptrServer, CBenchmarkReceiver& rreceiverServer, sdv::TObjectPtr& rptrClient,
+        CBenchmarkReceiver& rreceiverClient)
+    {
+        CBenchmarkReport& rReport = CBenchmarkReport::Get();
+        sdv::ipc::IDataSend* pServerSend = rptrServer.GetInterface<sdv::ipc::IDataSend>();
+        ASSERT_NE(pServerSend, nullptr);
+        sdv::ipc::IDataSend* pClientSend = rptrClient.GetInterface<sdv::ipc::IDataSend>();
+        ASSERT_NE(pClientSend, nullptr);
+        rreceiverServer.EnableEcho(pServerSend);
+
+        // Round-trip latency of small messages; the first messages are used to warm up.
+        const size_t nCount = rReport.Scale(5000);
+        std::vector<double> vecSamples;
+        sdv::sequence<sdv::pointer<uint8_t>> seqSmall = CreateMessage(64);
+        size_t nMessages = rreceiverClient.GetMessageCount();
+        for (size_t n = 0; n < nCount + 100; n++)
+        {
+            auto tpStart = std::chrono::steady_clock::now();
+            sdv::sequence<sdv::pointer<uint8_t>> seqData = seqSmall;
+            ASSERT_TRUE(pClientSend->SendData(seqData));
+            ASSERT_TRUE(rreceiverClient.WaitForMessages(++nMessages));
+            if (n >= 100)
+                vecSamples.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() -
+                    tpStart).count());
+        }
+        rReport.AddSamples("RoundTrip64B", "us", std::move(vecSamples));
+
+        // Bandwidth of large messages (echoed; both directions are counted).
+        const size_t nSize = 1024 * 1024;
+        const size_t nLargeCount = rReport.Scale(100);
+        sdv::sequence<sdv::pointer<uint8_t>> seqLarge = CreateMessage(nSize);
+        vecSamples.clear();
+        for (size_t nRepetition = 0; nRepetition < rReport.Repetitions(); nRepetition++)
+        {
+            auto tpStart = std::chrono::steady_clock::now();
+            for (size_t n = 0; n < nLargeCount; n++)
+            {
+                sdv::sequence<sdv::pointer<uint8_t>> seqData = seqLarge;
+                ASSERT_TRUE(pClientSend->SendData(seqData));
+                ASSERT_TRUE(rreceiverClient.WaitForMessages(++nMessages));
+            }
+            double dDuration = std::chrono::duration<double>(std::chrono::steady_clock::now() - tpStart).count();
+            vecSamples.push_back(2.0 * static_cast<double>(nSize * nLargeCount) / dDuration / 1000000.0);
+        }
+        rReport.AddSamples("Bandwidth1MB", "MB/s", std::move(vecSamples), true, nLargeCount);
+    }
+}
+
+TEST(IpcBenchmark, SharedMemory)
+{
+    sdv::app::CAppControl appcontrol;
+    ASSERT_TRUE(appcontrol.Startup(""));
+
+    CSharedMemChannelMgnt mgntServer, mgntClient;
+    mgntServer.Initialize("");
+    mgntClient.Initialize("");
+    sdv::ipc::SChannelEndpoint sChannelEndpoint = mgntServer.CreateEndpoint("");
+    ASSERT_NE(sChannelEndpoint.pConnection, nullptr);
+
+    sdv::TObjectPtr ptrServerConnection(sChannelEndpoint.pConnection);
+    sdv::TObjectPtr ptrClientConnection = mgntClient.Access(sChannelEndpoint.ssConnectString);
+    ASSERT_TRUE(ptrServerConnection);
+    ASSERT_TRUE(ptrClientConnection);
+
+    {
+        CBenchmarkReceiver receiverServer, receiverClient;
+        sdv::ipc::IConnect* pServerConnect = ptrServerConnection.GetInterface<sdv::ipc::IConnect>();
+        ASSERT_NE(pServerConnect, nullptr);
+        sdv::ipc::IConnect* pClientConnect = ptrClientConnection.GetInterface<sdv::ipc::IConnect>();
+        ASSERT_NE(pClientConnect, nullptr);
+        ASSERT_TRUE(pServerConnect->AsyncConnect(&receiverServer));
+        ASSERT_TRUE(pClientConnect->AsyncConnect(&receiverClient));
+        ASSERT_TRUE(pClientConnect->WaitForConnection(2000));
+        ASSERT_TRUE(pServerConnect->WaitForConnection(1000));
+
+        MeasureConnection(ptrServerConnection, receiverServer, ptrClientConnection, receiverClient);
+
+        pClientConnect->Disconnect();
+        pServerConnect->Disconnect();
+    }
+
+    ptrClientConnection.Clear();
+    ptrServerConnection.Clear();
+    mgntServer.Shutdown();
+    mgntClient.Shutdown();
+    appcontrol.Shutdown();
+}
+
+#ifdef __unix__
+TEST(IpcBenchmark, UnixDomainSockets)
+{
+    sdv::app::CAppControl appcontrol;
+    ASSERT_TRUE(appcontrol.Startup(""));
+    appcontrol.SetRunningMode();
+
+    CUnixDomainSocketsChannelMgnt mgnt;
+    mgnt.Initialize("");
+    mgnt.SetOperationMode(sdv::EOperationMode::running);
+    sdv::ipc::SChannelEndpoint sChannelEndpoint = mgnt.CreateEndpoint("");
+    ASSERT_FALSE(sChannelEndpoint.ssConnectString.empty());
+
+    // The client connect string only differs in the role.
+    std::string ssServerCS = sChannelEndpoint.ssConnectString;
+    std::string ssClientCS = ssServerCS;
+    size_t nPos = ssClientCS.find("role=server");
+    if (nPos != std::string::npos)
+        ssClientCS.replace(nPos, 11, "role=client");
+
+    sdv::TObjectPtr ptrServerConnection = mgnt.Access(ssServerCS);
+    sdv::TObjectPtr ptrClientConnection = mgnt.Access(ssClientCS);
+    ASSERT_TRUE(ptrServerConnection);
+    ASSERT_TRUE(ptrClientConnection);
+
+    {
+        CBenchmarkReceiver receiverServer, receiverClient;
+        sdv::ipc::IConnect* pServerConnect = ptrServerConnection.GetInterface<sdv::ipc::IConnect>();
+        ASSERT_NE(pServerConnect, nullptr);
+        sdv::ipc::IConnect* pClientConnect = ptrClientConnection.GetInterface<sdv::ipc::IConnect>();
+        ASSERT_NE(pClientConnect, nullptr);
+        ASSERT_TRUE(pServerConnect->AsyncConnect(&receiverServer));
+        ASSERT_TRUE(pClientConnect->AsyncConnect(&receiverClient));
+        ASSERT_TRUE(pServerConnect->WaitForConnection(5000));
+        ASSERT_TRUE(pClientConnect->WaitForConnection(5000));
+
+        MeasureConnection(ptrServerConnection, receiverServer, ptrClientConnection, receiverClient);
+
+        pClientConnect->Disconnect();
+        pServerConnect->Disconnect();
+    }
+
+    ptrClientConnection.Clear();
+    ptrServerConnection.Clear();
+    mgnt.Shutdown();
+    appcontrol.Shutdown();
+}
+#endif
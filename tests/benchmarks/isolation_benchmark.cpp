@@ -0,0 +1,94 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "benchmark.h"
+#include <support/app_control.h>
+#include <support/sdv_core.h>
+#include <interfaces/repository.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Isolation benchmark; the complex service of the repository component tests is installed for instance 3100 and is
+ * created in an isolated process (sdv_iso) for every object.
+ */
+class CIsolationBenchmark : public ::testing::Test
+{
+public:
+    /**
+     * @brief Stop the framework.
+     */
+    virtual void TearDown() override
+    {
+        m_appcontrol.Shutdown();
+    }
+
+protected:
+    /**
+     * @brief Measure the time from requesting an isolated object until the isolated process has connected and registered the
+     * object. The objects are created one after the other and destroyed after each repetition.
+     * @param[in] bZygote When set, the isolated processes are created through the sdv_iso zygote.
+     */
+    void MeasureSpawnToConnected(bool bZygote)
+    {
+        std::string ssConfig = R"code(
+[LogHandler]
+ViewFilter = "Fatal"
+
+[Application]
+Mode = "Main"
+Instance = 3100
+)code";
+        if (bZygote) ssConfig += "IsoZygote = true\n";
+        ASSERT_TRUE(m_appcontrol.Startup(ssConfig));
+        m_appcontrol.SetConfigMode();
+        sdv::core::IRepositoryControl* pRepositoryControl =
+            sdv::core::GetObject<sdv::core::IRepositoryControl>("RepositoryService");
+        ASSERT_NE(pRepositoryControl, nullptr);
+
+        CBenchmarkReport& rReport = CBenchmarkReport::Get();
+        const size_t nCount = rReport.Scale(20);
+        std::vector<double> vecSamples;
+
+        // The first run is used to warm up (and to start the zygote).
+        for (size_t nRun = 0; nRun <= rReport.Repetitions(); nRun++)
+        {
+            auto tpStart = std::chrono::steady_clock::now();
+            for (size_t n = 0; n < nCount; n++)
+            {
+                ASSERT_NE(pRepositoryControl->CreateObject("TestObject_ComplexHelloService",
+                    "IsolationBenchmark_" + std::to_string(n), ""), 0u);
+            }
+            double dDuration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tpStart).count();
+            if (nRun) vecSamples.push_back(dDuration / static_cast<double>(nCount));
+
+            for (size_t n = 0; n < nCount; n++)
+                EXPECT_TRUE(pRepositoryControl->DestroyObject("IsolationBenchmark_" + std::to_string(n)));
+        }
+        rReport.AddSamples("PerComponent", "ms", std::move(vecSamples), false, nCount);
+    }
+
+private:
+    sdv::app::CAppControl m_appcontrol;     ///< Application control.
+};
+
+TEST_F(CIsolationBenchmark, SpawnToConnected)
+{
+    MeasureSpawnToConnected(false);
+}
+
+TEST_F(CIsolationBenchmark, ZygoteSpawnToConnected)
+{
+    MeasureSpawnToConnected(true);
+}
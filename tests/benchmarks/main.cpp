@@ -0,0 +1,33 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include "../../global/process_watchdog.h"
+#include "benchmark.h"
+
+#if defined(_WIN32) && defined(_UNICODE)
+extern "C" int wmain(int argc, wchar_t* argv[])
+#else
+extern "C" int main(int argc, char* argv[])
+#endif
+{
+    // The benchmarks take longer than the functional tests.
+    CProcessWatchdog watchdog(1800ll);
+
+    CBenchmarkReport::Get().ProcessCommandLine(argc, argv);
+    ::testing::InitGoogleTest(&argc, argv);
+    int iResult = RUN_ALL_TESTS();
+    if (!CBenchmarkReport::Get().WriteJSON() && !iResult)
+        iResult = 1;
+    return iResult;
+}
@@ -0,0 +1,309 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "benchmark.h"
+#include "../../sdv_services/core/toml_parser/character_reader_utf_8.cpp"
+#include "../../sdv_services/core/toml_parser/lexer_toml.cpp"
+#include "../../sdv_services/core/toml_parser/lexer_toml_token.cpp"
+#include "../../sdv_services/core/toml_parser/parser_toml.cpp"
+#include "../../sdv_services/core/toml_parser/parser_node_toml.cpp"
+#include "../../sdv_services/core/toml_parser/miscellaneous.cpp"
+#include "../../sdv_services/core/toml_parser/code_snippet.cpp"
+#include "../../global/dbcparser/dbcparser.cpp"
+#include "../../global/ascformat/ascreader.cpp"
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Create a TOML document resembling a large system configuration and installation manifest.
+     * @param[in] nComponentCount Amount of component tables to create.
+     * @return The TOML document.
+     */
+    std::string CreateBenchmarkTOML(size_t nComponentCount)
+    {
+        std::stringstream sstream;
+        sstream << "# Generated configuration used for the parser benchmark\n";
+        sstream << "[Configuration]\nVersion = 100\n\n";
+        for (size_t n = 0; n < nComponentCount; n++)
+        {
+            sstream << "[[Component]]\n";
+            sstream << "Path = \"component_" << n << ".sdv\"   # The module containing the component\n";
+            sstream << "Class = \"Vehicle.Device.Class_" << n << "\"\n";
+            sstream << "Name = 'Instance \\" << n << " with a literal string'\n";
+            sstream << "Description = \"\"\"\nA multi-line description of the component, containing escaped \\\"quotes\\\",\n"
+                "a tab\\t and a unicode character \\u00E4 to exercise the string scanner.\"\"\"\n";
+            sstream << "Interval = " << (n % 1000) * 10 << "\n";
+            sstream << "Factor = " << n << ".25e-3\n";
+            sstream << "Mask = 0x" << std::hex << n << std::dec << "\n";
+            sstream << "Enabled = " << (n % 2 ? "true" : "false") << "\n";
+            sstream << "Signals = [ \"Signal_A_" << n << "\", \"Signal_B_" << n << "\", \"Signal_C_" << n << "\" ]\n";
+            sstream << "Limits = { min = -" << n << ", max = " << n << ", unit = \"km/h\" }\n\n";
+        }
+        return sstream.str();
+    }
+
+    /**
+     * @brief Create a DBC file with messages of 8 bytes, each containing a mix of Intel and Motorola signals.
+     * @param[in] nMessageCount Amount of messages to create.
+     * @return The DBC file content.
+     */
+    std::string CreateBenchmarkDBC(size_t nMessageCount)
+    {
+        std::stringstream sstream;
+        sstream << "VERSION \"Benchmark\"\n\nNS_ :\n\tCM_\n\tBA_DEF_\n\tBA_\n\tVAL_\n\nBS_:\n\nBU_: Sender Receiver\n\n";
+        for (size_t nMsg = 0; nMsg < nMessageCount; nMsg++)
+        {
+            sstream << "BO_ " << 100 + nMsg << " Message_" << nMsg << ": 8 Sender\n";
+            sstream << " SG_ Speed_" << nMsg << " : 0|16@1+ (0.01,0) [0|655.35] \"km/h\" Receiver\n";
+            sstream << " SG_ Torque_" << nMsg << " : 16|12@1- (0.5,0) [-1024|1023.5] \"Nm\" Receiver\n";
+            sstream << " SG_ Gear_" << nMsg << " : 28|4@1+ (1,0) [0|15] \"\" Receiver\n";
+            sstream << " SG_ Angle_" << nMsg << " : 39|16@0- (0.1,0) [-3276.8|3276.7] \"deg\" Receiver\n";
+            sstream << " SG_ Counter_" << nMsg << " : 55|4@0+ (1,0) [0|15] \"\" Receiver\n";
+            sstream << " SG_ Temp_" << nMsg << " : 51|12@0+ (0.1,-40) [-40|369.5] \"degC\" Receiver\n";
+            sstream << "\n";
+        }
+        for (size_t nMsg = 0; nMsg < nMessageCount; nMsg++)
+            sstream << "CM_ SG_ " << 100 + nMsg << " Speed_" << nMsg << " \"Vehicle speed of message " << nMsg << "\";\n";
+        sstream << "VAL_ 100 Gear_0 0 \"Park\" 1 \"Reverse\" 2 \"Neutral\" 3 \"Drive\" ;\n";
+        return sstream.str();
+    }
+
+    /**
+     * @brief Decoding information of a CAN signal; mirrors the code generated for the data link by the DBC utility.
+     */
+    struct SSignalDecoder
+    {
+        bool        bMotorola = false;  ///< Motorola (big endian) byte order.
+        bool        bSigned = false;    ///< Signed value.
+        uint32_t    uiFirstByte = 0;    ///< First byte containing the value (Intel: the least significant byte).
+        uint32_t    uiLastByte = 0;     ///< Last byte containing the value (Intel: the most significant byte).
+        uint32_t    uiMask = 0xff;      ///< Mask of the byte containing the most significant bits.
+        uint32_t    uiShiftRight = 0;   ///< Amount of bits to shift the value to the right.
+        uint32_t    uiSize = 0;         ///< Size of the value in bits.
+        double      dFactor = 1.0;      ///< Factor.
+        double      dOffset = 0.0;      ///< Offset.
+    };
+
+    /**
+     * @brief Create the decoder of a signal.
+     * @param[in] rsSig Reference to the signal definition.
+     * @return The decoder.
+     */
+    SSignalDecoder CreateDecoder(const dbc::SSignalDef& rsSig)
+    {
+        SSignalDecoder sDecoder;
+        sDecoder.bMotorola = rsSig.eByteOrder == dbc::SSignalDef::EByteOrder::big_endian;
+        sDecoder.bSigned = rsSig.eValType == dbc::SSignalDef::EValueType::signed_integer;
+        sDecoder.uiSize = rsSig.uiSize;
+        sDecoder.dFactor = rsSig.dFactor;
+        sDecoder.dOffset = rsSig.dOffset;
+        if (sDecoder.bMotorola)
+        {
+            auto fnInverseBitPos = [](uint32_t uiPos) -> uint32_t
+            {
+                return ((uiPos >> 3) << 3) + ((8 - ((uiPos + 1) & 7)) & 7);
+            };
+            sDecoder.uiFirstByte = rsSig.uiStartBit >> 3;
+            sDecoder.uiLastByte = (fnInverseBitPos(rsSig.uiStartBit) + rsSig.uiSize - 1) >> 3;
+            sDecoder.uiMask = (1 << ((rsSig.uiStartBit & 0x7) + 1)) - 1;
+            sDecoder.uiShiftRight = (fnInverseBitPos(fnInverseBitPos(rsSig.uiStartBit) + rsSig.uiSize) + 1) & 0x7;
+        }
+        else
+        {
+            sDecoder.uiFirstByte = rsSig.uiStartBit >> 3;
+            sDecoder.uiLastByte = (rsSig.uiStartBit + rsSig.uiSize - 1) >> 3;
+            sDecoder.uiMask = (1 << (((rsSig.uiStartBit + rsSig.uiSize - 1) & 0x7) + 1)) - 1;
+            sDecoder.uiShiftRight = rsSig.uiStartBit & 0x7;
+        }
+        return sDecoder;
+    }
+
+    /**
+     * @brief Decode a signal from the CAN data.
+     * @param[in] rsDecoder Reference to the signal decoder.
+     * @param[in] pData Pointer to the CAN data.
+     * @return The physical value.
+     */
+    double Decode(const SSignalDecoder& rsDecoder, const uint8_t* pData)
+    {
+        uint64_t uiValue = 0;
+        if (rsDecoder.bMotorola)
+        {
+            uiValue = pData[rsDecoder.uiFirstByte] & rsDecoder.uiMask;
+            for (uint32_t uiIndex = rsDecoder.uiFirstByte + 1; uiIndex <= rsDecoder.uiLastByte; uiIndex++)
+                uiValue = uiValue << 8 | pData[uiIndex];
+        }
+        else
+        {
+            uiValue = pData[rsDecoder.uiLastByte] & rsDecoder.uiMask;
+            for (uint32_t uiIndex = rsDecoder.uiLastByte; uiIndex-- > rsDecoder.uiFirstByte;)
+                uiValue = uiValue << 8 | pData[uiIndex];
+        }
+        uiValue >>= rsDecoder.uiShiftRight;
+        if (rsDecoder.uiSize < 64)
+            uiValue &= (1ull << rsDecoder.uiSize) - 1;
+        if (rsDecoder.bSigned && rsDecoder.uiSize < 64 && (uiValue & (1ull << (rsDecoder.uiSize - 1))))
+            uiValue |= ~((1ull << rsDecoder.uiSize) - 1);
+        double dRaw = rsDecoder.bSigned ? static_cast<double>(static_cast<int64_t>(uiValue)) : static_cast<double>(uiValue);
+        return dRaw * rsDecoder.dFactor + rsDecoder.dOffset;
+    }
+}
+
+TEST(ParserBenchmark, TOMLParse)
+{
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nComponentCount = rReport.Scale(2000);
+    std::string ssTOML = CreateBenchmarkTOML(nComponentCount);
+
+    SBenchmarkResult sResult = rReport.MeasureTime("Parse", 1, [&]()
+        {
+            toml_parser::CParser parser(ssTOML);
+            DoNotOptimize(parser);
+        });
+    rReport.AddSamples("ParseThroughput", "MB/s", { static_cast<double>(ssTOML.size()) * 1000.0 / sResult.dMedian }, true);
+
+    // Lexer only
+    size_t nErrorCount = 0;
+    sResult = rReport.MeasureTime("Lex", 1, [&]()
+        {
+            toml_parser::CLexer lexer(ssTOML);
+            lexer.NavigationMode(toml_parser::CLexer::ENavigationMode::do_not_skip_anything);
+            while (!lexer.IsEnd())
+            {
+                const toml_parser::CToken& rToken = lexer.Consume();
+                if (!rToken) break;
+                if (rToken.Category() == toml_parser::ETokenCategory::token_error) nErrorCount++;
+            }
+        });
+    EXPECT_EQ(nErrorCount, 0u);
+    rReport.AddSamples("LexThroughput", "MB/s", { static_cast<double>(ssTOML.size()) * 1000.0 / sResult.dMedian }, true);
+
+    // Parsing without comment and whitespace preservation, followed by the bulk export of all values
+    sResult = rReport.MeasureTime("ParseReadOnly", 1, [&]()
+        {
+            toml_parser::CParser parser;
+            parser.ProcessReadOnly(ssTOML);
+            DoNotOptimize(parser);
+        });
+    rReport.AddSamples("ParseReadOnlyThroughput", "MB/s", { static_cast<double>(ssTOML.size()) * 1000.0 / sResult.dMedian },
+        true);
+    toml_parser::CParser parserReadOnly;
+    parserReadOnly.ProcessReadOnly(ssTOML);
+    rReport.MeasureTime("Flatten", 1, [&]()
+        {
+            EXPECT_EQ(parserReadOnly.Root().GetFlattened(true).size(), nComponentCount * 14 + 1);
+        });
+}
+
+TEST(ParserBenchmark, ASCParse)
+{
+    // Create a trace with CAN and CAN-FD samples mixed with meta data lines.
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nSampleCount = rReport.Scale(200000);
+    std::filesystem::path pathFile = std::filesystem::temp_directory_path() / "sdv_benchmark.asc";
+    {
+        std::ofstream fstream(pathFile, std::ios::binary);
+        ASSERT_TRUE(fstream.is_open());
+        fstream << "date Wed Jul 28 06:47:19 pm 2010\nbase hex  timestamps absolute\ninternal events logged\n";
+        fstream << "Begin TriggerBlock Wed Jul 28 06:47:19 pm 2010\n   0.000000 Start of measurement\n";
+        fstream << std::fixed << std::setprecision(6);
+        for (size_t n = 0; n < nSampleCount; n++)
+        {
+            double dTimestamp = static_cast<double>(n) * 0.0005;
+            fstream << "   " << dTimestamp;
+            if (n % 10 == 9)
+                fstream << " CANFD 1 Rx " << std::hex << std::uppercase << (n & 0x7ff) << std::dec << " 1 0 13 32";
+            else if (n % 100 == 50)
+                fstream << " CAN 1 Status:chip status error active";
+            else
+                fstream << " 2  " << std::hex << std::uppercase << (n & 0x1fffffff) << std::dec << "x       Rx   d 8";
+            size_t nLength = n % 10 == 9 ? 32 : (n % 100 == 50 ? 0 : 8);
+            for (size_t nIndex = 0; nIndex < nLength; nIndex++)
+                fstream << " " << std::hex << std::setw(2) << std::setfill('0') << ((n + nIndex) & 0xff) << std::dec;
+            fstream << "\n";
+        }
+        fstream << "End TriggerBlock\n";
+    }
+    size_t nFileSize = static_cast<size_t>(std::filesystem::file_size(pathFile));
+
+    SBenchmarkResult sResult = rReport.MeasureTime("Parse", 1, [&]()
+        {
+            asc::CAscReader reader;
+            EXPECT_TRUE(reader.Read(pathFile));
+            EXPECT_EQ(reader.GetMessageCount(), static_cast<uint32_t>(nSampleCount - nSampleCount / 100));
+        });
+    rReport.AddSamples("ParseThroughput", "MB/s", { static_cast<double>(nFileSize) * 1000.0 / sResult.dMedian }, true);
+
+    std::filesystem::remove(pathFile);
+}
+
+TEST(ParserBenchmark, DBCParse)
+{
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nMessageCount = rReport.Scale(1500);
+    std::string ssDBC = CreateBenchmarkDBC(nMessageCount);
+
+    SBenchmarkResult sResult = rReport.MeasureTime("Parse", 1, [&]()
+        {
+            dbc::CDbcParser parser;
+            dbc::CDbcSource source(ssDBC);
+            parser.Parse(source);
+            EXPECT_EQ(parser.GetMessageIDs().size(), nMessageCount);
+        });
+    rReport.AddSamples("ParseThroughput", "MB/s", { static_cast<double>(ssDBC.size()) * 1000.0 / sResult.dMedian }, true);
+}
+
+TEST(ParserBenchmark, CANDecode)
+{
+    CBenchmarkReport& rReport = CBenchmarkReport::Get();
+    const size_t nMessageCount = 64;
+    dbc::CDbcParser parser;
+    dbc::CDbcSource source(CreateBenchmarkDBC(nMessageCount));
+    parser.Parse(source);
+
+    // Create the decoders per message
+    std::vector<std::vector<SSignalDecoder>> vecMessages;
+    for (uint32_t uiId : parser.GetMessageIDs())
+    {
+        auto prMsg = parser.GetMsgDef(uiId);
+        ASSERT_TRUE(prMsg.second);
+        std::vector<SSignalDecoder> vecDecoders;
+        for (const dbc::SSignalDef& rsSig : prMsg.first.vecSignals)
+            vecDecoders.push_back(CreateDecoder(rsSig));
+        vecMessages.push_back(std::move(vecDecoders));
+    }
+    ASSERT_EQ(vecMessages.size(), nMessageCount);
+
+    // Decode a sequence of frames of all messages
+    const size_t nFrameCount = rReport.Scale(1000000);
+    std::vector<uint8_t> vecFrames(256 * 8);
+    for (size_t n = 0; n < vecFrames.size(); n++)
+        vecFrames[n] = static_cast<uint8_t>(n * 37 + 11);
+    double dSum = 0.0;
+    SBenchmarkResult sResult = rReport.MeasureTime("DecodeFrame", nFrameCount, [&]()
+        {
+            for (size_t nFrame = 0; nFrame < nFrameCount; nFrame++)
+            {
+                const uint8_t* pData = vecFrames.data() + (nFrame & 255) * 8;
+                for (const SSignalDecoder& rsDecoder : vecMessages[nFrame % nMessageCount])
+                    dSum += Decode(rsDecoder, pData);
+            }
+        });
+    DoNotOptimize(dSum);
+    rReport.AddSamples("FramesPerSecond", "1/s", { 1000000000.0 / sResult.dMedian }, true);
+}
@@ -19,6 +19,7 @@
 #include <atomic>
 #include <chrono>
 #include <shared_mutex>
+#include <vector>
 
 #include <support/signal_support.h>
 #include <interfaces/dispatch.h>
@@ -644,6 +645,180 @@ TEST(DataDispatchServiceTest, DirectRxSignalReceptionCallback)
     appcontrol.Shutdown();
 }
 
+TEST(DataDispatchServiceTest, DirectRxSignalReceptionPolicy)
+{
+    sdv::app::CAppControl appcontrol;
+    bool bResult = appcontrol.Startup("");
+    EXPECT_TRUE(bResult);
+    appcontrol.SetConfigMode();
+    sdv::core::EConfigProcessResult eResult = appcontrol.LoadConfig("test_dds_config.toml");
+    EXPECT_EQ(eResult, sdv::core::EConfigProcessResult::successful);
+
+    // Register the signals
+    sdv::core::CDispatchService dispatch;
+    sdv::core::CSignal signal1 = dispatch.RegisterRxSignal("abc");
+    EXPECT_TRUE(signal1);
+    sdv::core::CSignal signal2 = dispatch.RegisterRxSignal("def");
+    EXPECT_TRUE(signal2);
+    sdv::core::CSignal signal3 = dispatch.RegisterRxSignal("ghi");
+    EXPECT_TRUE(signal3);
+
+    // Subscribe to the signals; change-only, deadband and rate limited
+    sdv::core::SSubscriptionPolicy sPolicyChange{};
+    sPolicyChange.bOnChangeOnly = true;
+    size_t nCnt4 = 0;
+    sdv::core::CSignal signal4 = dispatch.Subscribe("abc", [&](sdv::any_t) { nCnt4++; }, sPolicyChange);
+    EXPECT_TRUE(signal4);
+    sdv::core::SSubscriptionPolicy sPolicyDeadband{};
+    sPolicyDeadband.dAbsDeadband = 1.0;
+    sPolicyDeadband.dRelDeadband = 0.1;
+    double d5 = 0.0;
+    sdv::core::CSignal signal5 = dispatch.Subscribe("def", [&](sdv::any_t any) { d5 = any.get<double>(); }, sPolicyDeadband);
+    EXPECT_TRUE(signal5);
+    sdv::core::SSubscriptionPolicy sPolicyRate{};
+    sPolicyRate.uiMinInterval = 100;
+    std::atomic<int32_t> i6 = 0;
+    sdv::core::CSignal signal6 = dispatch.Subscribe("ghi", i6, sPolicyRate);
+    EXPECT_TRUE(signal6);
+    appcontrol.SetRunningMode();
+
+    // Change only
+    signal1.Write(10);
+    signal1.Write(10);
+    signal1.Write(11);
+    signal1.Write(11);
+    signal1.Write(10);
+    EXPECT_EQ(nCnt4, 3u);
+    EXPECT_EQ(signal4.GetSubscriptionStatistics().uiDelivered, 3u);
+    EXPECT_EQ(signal4.GetSubscriptionStatistics().uiSuppressed, 2u);
+
+    // Deadband: more than 1.0 and more than 10% difference
+    signal2.Write(5.0);
+    EXPECT_EQ(d5, 5.0);
+    signal2.Write(5.9);         // Within absolute deadband
+    EXPECT_EQ(d5, 5.0);
+    signal2.Write(6.5);
+    EXPECT_EQ(d5, 6.5);
+    signal2.Write(100.0);
+    EXPECT_EQ(d5, 100.0);
+    signal2.Write(105.0);       // Within relative deadband
+    EXPECT_EQ(d5, 100.0);
+    signal2.Write(89.0);
+    EXPECT_EQ(d5, 89.0);
+    EXPECT_EQ(signal5.GetSubscriptionStatistics().uiDelivered, 4u);
+    EXPECT_EQ(signal5.GetSubscriptionStatistics().uiSuppressed, 2u);
+
+    // Rate limit
+    signal3.Write(1);
+    signal3.Write(2);
+    signal3.Write(3);
+    EXPECT_EQ(i6, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    signal3.Write(4);
+    EXPECT_EQ(i6, 4);
+    EXPECT_EQ(signal6.GetSubscriptionStatistics().uiDelivered, 2u);
+    EXPECT_EQ(signal6.GetSubscriptionStatistics().uiSuppressed, 2u);
+
+    appcontrol.SetConfigMode();
+    signal1.Reset();
+    signal2.Reset();
+    signal3.Reset();
+    signal4.Reset();
+    signal5.Reset();
+    signal6.Reset();
+
+    appcontrol.Shutdown();
+}
+
+TEST(DataDispatchServiceTest, DirectRxSignalReceptionAsync)
+{
+    sdv::app::CAppControl appcontrol;
+    bool bResult = appcontrol.Startup("");
+    EXPECT_TRUE(bResult);
+    appcontrol.SetConfigMode();
+    sdv::core::EConfigProcessResult eResult = appcontrol.LoadConfig("test_dds_config.toml");
+    EXPECT_EQ(eResult, sdv::core::EConfigProcessResult::successful);
+
+    // Register the signals
+    sdv::core::CDispatchService dispatch;
+    sdv::core::CSignal signal1 = dispatch.RegisterRxSignal("abc");
+    EXPECT_TRUE(signal1);
+    sdv::core::CSignal signal2 = dispatch.RegisterRxSignal("def");
+    EXPECT_TRUE(signal2);
+
+    // Subscribe with slow subscribers; queued and coalesced delivery
+    sdv::core::SSubscriptionPolicy sPolicyQueue{};
+    sPolicyQueue.uiQueueSize = 16;
+    std::mutex mtxValues;
+    std::vector<int32_t> vecValues3;
+    sdv::core::CSignal signal3 = dispatch.Subscribe("abc", [&](sdv::any_t any)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            std::unique_lock<std::mutex> lock(mtxValues);
+            vecValues3.push_back(any.get<int32_t>());
+        }, sPolicyQueue);
+    EXPECT_TRUE(signal3);
+    sdv::core::SSubscriptionPolicy sPolicyCoalesce{};
+    sPolicyCoalesce.uiQueueSize = 1;
+    sPolicyCoalesce.bCoalesce = true;
+    std::atomic<int32_t> i4 = 0;
+    std::atomic<size_t> nCnt4 = 0;
+    sdv::core::CSignal signal4 = dispatch.Subscribe("def", [&](sdv::any_t any)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            i4 = any.get<int32_t>();
+            nCnt4++;
+        }, sPolicyCoalesce);
+    EXPECT_TRUE(signal4);
+    appcontrol.SetRunningMode();
+
+    // The writer is not blocked by the subscribers
+    auto tpStart = std::chrono::steady_clock::now();
+    for (int32_t i = 1; i <= 10; i++)
+    {
+        signal1.Write(i);
+        signal2.Write(i);
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - tpStart, std::chrono::milliseconds(100));
+
+    // Wait for the delivery
+    for (size_t n = 0; n < 200 && (signal3.GetSubscriptionStatistics().uiDelivered < 10 || i4 != 10); n++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // All queued values are delivered in order
+    std::unique_lock<std::mutex> lock(mtxValues);
+    ASSERT_EQ(vecValues3.size(), 10u);
+    for (size_t n = 0; n < vecValues3.size(); n++)
+        EXPECT_EQ(vecValues3[n], static_cast<int32_t>(n + 1));
+    lock.unlock();
+    sdv::core::SSubscriptionStatistics sStatistics3 = signal3.GetSubscriptionStatistics();
+    EXPECT_EQ(sStatistics3.uiDelivered, 10u);
+    EXPECT_EQ(sStatistics3.uiDropped, 0u);
+    EXPECT_EQ(sStatistics3.uiQueueDepth, 0u);
+    EXPECT_GE(sStatistics3.uiMaxQueueDepth, 2u);
+    EXPECT_GE(sStatistics3.uiMaxLatency, 20000u);
+
+    // Only the most recent value is delivered when coalescing
+    EXPECT_EQ(i4, 10);
+    sdv::core::SSubscriptionStatistics sStatistics4 = signal4.GetSubscriptionStatistics();
+    EXPECT_EQ(sStatistics4.uiDelivered, nCnt4);
+    EXPECT_LT(sStatistics4.uiDelivered, 10u);
+    EXPECT_EQ(sStatistics4.uiDelivered + sStatistics4.uiCoalesced, 10u);
+
+    // Values exceeding the queue size are dropped
+    for (int32_t i = 11; i <= 50; i++)
+        signal1.Write(i);
+    EXPECT_GT(signal3.GetSubscriptionStatistics().uiDropped, 0u);
+
+    appcontrol.SetConfigMode();
+    signal1.Reset();
+    signal2.Reset();
+    signal3.Reset();
+    signal4.Reset();
+
+    appcontrol.Shutdown();
+}
+
 TEST(DataDispatchServiceTest, DirectRxSignalReceptionData)
 {
     sdv::app::CAppControl appcontrol;
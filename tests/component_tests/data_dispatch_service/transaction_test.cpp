@@ -19,6 +19,7 @@
 #include <atomic>
 #include <chrono>
 #include <shared_mutex>
+#include <string>
 
 #include <support/signal_support.h>
 #include <interfaces/dispatch.h>
@@ -1689,3 +1690,79 @@ TEST(DataDispatchServiceTest, TransactionalRxTxSignalConcurrency)
     appcontrol.Shutdown();
 }
 
+TEST(DataDispatchServiceTest, TransactionalSnapshotHistory)
+{
+    sdv::app::CAppControl appcontrol;
+    bool bResult = appcontrol.Startup("");
+    EXPECT_TRUE(bResult);
+    appcontrol.SetConfigMode();
+    sdv::core::EConfigProcessResult eResult = appcontrol.LoadConfig("test_dds_config.toml");
+    EXPECT_EQ(eResult, sdv::core::EConfigProcessResult::successful);
+
+    // Register the signal and add a publisher
+    sdv::core::CDispatchService dispatch;
+    sdv::core::CSignal signal1 = dispatch.RegisterTxSignal("abc", 10);
+    EXPECT_TRUE(signal1);
+    sdv::core::CSignal signal2 = dispatch.AddPublisher("abc");
+    EXPECT_TRUE(signal2);
+    appcontrol.SetRunningMode();
+
+    sdv::core::ISignalHistoryStatistics* pStatistics =
+        sdv::core::GetObject<sdv::core::ISignalHistoryStatistics>("DataDispatchService");
+    ASSERT_NE(pStatistics, nullptr);
+    sdv::core::SSignalHistoryStatistics sStatisticsStart = pStatistics->GetHistoryStatistics();
+
+    // Write a value and start a read transaction
+    signal2.Write(100);
+    sdv::core::CTransaction transactionRead = dispatch.CreateTransaction();
+    EXPECT_EQ(signal1.Read(transactionRead).get<int>(), 100);
+
+    // Write more values than the initial history depth (default 16); the history is extended for the read transaction.
+    for (int i = 0; i < 40; i++)
+    {
+        sdv::core::CTransaction transactionWrite = dispatch.CreateTransaction();
+        signal2.Write(200 + i, transactionWrite);
+        transactionWrite.Finish();
+    }
+    EXPECT_EQ(signal1.Read().get<int>(), 239);
+    EXPECT_EQ(signal1.Read(transactionRead).get<int>(), 100);
+    EXPECT_FALSE(transactionRead.IsSnapshotTooOld());
+    sdv::core::SSignalHistoryStatistics sStatistics = pStatistics->GetHistoryStatistics();
+    EXPECT_GT(sStatistics.uiHistoryExtensions, sStatisticsStart.uiHistoryExtensions);
+    EXPECT_EQ(sStatistics.uiHistoryLimitHits, sStatisticsStart.uiHistoryLimitHits);
+    EXPECT_EQ(sStatistics.uiSnapshotReads, sStatisticsStart.uiSnapshotReads + 2);
+
+    // Write more values than the maximum history depth (default 64); the snapshot is too old
+    for (int i = 0; i < 100; i++)
+    {
+        sdv::core::CTransaction transactionWrite = dispatch.CreateTransaction();
+        signal2.Write(300 + i, transactionWrite);
+        transactionWrite.Finish();
+    }
+    EXPECT_NE(signal1.Read(transactionRead).get<int>(), 100);
+    EXPECT_TRUE(transactionRead.IsSnapshotTooOld());
+    sStatistics = pStatistics->GetHistoryStatistics();
+    EXPECT_GT(sStatistics.uiHistoryLimitHits, sStatisticsStart.uiHistoryLimitHits);
+    EXPECT_EQ(sStatistics.uiSnapshotTooOld, sStatisticsStart.uiSnapshotTooOld + 1);
+    transactionRead.Finish();
+
+    // Without read transaction, the history is not extended any more
+    sStatisticsStart = pStatistics->GetHistoryStatistics();
+    for (int i = 0; i < 100; i++)
+    {
+        sdv::core::CTransaction transactionWrite = dispatch.CreateTransaction();
+        signal2.Write(400 + i, transactionWrite);
+        transactionWrite.Finish();
+    }
+    EXPECT_EQ(signal1.Read().get<int>(), 499);
+    sStatistics = pStatistics->GetHistoryStatistics();
+    EXPECT_EQ(sStatistics.uiHistoryExtensions, sStatisticsStart.uiHistoryExtensions);
+    EXPECT_EQ(sStatistics.uiHistoryLimitHits, sStatisticsStart.uiHistoryLimitHits);
+
+    appcontrol.SetConfigMode();
+    signal1.Reset();
+    signal2.Reset();
+
+    appcontrol.Shutdown();
+}
+
@@ -631,6 +631,80 @@ TEST(DataDispatchServiceTest, PeriodicTriggerOnlyActive)
     appcontrol.Shutdown();
 }
 
+TEST(DataDispatchServiceTest, PeriodicTriggerOnlyActiveRepetitions)
+{
+    sdv::app::CAppControl appcontrol;
+    bool bResult = appcontrol.Startup("");
+    EXPECT_TRUE(bResult);
+    appcontrol.SetConfigMode();
+    sdv::core::EConfigProcessResult eResult = appcontrol.LoadConfig("test_dds_config.toml");
+    EXPECT_EQ(eResult, sdv::core::EConfigProcessResult::successful);
+
+    // Register the signals
+    sdv::core::CDispatchService dispatch;
+    sdv::core::CSignal signal1 = dispatch.RegisterTxSignal("abc", 10);
+    EXPECT_TRUE(signal1);
+    sdv::core::CSignal signal2 = dispatch.RegisterTxSignal("def", 20);
+    EXPECT_TRUE(signal2);
+
+    // Add publisher for the signals
+    sdv::core::CSignal signal3 = dispatch.AddPublisher("abc");
+    EXPECT_TRUE(signal3);
+    sdv::core::CSignal signal4 = dispatch.AddPublisher("def");
+    EXPECT_TRUE(signal4);
+
+    // Create a trigger sending three times after becoming inactive and a trigger stopping immediately.
+    std::atomic_size_t nTriggerCnt1 = 0;
+    sdv::core::CTrigger trigger1 = dispatch.CreateTxTrigger([&] { nTriggerCnt1++; }, false, 0, 100, true);
+    EXPECT_TRUE(trigger1);
+    trigger1.SetInactiveRepetitions(3);
+    trigger1.AddSignal(signal1);
+    trigger1.AddSignal(signal2);
+    std::atomic_size_t nTriggerCnt2 = 0;
+    sdv::core::CTrigger trigger2 = dispatch.CreateTxTrigger([&] { nTriggerCnt2++; }, false, 0, 100, true);
+    EXPECT_TRUE(trigger2);
+    trigger2.SetInactiveRepetitions(0);
+    trigger2.AddSignal(signal1);
+    trigger2.AddSignal(signal2);
+    appcontrol.SetRunningMode();
+
+    // Activate one signal
+    signal3.Write(100);
+
+    // Sleep for 220 ms
+    std::this_thread::sleep_for(std::chrono::milliseconds(220));
+    EXPECT_GT(nTriggerCnt1, 0u);
+    EXPECT_GT(nTriggerCnt2, 0u);
+
+    // Activate the other signal and deactivate the first; the trigger stays active.
+    signal4.Write(200);
+    signal3.Write(10);
+    size_t nTriggerCntTemp1 = nTriggerCnt1;
+    std::this_thread::sleep_for(std::chrono::milliseconds(220));
+    EXPECT_GT(nTriggerCnt1, nTriggerCntTemp1);
+
+    // Back to default value
+    nTriggerCntTemp1 = nTriggerCnt1;
+    size_t nTriggerCntTemp2 = nTriggerCnt2;
+    signal4.Write(20);
+
+    // Sleep for 700 ms
+    std::this_thread::sleep_for(std::chrono::milliseconds(700));
+    EXPECT_EQ(nTriggerCnt1, nTriggerCntTemp1 + 3);
+    EXPECT_EQ(nTriggerCnt2, nTriggerCntTemp2);
+
+    appcontrol.SetConfigMode();
+    trigger1.Reset();
+    trigger2.Reset();
+
+    signal1.Reset();
+    signal2.Reset();
+    signal3.Reset();
+    signal4.Reset();
+
+    appcontrol.Shutdown();
+}
+
 TEST(DataDispatchServiceTest, SpontaneousAndPeriodicTrigger)
 {
     sdv::app::CAppControl appcontrol;
@@ -278,3 +278,167 @@ TEST(TaskTimerTest, MultiTaskTest)
 
     appcontrol.Shutdown();
 }
+
+TEST(TaskTimerTest, ExtendedTimerStatistics)
+{
+    sdv::app::CAppControl appcontrol;
+    bool bResult = appcontrol.Startup("");
+    EXPECT_TRUE(bResult);
+    appcontrol.SetConfigMode();
+    sdv::core::EConfigProcessResult eResult = appcontrol.LoadConfig("test_tt_config.toml");
+    EXPECT_EQ(eResult, sdv::core::EConfigProcessResult::successful);
+
+    CTestTask task;
+
+    sdv::core::STimerConfig sConfig;
+    sConfig.uiPeriodUs = 2500;
+    sConfig.ePolicy = sdv::core::EOverrunPolicy::skip;
+    sdv::core::CTaskTimer timer(sConfig, [&]() {task.Execute(); });
+    EXPECT_TRUE(timer);
+    appcontrol.SetRunningMode();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    sdv::core::STimerStatistics sStatistics = timer.GetStatistics();
+    timer.Reset();
+
+    EXPECT_LE(sStatistics.uiExecutions, task.counter);
+    EXPECT_GT(sStatistics.uiExecutions, 100ull);
+    EXPECT_LE(sStatistics.uiExecutions, 200ull);
+    EXPECT_LE(sStatistics.uiPeriodMinUs, sStatistics.uiPeriodAvgUs);
+    EXPECT_LE(sStatistics.uiPeriodAvgUs, sStatistics.uiPeriodMaxUs);
+    EXPECT_LE(sStatistics.uiExecutionMinUs, sStatistics.uiExecutionAvgUs);
+    EXPECT_LE(sStatistics.uiExecutionAvgUs, sStatistics.uiExecutionMaxUs);
+
+    // NOTE: If running in a virtual environment, the constraints cannot be kept.
+    if (sStatistics.uiPeriodAvgUs < 2400 || sStatistics.uiPeriodAvgUs > 2600)
+        std::cout << __FILE__ << ":" << __LINE__ << ":" << "Warning" << std::endl <<
+        "Expected: 2400 <= (sStatistics.uiPeriodAvgUs) <= 2600, actual: " << sStatistics.uiPeriodAvgUs << std::endl;
+
+    appcontrol.Shutdown();
+}
+
+TEST(TaskTimerTest, ExtendedTimerOverrunPolicy)
+{
+    sdv::app::CAppControl appcontrol;
+    bool bResult = appcontrol.Startup("");
+    EXPECT_TRUE(bResult);
+    appcontrol.SetConfigMode();
+    sdv::core::EConfigProcessResult eResult = appcontrol.LoadConfig("test_tt_config.toml");
+    EXPECT_EQ(eResult, sdv::core::EConfigProcessResult::successful);
+
+    // Every execution takes 2.5 periods.
+    std::atomic<uint64_t> rguiMissed[3] = {};
+    sdv::core::CTaskTimer rgtimer[3];
+    sdv::core::EOverrunPolicy rgePolicies[3] = { sdv::core::EOverrunPolicy::skip, sdv::core::EOverrunPolicy::queue,
+        sdv::core::EOverrunPolicy::catch_up };
+    for (size_t n = 0; n < 3; n++)
+    {
+        sdv::core::STimerConfig sConfig;
+        sConfig.uiPeriodUs = 10000;
+        sConfig.ePolicy = rgePolicies[n];
+        rgtimer[n] = sdv::core::CTaskTimer(sConfig, []() { std::this_thread::sleep_for(std::chrono::microseconds(25000)); },
+            [&rguiMissed, n](uint64_t) { rguiMissed[n]++; });
+        EXPECT_TRUE(rgtimer[n]);
+    }
+    appcontrol.SetRunningMode();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    sdv::core::STimerStatistics rgsStatistics[3];
+    for (size_t n = 0; n < 3; n++)
+        rgsStatistics[n] = rgtimer[n].GetStatistics();
+    for (size_t n = 0; n < 3; n++)
+        rgtimer[n].Reset();
+
+    // Skip: every execution misses its deadline; the ticks passed during the execution are dropped.
+    EXPECT_GT(rgsStatistics[0].uiOverruns, 0ull);
+    EXPECT_GT(rgsStatistics[0].uiSkippedTicks, rgsStatistics[0].uiExecutions);
+    EXPECT_GE(rguiMissed[0], rgsStatistics[0].uiOverruns);
+
+    // Queue: one passed tick is executed directly; the others are dropped.
+    EXPECT_GT(rgsStatistics[1].uiOverruns, 0ull);
+    EXPECT_GT(rgsStatistics[1].uiSkippedTicks, 0ull);
+    EXPECT_GE(rguiMissed[1], rgsStatistics[1].uiOverruns);
+
+    // Catch-up: no ticks are dropped.
+    EXPECT_GT(rgsStatistics[2].uiOverruns, 0ull);
+    EXPECT_EQ(rgsStatistics[2].uiSkippedTicks, 0ull);
+    EXPECT_GE(rguiMissed[2], rgsStatistics[2].uiOverruns);
+
+    appcontrol.Shutdown();
+}
+
+TEST(TaskTimerTest, ExecuteInRunningModeOnly)
+{
+    sdv::app::CAppControl appcontrol;
+    bool bResult = appcontrol.Startup("");
+    EXPECT_TRUE(bResult);
+    appcontrol.SetConfigMode();
+    sdv::core::EConfigProcessResult eResult = appcontrol.LoadConfig("test_tt_config.toml");
+    EXPECT_EQ(eResult, sdv::core::EConfigProcessResult::successful);
+
+    CTestTask task;
+
+    sdv::core::CTaskTimer timer(50, &task);
+    EXPECT_TRUE(timer);
+
+    // The ticks are dropped while in configuration mode.
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(0ull, task.counter);
+
+    appcontrol.SetRunningMode();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300 + TimeTolerance));
+
+    timer.Reset();
+
+    EXPECT_GT(task.counter, 0ull);
+
+    appcontrol.Shutdown();
+}
+
+//test object which destroys its own timer from within the execution
+class CSelfDestroyTask : public sdv::core::ITaskExecute, public sdv::IInterfaceAccess
+{
+public:
+    BEGIN_SDV_INTERFACE_MAP()
+        SDV_INTERFACE_ENTRY(sdv::IInterfaceAccess)
+        SDV_INTERFACE_ENTRY(sdv::core::ITaskExecute)
+    END_SDV_INTERFACE_MAP()
+
+    virtual void Execute() override
+    {
+        if (++counter != 3) return;
+        sdv::IObjectDestroy* pDestroy = pTimer ? pTimer.load()->GetInterface<sdv::IObjectDestroy>() : nullptr;
+        if (pDestroy) pDestroy->DestroyObject();
+    }
+
+    std::atomic<sdv::IInterfaceAccess*> pTimer = nullptr;
+    std::atomic<uint64_t> counter = 0ull;
+};
+
+TEST(TaskTimerTest, DestroyFromTask)
+{
+    sdv::app::CAppControl appcontrol;
+    bool bResult = appcontrol.Startup("");
+    EXPECT_TRUE(bResult);
+    appcontrol.SetConfigMode();
+    sdv::core::EConfigProcessResult eResult = appcontrol.LoadConfig("test_tt_config.toml");
+    EXPECT_EQ(eResult, sdv::core::EConfigProcessResult::successful);
+
+    sdv::core::ITaskTimer* pTimerSvc = sdv::core::GetObject<sdv::core::ITaskTimer>("TaskTimerService");
+    ASSERT_NE(pTimerSvc, nullptr);
+
+    CSelfDestroyTask task;
+    task.pTimer = pTimerSvc->CreateTimer(50, &task);
+    EXPECT_NE(task.pTimer.load(), nullptr);
+    appcontrol.SetRunningMode();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500 + TimeTolerance));
+
+    // The timer was destroyed during the third execution.
+    EXPECT_EQ(3ull, task.counter);
+
+    appcontrol.Shutdown();
+}
@@ -29,7 +29,7 @@ public:
     {
         std::cout << "SetUpTestCase()" << std::endl;
 
-        std::vector<std::string> subFolders = { "generated0", "generated1", "generated2" };
+        std::vector<std::string> subFolders = { "generated0", "generated1", "generated2", "generated3" };
         for (auto subFolder : subFolders)
         {
             auto generatedPath = GetExecDirectory() / subFolder;
@@ -214,12 +214,19 @@ inline int ExecuteCommand(const std::string& rssCommand, const TArgs&... rgtArgs
 #endif
 }
 
-int CreateCode(const std::string& document, const std::string& subfolder, const bool bCreateComponents)
+int CreateCode(const std::string& document, const std::string& subfolder, const bool bCreateComponents, const bool bFusedSignalPath = false)
 {
     auto vssUtility = (GetExecDirectory() / "../../bin/sdv_vss_util").lexically_normal();
     auto documentPath = (GetExecDirectory() / "../../bin" / document).lexically_normal();
     auto outputFolder = (GetExecDirectory() / subfolder).lexically_normal();
 
+    if (bCreateComponents && bFusedSignalPath)
+    {
+        return ExecuteCommand(vssUtility.generic_string(), documentPath.generic_string(), std::string("-O") + outputFolder.generic_string(),
+            std::string("--enable_components"), std::string("--fused_signal_path"), std::string("--prefixdemo"),
+            std::string("--version1.2.3.4"), std::string("--silent"));
+    }
+
     // VSS_Sheet_Single.csv -O${VSSUTIL_OUTPUT_DIRECTORY}/generated/  --version1.0.0.2  --prefixdemo  --enable_components
     if (bCreateComponents)
     {
@@ -347,6 +354,59 @@ TEST_F(VSSUtilTest, ValidateGeneratedFilesCombinedSignalNames)
     EXPECT_EQ(allFilesCount, expected + (2 * signals));
 }
 
+std::string ReadGeneratedFile(const std::filesystem::path& filePath)
+{
+    std::ifstream fstream(filePath);
+    std::stringstream sstream;
+    sstream << fstream.rdbuf();
+    return sstream.str();
+}
+
+TEST_F(VSSUtilTest, ValidateGeneratedFilesFusedSignalPath)
+{
+    EXPECT_EQ(0, CreateCode("vss_unique_names.csv", "generated3", true, true));
+
+    std::filesystem::path allFilesPath = GetExecDirectory() / "generated3";
+    std::filesystem::path vssFilePath = allFilesPath / "vss_files";
+    std::filesystem::path benchmarkPath = vssFilePath / "latency_benchmark";
+
+    EXPECT_TRUE(std::filesystem::exists(vssFilePath / "summary.txt"));
+    EXPECT_TRUE(std::filesystem::exists(vssFilePath / "signal_identifier.h"));
+    EXPECT_TRUE(std::filesystem::exists(benchmarkPath / "latency_benchmark.cpp"));
+    EXPECT_TRUE(std::filesystem::exists(benchmarkPath / "latency_benchmark_dds.toml"));
+    EXPECT_TRUE(std::filesystem::exists(benchmarkPath / "latency_benchmark_vd_bs.toml"));
+    EXPECT_TRUE(std::filesystem::exists(benchmarkPath / "CMakeLists.txt"));
+
+    // The RX components distribute the values without a callback mutex
+    for (const auto& rxFile : { vssFilePath / "vd_steeringwheel" / "vd_steeringwheel.h", vssFilePath / "bs_steeringwheel" / "bs_steeringwheel.h" })
+    {
+        std::string content = ReadGeneratedFile(rxFile);
+        EXPECT_NE(content.find("sdv::core::CCallbackArray<"), std::string::npos) << rxFile;
+        EXPECT_EQ(content.find("MutexCallbacks"), std::string::npos) << rxFile;
+    }
+
+    // The basic service protects the stored value
+    std::string bsHeader = ReadGeneratedFile(vssFilePath / "bs_steeringwheel" / "bs_steeringwheel.h");
+    EXPECT_NE(bsHeader.find("MutexValue"), std::string::npos);
+
+    // The benchmark measures every RX basic service
+    std::string benchmark = ReadGeneratedFile(benchmarkPath / "latency_benchmark.cpp");
+    EXPECT_NE(benchmark.find("Vehicle.ChassisBS.SteeringWheel.Angle_Service"), std::string::npos);
+    EXPECT_NE(benchmark.find("Vehicle.ChassisBS.Vehicle.Speed_Service"), std::string::npos);
+
+    // Same files as without the fused signal path + 4 files of the latency benchmark
+    std::uintmax_t allFilesCount = CountNumberOfFiles(allFilesPath);
+    uint32_t signals = 4;
+    uint32_t expected = 2 * signals + 2 * signals + 2 * signals + (2 * signals) + 2 + 4;
+    EXPECT_EQ(allFilesCount, expected);
+
+    EXPECT_EQ(0, CompileIDLFiles(allFilesPath));
+
+    DeletePSAndSerdesFolder(vssFilePath); // created by the idl compiler
+    allFilesCount = CountNumberOfFiles(allFilesPath);
+    EXPECT_EQ(allFilesCount, expected + (2 * signals));
+}
+
 extern "C" int main(int argc, char* argv[])
 {
     CProcessWatchdog watchdog;
@@ -523,3 +523,46 @@ TEST(CAscReaderTest, CAN_FD)
     EXPECT_EQ(prSample.first.rguiData[8], 0x00);
 }
 
+
+TEST(CAscReaderTest, PlaybackAsFastAsPossible)
+{
+    asc::CAscReader reader;
+    EXPECT_TRUE(reader.Read(GetExecDirectory() / "asc_reader_test.asc"));
+    reader.SetPlaybackSpeed(0.0);
+    EXPECT_EQ(reader.GetPlaybackSpeed(), 0.0);
+
+    // The recording takes more than 3 seconds; without waiting the playback finishes almost immediately.
+    std::atomic<uint32_t> uiCount = 0;
+    auto tpStart = std::chrono::steady_clock::now();
+    reader.StartPlayback([&](const asc::SCanMessage&) { uiCount++; }, false);
+    while (reader.PlaybackRunning() && std::chrono::steady_clock::now() - tpStart < std::chrono::milliseconds(1000))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_FALSE(reader.PlaybackRunning());
+    reader.StopPlayback();
+    EXPECT_EQ(uiCount, reader.GetMessageCount());
+    EXPECT_TRUE(reader.IsEOF());
+}
+
+TEST(CAscReaderTest, PlaybackSpeedFactor)
+{
+    asc::CAscReader reader;
+    EXPECT_TRUE(reader.Read(GetExecDirectory() / "asc_reader_timing_test.asc"));
+    reader.SetPlaybackSpeed(2.0);
+    EXPECT_EQ(reader.GetPlaybackSpeed(), 2.0);
+
+    // The last sample is recorded at 310ms; with double speed, it is sent after 155ms.
+    std::vector<std::pair<double, double>> vecTimes;
+    auto tpStart = std::chrono::steady_clock::now();
+    reader.StartPlayback([&](const asc::SCanMessage& rsMsg)
+        {
+            vecTimes.emplace_back(rsMsg.dTimestamp, std::chrono::duration<double>(std::chrono::steady_clock::now() - tpStart).count());
+        }, false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    EXPECT_FALSE(reader.PlaybackRunning());
+    reader.StopPlayback();
+    ASSERT_EQ(vecTimes.size(), static_cast<size_t>(reader.GetMessageCount()));
+    for (const auto& rprTime : vecTimes)
+        EXPECT_GE(rprTime.second, rprTime.first / 2.0);
+    std::cout << "The last sample (" << vecTimes.back().first << "s) was sent after " << vecTimes.back().second <<
+        "s (should be somewhat more than 0.155s)" << std::endl;
+}
@@ -211,6 +211,7 @@ TEST(CAscWriterTest, CAN_FD)
     // Read the samples
     asc::CAscReader readerGenerate;
     EXPECT_TRUE(readerGenerate.Read(GetExecDirectory() / "asc_writer_test.asc"));
+    EXPECT_EQ(readerGenerate.GetMessageCount(), readerGroundThruth.GetMessageCount());
 
     // Check whether the samples correspond to the original samples
     readerGroundThruth.JumpBegin();
@@ -235,3 +236,54 @@ TEST(CAscWriterTest, CAN_FD)
     }
 }
 
+TEST(CAscWriterTest, CAN_FD_RoundTrip)
+{
+    // CAN-FD samples with every valid length (DLC 0..15) on channels with more than one digit, mixed with CAN samples.
+    const uint32_t rguiDLCLength[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64 };
+    std::vector<asc::SCanMessage> vecSamples;
+    for (uint32_t uiDLC = 0; uiDLC < 16; uiDLC++)
+    {
+        asc::SCanMessage sMsg{};
+        sMsg.dTimestamp = (2 * uiDLC + 1) / 1000.0;
+        sMsg.uiChannel = 10 + uiDLC;
+        sMsg.uiId = 0x1AB + uiDLC;
+        sMsg.bExtended = (uiDLC & 1) != 0;
+        sMsg.bCanFd = true;
+        sMsg.eDirection = (uiDLC & 2) ? asc::SCanMessage::EDirection::tx : asc::SCanMessage::EDirection::rx;
+        sMsg.uiLength = rguiDLCLength[uiDLC];
+        for (uint32_t uiIndex = 0; uiIndex < sMsg.uiLength; uiIndex++)
+            sMsg.rguiData[uiIndex] = static_cast<uint8_t>(0xF0 + uiIndex);
+        vecSamples.push_back(sMsg);
+
+        sMsg.dTimestamp = (2 * uiDLC + 2) / 1000.0;
+        sMsg.bCanFd = false;
+        sMsg.uiLength = std::min<uint32_t>(sMsg.uiLength, 8);
+        vecSamples.push_back(sMsg);
+    }
+
+    asc::CAscWriter writer;
+    for (const asc::SCanMessage& rsMsg : vecSamples)
+        writer.AddSample(rsMsg);
+    EXPECT_TRUE(writer.Write(GetExecDirectory() / "asc_writer_canfd_test.asc"));
+
+    asc::CAscReader reader;
+    EXPECT_TRUE(reader.Read(GetExecDirectory() / "asc_writer_canfd_test.asc"));
+    ASSERT_EQ(reader.GetMessageCount(), vecSamples.size());
+    for (const asc::SCanMessage& rsMsg : vecSamples)
+    {
+        auto prSample = reader.Get();
+        ASSERT_TRUE(prSample.second);
+        EXPECT_EQ(prSample.first.dTimestamp, rsMsg.dTimestamp);
+        EXPECT_EQ(prSample.first.uiChannel, rsMsg.uiChannel);
+        EXPECT_EQ(prSample.first.uiId, rsMsg.uiId);
+        EXPECT_EQ(prSample.first.bExtended, rsMsg.bExtended);
+        EXPECT_EQ(prSample.first.bCanFd, rsMsg.bCanFd);
+        EXPECT_EQ(prSample.first.eDirection, rsMsg.eDirection);
+        ASSERT_EQ(prSample.first.uiLength, rsMsg.uiLength);
+        for (uint32_t uiIndex = 0; uiIndex < rsMsg.uiLength; uiIndex++)
+            EXPECT_EQ(prSample.first.rguiData[uiIndex], rsMsg.rguiData[uiIndex]);
+        ++reader;
+    }
+
+    std::filesystem::remove(GetExecDirectory() / "asc_writer_canfd_test.asc");
+}
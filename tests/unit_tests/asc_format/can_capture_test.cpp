@@ -0,0 +1,238 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "../../include/gtest_custom.h"
+#include "../../../global/ascformat/cancapture.h"
+#include "../../../global/ascformat/ascwriter.h"
+#include <iostream>
+#include "../../../global/exec_dir_helper.h"
+
+/**
+ * @brief Compare two CAN messages.
+ * @param[in] rsMsg1 Reference to the first message.
+ * @param[in] rsMsg2 Reference to the second message.
+ */
+inline void CompareMessages(const asc::SCanMessage& rsMsg1, const asc::SCanMessage& rsMsg2)
+{
+    EXPECT_EQ(rsMsg1.dTimestamp, rsMsg2.dTimestamp);
+    EXPECT_EQ(rsMsg1.uiChannel, rsMsg2.uiChannel);
+    EXPECT_EQ(rsMsg1.uiId, rsMsg2.uiId);
+    EXPECT_EQ(rsMsg1.bExtended, rsMsg2.bExtended);
+    EXPECT_EQ(rsMsg1.bCanFd, rsMsg2.bCanFd);
+    EXPECT_EQ(rsMsg1.eDirection, rsMsg2.eDirection);
+    ASSERT_EQ(rsMsg1.uiLength, rsMsg2.uiLength);
+    for (uint32_t uiIndex = 0; uiIndex < rsMsg1.uiLength; uiIndex++)
+        EXPECT_EQ(rsMsg1.rguiData[uiIndex], rsMsg2.rguiData[uiIndex]);
+}
+
+TEST(CCaptureTest, LZCompression)
+{
+    // Repetitive data with some variation
+    std::string ssRaw;
+    for (size_t n = 0; n < 10000; n++)
+        ssRaw += "ID=" + std::to_string(n % 17) + ";" + std::string(n % 5, static_cast<char>('a' + n % 3));
+    std::string ssCompressed, ssDecompressed;
+    asc::capture::CompressLZ(ssRaw.data(), ssRaw.size(), ssCompressed);
+    EXPECT_LT(ssCompressed.size(), ssRaw.size() / 4);
+    EXPECT_TRUE(asc::capture::DecompressLZ(ssCompressed.data(), ssCompressed.size(), ssRaw.size(), ssDecompressed));
+    EXPECT_EQ(ssRaw, ssDecompressed);
+
+    // Small and empty data
+    for (const std::string& rssSmall : { std::string(), std::string("a"), std::string("abcdabcd") })
+    {
+        asc::capture::CompressLZ(rssSmall.data(), rssSmall.size(), ssCompressed);
+        EXPECT_TRUE(asc::capture::DecompressLZ(ssCompressed.data(), ssCompressed.size(), rssSmall.size(), ssDecompressed));
+        EXPECT_EQ(rssSmall, ssDecompressed);
+    }
+
+    // Corrupt data must be detected
+    asc::capture::CompressLZ(ssRaw.data(), ssRaw.size(), ssCompressed);
+    EXPECT_FALSE(asc::capture::DecompressLZ(ssCompressed.data(), ssCompressed.size() / 2, ssRaw.size(), ssDecompressed));
+}
+
+TEST(CCaptureTest, WriteReadAsc)
+{
+    // Convert the ASC file to the capture format
+    asc::CAscReader readerAsc;
+    EXPECT_TRUE(readerAsc.Read(GetExecDirectory() / "asc_reader_test.asc"));
+    std::filesystem::path pathCapture = GetExecDirectory() / "can_capture_test.cancap";
+    {
+        asc::CCaptureWriter writer;
+        EXPECT_TRUE(writer.Open(pathCapture, 256));
+        for (readerAsc.JumpBegin(); !readerAsc.IsEOF(); ++readerAsc)
+            writer.Add(readerAsc.Get().first);
+        EXPECT_EQ(writer.GetFrameCount(), readerAsc.GetMessageCount());
+        EXPECT_TRUE(writer.Close());
+    }
+    EXPECT_TRUE(asc::CCaptureReader::IsCaptureFile(pathCapture));
+    EXPECT_FALSE(asc::CCaptureReader::IsCaptureFile(GetExecDirectory() / "asc_reader_test.asc"));
+    EXPECT_LT(std::filesystem::file_size(pathCapture), std::filesystem::file_size(GetExecDirectory() / "asc_reader_test.asc") / 3);
+
+    // Read the capture file through the ASC reader; all messages must be identical.
+    asc::CAscReader readerCapture;
+    EXPECT_TRUE(readerCapture.Read(pathCapture));
+    EXPECT_EQ(readerCapture.GetMessageCount(), readerAsc.GetMessageCount());
+    for (readerAsc.JumpBegin(), readerCapture.JumpBegin(); !readerAsc.IsEOF() && !readerCapture.IsEOF(); ++readerAsc, ++readerCapture)
+        CompareMessages(readerAsc.Get().first, readerCapture.Get().first);
+    EXPECT_TRUE(readerAsc.IsEOF());
+    EXPECT_TRUE(readerCapture.IsEOF());
+
+    std::filesystem::remove(pathCapture);
+}
+
+TEST(CCaptureTest, Index)
+{
+    asc::CAscReader readerAsc;
+    EXPECT_TRUE(readerAsc.Read(GetExecDirectory() / "asc_reader_canfd_test.asc"));
+    std::filesystem::path pathCapture = GetExecDirectory() / "can_capture_index_test.cancap";
+    {
+        asc::CCaptureWriter writer;
+        EXPECT_TRUE(writer.Open(pathCapture, 2));
+        for (readerAsc.JumpBegin(); !readerAsc.IsEOF(); ++readerAsc)
+            writer.Add(readerAsc.Get().first);
+        EXPECT_TRUE(writer.Close());
+    }
+
+    asc::CCaptureReader reader;
+    ASSERT_TRUE(reader.Open(pathCapture));
+    EXPECT_EQ(reader.GetFrameCount(), 4u);
+    ASSERT_EQ(reader.GetBlocks().size(), 2u);
+    EXPECT_EQ(reader.GetBlocks()[0].dFirstTimestamp, 3.35516);
+    EXPECT_EQ(reader.GetBlocks()[0].dLastTimestamp, 3.35522);
+    EXPECT_EQ(reader.GetBlocks()[1].dFirstTimestamp, 3.36716);
+    EXPECT_EQ(reader.GetBlocks()[1].dLastTimestamp, 3.36722);
+
+    // Seek
+    EXPECT_EQ(reader.FindBlock(0.0), 0u);
+    EXPECT_EQ(reader.FindBlock(3.36), 1u);
+    EXPECT_EQ(reader.FindBlock(3.36722), 1u);
+    EXPECT_EQ(reader.FindBlock(4.0), 2u);
+    std::vector<asc::SCanMessage> vecFrames;
+    EXPECT_TRUE(reader.ReadBlock(1, vecFrames));
+    ASSERT_EQ(vecFrames.size(), 2u);
+    EXPECT_EQ(vecFrames[1].uiChannel, 15u);
+    EXPECT_TRUE(vecFrames[1].bCanFd);
+    EXPECT_FALSE(reader.ReadBlock(2, vecFrames));
+
+    // Channel/ID index: B4323x on channel 1 occurs in both blocks, 52 on channel 6 in the first and 86 on channel 15 in the last.
+    ASSERT_EQ(reader.GetIds().size(), 3u);
+    for (const asc::SCaptureIdInfo& rsId : reader.GetIds())
+    {
+        if (rsId.uiChannel == 1)
+        {
+            EXPECT_EQ(rsId.uiId, 0xB4323u);
+            EXPECT_TRUE(rsId.bExtended);
+            EXPECT_EQ(rsId.uiFrames, 2u);
+            EXPECT_EQ(rsId.vecBlocks, std::vector<uint32_t>({ 0, 1 }));
+        }
+        else if (rsId.uiChannel == 6)
+        {
+            EXPECT_EQ(rsId.uiId, 0x52u);
+            EXPECT_EQ(rsId.vecBlocks, std::vector<uint32_t>({ 0 }));
+        }
+        else
+        {
+            EXPECT_EQ(rsId.uiChannel, 15u);
+            EXPECT_EQ(rsId.uiId, 0x86u);
+            EXPECT_EQ(rsId.vecBlocks, std::vector<uint32_t>({ 1 }));
+        }
+    }
+    reader.Close();
+
+    std::filesystem::remove(pathCapture);
+}
+
+TEST(CCaptureTest, JumpTimestamp)
+{
+    asc::CAscReader reader;
+    EXPECT_TRUE(reader.Read(GetExecDirectory() / "asc_reader_canfd_test.asc"));
+    EXPECT_TRUE(reader.JumpTimestamp(3.36));
+    EXPECT_EQ(reader.Get().first.dTimestamp, 3.36716);
+    EXPECT_TRUE(reader.JumpTimestamp(3.35522));
+    EXPECT_EQ(reader.Get().first.dTimestamp, 3.35522);
+    EXPECT_TRUE(reader.JumpTimestamp(0.0));
+    EXPECT_TRUE(reader.IsBOF());
+    EXPECT_FALSE(reader.JumpTimestamp(10.0));
+    EXPECT_TRUE(reader.IsEOF());
+}
+
+TEST(CCaptureTest, JumpTimestampCapture)
+{
+    // Small blocks; the jumps and the navigation cross the block boundaries.
+    asc::CAscReader readerAsc;
+    EXPECT_TRUE(readerAsc.Read(GetExecDirectory() / "asc_reader_test.asc"));
+    std::filesystem::path pathCapture = GetExecDirectory() / "can_capture_jump_test.cancap";
+    {
+        asc::CCaptureWriter writer;
+        EXPECT_TRUE(writer.Open(pathCapture, 3));
+        for (readerAsc.JumpBegin(); !readerAsc.IsEOF(); ++readerAsc)
+            writer.Add(readerAsc.Get().first);
+        EXPECT_TRUE(writer.Close());
+    }
+
+    asc::CAscReader readerCapture;
+    EXPECT_TRUE(readerCapture.Read(pathCapture));
+    ASSERT_EQ(readerCapture.GetMessageCount(), readerAsc.GetMessageCount());
+
+    // Jump to the timestamp of every message and in between the messages.
+    std::vector<double> vecTimestamps;
+    for (readerAsc.JumpBegin(); !readerAsc.IsEOF(); ++readerAsc)
+        vecTimestamps.push_back(readerAsc.Get().first.dTimestamp);
+    for (size_t nIndex = vecTimestamps.size(); nIndex > 0; nIndex--)
+    {
+        for (double dTimestamp : { vecTimestamps[nIndex - 1], vecTimestamps[nIndex - 1] - 0.000001 })
+        {
+            EXPECT_EQ(readerCapture.JumpTimestamp(dTimestamp), readerAsc.JumpTimestamp(dTimestamp));
+            CompareMessages(readerCapture.Get().first, readerAsc.Get().first);
+        }
+
+        // Navigate back into the previous block
+        --readerCapture;
+        --readerAsc;
+        CompareMessages(readerCapture.Get().first, readerAsc.Get().first);
+    }
+    EXPECT_FALSE(readerCapture.JumpTimestamp(vecTimestamps.back() + 1.0));
+    EXPECT_TRUE(readerCapture.IsEOF());
+    EXPECT_FALSE(readerCapture.Get().second);
+
+    std::filesystem::remove(pathCapture);
+}
+
+TEST(CCaptureTest, AscWriterCaptureFormat)
+{
+    asc::CAscWriter writer;
+    asc::SCanMessage sMsg{};
+    sMsg.dTimestamp = 0.5;
+    sMsg.uiChannel = 2;
+    sMsg.uiId = 0x123;
+    sMsg.uiLength = 3;
+    sMsg.rguiData[0] = 1;
+    sMsg.rguiData[1] = 2;
+    sMsg.rguiData[2] = 3;
+    writer.AddSample(sMsg);
+    sMsg.dTimestamp = 0.75;
+    sMsg.eDirection = asc::SCanMessage::EDirection::tx;
+    writer.AddSample(sMsg);
+
+    std::filesystem::path pathCapture = GetExecDirectory() / "can_capture_writer_test.cancap";
+    EXPECT_TRUE(writer.Write(pathCapture));
+    EXPECT_TRUE(asc::CCaptureReader::IsCaptureFile(pathCapture));
+
+    asc::CAscReader reader;
+    EXPECT_TRUE(reader.Read(pathCapture));
+    ASSERT_EQ(reader.GetMessageCount(), 2u);
+    ++reader;
+    CompareMessages(reader.Get().first, sMsg);
+
+    std::filesystem::remove(pathCapture);
+}
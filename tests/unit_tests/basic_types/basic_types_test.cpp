@@ -36,8 +36,14 @@ void CBasicTypesTestAllocator::ResetPtrSet()
     m_setPointers.clear();
 }
 
+size_t CBasicTypesTestAllocator::GetAllocCount() const
+{
+    return m_nAllocCount;
+}
+
 void* CBasicTypesTestAllocator::Alloc(size_t nSize)
 {
+    m_nAllocCount++;
     void* p = CLocalMemMgr::Alloc(nSize);
     m_setPointers.insert(p);
     return p;
@@ -45,6 +51,7 @@ void* CBasicTypesTestAllocator::Alloc(size_t nSize)
 
 void* CBasicTypesTestAllocator::Realloc(void* pData, size_t nSize)
 {
+    m_nAllocCount++;
     m_setPointers.erase(pData);
     void* p = CLocalMemMgr::Realloc(pData, nSize);
     m_setPointers.insert(p);
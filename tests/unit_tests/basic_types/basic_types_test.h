@@ -32,6 +32,12 @@ public:
     */
     void ResetPtrSet();
 
+    /**
+    * @brief Get the amount of allocations since the start (including allocations that were freed again).
+    * @return The amount of allocations.
+    */
+    size_t GetAllocCount() const;
+
 private:
     /**
     * @brief Allocate memory. Overload of sdv::internal::IInternalMemAlloc::Alloc.
@@ -55,6 +61,7 @@ private:
     virtual void Free(void* pData) override;
 
     std::set<void*> m_setPointers;      ///< Pointer set for pointer tracking.
+    size_t          m_nAllocCount = 0;  ///< Amount of allocations.
 };
 
 /**
@@ -113,3 +113,66 @@ TEST_F(CCrcTest, CalcPartialCRC)
     crcCRC32C.calc_checksum(arrTable.data() + 512, 512);
     EXPECT_EQ(crcCRC32C.get_checksum(), 0x2CDF6E8Fu);
 }
+
+TEST_F(CCrcTest, BulkAndSingleCRC)
+{
+    std::vector<uint8_t> vecData(4099);
+    for (size_t n = 0; n < vecData.size(); n++)
+        vecData[n] = static_cast<uint8_t>((n * 7919) >> 3);
+
+    // The bulk calculation (possibly using processor instructions) must match the byte-wise calculation, also for unaligned data.
+    for (size_t nOffset : {0, 1, 3, 7})
+    {
+        sdv::crcCRC32C crcBulk, crcSingle;
+        crcBulk.calc_checksum(vecData.data() + nOffset, vecData.size() - nOffset);
+        for (size_t n = nOffset; n < vecData.size(); n++)
+            crcSingle.add(vecData[n]);
+        EXPECT_EQ(crcBulk.get_checksum(), crcSingle.get_checksum());
+
+        sdv::crcECMA crcBulkECMA, crcSingleECMA;
+        crcBulkECMA.calc_checksum(vecData.data() + nOffset, vecData.size() - nOffset);
+        for (size_t n = nOffset; n < vecData.size(); n++)
+            crcSingleECMA.add(vecData[n]);
+        EXPECT_EQ(crcBulkECMA.get_checksum(), crcSingleECMA.get_checksum());
+    }
+}
+
+TEST_F(CCrcTest, CombineCRC)
+{
+    // Create data table
+    constexpr auto arrTable = []
+    {
+        std::array<uint8_t, 1024> arrTemp{};
+        for (size_t n = 0; n < 1024; n++)
+            arrTemp[n] = static_cast<uint8_t>(n & 0xff);
+        return arrTemp;
+    }();
+
+    // Calculate the second half separately and combine
+    sdv::crcCRC32C crcCRC32C;
+    crcCRC32C.calc_checksum(arrTable.data(), 512);
+    sdv::crcCRC32C crcBlock;
+    crcCRC32C.combine(crcBlock.calc_checksum(arrTable.data() + 512, 512), 512);
+    EXPECT_EQ(crcCRC32C.get_checksum(), 0x2CDF6E8Fu);
+
+    // Combine multiple blocks of different sizes, including an empty block
+    for (size_t nSplit : {0, 1, 100, 511, 1023, 1024})
+    {
+        crcCRC32C.reset();
+        crcBlock.reset();
+        crcCRC32C.combine(crcBlock.calc_checksum(arrTable.data(), nSplit), nSplit);
+        crcBlock.reset();
+        crcCRC32C.combine(crcBlock.calc_checksum(arrTable.data() + nSplit, 1024 - nSplit), 1024 - nSplit);
+        EXPECT_EQ(crcCRC32C.get_checksum(), 0x2CDF6E8Fu);
+    }
+
+    // Other reflected CRC functions
+    sdv::crcIEEE_802_3 crcIEEE_802_3, crcIEEE_802_3_Block;
+    crcIEEE_802_3.calc_checksum(arrTable.data(), 300);
+    crcIEEE_802_3.combine(crcIEEE_802_3_Block.calc_checksum(arrTable.data() + 300, 724), 724);
+    EXPECT_EQ(crcIEEE_802_3.get_checksum(), 0xB70B4C26u);
+    sdv::crcECMA crcECMA, crcECMABlock;
+    crcECMA.calc_checksum(arrTable.data(), 700);
+    crcECMA.combine(crcECMABlock.calc_checksum(arrTable.data() + 700, 324), 324);
+    EXPECT_EQ(crcECMA.get_checksum(), 0xD51FB58DC789C400);
+}
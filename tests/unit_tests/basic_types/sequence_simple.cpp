@@ -893,4 +893,84 @@ TEST_F(CSimpleSequenceTypeTest, IteratorDistance)
 {
     sdv::sequence<uint32_t> seq1 = {10u, 20u, 30u};
     EXPECT_EQ(std::distance(seq1.begin(), seq1.end()), seq1.length());
-}
\ No newline at end of file
+}
+TEST_F(CSimpleSequenceTypeTest, InlineStorage)
+{
+    CBasicTypesTestAllocator& rAllocator = GetMemMgr();
+    size_t nPtrCount = rAllocator.GetPtrCount();
+
+    // Small sequences (e.g. the data of a CAN message) are stored inline
+    sdv::sequence<uint8_t> seqData = {0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x77, 0x88};
+    sdv::sequence<uint8_t> seqCopy = seqData;
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+    EXPECT_EQ(seqCopy, seqData);
+
+    // Exceeding the inline capacity moves the sequence into an allocation
+    seqCopy.resize(sdv::internal::sequence_storage<uint8_t>::inline_capacity + 1);
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount + 1);
+    EXPECT_EQ(seqCopy[7], 0x88);
+    EXPECT_EQ(seqCopy.back(), 0);
+    seqCopy = std::move(seqData);
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+    EXPECT_TRUE(seqData.empty());
+    EXPECT_EQ(seqCopy.size(), 8);
+
+    // Sequence of buffers; only the buffers are allocated
+    sdv::sequence<sdv::pointer<uint8_t>> seqChunks;
+    seqChunks.push_back(sdv::make_ptr<uint8_t>(10));
+    seqChunks.push_back(sdv::make_ptr<uint8_t>(20));
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount + 2);
+    sdv::sequence<sdv::pointer<uint8_t>> seqChunksMoved = std::move(seqChunks);
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount + 2);
+    EXPECT_EQ(seqChunksMoved[1].size(), 20);
+    for (size_t n = 0; n < sdv::internal::sequence_storage<sdv::pointer<uint8_t>>::inline_capacity; n++)
+        seqChunksMoved.push_back(sdv::make_ptr<uint8_t>(1));
+    EXPECT_EQ(seqChunksMoved[0].size(), 10);
+    EXPECT_EQ(seqChunksMoved[1].size(), 20);
+    seqChunksMoved.clear();
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+
+    // Moving into a fixed sequence and back
+    sdv::sequence<uint8_t, 10> seqFixed = std::move(seqCopy);
+    EXPECT_EQ(seqFixed.size(), 8);
+    sdv::sequence<uint8_t> seqDynamic = std::move(seqFixed);
+    EXPECT_EQ(seqDynamic.size(), 8);
+    EXPECT_EQ(seqDynamic[0], 0xaa);
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+}
+
+TEST_F(CSimpleSequenceTypeTest, InlineStorageMoveToFixed)
+{
+    CBasicTypesTestAllocator& rAllocator = GetMemMgr();
+    size_t nAllocCount = rAllocator.GetAllocCount();
+
+    // Moving an inline stored sequence into a fixed sequence doesn't allocate
+    sdv::sequence<uint8_t> seqDynamic = {1, 2, 3, 4};
+    sdv::sequence<uint8_t, 10> seqFixed = std::move(seqDynamic);
+    EXPECT_EQ(seqFixed, (sdv::sequence<uint8_t>{1, 2, 3, 4}));
+    EXPECT_TRUE(seqDynamic.empty());
+    seqDynamic = {5, 6};
+    seqFixed = std::move(seqDynamic);
+    EXPECT_EQ(seqFixed, (sdv::sequence<uint8_t>{5, 6}));
+    EXPECT_TRUE(seqDynamic.empty());
+
+    // Swapping in both directions doesn't allocate either
+    seqDynamic = {7, 8, 9};
+    seqDynamic.swap(seqFixed);
+    EXPECT_EQ(seqDynamic, (sdv::sequence<uint8_t>{5, 6}));
+    EXPECT_EQ(seqFixed, (sdv::sequence<uint8_t>{7, 8, 9}));
+    swap(seqFixed, seqDynamic);
+    EXPECT_EQ(seqDynamic, (sdv::sequence<uint8_t>{7, 8, 9}));
+    EXPECT_EQ(seqFixed, (sdv::sequence<uint8_t>{5, 6}));
+
+    // Sequences of pointers are stored inline as well
+    sdv::sequence<sdv::pointer<uint8_t>> seqChunks(2);
+    sdv::sequence<sdv::pointer<uint8_t>, 4> seqChunksFixed = std::move(seqChunks);
+    EXPECT_EQ(seqChunksFixed.size(), 2u);
+    EXPECT_TRUE(seqChunks.empty());
+    EXPECT_EQ(rAllocator.GetAllocCount(), nAllocCount);
+
+    // A sequence not fitting into the fixed sequence is not moved
+    seqDynamic = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    EXPECT_THROW(seqFixed = std::move(seqDynamic), sdv::XBufferTooSmall);
+}
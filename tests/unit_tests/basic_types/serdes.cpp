@@ -1236,4 +1236,86 @@ TEST_F(CSerdesTest, SerializeSize)
     nSize = 0;
     sdv::ser_size(ptr,nSize);
     EXPECT_EQ(nSize, sizeof(uint64_t) + ptr.size() * sizeof(uint16_t));
-}
\ No newline at end of file
+}
+
+TEST_F(CSerdesTest, DeserializeOtherCRC)
+{
+    sdv::sequence<uint32_t> seqValues = { 10, 20, 30 };
+    sdv::serializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> serializer;
+    serializer << seqValues;
+
+    // The checksum is verified using the CRC of the deserializer
+    sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer;
+    EXPECT_NO_THROW(deserializer.attach(serializer.buffer(), serializer.checksum()));
+    sdv::sequence<uint32_t> seqValues2;
+    deserializer >> seqValues2;
+    EXPECT_EQ(seqValues, seqValues2);
+    EXPECT_EQ(deserializer.checksum(), serializer.checksum());
+
+    sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer2;
+    EXPECT_THROW(deserializer2.attach(serializer.buffer(), serializer.checksum() + 1), sdv::XHashNotMatching);
+}
+
+TEST_F(CSerdesTest, AssignOtherCRC)
+{
+    // Regression: assign verified the provided checksum with CRC16 regardless of the CRC of the deserializer.
+    sdv::sequence<uint32_t> seqValues = { 10, 20, 30 };
+    sdv::serializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> serializer;
+    serializer << seqValues;
+    sdv::pointer<uint8_t> ptrBuffer = serializer.buffer();
+
+    sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer;
+    EXPECT_NO_THROW(deserializer.assign(ptrBuffer.get(), ptrBuffer.size(), serializer.checksum()));
+    sdv::sequence<uint32_t> seqValues2;
+    deserializer >> seqValues2;
+    EXPECT_EQ(seqValues, seqValues2);
+
+    // The CRC16 of the data doesn't match a CRC32C checksum.
+    sdv::crcCCITT_FALSE crc16;
+    for (size_t nIndex = 0; nIndex < ptrBuffer.size(); nIndex++)
+        crc16.add(ptrBuffer.get()[nIndex]);
+    sdv::deserializer<sdv::GetPlatformEndianess(), sdv::crcCRC32C> deserializer2;
+    EXPECT_THROW(deserializer2.assign(ptrBuffer.get(), ptrBuffer.size(), crc16.get_checksum()), sdv::XHashNotMatching);
+}
+
+TEST_F(CSerdesTest, DeserializeInvalidCount)
+{
+    // Element count of 16 followed by 16 bytes; too small for 16 strings, each having at least a length.
+    sdv::serializer serializer;
+    serializer << static_cast<uint64_t>(16) << static_cast<uint64_t>(0) << static_cast<uint64_t>(0);
+
+    // The count is rejected before the elements are allocated.
+    sdv::deserializer deserializer;
+    deserializer.attach(serializer.buffer(), serializer.checksum());
+    sdv::sequence<sdv::u8string> seqStrings;
+    EXPECT_THROW(deserializer >> seqStrings, sdv::XOffsetPastBufferSize);
+    EXPECT_TRUE(seqStrings.empty());
+
+    sdv::deserializer deserializer1;
+    deserializer1.attach(serializer.buffer(), serializer.checksum());
+    sdv::pointer<sdv::sequence<uint32_t>> ptrSequences;
+    EXPECT_THROW(deserializer1 >> ptrSequences, sdv::XOffsetPastBufferSize);
+    EXPECT_EQ(ptrSequences.size(), 0u);
+
+    // Two elements fit
+    sdv::serializer serializer2;
+    serializer2 << static_cast<uint64_t>(2) << static_cast<uint64_t>(0) << static_cast<uint64_t>(0);
+    sdv::deserializer deserializer2;
+    deserializer2.attach(serializer2.buffer(), serializer2.checksum());
+    EXPECT_NO_THROW(deserializer2 >> seqStrings);
+    EXPECT_EQ(seqStrings.size(), 2u);
+
+    // The count multiplied with the element size must not overflow.
+    sdv::serializer serializer3;
+    serializer3 << static_cast<uint64_t>(1ull << 61) << static_cast<uint64_t>(0);
+    sdv::deserializer deserializer3;
+    deserializer3.attach(serializer3.buffer(), serializer3.checksum());
+    sdv::sequence<uint64_t> seqValues;
+    EXPECT_THROW(deserializer3 >> seqValues, sdv::XOffsetPastBufferSize);
+    EXPECT_TRUE(seqValues.empty());
+    sdv::deserializer deserializer4;
+    deserializer4.attach(serializer3.buffer(), serializer3.checksum());
+    sdv::u32string ssValue;
+    EXPECT_THROW(deserializer4 >> ssValue, sdv::XOffsetPastBufferSize);
+    EXPECT_TRUE(ssValue.empty());
+}
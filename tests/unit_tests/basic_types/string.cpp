@@ -3892,3 +3892,58 @@ TEST_F(CStringTypeTest, IteratorDistance)
 #ifdef __GNUC__
     #pragma GCC diagnostic pop
 #endif
+
+TEST_F(CStringTypeTest, SmallStringStorage)
+{
+    CBasicTypesTestAllocator& rAllocator = GetMemMgr();
+    size_t nInlineLength = sdv::internal::string_storage<char>::inline_capacity - 1;
+
+    // Short strings are stored inline without allocation
+    size_t nPtrCount = rAllocator.GetPtrCount();
+    sdv::string ssShort = "Speed";
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+    sdv::string ssMax(nInlineLength, 'x');
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+    sdv::string ssCopy = ssShort;
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+    EXPECT_EQ(ssCopy, "Speed");
+    EXPECT_EQ(ssMax.size(), nInlineLength);
+
+    // Exceeding the inline capacity moves the string into an allocation
+    ssMax += "y";
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount + 1);
+    EXPECT_EQ(ssMax.size(), nInlineLength + 1);
+    EXPECT_EQ(ssMax.substr(0, nInlineLength), sdv::string(nInlineLength, 'x'));
+    EXPECT_EQ(ssMax.back(), 'y');
+
+    // Moving strings
+    sdv::string ssMoved = std::move(ssMax);
+    EXPECT_TRUE(ssMax.empty());
+    EXPECT_EQ(ssMoved.size(), nInlineLength + 1);
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount + 1);
+    ssMoved = std::move(ssCopy);
+    EXPECT_EQ(ssMoved, "Speed");
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+
+    // Moving into a fixed string and back
+    sdv::fixed_string<30> ssFixed = std::move(ssMoved);
+    EXPECT_EQ(ssFixed, "Speed");
+    sdv::string ssDynamic = std::move(ssFixed);
+    EXPECT_EQ(ssDynamic, "Speed");
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+
+    // Access to the buffer moves the string into an allocation
+    sdv::pointer<char>& rptrBuffer = ssDynamic.buffer();
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount + 1);
+    EXPECT_STREQ(rptrBuffer.get(), "Speed");
+    EXPECT_EQ(ssDynamic, "Speed");
+    ssDynamic.clear();
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+
+    // Wide characters
+    sdv::u32string ss32 = U"Gear";
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount);
+    ss32 += U"Position";
+    EXPECT_EQ(rAllocator.GetPtrCount(), nPtrCount + 1);
+    EXPECT_EQ(ss32, U"GearPosition");
+}
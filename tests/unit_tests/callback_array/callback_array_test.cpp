@@ -0,0 +1,127 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include "../../../global/localmemmgr.h"
+#include <support/signal_support.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Callback detecting calls after its removal.
+     */
+    struct STestCallback
+    {
+        /**
+         * @brief Called by the array.
+         */
+        void Call()
+        {
+            if (bRemoved) bCalledAfterRemoval = true;
+            nCalls++;
+        }
+
+        std::atomic_bool    bRemoved = false;               ///< Set after the callback was removed.
+        std::atomic_bool    bCalledAfterRemoval = false;    ///< Set when called after the removal.
+        std::atomic_size_t  nCalls = 0;                     ///< Amount of calls.
+    };
+}
+
+TEST(CallbackArrayTest, AddRemove)
+{
+    sdv::core::CCallbackArray<STestCallback> arrCallbacks;
+    EXPECT_TRUE(arrCallbacks.Empty());
+
+    STestCallback sCallback1, sCallback2;
+    arrCallbacks.Add(&sCallback1);
+    arrCallbacks.Add(&sCallback2);
+    arrCallbacks.Add(&sCallback1);
+    arrCallbacks.Add(nullptr);
+    arrCallbacks.ForEach([](STestCallback* pCallback) { pCallback->Call(); });
+    EXPECT_EQ(sCallback1.nCalls, 1u);
+    EXPECT_EQ(sCallback2.nCalls, 1u);
+
+    arrCallbacks.Remove(&sCallback1);
+    arrCallbacks.Remove(&sCallback1);
+    arrCallbacks.ForEach([](STestCallback* pCallback) { pCallback->Call(); });
+    EXPECT_EQ(sCallback1.nCalls, 1u);
+    EXPECT_EQ(sCallback2.nCalls, 2u);
+
+    arrCallbacks.Remove(&sCallback2);
+    EXPECT_TRUE(arrCallbacks.Empty());
+}
+
+TEST(CallbackArrayTest, ConcurrentAddForEachRemove)
+{
+    sdv::core::CCallbackArray<STestCallback> arrCallbacks;
+    std::atomic_bool bStop = false;
+
+    // Threads calling the callbacks
+    std::vector<std::thread> vecThreads;
+    for (size_t n = 0; n < 3; n++)
+        vecThreads.emplace_back([&]()
+            {
+                while (!bStop)
+                {
+                    arrCallbacks.ForEach([](STestCallback* pCallback) { pCallback->Call(); });
+                    std::this_thread::yield();
+                }
+            });
+
+    // Thread adding and removing a callback; creates snapshots in between the snapshots of the removal below.
+    vecThreads.emplace_back([&]()
+        {
+            STestCallback sCallback;
+            while (!bStop)
+            {
+                arrCallbacks.Add(&sCallback);
+                arrCallbacks.Remove(&sCallback);
+            }
+        });
+
+    // After the removal, the callback must not be called any more.
+    bool bCalledAfterRemoval = false;
+    for (size_t n = 0; n < 500; n++)
+    {
+        STestCallback sCallback;
+        arrCallbacks.Add(&sCallback);
+        arrCallbacks.Remove(&sCallback);
+        sCallback.bRemoved = true;
+        std::this_thread::yield();
+        bCalledAfterRemoval |= sCallback.bCalledAfterRemoval;
+    }
+
+    bStop = true;
+    for (std::thread& rthread : vecThreads)
+        rthread.join();
+    EXPECT_FALSE(bCalledAfterRemoval);
+    EXPECT_TRUE(arrCallbacks.Empty());
+}
+
+TEST(CallbackArrayTest, ForEachNested)
+{
+    sdv::core::CCallbackArray<STestCallback> arrCallbacks;
+    STestCallback sCallback;
+    arrCallbacks.Add(&sCallback);
+
+    // Calling the array from within a callback of the same array and removing afterwards doesn't block.
+    arrCallbacks.ForEach([&](STestCallback*)
+        {
+            arrCallbacks.ForEach([](STestCallback* pCallback) { pCallback->Call(); });
+        });
+    arrCallbacks.Remove(&sCallback);
+    EXPECT_EQ(sCallback.nCalls, 1u);
+    EXPECT_TRUE(arrCallbacks.Empty());
+}
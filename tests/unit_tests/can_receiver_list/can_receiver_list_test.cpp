@@ -0,0 +1,243 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include "../../../global/localmemmgr.h"
+#include "../../../global/can_receiver_list.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Test receiver recording the received messages.
+     */
+    class CTestReceiver : public sdv::can::IReceive
+    {
+    public:
+        virtual void Receive(/*in*/ const sdv::can::SMessage& sMsg, /*in*/ uint32_t uiIfcIndex) override
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            m_vecIDs.push_back(sMsg.uiID);
+            m_uiIfcIndex = uiIfcIndex;
+            m_idThread = std::this_thread::get_id();
+            lock.unlock();
+            if (m_fnOnReceive) m_fnOnReceive(sMsg);
+            m_nCount++;
+        }
+
+        virtual void Error(/*in*/ const sdv::can::SErrorFrame& sError, /*in*/ uint32_t /*uiIfcIndex*/) override
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            m_vecErrors.push_back(sError.eError);
+        }
+
+        std::vector<uint32_t> GetIDs() const
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            return m_vecIDs;
+        }
+
+        bool WaitForCount(size_t nCount) const
+        {
+            auto tpEnd = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (m_nCount < nCount && std::chrono::steady_clock::now() < tpEnd)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return m_nCount >= nCount;
+        }
+
+        mutable std::mutex                      m_mtx;
+        std::vector<uint32_t>                   m_vecIDs;
+        std::vector<sdv::can::EError>           m_vecErrors;
+        uint32_t                                m_uiIfcIndex = 0;
+        std::thread::id                         m_idThread;
+        std::atomic_size_t                      m_nCount{0};
+        std::function<void(const sdv::can::SMessage&)> m_fnOnReceive;
+    };
+
+    sdv::can::SMessage MakeMsg(uint32_t uiID)
+    {
+        sdv::can::SMessage sMsg{};
+        sMsg.uiID = uiID;
+        sMsg.seqData = sdv::sequence<uint8_t>{1, 2, 3};
+        return sMsg;
+    }
+
+    sdv::can::SReceiverConfig MakeConfig(std::initializer_list<std::pair<uint32_t, uint32_t>> ilFilters, uint32_t uiQueueSize = 0)
+    {
+        sdv::can::SReceiverConfig sConfig{};
+        for (const auto& rprFilter : ilFilters)
+            sConfig.seqFilters.push_back(sdv::can::SReceiveFilter{rprFilter.first, rprFilter.second});
+        sConfig.uiQueueSize = uiQueueSize;
+        return sConfig;
+    }
+}
+
+TEST(CanReceiverListTest, RegisterUnregister)
+{
+    CCanReceiverList lstReceivers;
+    CTestReceiver receiver1, receiver2;
+    EXPECT_FALSE(lstReceivers.Register(nullptr));
+    EXPECT_TRUE(lstReceivers.Register(&receiver1));
+    EXPECT_FALSE(lstReceivers.Register(&receiver1));
+    EXPECT_TRUE(lstReceivers.Register(&receiver2));
+    EXPECT_EQ(lstReceivers.GetCount(), 2u);
+
+    lstReceivers.Dispatch(MakeMsg(0x100), 3);
+    EXPECT_EQ(receiver1.GetIDs(), std::vector<uint32_t>{0x100});
+    EXPECT_EQ(receiver2.GetIDs(), std::vector<uint32_t>{0x100});
+    EXPECT_EQ(receiver1.m_uiIfcIndex, 3u);
+
+    EXPECT_TRUE(lstReceivers.Unregister(&receiver1));
+    EXPECT_FALSE(lstReceivers.Unregister(&receiver1));
+    EXPECT_EQ(lstReceivers.GetCount(), 1u);
+    lstReceivers.Dispatch(MakeMsg(0x101), 0);
+    EXPECT_EQ(receiver1.GetIDs().size(), 1u);
+    EXPECT_EQ(receiver2.GetIDs().size(), 2u);
+
+    lstReceivers.Clear();
+    EXPECT_EQ(lstReceivers.GetCount(), 0u);
+    lstReceivers.Dispatch(MakeMsg(0x102), 0);
+    EXPECT_EQ(receiver2.GetIDs().size(), 2u);
+}
+
+TEST(CanReceiverListTest, Filters)
+{
+    CCanReceiverList lstReceivers;
+    CTestReceiver receiverAll, receiverExact, receiverRange;
+    EXPECT_TRUE(lstReceivers.Register(&receiverAll));
+    EXPECT_TRUE(lstReceivers.Register(&receiverExact, MakeConfig({{0x123, 0x7ff}, {0x200, 0x7ff}})));
+    EXPECT_TRUE(lstReceivers.Register(&receiverRange, MakeConfig({{0x300, 0x700}})));
+
+    for (uint32_t uiID : {0x100u, 0x123u, 0x200u, 0x300u, 0x3ffu, 0x400u})
+        lstReceivers.Dispatch(MakeMsg(uiID), 0);
+
+    EXPECT_EQ(receiverAll.GetIDs().size(), 6u);
+    EXPECT_EQ(receiverExact.GetIDs(), (std::vector<uint32_t>{0x123, 0x200}));
+    EXPECT_EQ(receiverRange.GetIDs(), (std::vector<uint32_t>{0x300, 0x3ff}));
+
+    // Errors referring to an ID are filtered; general errors are delivered to all.
+    lstReceivers.DispatchError(sdv::can::SErrorFrame{0x123, sdv::can::EError::crc_error}, 0);
+    lstReceivers.DispatchError(sdv::can::SErrorFrame{0, sdv::can::EError::bit_error}, 0);
+    EXPECT_EQ(receiverAll.m_vecErrors.size(), 2u);
+    EXPECT_EQ(receiverExact.m_vecErrors.size(), 2u);
+    ASSERT_EQ(receiverRange.m_vecErrors.size(), 1u);
+    EXPECT_EQ(receiverRange.m_vecErrors[0], sdv::can::EError::bit_error);
+}
+
+TEST(CanReceiverListTest, QueuedDelivery)
+{
+    CCanReceiverList lstReceivers;
+    CTestReceiver receiver;
+    EXPECT_TRUE(lstReceivers.Register(&receiver, MakeConfig({}, 64)));
+
+    for (uint32_t uiID = 0; uiID < 50; uiID++)
+        lstReceivers.Dispatch(MakeMsg(uiID), 1);
+    EXPECT_TRUE(receiver.WaitForCount(50));
+
+    // Delivered in order by another thread.
+    std::vector<uint32_t> vecIDs = receiver.GetIDs();
+    ASSERT_EQ(vecIDs.size(), 50u);
+    for (uint32_t uiID = 0; uiID < 50; uiID++)
+        EXPECT_EQ(vecIDs[uiID], uiID);
+    EXPECT_NE(receiver.m_idThread, std::this_thread::get_id());
+    EXPECT_EQ(lstReceivers.GetDroppedCount(&receiver), 0u);
+    EXPECT_TRUE(lstReceivers.Unregister(&receiver));
+}
+
+TEST(CanReceiverListTest, SlowReceiverDoesNotBlockReader)
+{
+    CCanReceiverList lstReceivers;
+    CTestReceiver receiverSlow, receiverFast;
+    std::atomic_bool bRelease = false;
+    receiverSlow.m_fnOnReceive = [&](const sdv::can::SMessage&)
+    {
+        while (!bRelease) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    };
+    EXPECT_TRUE(lstReceivers.Register(&receiverSlow, MakeConfig({}, 8)));
+    EXPECT_TRUE(lstReceivers.Register(&receiverFast));
+
+    // The slow receiver blocks on the first message; the queue holds 8 messages and the rest are dropped.
+    auto tpStart = std::chrono::steady_clock::now();
+    for (uint32_t uiID = 0; uiID < 100; uiID++)
+        lstReceivers.Dispatch(MakeMsg(uiID), 0);
+    EXPECT_LT(std::chrono::steady_clock::now() - tpStart, std::chrono::seconds(1));
+    EXPECT_EQ(receiverFast.GetIDs().size(), 100u);
+
+    bRelease = true;
+    EXPECT_TRUE(receiverSlow.WaitForCount(8));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    uint64_t uiDropped = lstReceivers.GetDroppedCount(&receiverSlow);
+    EXPECT_GE(uiDropped, 90u);
+    EXPECT_EQ(receiverSlow.GetIDs().size() + uiDropped, 100u);
+}
+
+TEST(CanReceiverListTest, NoCallAfterUnregister)
+{
+    for (uint32_t uiQueueSize : {0u, 16u})
+    {
+        CCanReceiverList lstReceivers;
+        CTestReceiver receiver;
+        std::atomic_bool bUnregistered = false;
+        std::atomic_bool bCalledAfter = false;
+        receiver.m_fnOnReceive = [&](const sdv::can::SMessage&)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            if (bUnregistered) bCalledAfter = true;
+        };
+        EXPECT_TRUE(lstReceivers.Register(&receiver, MakeConfig({}, uiQueueSize)));
+
+        std::atomic_bool bStop = false;
+        std::thread threadReader([&]()
+            {
+                while (!bStop) lstReceivers.Dispatch(MakeMsg(0x10), 0);
+            });
+        EXPECT_TRUE(receiver.WaitForCount(10));
+        EXPECT_TRUE(lstReceivers.Unregister(&receiver));
+        bUnregistered = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        bStop = true;
+        threadReader.join();
+        EXPECT_FALSE(bCalledAfter);
+    }
+}
+
+TEST(CanReceiverListTest, UnregisterFromCallback)
+{
+    CCanReceiverList lstReceivers;
+    CTestReceiver receiverSelf, receiverOther;
+    receiverSelf.m_fnOnReceive = [&](const sdv::can::SMessage&)
+    {
+        lstReceivers.Unregister(&receiverSelf);
+        lstReceivers.Unregister(&receiverOther);
+    };
+    EXPECT_TRUE(lstReceivers.Register(&receiverSelf));
+    EXPECT_TRUE(lstReceivers.Register(&receiverOther));
+
+    // The other receiver was unregistered during the dispatch and must not be called anymore.
+    lstReceivers.Dispatch(MakeMsg(1), 0);
+    lstReceivers.Dispatch(MakeMsg(2), 0);
+    EXPECT_EQ(receiverSelf.GetIDs().size(), 1u);
+    EXPECT_TRUE(receiverOther.GetIDs().empty());
+    EXPECT_EQ(lstReceivers.GetCount(), 0u);
+
+    // Publishing outside a dispatch releases the retired snapshots.
+    CTestReceiver receiverNew;
+    EXPECT_TRUE(lstReceivers.Register(&receiverNew));
+    lstReceivers.Dispatch(MakeMsg(3), 0);
+    EXPECT_EQ(receiverNew.GetIDs(), std::vector<uint32_t>{3});
+}
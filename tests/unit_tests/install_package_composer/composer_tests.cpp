@@ -3610,3 +3610,127 @@ TEST_F(CInstallPackageComposerTest, UninstallPackageSubDirs)
     // Check for the target directory to have been removed.
     EXPECT_FALSE(std::filesystem::exists(pathTgtPckDir / "UninstallPackageSubDirs"));
 }
+
+namespace
+{
+    /**
+     * @brief Create a file with the provided content.
+     * @param[in] rpathFile Reference to the path of the file.
+     * @param[in] rssContent Reference to the file content.
+     */
+    void CreateDeltaTestFile(const std::filesystem::path& rpathFile, const std::string& rssContent)
+    {
+        std::filesystem::create_directories(rpathFile.parent_path());
+        std::ofstream fstream(rpathFile.native().c_str(), std::ios::binary | std::ios::trunc);
+        fstream << rssContent;
+    }
+}
+
+TEST_F(CInstallPackageComposerTest, ComposeDeltaPackage)
+{
+    // Source and target directories
+    std::filesystem::path pathSrcDir     = GetExecDirectory() / "install_package_composer_sources";
+    std::filesystem::path pathSrcFileDir = pathSrcDir / "delta_package";
+    std::filesystem::path pathTgtPckDir  = GetExecDirectory() / "install_package_composer_targets";
+    std::filesystem::path pathTgtFileDir = pathTgtPckDir / "ComposeDeltaPackage";
+
+    // Version 1.0.0 consisting of five files
+    for (size_t n = 0; n < 5; n++)
+        CreateDeltaTestFile(pathSrcFileDir / ("file" + std::to_string(n) + ".bin"), std::string(10000 + n, static_cast<char>('a' + n)));
+    CInstallComposer composerV1;
+    EXPECT_EQ(composerV1.AddModule(pathSrcFileDir, "*.bin").size(), 5);
+    composerV1.AddProperty("Version", "1.0.0");
+    EXPECT_NO_THROW(EXPECT_TRUE(composerV1.Compose(pathSrcDir / "ComposeDeltaPackageV1.sdv_package", "ComposeDeltaPackage")));
+    EXPECT_NO_THROW(EXPECT_TRUE(CInstallComposer::Extract(pathSrcDir / "ComposeDeltaPackageV1.sdv_package", pathTgtPckDir).IsValid()));
+
+    // The installed manifest contains the content hashes
+    CInstallManifest manifestBase;
+    EXPECT_TRUE(manifestBase.Load(pathTgtFileDir));
+    auto optHash = manifestBase.ModuleHash("file1.bin");
+    ASSERT_TRUE(optHash);
+    EXPECT_EQ(optHash->uiSize, 10001u);
+
+    // Version 2.0.0: file1 changed, file4 removed and file5 added
+    CreateDeltaTestFile(pathSrcFileDir / "file1.bin", std::string(20000, 'x'));
+    std::filesystem::remove(pathSrcFileDir / "file4.bin");
+    CreateDeltaTestFile(pathSrcFileDir / "sub" / "file5.bin", std::string(500, 'y'));
+    CInstallComposer composerV2;
+    EXPECT_EQ(composerV2.AddModule(pathSrcFileDir, "**/*.bin", ".", static_cast<uint32_t>(CInstallComposer::EAddModuleFlags::keep_structure)).size(), 5);
+    composerV2.AddProperty("Version", "2.0.0");
+    EXPECT_NO_THROW(EXPECT_TRUE(composerV2.Compose(pathSrcDir / "ComposeDeltaPackageV2.sdv_package", "ComposeDeltaPackage")));
+    EXPECT_NO_THROW(EXPECT_TRUE(composerV2.ComposeDelta(pathSrcDir / "ComposeDeltaPackageV2Delta.sdv_package", "ComposeDeltaPackage", manifestBase)));
+    EXPECT_LT(std::filesystem::file_size(pathSrcDir / "ComposeDeltaPackageV2Delta.sdv_package"),
+        std::filesystem::file_size(pathSrcDir / "ComposeDeltaPackageV2.sdv_package") / 2);
+
+    // The delta package describes the complete installation
+    CInstallManifest manifestDelta = CInstallComposer::ExtractInstallManifest(pathSrcDir / "ComposeDeltaPackageV2Delta.sdv_package");
+    ASSERT_TRUE(manifestDelta.DeltaBase());
+    EXPECT_TRUE(*manifestDelta.DeltaBase() == (sdv::installation::SPackageVersion{ 1, 0, 0 }));
+    EXPECT_EQ(manifestDelta.ModuleList().size(), 5);
+    EXPECT_TRUE(CInstallComposer::Verify(pathSrcDir / "ComposeDeltaPackageV2Delta.sdv_package"));
+
+    // A delta package cannot be installed without the base installation
+    EXPECT_THROW(CInstallComposer::Extract(pathSrcDir / "ComposeDeltaPackageV2Delta.sdv_package", pathTgtPckDir / "other",
+        CInstallComposer::EUpdateRules::update_when_new), sdv::installation::XInstallationNotFound);
+
+    // Apply the delta package
+    CInstallManifest manifestInstalled;
+    EXPECT_NO_THROW(manifestInstalled = CInstallComposer::Extract(pathSrcDir / "ComposeDeltaPackageV2Delta.sdv_package",
+        pathTgtPckDir, CInstallComposer::EUpdateRules::update_when_new));
+    EXPECT_TRUE(manifestInstalled.IsValid());
+    EXPECT_FALSE(manifestInstalled.DeltaBase());
+    EXPECT_EQ(manifestInstalled.ModuleList().size(), 5);
+    for (const char* szFile : { "file0.bin", "file1.bin", "file2.bin", "file3.bin", "sub/file5.bin" })
+        EXPECT_TRUE(AreFilesEqual(pathSrcFileDir / szFile, pathTgtFileDir / szFile));
+    EXPECT_FALSE(std::filesystem::exists(pathTgtFileDir / "file4.bin"));
+    EXPECT_FALSE(std::filesystem::exists(pathTgtPckDir / "ComposeDeltaPackage.staging"));
+    EXPECT_FALSE(std::filesystem::exists(pathTgtPckDir / "ComposeDeltaPackage.previous"));
+
+    // The installation is not the base of the delta package anymore
+    EXPECT_THROW(CInstallComposer::Extract(pathSrcDir / "ComposeDeltaPackageV2Delta.sdv_package", pathTgtPckDir,
+        CInstallComposer::EUpdateRules::overwrite), sdv::installation::XIncompatiblePackage);
+    EXPECT_TRUE(AreFilesEqual(pathSrcFileDir / "file1.bin", pathTgtFileDir / "file1.bin"));
+}
+
+TEST_F(CInstallPackageComposerTest, ComposeDeltaPackageChangedInstallation)
+{
+    // Source and target directories
+    std::filesystem::path pathSrcDir     = GetExecDirectory() / "install_package_composer_sources";
+    std::filesystem::path pathSrcFileDir = pathSrcDir / "delta_package_changed";
+    std::filesystem::path pathTgtPckDir  = GetExecDirectory() / "install_package_composer_targets";
+    std::filesystem::path pathTgtFileDir = pathTgtPckDir / "ComposeDeltaPackageChangedInstallation";
+
+    // Install version 1.0.0
+    for (size_t n = 0; n < 3; n++)
+        CreateDeltaTestFile(pathSrcFileDir / ("file" + std::to_string(n) + ".bin"), std::string(1000, static_cast<char>('a' + n)));
+    CInstallComposer composerV1;
+    EXPECT_EQ(composerV1.AddModule(pathSrcFileDir, "*.bin").size(), 3);
+    composerV1.AddProperty("Version", "1.0.0");
+    sdv::pointer<uint8_t> ptrPackageV1;
+    EXPECT_NO_THROW(ptrPackageV1 = composerV1.Compose("ComposeDeltaPackageChangedInstallation"));
+    EXPECT_NO_THROW(EXPECT_TRUE(CInstallComposer::Extract(ptrPackageV1, pathTgtPckDir).IsValid()));
+    CInstallManifest manifestBase;
+    EXPECT_TRUE(manifestBase.Load(pathTgtFileDir));
+
+    // Compose a delta package for version 2.0.0 changing file0 only
+    CreateDeltaTestFile(pathSrcFileDir / "file0.bin", std::string(1000, 'z'));
+    CInstallComposer composerV2;
+    EXPECT_EQ(composerV2.AddModule(pathSrcFileDir, "*.bin").size(), 3);
+    composerV2.AddProperty("Version", "2.0.0");
+    sdv::pointer<uint8_t> ptrPackageDelta;
+    EXPECT_NO_THROW(ptrPackageDelta = composerV2.ComposeDelta("ComposeDeltaPackageChangedInstallation", manifestBase));
+
+    // Damage an unchanged file of the installation; the delta cannot be applied and the installation remains untouched.
+    CreateDeltaTestFile(pathTgtFileDir / "file2.bin", "damaged");
+    EXPECT_THROW(CInstallComposer::Extract(ptrPackageDelta, pathTgtPckDir, CInstallComposer::EUpdateRules::update_when_new),
+        sdv::installation::XModuleNotFound);
+    EXPECT_FALSE(AreFilesEqual(pathSrcFileDir / "file0.bin", pathTgtFileDir / "file0.bin"));
+    EXPECT_FALSE(std::filesystem::exists(pathTgtPckDir / "ComposeDeltaPackageChangedInstallation.staging"));
+
+    // Repair the installation and apply the delta
+    CreateDeltaTestFile(pathTgtFileDir / "file2.bin", std::string(1000, 'c'));
+    EXPECT_NO_THROW(EXPECT_TRUE(CInstallComposer::Extract(ptrPackageDelta, pathTgtPckDir,
+        CInstallComposer::EUpdateRules::update_when_new).IsValid()));
+    for (const char* szFile : { "file0.bin", "file1.bin", "file2.bin" })
+        EXPECT_TRUE(AreFilesEqual(pathSrcFileDir / szFile, pathTgtFileDir / szFile));
+}
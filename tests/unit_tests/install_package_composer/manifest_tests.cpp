@@ -596,3 +596,96 @@ TEST_F(CInstallManifestTest, SaveLoadFindComponents)
     EXPECT_TRUE(manifestRead.FindComponentByClass("DummyService #2"));
     EXPECT_FALSE(manifestRead.FindComponentByClass("DummyServer #3"));
 }
+
+TEST_F(CInstallManifestTest, SaveLoadIndex)
+{
+    // Source and target directories
+    std::filesystem::path pathSrcFileDir = GetExecDirectory();
+    std::filesystem::path pathTgtPckDir  = GetExecDirectory() / "install_package_composer_targets";
+    std::filesystem::create_directories(pathTgtPckDir);
+    EXPECT_FALSE(std::filesystem::exists(pathTgtPckDir / "install_manifest.idx"));
+
+    CInstallManifest manifestWrite;
+    manifestWrite.Create("Hello");
+    manifestWrite.Property("Version", "1.2.3");
+    EXPECT_TRUE(manifestWrite.AddModule(pathSrcFileDir / "UnitTest_InstallPackageComposer_Component1.sdv"));
+    EXPECT_TRUE(manifestWrite.AddModule(pathSrcFileDir / "UnitTest_InstallPackageComposer_Component2.sdv"));
+    EXPECT_FALSE(manifestWrite.SaveIndex(pathTgtPckDir));   // Manifest not saved yet
+    EXPECT_TRUE(manifestWrite.Save(pathTgtPckDir));
+    EXPECT_TRUE(manifestWrite.SaveIndex(pathTgtPckDir));
+    EXPECT_TRUE(std::filesystem::exists(pathTgtPckDir / "install_manifest.idx"));
+
+    // Load using the index
+    CInstallManifest manifestRead;
+    EXPECT_TRUE(manifestRead.Load(pathTgtPckDir));
+    EXPECT_TRUE(manifestRead.IsValid());
+    EXPECT_EQ(manifestRead.InstallName(), "Hello");
+    EXPECT_EQ(manifestRead.Version().uiMinor, 2u);
+    EXPECT_EQ(manifestRead.ModuleList().size(), 2u);
+    EXPECT_EQ(manifestRead.ClassList().size(), 3u);
+    EXPECT_FALSE(manifestRead.FindModule("UnitTest_InstallPackageComposer_Component1.sdv").empty());
+    EXPECT_FALSE(manifestRead.FindModule("./UnitTest_InstallPackageComposer_Component2.sdv").empty());
+    EXPECT_FALSE(manifestRead.FindModuleManifest("UnitTest_InstallPackageComposer_Component2.sdv").empty());
+    EXPECT_TRUE(manifestRead.FindComponentByClass("DummySvc1"));
+    EXPECT_TRUE(manifestRead.FindComponentByClass("DummyService #2"));
+    EXPECT_FALSE(manifestRead.FindComponentByClass("DummyServer #3"));
+    EXPECT_EQ(manifestRead.Write(), manifestWrite.Write());
+
+    // Changing the manifest invalidates the index; the manifest is parsed instead.
+    manifestWrite.Property("Description", "Changed");
+    EXPECT_TRUE(manifestWrite.Save(pathTgtPckDir));
+    CInstallManifest manifestChanged;
+    EXPECT_TRUE(manifestChanged.Load(pathTgtPckDir));
+    EXPECT_EQ(*manifestChanged.Property("Description"), "Changed");
+    EXPECT_EQ(manifestChanged.ClassList().size(), 3u);
+
+    // A corrupt index is ignored.
+    EXPECT_TRUE(manifestWrite.SaveIndex(pathTgtPckDir));
+    std::filesystem::resize_file(pathTgtPckDir / "install_manifest.idx",
+        std::filesystem::file_size(pathTgtPckDir / "install_manifest.idx") - 10);
+    CInstallManifest manifestCorrupt;
+    EXPECT_TRUE(manifestCorrupt.Load(pathTgtPckDir));
+    EXPECT_EQ(manifestCorrupt.ClassList().size(), 3u);
+    EXPECT_TRUE(manifestCorrupt.FindComponentByClass("Dummy1"));
+}
+
+TEST_F(CInstallManifestTest, WriteReadContentHashes)
+{
+    // Source and target directories
+    std::filesystem::path pathSrcFileDir = GetExecDirectory() / "install_package_composer_sources" / "dummy_package";
+
+    CInstallManifest manifestWrite;
+    manifestWrite.Create("Hello");
+    EXPECT_TRUE(manifestWrite.AddModule(pathSrcFileDir / "file0.bin"));
+    EXPECT_TRUE(manifestWrite.AddModule(pathSrcFileDir / "file1.bin"));
+    EXPECT_TRUE(manifestWrite.ModuleHash("file0.bin", CInstallManifest::SContentHash{ 1234, 0xfedcba98 }));
+    EXPECT_FALSE(manifestWrite.ModuleHash("file2.bin", CInstallManifest::SContentHash{ 1, 1 }));
+    EXPECT_FALSE(manifestWrite.DeltaBase());
+    manifestWrite.SetDeltaBase(sdv::installation::SPackageVersion{ 1, 2, 3 });
+    std::string ssManifest = manifestWrite.Write();
+    EXPECT_FALSE(ssManifest.empty());
+
+    CInstallManifest manifestRead;
+    EXPECT_TRUE(manifestRead.Read(ssManifest));
+    auto optHash = manifestRead.ModuleHash("file0.bin");
+    ASSERT_TRUE(optHash);
+    EXPECT_EQ(optHash->uiSize, 1234u);
+    EXPECT_EQ(optHash->uiChecksum, 0xfedcba98u);
+    EXPECT_FALSE(manifestRead.ModuleHash("file1.bin"));
+    auto optDeltaBase = manifestRead.DeltaBase();
+    ASSERT_TRUE(optDeltaBase);
+    EXPECT_TRUE(*optDeltaBase == (sdv::installation::SPackageVersion{ 1, 2, 3 }));
+
+    // The index contains the content hashes as well
+    std::filesystem::path pathTgtDir = GetExecDirectory() / "install_package_composer_targets" / "WriteReadContentHashes";
+    std::filesystem::create_directories(pathTgtDir);
+    manifestRead.ResetDeltaBase();
+    EXPECT_TRUE(manifestRead.Save(pathTgtDir));
+    EXPECT_TRUE(manifestRead.SaveIndex(pathTgtDir));
+    CInstallManifest manifestLoad;
+    EXPECT_TRUE(manifestLoad.Load(pathTgtDir));
+    optHash = manifestLoad.ModuleHash("file0.bin");
+    ASSERT_TRUE(optHash);
+    EXPECT_TRUE(*optHash == (CInstallManifest::SContentHash{ 1234, 0xfedcba98 }));
+    EXPECT_FALSE(manifestLoad.DeltaBase());
+}
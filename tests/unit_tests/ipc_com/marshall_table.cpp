@@ -0,0 +1,150 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include "../../include/gtest_custom.h"
+#include "../../../sdv_services/ipc_com/marshall_table.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(MarshallObjectTableTest, AddFindRemove)
+{
+    CMarshallObjectTable<int> table;
+    auto ptrObject = std::make_shared<int>(10);
+    auto sSlot = table.Add(ptrObject);
+    EXPECT_NE(sSlot.uiGeneration, 0u);
+    EXPECT_EQ(table.GetObjectCount(), 1u);
+
+    // Find with correct and incorrect identification
+    EXPECT_EQ(table.Find(sSlot.uiIndex, sSlot.uiGeneration), ptrObject);
+    EXPECT_FALSE(table.Find(sSlot.uiIndex, sSlot.uiGeneration + 1));
+    EXPECT_FALSE(table.Find(sSlot.uiIndex + 1, sSlot.uiGeneration));
+    EXPECT_FALSE(table.Find(0xffffffff, sSlot.uiGeneration));
+
+    // Remove with incorrect generation is ignored
+    table.Remove(sSlot.uiIndex, sSlot.uiGeneration + 1);
+    EXPECT_EQ(table.Find(sSlot.uiIndex, sSlot.uiGeneration), ptrObject);
+
+    table.Remove(sSlot.uiIndex, sSlot.uiGeneration);
+    EXPECT_FALSE(table.Find(sSlot.uiIndex, sSlot.uiGeneration));
+    EXPECT_EQ(table.GetObjectCount(), 0u);
+
+    // Empty objects are not added
+    EXPECT_EQ(table.Add(nullptr).uiGeneration, 0u);
+}
+
+TEST(MarshallObjectTableTest, ExpiredObject)
+{
+    CMarshallObjectTable<int> table;
+    auto ptrObject = std::make_shared<int>(10);
+    auto sSlot = table.Add(ptrObject);
+
+    // The table doesn't keep the object alive
+    ptrObject.reset();
+    EXPECT_FALSE(table.Find(sSlot.uiIndex, sSlot.uiGeneration));
+    table.Remove(sSlot.uiIndex, sSlot.uiGeneration);
+}
+
+TEST(MarshallObjectTableTest, SlotReuse)
+{
+    CMarshallObjectTable<int> table;
+    auto ptrObject1 = std::make_shared<int>(1);
+    auto sSlot1 = table.Add(ptrObject1);
+    table.Remove(sSlot1.uiIndex, sSlot1.uiGeneration);
+
+    // The slot is reused with another generation; the old ID doesn't access the new object
+    auto ptrObject2 = std::make_shared<int>(2);
+    auto sSlot2 = table.Add(ptrObject2);
+    EXPECT_EQ(sSlot2.uiIndex, sSlot1.uiIndex);
+    EXPECT_NE(sSlot2.uiGeneration, sSlot1.uiGeneration);
+    EXPECT_NE(sSlot2.uiGeneration, 0u);
+    EXPECT_FALSE(table.Find(sSlot1.uiIndex, sSlot1.uiGeneration));
+    EXPECT_EQ(table.Find(sSlot2.uiIndex, sSlot2.uiGeneration), ptrObject2);
+
+    // Creating and destroying objects over a long time doesn't grow the table
+    for (size_t n = 0; n < 100000; n++)
+    {
+        auto ptrObject = std::make_shared<int>(static_cast<int>(n));
+        auto sSlot = table.Add(ptrObject);
+        ASSERT_NE(sSlot.uiGeneration, 0u);
+        EXPECT_EQ(*table.Find(sSlot.uiIndex, sSlot.uiGeneration), static_cast<int>(n));
+        table.Remove(sSlot.uiIndex, sSlot.uiGeneration);
+    }
+    EXPECT_EQ(table.GetSlotCount(), 2u);
+    EXPECT_EQ(table.GetObjectCount(), 1u);
+}
+
+TEST(MarshallObjectTableTest, MultipleBlocks)
+{
+    CMarshallObjectTable<int> table;
+    const size_t nCount = CMarshallObjectTable<int>::nBlockSize * 3 + 10;
+    std::vector<std::shared_ptr<int>> vecObjects;
+    std::vector<CMarshallObjectTable<int>::SSlotID> vecSlots;
+    for (size_t n = 0; n < nCount; n++)
+    {
+        vecObjects.push_back(std::make_shared<int>(static_cast<int>(n)));
+        vecSlots.push_back(table.Add(vecObjects.back()));
+    }
+    EXPECT_EQ(table.GetSlotCount(), nCount);
+    for (size_t n = 0; n < nCount; n++)
+        EXPECT_EQ(table.Find(vecSlots[n].uiIndex, vecSlots[n].uiGeneration), vecObjects[n]);
+}
+
+TEST(MarshallObjectTableTest, ConcurrentFindAndRemove)
+{
+    CMarshallObjectTable<int> table;
+    const size_t nSlotCount = 64;
+    std::vector<std::atomic_uint64_t> vecIDs(nSlotCount);
+    std::vector<std::shared_ptr<int>> vecObjects(nSlotCount);
+    for (size_t n = 0; n < nSlotCount; n++)
+    {
+        vecObjects[n] = std::make_shared<int>(static_cast<int>(n));
+        auto sSlot = table.Add(vecObjects[n]);
+        vecIDs[n] = static_cast<uint64_t>(sSlot.uiGeneration) << 32 | sSlot.uiIndex;
+    }
+
+    // Readers look up the objects while the writer replaces them
+    std::atomic_bool bStop = false;
+    std::atomic_size_t nFound = 0, nWrong = 0;
+    std::vector<std::thread> vecReaders;
+    for (size_t nThread = 0; nThread < 4; nThread++)
+        vecReaders.emplace_back([&]()
+            {
+                size_t nIndex = 0;
+                while (!bStop)
+                {
+                    uint64_t uiID = vecIDs[nIndex++ % nSlotCount].load();
+                    auto ptrObject = table.Find(static_cast<uint32_t>(uiID), static_cast<uint32_t>(uiID >> 32));
+                    if (!ptrObject) continue;
+                    nFound++;
+                    if (*ptrObject % static_cast<int>(nSlotCount) != static_cast<int>(nIndex - 1) % static_cast<int>(nSlotCount))
+                        nWrong++;
+                }
+            });
+    for (size_t nLoop = 0; nLoop < 20000; nLoop++)
+    {
+        size_t n = nLoop % nSlotCount;
+        uint64_t uiID = vecIDs[n].load();
+        table.Remove(static_cast<uint32_t>(uiID), static_cast<uint32_t>(uiID >> 32));
+        vecObjects[n] = std::make_shared<int>(static_cast<int>(nLoop));
+        auto sSlot = table.Add(vecObjects[n]);
+        vecIDs[n] = static_cast<uint64_t>(sSlot.uiGeneration) << 32 | sSlot.uiIndex;
+    }
+    bStop = true;
+    for (std::thread& rthread : vecReaders)
+        rthread.join();
+
+    EXPECT_GT(nFound, 0u);
+    EXPECT_EQ(nWrong, 0u);
+    EXPECT_EQ(table.GetSlotCount(), nSlotCount);
+}
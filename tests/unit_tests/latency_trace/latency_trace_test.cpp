@@ -0,0 +1,195 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <interfaces/log.h>
+#include "../../../global/latencytrace/latency_trace_buffer.h"
+#include "../../../sdv_executables/sdv_trace_mon/latency_monitor.h"
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Create a trace event.
+     * @param[in] uiTraceID The trace ID.
+     * @param[in] uiTimestamp The timestamp.
+     * @param[in] eStage The stage.
+     * @param[in] uiKey The key.
+     * @return The event.
+     */
+    SLatencyTraceRecord MakeRecord(uint64_t uiTraceID, uint64_t uiTimestamp, sdv::core::ETraceStage eStage, uint32_t uiKey)
+    {
+        SLatencyTraceRecord sRecord;
+        sRecord.uiTraceID = uiTraceID;
+        sRecord.uiTimestamp = uiTimestamp;
+        sRecord.uiStage = static_cast<uint32_t>(eStage);
+        sRecord.uiKey = uiKey;
+        return sRecord;
+    }
+}
+
+TEST(LatencyTraceTest, OpenRequiresMonitor)
+{
+    CLatencyTraceBuffer bufferWriter(9998);
+    EXPECT_FALSE(bufferWriter.Open());
+
+    CLatencyTraceBuffer bufferMonitor(9998);
+    ASSERT_TRUE(bufferMonitor.Create());
+    EXPECT_TRUE(bufferMonitor.IsActive(CLatencyTraceBuffer::GetTimestamp()));
+    EXPECT_TRUE(bufferWriter.Open());
+    EXPECT_TRUE(bufferWriter.IsActive(CLatencyTraceBuffer::GetTimestamp()));
+
+    // Without heartbeat, the buffer becomes inactive
+    EXPECT_FALSE(bufferWriter.IsActive(CLatencyTraceBuffer::GetTimestamp() + CLatencyTraceBuffer::uiHeartbeatTimeout));
+
+    // Closing the monitor deactivates the recording
+    bufferMonitor.Close();
+    EXPECT_FALSE(bufferWriter.IsActive(CLatencyTraceBuffer::GetTimestamp()));
+    bufferWriter.Close();
+    EXPECT_FALSE(bufferWriter.Open());
+}
+
+TEST(LatencyTraceTest, RecordAndRead)
+{
+    CLatencyTraceBuffer bufferMonitor(9998);
+    ASSERT_TRUE(bufferMonitor.Create());
+
+    // Record the events in several threads
+    const size_t nThreadCount = 4, nEventCount = 1000;
+    std::vector<std::thread> vecThreads;
+    for (size_t nThread = 0; nThread < nThreadCount; nThread++)
+    {
+        vecThreads.emplace_back([&, nThread]()
+            {
+                CLatencyTraceBuffer bufferWriter(9998);
+                ASSERT_TRUE(bufferWriter.Open());
+                uint32_t uiRing = bufferWriter.ClaimRing();
+                ASSERT_LT(uiRing, CLatencyTraceBuffer::nRingCount);
+                for (size_t n = 0; n < nEventCount; n++)
+                {
+                    SLatencyTraceEvent sEvent;
+                    sEvent.uiTraceID = bufferWriter.NewTraceID();
+                    sEvent.uiTimestamp = CLatencyTraceBuffer::GetTimestamp();
+                    sEvent.uiStage = static_cast<uint32_t>(sdv::core::ETraceStage::can_receive);
+                    sEvent.uiKey = static_cast<uint32_t>(nThread);
+                    bufferWriter.Record(uiRing, sEvent);
+                }
+                bufferWriter.ReleaseRing(uiRing);
+            });
+    }
+    for (std::thread& rthread : vecThreads)
+        rthread.join();
+
+    std::vector<SLatencyTraceRecord> vecRecords;
+    EXPECT_EQ(bufferMonitor.Read(vecRecords), 0u);
+    ASSERT_EQ(vecRecords.size(), nThreadCount * nEventCount);
+
+    // The trace IDs are unique
+    std::vector<uint64_t> vecTraceIDs;
+    for (const SLatencyTraceRecord& rsRecord : vecRecords)
+        vecTraceIDs.push_back(rsRecord.uiTraceID);
+    std::sort(vecTraceIDs.begin(), vecTraceIDs.end());
+    EXPECT_EQ(std::unique(vecTraceIDs.begin(), vecTraceIDs.end()), vecTraceIDs.end());
+    EXPECT_NE(vecTraceIDs.front(), 0u);
+
+    // Nothing new to read
+    vecRecords.clear();
+    EXPECT_EQ(bufferMonitor.Read(vecRecords), 0u);
+    EXPECT_TRUE(vecRecords.empty());
+}
+
+TEST(LatencyTraceTest, Overrun)
+{
+    CLatencyTraceBuffer bufferMonitor(9998);
+    ASSERT_TRUE(bufferMonitor.Create());
+    CLatencyTraceBuffer bufferWriter(9998);
+    ASSERT_TRUE(bufferWriter.Open());
+    uint32_t uiRing = bufferWriter.ClaimRing();
+    ASSERT_LT(uiRing, CLatencyTraceBuffer::nRingCount);
+
+    const size_t nEventCount = CLatencyTraceBuffer::nRingSize + 100;
+    for (size_t n = 0; n < nEventCount; n++)
+    {
+        SLatencyTraceEvent sEvent;
+        sEvent.uiTraceID = n + 1;
+        bufferWriter.Record(uiRing, sEvent);
+    }
+
+    // The oldest events are lost
+    std::vector<SLatencyTraceRecord> vecRecords;
+    EXPECT_EQ(bufferMonitor.Read(vecRecords), 100u);
+    ASSERT_EQ(vecRecords.size(), static_cast<size_t>(CLatencyTraceBuffer::nRingSize));
+    EXPECT_EQ(vecRecords.front().uiTraceID, 101u);
+    EXPECT_EQ(vecRecords.back().uiTraceID, nEventCount);
+    bufferWriter.ReleaseRing(uiRing);
+}
+
+TEST(LatencyTraceTest, Names)
+{
+    CLatencyTraceBuffer bufferMonitor(9998);
+    ASSERT_TRUE(bufferMonitor.Create());
+    CLatencyTraceBuffer bufferWriter(9998);
+    ASSERT_TRUE(bufferWriter.Open());
+
+    bufferWriter.AddName(10, "Vehicle.Speed");
+    bufferWriter.AddName(10, "Other");
+    bufferWriter.AddName(11, std::string(100, 'x'));
+    EXPECT_EQ(bufferMonitor.FindName(10), "Vehicle.Speed");
+    EXPECT_EQ(bufferMonitor.FindName(11), std::string(CLatencyTraceBuffer::nNameLength - 1, 'x'));
+    EXPECT_TRUE(bufferMonitor.FindName(12).empty());
+}
+
+TEST(LatencyTraceTest, MonitorPercentiles)
+{
+    CLatencyMonitor monitor(9998, true);
+    std::vector<SLatencyTraceRecord> vecRecords;
+    for (uint64_t uiTrace = 1; uiTrace <= 100; uiTrace++)
+    {
+        uint64_t uiStart = uiTrace * 1000000;
+        vecRecords.push_back(MakeRecord(uiTrace, uiStart, sdv::core::ETraceStage::can_receive, 0x100));
+        vecRecords.push_back(MakeRecord(uiTrace, uiStart + uiTrace * 1000, sdv::core::ETraceStage::dispatch_deliver, 5));
+    }
+
+    // A trace of which the start is missing is not measured
+    vecRecords.push_back(MakeRecord(1000, 500000000, sdv::core::ETraceStage::dispatch_deliver, 5));
+    monitor.Process(vecRecords);
+
+    CLatencyMonitor::SStatistics sStatistics = monitor.GetStatistics(
+        static_cast<uint32_t>(sdv::core::ETraceStage::dispatch_deliver), 5);
+    EXPECT_EQ(sStatistics.uiCount, 100u);
+    EXPECT_EQ(sStatistics.uiP50, 50000u);
+    EXPECT_EQ(sStatistics.uiP90, 90000u);
+    EXPECT_EQ(sStatistics.uiP99, 99000u);
+    EXPECT_EQ(sStatistics.uiMax, 100000u);
+    sStatistics = monitor.GetStatistics(static_cast<uint32_t>(sdv::core::ETraceStage::can_receive), 0x100);
+    EXPECT_EQ(sStatistics.uiCount, 100u);
+    EXPECT_EQ(sStatistics.uiMax, 0u);
+
+    std::stringstream sstreamTable;
+    monitor.PrintStatistics(sstreamTable);
+    EXPECT_NE(sstreamTable.str().find("CAN 0x100"), std::string::npos);
+
+    // The export contains an instant event for the start and a complete event for the delivery of each trace
+    std::stringstream sstreamExport;
+    monitor.ExportChromeTrace(sstreamExport);
+    std::string ssExport = sstreamExport.str();
+    EXPECT_EQ(ssExport.rfind("{\"traceEvents\":[", 0), 0u);
+    size_t nComplete = 0;
+    for (size_t nPos = ssExport.find("\"ph\":\"X\""); nPos != std::string::npos; nPos = ssExport.find("\"ph\":\"X\"", nPos + 1))
+        nComplete++;
+    EXPECT_EQ(nComplete, 100u);
+    EXPECT_NE(ssExport.find("\"dur\":100.000"), std::string::npos);
+}
@@ -15,6 +15,9 @@
 #include <gtest/gtest.h>
 #include "../../../global/process_watchdog.h"
 #include <support/mem_access.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #if defined(_WIN32) && defined(_UNICODE)
 extern "C" int wmain(int argc, wchar_t* argv[])
@@ -66,3 +69,66 @@ TEST(MemoryManagerTest, ReallocateSupportFunc)
 	ASSERT_FALSE(ptr);
 }
 
+
+TEST(MemoryManagerTest, SizeClassStatistics)
+{
+	sdv::core::IMemoryStatistics* pStatistics = sdv::core::GetCore<sdv::core::IMemoryStatistics>();
+	ASSERT_NE(pStatistics, nullptr);
+	sdv::core::SMemoryStatistics sBefore = pStatistics->GetMemoryStatistics();
+	ASSERT_EQ(sBefore.seqSizeClasses.size(), 17u);
+	EXPECT_EQ(sBefore.seqSizeClasses[0].uiBlockSize, 16u);
+	EXPECT_EQ(sBefore.seqSizeClasses[15].uiBlockSize, 4096u);
+	EXPECT_EQ(sBefore.seqSizeClasses[16].uiBlockSize, 0u);
+
+	// Small allocations are served from the pool; large allocations are not pooled.
+	std::vector<sdv::pointer<uint8_t>> vecSmall;
+	for (size_t n = 0; n < 100; n++)
+		vecSmall.push_back(sdv::core::AllocMem<uint8_t>(100));
+	sdv::pointer<uint8_t> ptrLarge = sdv::core::AllocMem<uint8_t>(1024 * 1024);
+	sdv::core::SMemoryStatistics sDuring = pStatistics->GetMemoryStatistics();
+	EXPECT_GE(sDuring.seqSizeClasses[5].uiAllocations - sBefore.seqSizeClasses[5].uiAllocations, 100u);
+	EXPECT_GE(sDuring.seqSizeClasses[5].uiInUse, 100u);
+	EXPECT_GE(sDuring.seqSizeClasses[5].uiPoolBlocks, 100u);
+	EXPECT_GE(sDuring.seqSizeClasses[5].uiHighWater, 100u);
+	EXPECT_GE(sDuring.seqSizeClasses[16].uiInUse, 1u);
+	EXPECT_GE(sDuring.uiLargeBytes, 1024u * 1024u);
+	EXPECT_GE(sDuring.uiLargeBytesHighWater, 1024u * 1024u);
+
+	// Freed blocks return to the pool
+	vecSmall.clear();
+	ptrLarge.reset();
+	sdv::core::SMemoryStatistics sAfter = pStatistics->GetMemoryStatistics();
+	EXPECT_GE(sAfter.seqSizeClasses[5].uiFrees - sBefore.seqSizeClasses[5].uiFrees, 100u);
+	EXPECT_EQ(sAfter.seqSizeClasses[5].uiPoolBlocks, sDuring.seqSizeClasses[5].uiPoolBlocks);
+	EXPECT_LT(sAfter.uiLargeBytes, sDuring.uiLargeBytes);
+
+	// Reallocation across the size classes keeps the content
+	sdv::pointer<uint32_t> ptr = sdv::core::AllocMem<uint32_t>(4);
+	for (uint32_t n = 0; n < 4; n++) ptr.get()[n] = n;
+	ptr.resize(100000);
+	for (uint32_t n = 0; n < 4; n++) EXPECT_EQ(ptr.get()[n], n);
+	ptr.resize(8);
+	for (uint32_t n = 0; n < 4; n++) EXPECT_EQ(ptr.get()[n], n);
+}
+
+TEST(MemoryManagerTest, ConcurrentAllocations)
+{
+	std::vector<std::thread> vecThreads;
+	std::atomic_bool bMismatch = false;
+	for (size_t nThread = 0; nThread < 8; nThread++)
+	{
+		vecThreads.emplace_back([&, nThread]()
+			{
+				for (size_t n = 0; n < 10000; n++)
+				{
+					sdv::pointer<uint8_t> ptr = sdv::core::AllocMem<uint8_t>((n * 37 + nThread) % 600 + 1);
+					std::fill(ptr.get(), ptr.get() + ptr.size(), static_cast<uint8_t>(nThread));
+					if (n % 3 == 0) ptr.resize(ptr.size() * 4);
+					if (ptr.get()[0] != static_cast<uint8_t>(nThread)) bMismatch = true;
+				}
+			});
+	}
+	for (std::thread& rthread : vecThreads)
+		rthread.join();
+	EXPECT_FALSE(bMismatch);
+}
@@ -0,0 +1,69 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#define SDV_NO_LOADER
+#include <gtest/gtest.h>
+#include "../../../global/process_watchdog.h"
+#include "../../../sdv_services/core/memory.cpp"
+#include "../../../sdv_services/core/metrics_registry.cpp"
+
+/**
+ * @brief Core replacement exposing the memory manager and the metrics registry.
+ */
+class CTestCore : public sdv::IInterfaceAccess
+{
+public:
+    BEGIN_SDV_INTERFACE_MAP()
+        SDV_INTERFACE_CHAIN_MEMBER(GetMemoryManager())
+        SDV_INTERFACE_CHAIN_MEMBER(GetMetricsRegistry())
+    END_SDV_INTERFACE_MAP()
+};
+
+namespace sdv
+{
+    namespace core
+    {
+        /**
+         * @brief Access to the core.
+         * @return Smart pointer to the core services interface.
+         */
+        TInterfaceAccessPtr GetCore()
+        {
+            static CTestCore core;
+            return &core;
+        }
+
+        /**
+         * @brief Access to specific interface of the core.
+         * @tparam TInterface Type of interface to return.
+         * @return Pointer to the interface or NULL when the interface was not exposed.
+         */
+        template <typename TInterface>
+        TInterface* GetCore()
+        {
+            return GetCore().GetInterface<TInterface>();
+        }
+    }
+}
+
+#if defined(_WIN32) && defined(_UNICODE)
+extern "C" int wmain(int argc, wchar_t* argv[])
+#else
+extern "C" int main(int argc, char* argv[])
+#endif
+{
+    CProcessWatchdog watchdog;
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,219 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include "../../../sdv_services/core/metrics_registry.h"
+#include "../../../global/metrics_exposition.h"
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Find a metric in the snapshot.
+     * @param[in] rsSnapshot Reference to the snapshot.
+     * @param[in] rssName Reference to the name of the metric.
+     * @return Pointer to the metric or NULL when not found.
+     */
+    const sdv::core::SMetric* FindMetric(const sdv::core::SMetricsSnapshot& rsSnapshot, const std::string& rssName)
+    {
+        for (const sdv::core::SMetric& rsMetric : rsSnapshot.seqMetrics)
+            if (rsMetric.ssName == rssName) return &rsMetric;
+        return nullptr;
+    }
+
+    /**
+     * @brief Collector setting a gauge when called.
+     */
+    class CTestCollector : public sdv::IInterfaceAccess, public sdv::core::IMetricsCollector
+    {
+    public:
+        BEGIN_SDV_INTERFACE_MAP()
+            SDV_INTERFACE_ENTRY(sdv::core::IMetricsCollector)
+        END_SDV_INTERFACE_MAP()
+
+        /**
+         * @brief Update the metrics. Overload of sdv::core::IMetricsCollector::CollectMetrics.
+         */
+        virtual void CollectMetrics() override
+        {
+            m_nCalls++;
+            GetMetricsRegistry().SetGauge(m_uiID, static_cast<int64_t>(m_nCalls));
+        }
+
+        uint32_t    m_uiID = 0;     ///< ID of the gauge to set.
+        size_t      m_nCalls = 0;   ///< Amount of calls.
+    };
+}
+
+TEST(MetricsTest, RegisterMetric)
+{
+    CMetricsRegistry& rRegistry = GetMetricsRegistry();
+    uint32_t uiID = rRegistry.RegisterMetric("test_register_total", "Test counter.", sdv::core::EMetricType::counter, {});
+    EXPECT_NE(uiID, 0u);
+
+    // Same name and type returns the same ID; another type is refused.
+    EXPECT_EQ(rRegistry.RegisterMetric("test_register_total", "Test counter.", sdv::core::EMetricType::counter, {}), uiID);
+    EXPECT_EQ(rRegistry.RegisterMetric("test_register_total", "Test gauge.", sdv::core::EMetricType::gauge, {}), 0u);
+
+    // Empty name and unsorted bounds are refused.
+    EXPECT_EQ(rRegistry.RegisterMetric("", "Test counter.", sdv::core::EMetricType::counter, {}), 0u);
+    EXPECT_EQ(rRegistry.RegisterMetric("test_register_us", "Test histogram.", sdv::core::EMetricType::histogram, {10, 5}), 0u);
+
+    // Updates with an invalid ID or wrong type are ignored.
+    rRegistry.AddCounter(0, 1);
+    rRegistry.Observe(uiID, 1);
+    rRegistry.SetGauge(uiID, 1);
+    sdv::core::SMetricsSnapshot sSnapshot = rRegistry.GetMetricsSnapshot();
+    const sdv::core::SMetric* psMetric = FindMetric(sSnapshot, "test_register_total");
+    ASSERT_NE(psMetric, nullptr);
+    EXPECT_EQ(psMetric->iValue, 0);
+}
+
+TEST(MetricsTest, CounterMultipleThreads)
+{
+    CMetricsRegistry& rRegistry = GetMetricsRegistry();
+    uint32_t uiID = rRegistry.RegisterMetric("test_threads_total", "Test counter.", sdv::core::EMetricType::counter, {});
+    ASSERT_NE(uiID, 0u);
+
+    // The counts of ended threads are kept; the cells are reused by the next threads.
+    for (size_t nRound = 0; nRound < 2; nRound++)
+    {
+        std::vector<std::thread> vecThreads;
+        for (size_t nThread = 0; nThread < 4; nThread++)
+            vecThreads.emplace_back([&]()
+                {
+                    for (size_t n = 0; n < 10000; n++)
+                        rRegistry.AddCounter(uiID, 1);
+                });
+        for (std::thread& rthread : vecThreads)
+            rthread.join();
+    }
+    rRegistry.AddCounter(uiID, 5);
+
+    sdv::core::SMetricsSnapshot sSnapshot = rRegistry.GetMetricsSnapshot();
+    const sdv::core::SMetric* psMetric = FindMetric(sSnapshot, "test_threads_total");
+    ASSERT_NE(psMetric, nullptr);
+    EXPECT_EQ(psMetric->eType, sdv::core::EMetricType::counter);
+    EXPECT_EQ(psMetric->iValue, 80005);
+    EXPECT_NE(sSnapshot.uiTimestamp, 0u);
+}
+
+TEST(MetricsTest, Gauge)
+{
+    CMetricsRegistry& rRegistry = GetMetricsRegistry();
+    uint32_t uiID = rRegistry.RegisterMetric("test_gauge", "Test gauge.", sdv::core::EMetricType::gauge, {});
+    ASSERT_NE(uiID, 0u);
+    rRegistry.SetGauge(uiID, 10);
+    rRegistry.AddGauge(uiID, -15);
+    sdv::core::SMetricsSnapshot sSnapshot = rRegistry.GetMetricsSnapshot();
+    const sdv::core::SMetric* psMetric = FindMetric(sSnapshot, "test_gauge");
+    ASSERT_NE(psMetric, nullptr);
+    EXPECT_EQ(psMetric->iValue, -5);
+}
+
+TEST(MetricsTest, Histogram)
+{
+    CMetricsRegistry& rRegistry = GetMetricsRegistry();
+    uint32_t uiID = rRegistry.RegisterMetric("test_histogram_us", "Test histogram.", sdv::core::EMetricType::histogram,
+        {10, 100});
+    ASSERT_NE(uiID, 0u);
+    rRegistry.Observe(uiID, 5);
+    rRegistry.Observe(uiID, 10);
+    rRegistry.Observe(uiID, 50);
+    std::thread([&]() { rRegistry.Observe(uiID, 1000); }).join();
+
+    sdv::core::SMetricsSnapshot sSnapshot = rRegistry.GetMetricsSnapshot();
+    const sdv::core::SMetric* psMetric = FindMetric(sSnapshot, "test_histogram_us");
+    ASSERT_NE(psMetric, nullptr);
+    EXPECT_EQ(psMetric->uiCount, 4u);
+    EXPECT_EQ(psMetric->uiSum, 1065u);
+    ASSERT_EQ(psMetric->seqBuckets.size(), 3u);
+    EXPECT_EQ(psMetric->seqBuckets[0].uiUpperBound, 10u);
+    EXPECT_EQ(psMetric->seqBuckets[0].uiCount, 2u);
+    EXPECT_EQ(psMetric->seqBuckets[1].uiUpperBound, 100u);
+    EXPECT_EQ(psMetric->seqBuckets[1].uiCount, 3u);
+    EXPECT_EQ(psMetric->seqBuckets[2].uiUpperBound, UINT64_MAX);
+    EXPECT_EQ(psMetric->seqBuckets[2].uiCount, 4u);
+}
+
+TEST(MetricsTest, Collector)
+{
+    CMetricsRegistry& rRegistry = GetMetricsRegistry();
+    CTestCollector collector;
+    collector.m_uiID = rRegistry.RegisterMetric("test_collected", "Test gauge.", sdv::core::EMetricType::gauge, {});
+    ASSERT_NE(collector.m_uiID, 0u);
+    uint64_t uiCookie = rRegistry.RegisterCollector(&collector);
+    ASSERT_NE(uiCookie, 0u);
+
+    sdv::core::SMetricsSnapshot sSnapshot = rRegistry.GetMetricsSnapshot();
+    const sdv::core::SMetric* psMetric = FindMetric(sSnapshot, "test_collected");
+    ASSERT_NE(psMetric, nullptr);
+    EXPECT_EQ(psMetric->iValue, 1);
+    EXPECT_EQ(collector.m_nCalls, 1u);
+
+    rRegistry.UnregisterCollector(uiCookie);
+    rRegistry.GetMetricsSnapshot();
+    EXPECT_EQ(collector.m_nCalls, 1u);
+}
+
+TEST(MetricsTest, MemoryMetrics)
+{
+    sdv::core::SMetricsSnapshot sSnapshot = GetMetricsRegistry().GetMetricsSnapshot();
+    EXPECT_NE(FindMetric(sSnapshot, "sdv_memory_pool_bytes"), nullptr);
+    EXPECT_NE(FindMetric(sSnapshot, "sdv_memory_in_use{block_size=\"large\"}"), nullptr);
+
+    // The snapshot is ordered by name.
+    for (size_t n = 1; n < sSnapshot.seqMetrics.size(); n++)
+        EXPECT_LT(sSnapshot.seqMetrics[n - 1].ssName, sSnapshot.seqMetrics[n].ssName);
+}
+
+TEST(MetricsTest, Exposition)
+{
+    sdv::core::SMetricsSnapshot sSnapshot;
+    sdv::core::SMetric sMetric;
+    sMetric.ssName = "sdv_x{ifc=\"a\"}";
+    sMetric.ssHelp = "Help\nwith newline.";
+    sMetric.eType = sdv::core::EMetricType::counter;
+    sMetric.iValue = 3;
+    sSnapshot.seqMetrics.push_back(sMetric);
+    sMetric.ssName = "sdv_x_us";
+    sMetric.ssHelp = "Histogram.";
+    sMetric.eType = sdv::core::EMetricType::histogram;
+    sMetric.uiCount = 2;
+    sMetric.uiSum = 30;
+    sMetric.seqBuckets.push_back({10, 1});
+    sMetric.seqBuckets.push_back({UINT64_MAX, 2});
+    sSnapshot.seqMetrics.push_back(sMetric);
+    sMetric.ssName = "sdv_x{ifc=\"b\"}";
+    sMetric.ssHelp = "Help\nwith newline.";
+    sMetric.eType = sdv::core::EMetricType::counter;
+    sMetric.iValue = 4;
+    sMetric.seqBuckets.clear();
+    sSnapshot.seqMetrics.push_back(sMetric);
+
+    std::stringstream sstream;
+    WriteMetricsExposition(sstream, sSnapshot);
+    EXPECT_EQ(sstream.str(),
+        "# HELP sdv_x Help\\nwith newline.\n"
+        "# TYPE sdv_x counter\n"
+        "sdv_x{ifc=\"a\"} 3\n"
+        "sdv_x{ifc=\"b\"} 4\n"
+        "# HELP sdv_x_us Histogram.\n"
+        "# TYPE sdv_x_us histogram\n"
+        "sdv_x_us_bucket{le=\"10\"} 1\n"
+        "sdv_x_us_bucket{le=\"+Inf\"} 2\n"
+        "sdv_x_us_sum 30\n"
+        "sdv_x_us_count 2\n");
+}
@@ -31,6 +31,23 @@ extern "C" int wmain(int argc, wchar_t* argv[])
 extern "C" int main(int argc, char* argv[])
 #endif
 {
+#ifdef __unix__
+    // Zygote mode: wait for process requests; each created process continues with the received arguments.
+    std::vector<std::string> vecZygoteArgs;
+    std::vector<char*> vecZygoteArgv;
+    if (argc == 2 && zygote::GetZygoteFD(argv[1]) >= 0)
+    {
+        zygote::CZygoteServer zygote(zygote::GetZygoteFD(argv[1]));
+        if (!zygote.Run(vecZygoteArgs)) return 0;
+        vecZygoteArgv.push_back(argv[0]);
+        for (std::string& rssArg : vecZygoteArgs)
+            vecZygoteArgv.push_back(&rssArg.front());
+        vecZygoteArgv.push_back(nullptr);
+        argc = static_cast<int>(vecZygoteArgv.size() - 1);
+        argv = vecZygoteArgv.data();
+    }
+#endif
+
     std::cout << GetTimestamp() << "Startup process control application..." << std::endl;
 
     // The first argument is the name of the application
@@ -139,6 +156,9 @@ Mode="Maintenance")code"))
             control.Shutdown(); // Needed to prevent clash with core
         }
         break;
+    case EOperatingmode::immediate_shutdown:
+        std::cout << GetTimestamp() << "Immediate shutdown" << std::endl;
+        break;
     default: // Unknown mode
         std::cout << GetTimestamp() << "Invalid arguments..." << std::endl;
         nResult = -2;
@@ -24,6 +24,7 @@ enum class EOperatingmode : uint32_t
     emergency_exit_1000ms,          ///< Emergency exit after 1000ms; exit code = -20
     wait_for_process,               ///< Wait for process end; then shutdown; exit code = 0 on proper shutdown, -10 on emergency exit, -20 on timeout
     terminate_process,              ///< Terminate the first process; then shutdown; exit code = 0
+    immediate_shutdown,             ///< Proper shutdown directly after startup; exit code = 0
 };
 
 /**
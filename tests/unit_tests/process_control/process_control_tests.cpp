@@ -15,6 +15,9 @@
 #include <support/sdv_core.h>
 #include <support/app_control.h>
 #include <interfaces/process.h>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
 
 #include "../../../sdv_services/process_control/process_control.cpp"
 #include "process_control_ifc.h"
@@ -660,3 +663,150 @@ Mode="Maintenance")code"));
     control.Shutdown();                 // Needed to prevent clash with core
     appcontrol.Shutdown();
 }
+
+#ifdef __unix__
+/**
+ * @brief Read the parent process ID and the command line of a running process.
+ * @param[in] tProcessID The process ID.
+ * @param[out] rssCmdLine Reference to the string receiving the command line (arguments separated by spaces).
+ * @return The parent process ID or 0 when the process is not running.
+ */
+inline sdv::process::TProcessID GetProcessInfo(sdv::process::TProcessID tProcessID, std::string& rssCmdLine)
+{
+    std::ifstream fstreamStat("/proc/" + std::to_string(tProcessID) + "/stat");
+    std::string ssStat((std::istreambuf_iterator<char>(fstreamStat)), std::istreambuf_iterator<char>());
+    size_t nPos = ssStat.rfind(')');
+    if (nPos == std::string::npos) return 0;
+    std::istringstream sstreamStat(ssStat.substr(nPos + 1));
+    std::string ssState;
+    sdv::process::TProcessID tParentID = 0;
+    sstreamStat >> ssState >> tParentID;
+
+    std::ifstream fstreamCmdLine("/proc/" + std::to_string(tProcessID) + "/cmdline");
+    rssCmdLine.assign((std::istreambuf_iterator<char>(fstreamCmdLine)), std::istreambuf_iterator<char>());
+    std::replace(rssCmdLine.begin(), rssCmdLine.end(), '\0', ' ');
+    return tParentID;
+}
+
+TEST(ProcessControlTest, ZygoteExecuteProcessNormalShutdownWithMonitor)
+{
+    sdv::app::CAppControl appcontrol;
+    ASSERT_TRUE(appcontrol.Startup(R"code([Application]
+Mode="Maintenance")code"));
+
+    CProcessMonitorHelper monitor;
+
+    CProcessControl control;
+    control.Initialize(R"code(ZygoteModule = "UnitTest_ProcessControlApp")code");  // Needed since local instantiation
+    const std::string ssModule = "UnitTest_ProcessControlApp";
+    sdv::sequence<sdv::u8string> seqArgs;
+    seqArgs.push_back(std::to_string(static_cast<uint32_t>(EOperatingmode::normal_shutdown_1000ms)));
+    sdv::process::TProcessID tProcessID = control.Execute(ssModule, seqArgs, sdv::process::EProcessRights::parent_rights);
+    EXPECT_NE(tProcessID, 0u);
+
+    // The process is a copy of the zygote (sharing its command line), but a child of this process.
+    std::string ssCmdLine;
+    EXPECT_EQ(GetProcessInfo(tProcessID, ssCmdLine), static_cast<sdv::process::TProcessID>(getpid()));
+    EXPECT_NE(ssCmdLine.find(zygote::szZygoteArg), std::string::npos);
+
+    uint32_t uiCookie = control.RegisterMonitor(tProcessID, &monitor);
+    EXPECT_NE(uiCookie, 0u);
+
+    EXPECT_TRUE(monitor.Wait5000ms());
+    EXPECT_EQ(monitor.GetProcessID(), tProcessID);
+    EXPECT_EQ(monitor.GetRetValue(), 0);
+    control.UnregisterMonitor(uiCookie);
+
+    control.Shutdown();                 // Needed to prevent clash with core
+    appcontrol.Shutdown();
+}
+
+TEST(ProcessControlTest, ZygoteExecuteProcessEmergencyExitWithMonitor)
+{
+    sdv::app::CAppControl appcontrol;
+    ASSERT_TRUE(appcontrol.Startup(R"code([Application]
+Mode="Maintenance")code"));
+
+    CProcessMonitorHelper monitor;
+
+    CProcessControl control;
+    control.Initialize(R"code(ZygoteModule = "UnitTest_ProcessControlApp")code");  // Needed since local instantiation
+    const std::string ssModule = "UnitTest_ProcessControlApp";
+    sdv::sequence<sdv::u8string> seqArgs;
+    seqArgs.push_back(std::to_string(static_cast<uint32_t>(EOperatingmode::emergency_exit_1000ms)));
+    sdv::process::TProcessID tProcessID = control.Execute(ssModule, seqArgs, sdv::process::EProcessRights::reduced_rights);
+    EXPECT_NE(tProcessID, 0u);
+
+    uint32_t uiCookie = control.RegisterMonitor(tProcessID, &monitor);
+    EXPECT_NE(uiCookie, 0u);
+
+    // The process is a child of this process; the exit code is available.
+    EXPECT_TRUE(monitor.Wait5000ms());
+    EXPECT_EQ(monitor.GetProcessID(), tProcessID);
+    EXPECT_EQ(monitor.GetRetValue(), -20);
+    control.UnregisterMonitor(uiCookie);
+
+    control.Shutdown();                 // Needed to prevent clash with core
+    appcontrol.Shutdown();
+}
+
+TEST(ProcessControlTest, ZygoteSpawnChild)
+{
+    zygote::CZygoteClient client;
+    std::filesystem::path pathModule = std::filesystem::read_symlink("/proc/self/exe").parent_path() /
+        "UnitTest_ProcessControlApp";
+    ASSERT_TRUE(client.Start(pathModule));
+    pid_t pidZygote = client.GetZygoteProcessID();
+    ASSERT_NE(pidZygote, 0);
+
+    // The process is a copy of the zygote, but a child of this process.
+    pid_t pid = client.Spawn({ std::to_string(static_cast<uint32_t>(EOperatingmode::emergency_exit_1000ms)) }, false);
+    ASSERT_GT(pid, 0);
+    EXPECT_NE(pid, pidZygote);
+    std::string ssCmdLine;
+    EXPECT_EQ(GetProcessInfo(static_cast<sdv::process::TProcessID>(pid), ssCmdLine),
+        static_cast<sdv::process::TProcessID>(getpid()));
+    EXPECT_NE(ssCmdLine.find(zygote::szZygoteArg), std::string::npos);
+
+#ifdef SYS_pidfd_open
+    // The process can be monitored through a process file descriptor, which becomes readable when the process ends.
+    int iPidFD = static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+    ASSERT_GE(iPidFD, 0);
+    pollfd sPollFD{ iPidFD, POLLIN, 0 };
+    EXPECT_EQ(poll(&sPollFD, 1, 5000), 1);
+    close(iPidFD);
+#endif
+
+    // The exit status is reported to this process.
+    int iStatus = 0;
+    ASSERT_EQ(waitpid(pid, &iStatus, 0), pid);
+    ASSERT_TRUE(WIFEXITED(iStatus));
+    EXPECT_EQ(static_cast<int8_t>(WEXITSTATUS(iStatus)), -20);
+
+    client.Close();
+}
+
+TEST(ProcessControlTest, ZygoteEnded)
+{
+    zygote::CZygoteClient client;
+    std::filesystem::path pathModule = std::filesystem::read_symlink("/proc/self/exe").parent_path() /
+        "UnitTest_ProcessControlApp";
+    ASSERT_TRUE(client.Start(pathModule));
+    pid_t pidZygote = client.GetZygoteProcessID();
+    ASSERT_NE(pidZygote, 0);
+
+    // End the zygote and wait until it has terminated (without collecting the exit status).
+    ASSERT_EQ(kill(pidZygote, SIGKILL), 0);
+    siginfo_t sInfo{};
+    ASSERT_EQ(waitid(P_PID, static_cast<id_t>(pidZygote), &sInfo, WEXITED | WNOWAIT), 0);
+
+    // The request fails with EPIPE instead of raising SIGPIPE, which would terminate this process. The connection is closed.
+    EXPECT_EQ(client.Spawn({ std::to_string(static_cast<uint32_t>(EOperatingmode::immediate_shutdown)) }, false), 0);
+    EXPECT_FALSE(client.IsRunning());
+
+    // The zygote can be restarted.
+    EXPECT_TRUE(client.Start(pathModule));
+    EXPECT_NE(client.GetZygoteProcessID(), pidZygote);
+    client.Close();
+}
+#endif
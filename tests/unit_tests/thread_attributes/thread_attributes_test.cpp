@@ -0,0 +1,70 @@
+/********************************************************************************
+ * Copyright (c) 2025-2026 ZF Friedrichshafen AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Contributors:
+ *   Erik Verhoeven - initial API and implementation
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include "../../../global/localmemmgr.h"
+#include "../../../global/thread_attributes.h"
+#include <thread>
+
+TEST(ThreadAttributesTest, ParseCpuList)
+{
+    std::vector<uint32_t> vecCpus;
+    EXPECT_TRUE(ParseCpuList("", vecCpus));
+    EXPECT_TRUE(vecCpus.empty());
+    EXPECT_TRUE(ParseCpuList("2", vecCpus));
+    EXPECT_EQ(vecCpus, std::vector<uint32_t>({2}));
+    EXPECT_TRUE(ParseCpuList("0-3, 6", vecCpus));
+    EXPECT_EQ(vecCpus, std::vector<uint32_t>({0, 1, 2, 3, 6}));
+
+    EXPECT_FALSE(ParseCpuList("a", vecCpus));
+    EXPECT_FALSE(ParseCpuList("1,,2", vecCpus));
+    EXPECT_FALSE(ParseCpuList("3-1", vecCpus));
+    EXPECT_FALSE(ParseCpuList("-1", vecCpus));
+    EXPECT_FALSE(ParseCpuList("1-", vecCpus));
+    EXPECT_FALSE(ParseCpuList("1-2-3", vecCpus));
+}
+
+TEST(ThreadAttributesTest, Parameters)
+{
+    CThreadAttributes attributes;
+    attributes.InitParamMap();
+    EXPECT_FALSE(attributes.IsConfigured());
+    EXPECT_TRUE(attributes.Apply("Test"));
+
+    EXPECT_TRUE(attributes.SetParam("RealTime.CpuAffinity", "0"));
+    EXPECT_TRUE(attributes.IsConfigured());
+    EXPECT_FALSE(attributes.SetParam("RealTime.Priority", 100));
+    EXPECT_TRUE(attributes.SetParam("RealTime.Priority", 0));
+}
+
+TEST(ThreadAttributesTest, ApplyCpuAffinity)
+{
+    CThreadAttributes attributes;
+    attributes.InitParamMap();
+    EXPECT_TRUE(attributes.SetParam("RealTime.CpuAffinity", "0"));
+
+    bool bResult = false;
+    std::thread thread([&]()
+        {
+            bResult = attributes.Apply("Test");
+#ifdef __unix__
+            cpu_set_t sCpuSet;
+            CPU_ZERO(&sCpuSet);
+            ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(sCpuSet), &sCpuSet), 0);
+            EXPECT_EQ(CPU_COUNT(&sCpuSet), 1);
+            EXPECT_TRUE(CPU_ISSET(0, &sCpuSet));
+#endif
+        });
+    thread.join();
+    EXPECT_TRUE(bResult);
+}
@@ -1577,6 +1577,70 @@ TEST(TOMLLexerTest, ExceptionHandling)
     EXPECT_FALSE(lexer.Consume(0));
 }
 
+TEST(TOMLLexerTest, RawStringRoundTrip)
+{
+    // Long strings and comments cross the 16 byte blocks used for scanning; the quotes and escapes are located at the block
+    // boundaries as well as in between.
+    using namespace std::string_literals;
+    std::string ssSource = "# Comment with UTF-8 \xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80 characters\r\n"s +
+        "[table.\"quoted \\\" key\".'literal key']\n"
+        "basic = \"0123456789abcde\\\"0123456789abcdef\\\\0123456789abcdef\\u00E4 \xE2\x82\xAC end\" # trailing\n"
+        "literal = '0123456789abcdef0123456789abcdef\\n \xC3\xA4'\n"
+        "multi = \"\"\"\n0123456789abcdef\"\"0123456789abcdef\\\n    continued \"\"\"\"\n"
+        "multi_literal = '''\r\n0123456789abcdef''0123456789abcdef'''\n"
+        "array = [ 1, +2, -3_000, 0x1F, 0o17, 0b101, 1.5, -2e3, inf, nan, true, false ]\n"
+        "inline = { a = 1, b.c = \"x\" }\n"
+        "[[table_array]]\r\n"
+        "\tvalue\t=\t\"tab\"";
+
+    toml_parser::CLexer lexer(ssSource);
+    lexer.NavigationMode(toml_parser::CLexer::ENavigationMode::do_not_skip_anything);
+    std::string ssRegenerated;
+    std::vector<std::pair<toml_parser::ETokenCategory, std::string>> vecStrings;
+    while (!lexer.IsEnd())
+    {
+        const toml_parser::CToken& rToken = lexer.Consume();
+        if (!rToken) break;
+        ssRegenerated += rToken.RawString();
+        EXPECT_NE(rToken.Category(), toml_parser::ETokenCategory::token_error) << rToken.RawString();
+        if (rToken.Category() == toml_parser::ETokenCategory::token_string || rToken.Category() == toml_parser::ETokenCategory::token_key)
+            vecStrings.emplace_back(rToken.Category(), rToken.StringValue());
+    }
+    EXPECT_EQ(ssRegenerated, ssSource);
+
+    std::vector<std::pair<toml_parser::ETokenCategory, std::string>> vecExpected = {
+        {toml_parser::ETokenCategory::token_key, "table"},
+        {toml_parser::ETokenCategory::token_key, "quoted \" key"},
+        {toml_parser::ETokenCategory::token_key, "literal key"},
+        {toml_parser::ETokenCategory::token_key, "basic"},
+        {toml_parser::ETokenCategory::token_string,
+            "0123456789abcde\"0123456789abcdef\\0123456789abcdef\xC3\xA4 \xE2\x82\xAC end"},
+        {toml_parser::ETokenCategory::token_key, "literal"},
+        {toml_parser::ETokenCategory::token_string, "0123456789abcdef0123456789abcdef\\n \xC3\xA4"},
+        {toml_parser::ETokenCategory::token_key, "multi"},
+        {toml_parser::ETokenCategory::token_string, "0123456789abcdef\"\"0123456789abcdefcontinued \""},
+        {toml_parser::ETokenCategory::token_key, "multi_literal"},
+        {toml_parser::ETokenCategory::token_string, "0123456789abcdef''0123456789abcdef"},
+        {toml_parser::ETokenCategory::token_key, "array"},
+        {toml_parser::ETokenCategory::token_key, "inline"},
+        {toml_parser::ETokenCategory::token_key, "a"},
+        {toml_parser::ETokenCategory::token_key, "b"},
+        {toml_parser::ETokenCategory::token_key, "c"},
+        {toml_parser::ETokenCategory::token_string, "x"},
+        {toml_parser::ETokenCategory::token_key, "table_array"},
+        {toml_parser::ETokenCategory::token_key, "value"},
+        {toml_parser::ETokenCategory::token_string, "tab"}};
+    EXPECT_EQ(vecStrings, vecExpected);
+}
+
+TEST(TOMLLexerTest, Invalid_UnterminatedLiteralKey)
+{
+    using namespace std::string_literals;
+    toml_parser::CLexer lexer(R"('unterminated key)"s);
+    EXPECT_EQ(lexer.Consume().Category(), toml_parser::ETokenCategory::token_error);
+    EXPECT_FALSE(lexer.Consume());
+}
+
 TEST(TOMLLexerTest, DISABLED_RegenerateTOML)
 {
     using namespace std::string_literals;
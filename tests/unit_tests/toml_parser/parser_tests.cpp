@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 #include "../../../sdv_services/core/toml_parser/parser_toml.h"
 #include "../../../sdv_services/core/toml_parser/parser_node_toml.h"
+#include <support/toml.h>
 
 /* Requirements TOML toml_parser::CParser
  * - The output after parsing is a tree structure only if parsing is successful
@@ -968,3 +969,130 @@ TEST(NodeAccess, Parent)
     EXPECT_EQ(table_test_3_d->GetParent(), table_test_3.get());
     EXPECT_EQ(fnGetName(table_test_3_d->GetParent()), "table.test[2]");
 }
+
+TEST(NodeAccess, Flattened)
+{
+    using namespace std::string_literals;
+    toml_parser::CParser parser(R"(
+        name = "root"
+        list = [1, 2, [3]]
+        [table]
+        a = 1
+        sub.b = true
+        [table.nested]
+        c = 1.5
+        [[tables]]
+        x = 10
+        [[tables]]
+        x = 20
+        )"s);
+
+    auto fnCompare = [](const sdv::sequence<sdv::toml::SKeyValue>& rseqKeyValues,
+        const std::vector<std::pair<std::string, sdv::any_t>>& rvecExpected)
+    {
+        ASSERT_EQ(rseqKeyValues.size(), rvecExpected.size());
+        for (size_t n = 0; n < rvecExpected.size(); n++)
+        {
+            EXPECT_EQ(rseqKeyValues[n].ssKey, rvecExpected[n].first);
+            EXPECT_EQ(rseqKeyValues[n].anyValue, rvecExpected[n].second);
+        }
+    };
+
+    // Without arrays
+    fnCompare(parser.Root().GetFlattened(false), {{"name", "root"}, {"table.a", 1}, {"table.sub.b", true},
+        {"table.nested.c", 1.5}});
+
+    // Including arrays and table arrays
+    fnCompare(parser.Root().GetFlattened(true), {{"name", "root"}, {"list[0]", 1}, {"list[1]", 2}, {"list[2][0]", 3},
+        {"table.a", 1}, {"table.sub.b", true}, {"table.nested.c", 1.5}, {"tables[0].x", 10}, {"tables[1].x", 20}});
+
+    // Sub-table; keys are relative to the collection.
+    auto ptrTable = parser.Root().Direct("table");
+    ASSERT_TRUE(ptrTable);
+    sdv::toml::INodeCollectionFlatten* pFlatten =
+        static_cast<sdv::IInterfaceAccess*>(ptrTable.get())->GetInterface<sdv::toml::INodeCollectionFlatten>();
+    ASSERT_NE(pFlatten, nullptr);
+    fnCompare(pFlatten->GetFlattened(false), {{"a", 1}, {"sub.b", true}, {"nested.c", 1.5}});
+}
+
+TEST(NodeAccess, FlattenedWithoutInterface)
+{
+    using namespace std::string_literals;
+    toml_parser::CParser parser(R"(
+        name = "root"
+        list = [1, 2, [3]]
+        [table]
+        a = 1
+        sub.b = true
+        [table.nested]
+        c = 1.5
+        [[tables]]
+        x = 10
+        [[tables]]
+        x = 20
+        )"s);
+
+    // Node access hiding the INodeCollectionFlatten interface of the root node
+    class CNodeWithoutFlatten : public sdv::IInterfaceAccess
+    {
+    public:
+        CNodeWithoutFlatten(sdv::IInterfaceAccess* pNode) : m_pNode(pNode) {}
+        virtual sdv::interface_t GetInterface(sdv::interface_id idInterface) override
+        {
+            if (idInterface == sdv::GetInterfaceId<sdv::toml::INodeCollectionFlatten>()) return nullptr;
+            return m_pNode->GetInterface(idInterface);
+        }
+    private:
+        sdv::IInterfaceAccess* m_pNode = nullptr;
+    } node(static_cast<sdv::IInterfaceAccess*>(&parser.Root()));
+    sdv::toml::CNodeCollection collection{sdv::TInterfaceAccessPtr(&node)};
+    ASSERT_TRUE(collection.IsValid());
+
+    // The fallback returns the same values as the interface.
+    for (bool bIncludeArrays : {false, true})
+    {
+        sdv::sequence<sdv::toml::SKeyValue> seqFallback = collection.GetFlattened(bIncludeArrays);
+        sdv::sequence<sdv::toml::SKeyValue> seqInterface = parser.Root().GetFlattened(bIncludeArrays);
+        ASSERT_EQ(seqFallback.size(), seqInterface.size());
+        for (size_t n = 0; n < seqInterface.size(); n++)
+        {
+            EXPECT_EQ(seqFallback[n].ssKey, seqInterface[n].ssKey);
+            EXPECT_EQ(seqFallback[n].anyValue, seqInterface[n].anyValue);
+        }
+    }
+}
+
+TEST(NodeAccess, ProcessReadOnly)
+{
+    using namespace std::string_literals;
+    const std::string ssTOML = R"(# Comment before
+        name = "root"   # Comment behind
+        [table]
+        # Comment for a
+        a = 1
+        )"s;
+    toml_parser::CParser parser;
+    sdv::toml::ITOMLParserReadOnly* pReadOnly = static_cast<sdv::IInterfaceAccess*>(&parser)->GetInterface<sdv::toml::ITOMLParserReadOnly>();
+    ASSERT_NE(pReadOnly, nullptr);
+    EXPECT_TRUE(pReadOnly->ProcessReadOnly(ssTOML));
+
+    // The content is identical to the content processed with preservation of the comments.
+    toml_parser::CParser parserFull(ssTOML);
+    sdv::sequence<sdv::toml::SKeyValue> seqReadOnly = parser.Root().GetFlattened(true);
+    sdv::sequence<sdv::toml::SKeyValue> seqFull = parserFull.Root().GetFlattened(true);
+    ASSERT_EQ(seqReadOnly.size(), 2u);
+    ASSERT_EQ(seqReadOnly.size(), seqFull.size());
+    for (size_t n = 0; n < seqFull.size(); n++)
+    {
+        EXPECT_EQ(seqReadOnly[n].ssKey, seqFull[n].ssKey);
+        EXPECT_EQ(seqReadOnly[n].anyValue, seqFull[n].anyValue);
+    }
+
+    // The comments are not preserved.
+    std::string ssGenerated = parser.GenerateTOML();
+    EXPECT_EQ(ssGenerated.find('#'), std::string::npos);
+    EXPECT_NE(parserFull.GenerateTOML().find("# Comment for a"), std::string::npos);
+
+    // Errors are still detected.
+    EXPECT_THROW(pReadOnly->ProcessReadOnly("a = 1\na = 2"), sdv::toml::XTOMLParseException);
+}